@@ -0,0 +1,107 @@
+#ifndef CIDR_TREE_H
+#define CIDR_TREE_H
+
+#include <Arduino.h>
+#include <vector>
+#include "storage.h"
+
+/**
+ * @brief IPv6 address as two 64-bit halves; IPv4 is mapped to ::ffff:a.b.c.d
+ */
+struct CidrAddress {
+    uint64_t hi;
+    uint64_t lo;
+};
+
+/**
+ * @brief What an address range is
+ */
+enum CidrTag {
+    CIDR_NONE = 0,
+    CIDR_PRIVATE,       // RFC 1918, link-local, unique local
+    CIDR_LOOPBACK,
+    CIDR_ALLOW,         // Known good (customer ranges, whitelisted hosts)
+    CIDR_DENY,          // Known bad, always reported
+    CIDR_INTEL          // Threat-intel range (hosting provider, ASN block, ...)
+};
+
+/**
+ * @brief The most specific range containing an address
+ */
+struct CidrMatch {
+    CidrTag tag;
+    uint8_t prefix_len;         // In the 128-bit space; IPv4 prefixes are offset by 96
+    uint8_t severity;
+    const String* label;
+};
+
+/**
+ * @brief Longest-prefix lookups over tagged IPv4/IPv6 CIDR ranges
+ *
+ * A path-compressed binary radix (Patricia) tree over 128-bit keys. Every
+ * node stores its full prefix, so a lookup walks at most one node per
+ * distinct prefix length on the path, comparing whole masked words, and
+ * remembers the last tagged node it passed.
+ *
+ * Range files have one range per line, in the same column order as the
+ * watchlist CSV feeds: tag,cidr[,severity[,label]] with tag one of allow,
+ * deny, intel, private or loopback. Blank lines and lines starting with '#'
+ * are skipped.
+ */
+class CidrTree {
+public:
+    CidrTree();
+
+    void clear();
+    void addDefaultRanges();    // Private and loopback ranges for IPv4 and IPv6
+
+    bool add(const CidrAddress& address, uint8_t prefix_len, CidrTag tag,
+             uint8_t severity = 0, const String& label = "");
+    bool add(const String& cidr, CidrTag tag, uint8_t severity = 0, const String& label = "");
+    bool loadFile(FRFDStorage* storage, const String& path);
+
+    CidrTag lookup(const CidrAddress& address, CidrMatch* match = nullptr) const;
+    CidrTag lookup(const char* ip, size_t length, CidrMatch* match = nullptr) const;
+    CidrTag lookup(const String& ip, CidrMatch* match = nullptr) const {
+        return lookup(ip.c_str(), ip.length(), match);
+    }
+
+    size_t getRangeCount() const { return range_count; }
+    size_t getNodeCount() const { return nodes.size(); }
+    size_t getMemoryUsage() const;
+
+    // Parsing
+    static bool parseAddress(const char* text, size_t length, CidrAddress& address, bool* is_ipv4 = nullptr);
+    static bool parseCidr(const String& cidr, CidrAddress& address, uint8_t& prefix_len);
+    static CidrTag parseTag(const String& name);
+    static const char* getTagName(CidrTag tag);
+
+private:
+    struct Node {
+        uint64_t hi;
+        uint64_t lo;
+        int32_t child[2];
+        uint16_t label;
+        uint8_t prefix_len;
+        uint8_t tag;
+        uint8_t severity;
+    };
+
+    static const uint16_t NO_LABEL = 0xFFFF;
+
+    std::vector<Node> nodes;    // nodes[0] is the root, ::/0
+    std::vector<String> labels;
+    size_t range_count;
+
+    int32_t newNode(const CidrAddress& address, uint8_t prefix_len, CidrTag tag);
+    void setRange(int32_t node, CidrTag tag, uint8_t severity, const String& label);
+
+    static CidrAddress maskAddress(const CidrAddress& address, uint8_t prefix_len);
+    static bool matchesPrefix(const CidrAddress& address, const Node& node);
+    static uint8_t commonPrefix(const CidrAddress& a, const CidrAddress& b, uint8_t limit);
+    static int bitAt(const CidrAddress& address, uint8_t position) {
+        return position < 64 ? (address.hi >> (63 - position)) & 1 : (address.lo >> (127 - position)) & 1;
+    }
+};
+
+#endif // CIDR_TREE_H
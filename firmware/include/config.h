@@ -29,6 +29,8 @@
 #define SD_MOSI 11
 #define SD_MISO 13
 #define SD_SCK 12
+#define SD_SPI_FREQUENCY 4000000
+#define SD_MAX_OPEN_FILES 16    // Timeline external sort holds up to TIMELINE_SORT_MAX_FANIN runs open
 
 // USB Configuration
 #define USB_VENDOR_ID 0x303A
@@ -42,7 +42,7 @@ struct Correlation {
     String entity2;             // Second entity
     String relationship;        // Description of relationship
     uint8_t confidence;         // Confidence score 0-100
-    unsigned long timestamp;    // When correlation was found
+    int64_t timestamp;          // Time of the anchoring event, UTC microseconds
     std::vector<String> evidence; // Supporting evidence
 };
 
@@ -124,7 +124,7 @@ private:
     std::vector<PatternDetection> detected_patterns;
 
     // Analysis helpers
-    bool isTimeProximate(unsigned long time1, unsigned long time2, unsigned long threshold_ms);
+    bool isTimeProximate(int64_t time1, int64_t time2, unsigned long threshold_ms);
     bool isNetworkRelated(const String& entity1, const String& entity2);
     bool isProcessRelated(const String& proc1, const String& proc2);
 
@@ -154,6 +154,7 @@ private:
 
     // String helpers
     bool containsKeyword(const String& text, const String& keyword);
+    bool containsKeyword(const char* text, const char* keyword);
     std::vector<String> extractIPsFromString(const String& text);
     std::vector<String> extractProcessNamesFromString(const String& text);
 };
@@ -0,0 +1,98 @@
+#ifndef CSV_READER_H
+#define CSV_READER_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include <vector>
+#include <string.h>
+
+#define CSV_READER_BLOCK_SIZE   (16 * 1024)     // Read buffer; each refill tops it up after the carried partial record
+#define CSV_READER_MAX_RECORD   (256 * 1024)    // Longest record; the buffer grows up to this for long ones
+
+/**
+ * @brief One field of the current row, pointing into the reader's buffer
+ *
+ * The text is unescaped and NUL-terminated. It is only valid until the next
+ * call to nextRow() or nextLine().
+ */
+struct CSVField {
+    const char* data;
+    uint32_t length;
+
+    bool isEmpty() const { return length == 0; }
+    bool equals(const char* text) const { return strlen(text) == length && memcmp(data, text, length) == 0; }
+    bool equals(const CSVField& other) const { return other.length == length && memcmp(data, other.data, length) == 0; }
+    bool contains(const char* text) const { return strstr(data, text) != nullptr; }
+    String toString() const { return String(data); }
+    void copyTo(String& out) const {    // Reuses out's buffer
+        out = "";
+        out.concat(data, length);
+    }
+};
+
+/**
+ * @brief Streaming CSV reader over a reusable block buffer
+ *
+ * Reads a file (or a block of memory) a block at a time and splits records
+ * in place: quoted fields are unescaped by moving their bytes down within
+ * the buffer, and each field is terminated where its delimiter was, so a
+ * row costs no allocation. Only the partial record at the end of a block is
+ * carried over to the next; the buffer grows, up to CSV_READER_MAX_RECORD,
+ * only for a record longer than a block.
+ *
+ * Records follow RFC 4180: a field starting with '"' is quoted and may hold
+ * commas, line breaks and "" for a quote; a quote elsewhere is literal, as is
+ * text after a closing quote. Lines may end in LF or CRLF. Empty lines are
+ * skipped.
+ */
+class CSVReader {
+public:
+    CSVReader();
+    ~CSVReader();
+    CSVReader(const CSVReader&) = delete;
+    CSVReader& operator=(const CSVReader&) = delete;
+
+    bool open(File file);                           // From the current position; closed by close()
+    void open(const char* data, size_t length);     // Borrowed: must outlive the reader
+    void close();
+
+    bool nextRow();         // Next record, split into fields; false at the end or on error
+    bool nextLine();        // Next line, whole and unquoted, as the only field
+
+    size_t getFieldCount() const { return field_count; }
+    const CSVField& getField(size_t index) const { return index < field_count ? fields[index] : empty_field; }
+    bool rowContains(const char* text) const;       // Any field contains text
+    uint32_t getRowNumber() const { return row_number; }   // Rows returned so far, the current one included
+    bool hasError() const { return failed; }
+
+private:
+    // Record scanner states, kept across refills
+    enum ScanState : uint8_t {
+        SCAN_FIELD_START,
+        SCAN_UNQUOTED,
+        SCAN_QUOTED,
+        SCAN_QUOTE_IN_QUOTED    // A quote inside a quoted field: closes it unless another follows
+    };
+
+    File file;
+    const char* memory;
+    size_t memory_left;
+
+    char* buffer;
+    size_t capacity;        // Bytes of buffer, not counting the byte kept for a final terminator
+    size_t pos;             // Start of unread data
+    size_t filled;
+    bool eof;
+    bool failed;
+
+    std::vector<CSVField> fields;
+    std::vector<uint32_t> field_bounds;     // Start and end offsets from the record start, in pairs
+    size_t field_count;
+    uint32_t row_number;
+    static const CSVField empty_field;
+
+    bool fill();
+    void reset();
+};
+
+#endif // CSV_READER_H
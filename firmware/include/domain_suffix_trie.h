@@ -0,0 +1,105 @@
+#ifndef DOMAIN_SUFFIX_TRIE_H
+#define DOMAIN_SUFFIX_TRIE_H
+
+#include <Arduino.h>
+#include <vector>
+#include <map>
+#include "storage.h"
+
+/**
+ * @brief What a domain suffix is
+ */
+enum DomainTag {
+    DOMAIN_NONE = 0,
+    DOMAIN_ALLOW,       // Known good, everything below it is whitelisted
+    DOMAIN_DENY,        // Known bad, always reported
+    DOMAIN_INTEL        // Threat-intel suffix (dynamic DNS, bulletproof hosting, ...)
+};
+
+/**
+ * @brief The most specific listed suffix of a domain
+ */
+struct DomainMatch {
+    DomainTag tag;
+    uint8_t severity;
+    size_t suffix_length;       // Characters of the domain covered by the suffix
+    const String* label;
+};
+
+/**
+ * @brief "Is this domain under any listed suffix" in one pass over its labels
+ *
+ * A trie keyed on labels from right to left (com -> microsoft -> login).
+ * Edges live in a single open-addressing hash table keyed by (parent node,
+ * label), so a lookup costs one probe per label whatever the fan-out, and a
+ * node is 12 bytes plus its label text.
+ *
+ * Suffix files have one entry per line, in the same column order as the
+ * range and watchlist CSV feeds: tag,suffix[,severity[,label]] with tag one
+ * of allow, deny or intel. Public suffix list rules (public_suffix_list.dat,
+ * including wildcard and exception rules) load into the same trie and answer
+ * registrable-domain queries.
+ */
+class DomainSuffixTrie {
+public:
+    DomainSuffixTrie();
+
+    void clear();
+    void compact();
+
+    bool add(const char* suffix, size_t length, DomainTag tag, uint8_t severity = 0, const String& label = "");
+    bool add(const String& suffix, DomainTag tag, uint8_t severity = 0, const String& label = "") {
+        return add(suffix.c_str(), suffix.length(), tag, severity, label);
+    }
+    bool loadFile(FRFDStorage* storage, const String& path);
+    bool loadPublicSuffixList(FRFDStorage* storage, const String& path);
+
+    DomainTag lookup(const char* domain, size_t length, DomainMatch* match = nullptr) const;
+    DomainTag lookup(const String& domain, DomainMatch* match = nullptr) const {
+        return lookup(domain.c_str(), domain.length(), match);
+    }
+
+    // Public suffixes; without a loaded list (or a matching rule) the last label is the suffix
+    size_t getPublicSuffixStart(const char* domain, size_t length, bool* listed = nullptr) const;
+    String getRegistrableDomain(const String& domain) const;    // "" for a bare public suffix
+    bool hasPublicSuffixList() const { return psl_rule_count > 0; }
+
+    size_t getEntryCount() const { return entry_count; }
+    size_t getPublicSuffixRuleCount() const { return psl_rule_count; }
+    size_t getNodeCount() const { return nodes.size(); }
+    size_t getMemoryUsage() const;
+
+    static DomainTag parseTag(const String& name);
+    static const char* getTagName(DomainTag tag);
+
+private:
+    struct Node {
+        uint32_t parent;
+        uint32_t text;          // Lowercased label in the arena
+        uint8_t length;
+        uint8_t tag;
+        uint8_t psl;            // PSL_* flags
+        uint8_t severity;
+    };
+
+    static const uint8_t PSL_RULE = 0x01;
+    static const uint8_t PSL_WILDCARD = 0x02;   // Every child label is a public suffix
+    static const uint8_t PSL_EXCEPTION = 0x04;  // Not a public suffix despite a wildcard
+    static const uint32_t NO_NODE = 0xFFFFFFFF;
+
+    std::vector<Node> nodes;                // nodes[0] is the root
+    std::vector<char> arena;
+    std::vector<uint32_t> index;            // Node + 1, 0 = empty; power of two
+    std::map<uint32_t, String> labels;      // Only entries that have one
+    size_t entry_count;
+    size_t psl_rule_count;
+
+    uint32_t findChild(uint32_t parent, const char* label, size_t length) const;
+    uint32_t insertPath(const char* suffix, size_t length);
+    void growIndex();
+
+    static uint32_t hashLabel(uint32_t parent, const char* label, size_t length);
+    static size_t trimDomain(const char* domain, size_t length);
+};
+
+#endif // DOMAIN_SUFFIX_TRIE_H
@@ -10,6 +10,9 @@
 #include "hid_automation.h"
 #include "evidence_container.h"
 #include "wifi_manager.h"
+#include "performance_monitor.h"
+#include "ioc_matcher.h"
+#include "threat_detector.h"
 
 struct DeviceState {
     OperatingMode mode;
@@ -41,6 +44,11 @@ private:
     WiFiManager* wifi_manager;
     DeviceState state;
 
+    // Analysis engines; both report per-rule scan costs to the monitor
+    PerformanceMonitor* performance_monitor;
+    IOCMatcher* ioc_matcher;
+    ThreatDetector* threat_detector;
+
     // Configuration
     JsonDocument config;
     String deviceId;
@@ -61,6 +69,8 @@ private:
     void initializeUSB();
     void initializeWiFi();
     void initializeStorage();
+    void initializeAnalysis();
+    std::vector<String> getCaseFiles();
 
 public:
     FRFD();
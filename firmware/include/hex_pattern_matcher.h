@@ -0,0 +1,149 @@
+#ifndef HEX_PATTERN_MATCHER_H
+#define HEX_PATTERN_MATCHER_H
+
+#include <Arduino.h>
+#include <vector>
+
+/**
+ * @brief Bit-parallel (shift-and) matcher for YARA-style hex strings
+ *
+ * Supports exact bytes ("4D"), wildcards ("??"), nibble masks ("4?", "?D")
+ * and bounded jumps ("[2]", "[0-4]"). Every hex string becomes a run of
+ * positions in a 64-bit word; several strings are packed into one word, so
+ * the whole set advances with a handful of AND/shift operations per byte.
+ *
+ * A jump [n-m] is n wildcard positions followed by m-n optional ones. Optional
+ * positions are closed over with the constant-time formula from Navarro's
+ * extended shift-and, so jumps cost nothing extra per byte.
+ *
+ * While no pattern is in progress the scanner skips ahead to the next byte
+ * that can start a pattern (memchr when there is only one).
+ *
+ * The tables are plain arrays, so they can be compiled on the build host and
+ * attached from a rule image (see rule_image.h).
+ */
+class HexPatternMatcher {
+public:
+    static const size_t MAX_POSITIONS = 64;
+
+    // Per word: start bits, accepting bits, optional bits, bit before each optional run, last bit of each run
+    enum WordBits {
+        WORD_STARTS = 0,
+        WORD_ACCEPTS,
+        WORD_OPTIONAL,
+        WORD_OPT_BEFORE,
+        WORD_OPT_LAST,
+        WORD_BITS_COUNT
+    };
+
+    /**
+     * @brief Compiled matcher tables
+     */
+    struct Tables {
+        const uint64_t* byte_masks;     // word_count * 256: positions each byte value satisfies
+        const uint64_t* word_bits;      // word_count * WORD_BITS_COUNT
+        const uint16_t* accept_ids;     // word_count * 64: pattern id per accepting bit
+        const uint8_t* first_bytes;     // 256-bit bitmap of bytes that can start a pattern
+        uint32_t word_count;
+        uint32_t pattern_count;
+    };
+
+    HexPatternMatcher();
+
+    // Pattern management
+    int addPattern(const String& hex);      // Returns pattern id, or -1 on a syntax error
+    void clear();
+    bool compile();
+    bool attach(const Tables& external);
+
+    bool isCompiled() const { return compiled; }
+    size_t getPatternCount() const { return tables.pattern_count; }
+    size_t getWordCount() const { return tables.word_count; }
+    size_t getMinLength(uint16_t pattern_id) const { return min_lengths[pattern_id]; }   // Locally compiled only
+
+    struct Position {
+        uint8_t value;
+        uint8_t mask;
+        bool optional;                  // Inside a jump, may be skipped
+    };
+
+    /**
+     * @brief Parse a hex string into match positions
+     * @return false on syntax errors, unbounded jumps, alternations or more than MAX_POSITIONS positions
+     */
+    static bool parse(const String& hex, std::vector<Position>& positions);
+
+    /**
+     * @brief Scan a block of bytes
+     *
+     * @param state getWordCount() words of state, zeroed for a new stream and
+     *              passed unchanged between blocks of the same stream
+     * @param on_match Called as on_match(pattern_id, end_offset), end_offset
+     *                 being one past the last matched byte in this block
+     */
+    template <typename MatchSink>
+    void scan(const uint8_t* data, size_t len, uint64_t* state, MatchSink&& on_match) const {
+        if (!compiled || tables.word_count == 0) return;
+
+        const uint32_t words = tables.word_count;
+        size_t i = 0;
+        while (i < len) {
+            // Nothing in progress: jump to the next byte that can start a pattern
+            bool idle = true;
+            for (uint32_t w = 0; w < words; w++) {
+                if (state[w]) {
+                    idle = false;
+                    break;
+                }
+            }
+            if (idle) {
+                if (single_first_byte >= 0) {
+                    const void* next = memchr(data + i, single_first_byte, len - i);
+                    if (!next) return;
+                    i = (const uint8_t*)next - data;
+                } else {
+                    while (i < len && !(tables.first_bytes[data[i] >> 3] & (1 << (data[i] & 7)))) i++;
+                    if (i == len) return;
+                }
+            }
+
+            uint8_t c = data[i++];
+            for (uint32_t w = 0; w < words; w++) {
+                const uint64_t* bits = &tables.word_bits[w * WORD_BITS_COUNT];
+                uint64_t d = ((state[w] << 1) | bits[WORD_STARTS]) & tables.byte_masks[w * 256 + c];
+                if (bits[WORD_OPTIONAL]) {
+                    uint64_t df = d | bits[WORD_OPT_LAST];
+                    d |= bits[WORD_OPTIONAL] & (~(df - bits[WORD_OPT_BEFORE]) ^ df);
+                }
+                state[w] = d;
+
+                uint64_t hits = d & bits[WORD_ACCEPTS];
+                while (hits) {
+                    int bit = __builtin_ctzll(hits);
+                    on_match(tables.accept_ids[w * 64 + bit], i);
+                    hits &= hits - 1;
+                }
+            }
+        }
+    }
+
+private:
+    Tables tables;
+    bool compiled;
+    int single_first_byte;              // Only byte that can start a pattern, or -1
+
+    // Patterns as added, consumed by compile()
+    std::vector<std::vector<Position>> patterns;
+    std::vector<uint16_t> min_lengths;
+
+    // Storage behind `tables` when compiled locally
+    std::vector<uint64_t> byte_masks;
+    std::vector<uint64_t> word_bits;
+    std::vector<uint16_t> accept_ids;
+    uint8_t first_bytes[32];
+
+    void resetTables();
+    void findSingleFirstByte();
+};
+
+#endif // HEX_PATTERN_MATCHER_H
@@ -0,0 +1,51 @@
+#ifndef HYPERLOGLOG_H
+#define HYPERLOGLOG_H
+
+#include <Arduino.h>
+#include <vector>
+
+#define HLL_DEFAULT_PRECISION   12      // 4096 registers, 4 KB: about 1.6% standard error
+#define HLL_MIN_PRECISION       4
+#define HLL_MAX_PRECISION       16
+
+/**
+ * @brief HyperLogLog distinct-value counter
+ *
+ * The top `precision` bits of a value's 64-bit hash pick a register; the
+ * register keeps the longest run of leading zeros (plus one) seen in the
+ * rest. The count is estimated from how many registers hold each value,
+ * with Ertl's improved estimator ("New cardinality estimation algorithms
+ * for HyperLogLog sketches", 2017), which needs no bias tables and has no
+ * jump between small and large counts. The standard error is about
+ * 1.04 / sqrt(2^precision) at any count, in 2^precision bytes.
+ *
+ * The histogram and the estimate are updated when a register grows, which
+ * gets rarer as the count rises, so estimate() is a stored value and add()
+ * of a value already counted changes nothing.
+ */
+class HyperLogLog {
+public:
+    explicit HyperLogLog(uint8_t precision = HLL_DEFAULT_PRECISION);
+
+    void add(uint64_t hash);
+    void add(const char* text, size_t length) { add(hashText(text, length)); }
+    void merge(const HyperLogLog& other);       // Union; same precision only
+    void clear();
+
+    uint32_t estimate() const { return cached_estimate; }
+    uint8_t getPrecision() const { return precision; }
+    size_t getMemoryUsage() const { return sizeof(*this) + registers.capacity(); }
+
+    static uint64_t hashText(const char* text, size_t length);
+
+private:
+    uint8_t precision;
+    std::vector<uint8_t> registers;
+    uint32_t histogram[66];         // Registers holding each value, 0 to 65 - precision
+    uint32_t cached_estimate;
+
+    void setRegister(size_t index, uint8_t value);
+    void updateEstimate();
+};
+
+#endif // HYPERLOGLOG_H
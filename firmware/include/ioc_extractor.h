@@ -4,7 +4,19 @@
 #include <Arduino.h>
 #include <vector>
 #include <set>
+#include <map>
 #include "storage.h"
+#include "ioc_store.h"
+#include "threat_intel_watchlist.h"
+#include "cidr_tree.h"
+#include "domain_suffix_trie.h"
+
+// Streaming extraction
+#define IOC_EXTRACT_CHUNK_SIZE  4096    // Bytes read from the artifact per step
+#define IOC_EXTRACT_MAX_LINE    2048    // Longest partial line carried between chunks; longer lines are split
+#define IOC_CONTEXT_CHARS       20      // Context kept on each side of an IOC
+#define IOC_MARK_HASH_BYTES     256     // Bytes before a high-water mark covered by its hash
+#define IOC_MARKS_FILE          "ioc_marks.txt"
 
 /**
  * @brief IOC (Indicator of Compromise) Types
@@ -25,6 +37,9 @@ enum IOCType {
     IOC_UNKNOWN
 };
 
+// Type mask selecting every IOCType, for IOCExtractor::lexContent
+#define IOC_ALL_TYPES ((1UL << IOC_UNKNOWN) - 1)
+
 /**
  * @brief IOC Entry
  */
@@ -37,19 +52,35 @@ struct IOC {
     uint8_t confidence;          // Confidence score 0-100
 };
 
+/**
+ * @brief Extraction high-water mark for one artifact
+ *
+ * Everything up to `size` has been extracted. Lexing resumes at `offset`, the
+ * start of the last unterminated line, so a token cut off by the end of a
+ * growing log is seen whole next time; tokens ending at or before `size` are
+ * not reported again. `tail_hash` covers the bytes just before `size` and
+ * detects files that were replaced or rotated rather than appended to.
+ */
+struct IOCFileMark {
+    uint32_t offset;
+    uint32_t size;
+    uint32_t tail_hash;             // FNV-1a
+};
+
 /**
  * @brief IOC Statistics
  */
 struct IOCStatistics {
-    uint16_t total_iocs;
-    uint16_t ip_addresses;
-    uint16_t domains;
-    uint16_t urls;
-    uint16_t file_hashes;
-    uint16_t emails;
-    uint16_t registry_keys;
-    uint16_t file_paths;
-    uint16_t unique_iocs;
+    uint32_t total_iocs;
+    uint32_t ip_addresses;
+    uint32_t domains;
+    uint32_t urls;
+    uint32_t file_hashes;
+    uint32_t emails;
+    uint32_t registry_keys;
+    uint32_t file_paths;
+    uint32_t unique_iocs;
+    uint32_t watchlist_hits;
 };
 
 /**
@@ -57,6 +88,9 @@ struct IOCStatistics {
  *
  * Extracts indicators of compromise from forensic artifacts
  * Supports multiple output formats (CSV, JSON, STIX, OpenIOC)
+ *
+ * Extracted IOCs are kept in an IOCStore: values are interned and deduplicated
+ * on insert, and contexts are read back from the artifacts only on demand.
  */
 class IOCExtractor {
 public:
@@ -85,9 +119,33 @@ public:
     // IOC Management
     void addIOC(const IOC& ioc);
     void clearIOCs();
-    std::vector<IOC> getIOCs() const { return iocs; }
+    // Built from the store on first use and extended as IOCs are added, so repeated calls copy
+    // nothing; valid until the next extraction. Contexts are left empty, see getIOCContext()
+    const std::vector<IOC>& getIOCs() const;
+    const std::vector<IOC>& getUniqueIOCs() const;      // First occurrence of each value
     std::vector<IOC> getIOCsByType(IOCType type) const;
-    std::vector<IOC> getUniqueIOCs() const;
+    IOC getIOC(size_t index) const;
+    String getIOCContext(size_t index) const;           // Read back from the source artifact
+    const IOCStore& getStore() const { return store; }
+
+    // Threat-intel watchlist; IPs, domains, URLs and hashes are checked once per unique value
+    void setWatchlist(ThreatIntelWatchlist* list) { watchlist = list; }
+    const std::vector<WatchlistHit>& getWatchlistHits() const { return watchlist_hits; }
+
+    // IP ranges (tag,cidr[,severity[,label]] per line); deny and intel ranges are reported as watchlist hits
+    bool loadIPRanges(const String& path) { return ip_ranges.loadFile(storage, path); }
+    const CidrTree& getIPRanges() const { return ip_ranges; }
+    CidrTag classifyIP(const String& ip, CidrMatch* match = nullptr) const { return ip_ranges.lookup(ip, match); }
+    bool isExternalIP(const String& ip) const;
+
+    // Domain suffixes (tag,suffix[,severity[,label]] per line); with a public suffix list loaded,
+    // candidate domains must end in a listed public suffix
+    bool loadDomainSuffixes(const String& path) { return domain_suffixes.loadFile(storage, path); }
+    bool loadPublicSuffixList(const String& path) { return domain_suffixes.loadPublicSuffixList(storage, path); }
+    const DomainSuffixTrie& getDomainSuffixes() const { return domain_suffixes; }
+    DomainTag classifyDomain(const String& domain, DomainMatch* match = nullptr) const {
+        return domain_suffixes.lookup(domain, match);
+    }
 
     // Filtering
     void filterPrivateIPs(bool enable) { filter_private_ips = enable; }
@@ -103,8 +161,14 @@ public:
 
     // Statistics
     IOCStatistics getStatistics() const;
-    uint16_t getIOCCount() const { return iocs.size(); }
-    uint16_t getUniqueIOCCount() const;
+    size_t getIOCCount() const { return store.getOccurrenceCount(); }
+    size_t getUniqueIOCCount() const { return store.getUniqueCount(); }
+
+    // Incremental extraction
+    bool loadFileMarks();           // From IOC_MARKS_FILE in the case directory
+    bool saveFileMarks();
+    void resetFileMarks();          // Next extraction starts every artifact from scratch
+    size_t getFileMarkCount() const { return file_marks.size(); }
 
     // Validation
     bool isValidIPv4(const String& ip);
@@ -118,7 +182,9 @@ public:
 
 private:
     FRFDStorage* storage;
-    std::vector<IOC> iocs;
+    IOCStore store;
+    ThreatIntelWatchlist* watchlist;
+    std::vector<WatchlistHit> watchlist_hits;
 
     // Filtering options
     bool filter_private_ips;
@@ -129,15 +195,29 @@ private:
     String getIOCTypeName(IOCType type) const;
     uint8_t calculateConfidence(const String& value, IOCType type);
     bool isInWhitelist(const String& value, IOCType type);
-    void deduplicateIOCs();
+
+    // IOCs materialized for getIOCs() and getUniqueIOCs()
+    mutable std::vector<IOC> ioc_list;
+    mutable std::vector<IOC> unique_list;
 
     // Pattern matching helpers
-    bool matchesPattern(const String& text, const String& pattern);
-    std::vector<String> findMatches(const String& content, const String& pattern);
+    void lexContent(const String& content, const String& source, uint32_t type_mask,
+                    std::vector<IOC>& found_iocs);
+    bool checkIOC(IOCType type, const char* data, size_t start, size_t& end,
+                  String& value, uint8_t& confidence);
+    void checkWatchlist(uint32_t entry);
+
+    // High-water marks by artifact path
+    std::map<String, IOCFileMark> file_marks;
+    bool marks_loaded;
+    bool marks_dirty;
+
+    String getMarksPath() const;
+    uint32_t hashFileTail(File& file, uint32_t end);
 
     // Whitelists
-    std::set<String> domain_whitelist;
-    std::set<String> ip_whitelist;
+    DomainSuffixTrie domain_suffixes; // Whitelisted and intel suffixes, public suffix rules
+    CidrTree ip_ranges;             // Private, loopback, whitelisted and intel ranges
 
     void initializeWhitelists();
 };
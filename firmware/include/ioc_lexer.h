@@ -0,0 +1,226 @@
+#ifndef IOC_LEXER_H
+#define IOC_LEXER_H
+
+#include <Arduino.h>
+#include "ioc_extractor.h"
+
+/**
+ * @brief Single-pass, table-driven lexer for IOC candidates
+ *
+ * Classifies IPv4 addresses, domains, URLs, MD5/SHA1/SHA256 hashes, emails,
+ * registry keys, file paths, mutexes and CVE ids in one forward pass over a
+ * byte buffer, using a 256-entry character-class table and no allocation.
+ *
+ * The pass splits the input into words (runs of alphanumerics, '.', '-' and
+ * '_'), accumulating the classes seen in each. IPs, domains, hashes and CVE
+ * ids never cross a word boundary, so a word is only looked at again when
+ * its classes and length allow one of them (e.g. a dot for IPs and domains,
+ * 32+ hex digits for hashes); ordinary words cost nothing extra. Emails are
+ * anchored on '@'. URLs, registry keys, paths and mutexes are anchored on
+ * the first separator in their prefix (':', '\\' or '/').
+ *
+ * Overlapping indicators of different types (a domain inside a URL, an IP
+ * inside a path) are all reported. The lexer only finds plausible spans;
+ * full validation and filtering are left to IOCExtractor, which only ever
+ * looks at the reported spans.
+ */
+class IOCLexer {
+public:
+    IOCLexer();
+
+    /**
+     * @brief Lex a complete buffer
+     *
+     * @param on_token Called as on_token(type, start, end) for every candidate span
+     */
+    template <typename TokenSink>
+    void scan(const uint8_t* data, size_t len, TokenSink&& on_token) const {
+        size_t span_until[SPAN_COUNT] = {0};    // A span kind does not restart inside its own last span
+        size_t word_start = 0;
+        size_t word_end = 0;
+
+        size_t i = 0;
+        while (i < len) {
+            uint16_t cls = char_class[data[i]];
+
+            if (cls & CC_WORD) {
+                uint16_t seen = 0;
+                word_start = i;
+                do {
+                    seen |= cls;
+                    i++;
+                } while (i < len && ((cls = char_class[data[i]]) & CC_WORD));
+                word_end = i;
+
+                lexWord(data, word_start, word_end, seen, on_token);
+                continue;
+            }
+
+            if (cls & CC_AT) {
+                if (word_end == i && word_start < word_end) {
+                    lexEmail(data, len, word_start, i, on_token);
+                }
+            } else if (cls & CC_PREFIX) {
+                lexPrefixes(data, len, i, span_until, on_token);
+            }
+            i++;
+        }
+    }
+
+private:
+    // Character classes
+    enum {
+        CC_DIGIT        = 0x0001,
+        CC_HEX          = 0x0002,
+        CC_ALPHA        = 0x0004,
+        CC_DOT          = 0x0008,
+        CC_HYPHEN       = 0x0010,
+        CC_UNDERSCORE   = 0x0020,
+        CC_BRACE        = 0x0040,
+        CC_AT           = 0x0080,
+        CC_URL_BODY     = 0x0100,   // Anything but spaces, line breaks, quotes and angle brackets
+        CC_KEY_BODY     = 0x0200,   // Anything but line breaks, double quotes and angle brackets
+        CC_PATH_BODY    = 0x0400,   // Registry key body minus spaces
+        CC_PREFIX       = 0x0800,   // First separator of some span prefix
+
+        CC_DOMAIN       = CC_DIGIT | CC_ALPHA | CC_DOT | CC_HYPHEN,
+        CC_WORD         = CC_DOMAIN | CC_UNDERSCORE,        // Also the email local part
+        CC_MUTEX        = CC_DIGIT | CC_ALPHA | CC_UNDERSCORE | CC_HYPHEN | CC_BRACE,
+        CC_CVE          = CC_DIGIT | CC_HYPHEN
+    };
+
+    enum SpanKind {
+        SPAN_URL,
+        SPAN_REGISTRY,
+        SPAN_PATH,
+        SPAN_MUTEX,
+        SPAN_COUNT
+    };
+
+    struct Prefix {
+        const char* text;
+        uint8_t length;
+        uint8_t kind;
+        uint8_t min_length;         // Spans this long or shorter are dropped
+        uint8_t trigger;            // Index of the first separator in text, set by the constructor
+    };
+
+    static const uint8_t PREFIX_COUNT = 23;
+    static const Prefix prefix_table[PREFIX_COUNT];
+    static const uint16_t span_keep[SPAN_COUNT];
+    static const IOCType span_type[SPAN_COUNT];
+
+    uint16_t char_class[256];
+    Prefix prefixes[PREFIX_COUNT];
+    uint32_t prefix_index[256];     // Prefixes by their first separator
+
+    template <typename TokenSink>
+    void lexWord(const uint8_t* data, size_t start, size_t end, uint16_t seen, TokenSink& on_token) const {
+        size_t n = end - start;
+        size_t j;
+
+        // IPv4: digit and dot pieces starting at a digit, with three dots
+        if ((seen & CC_DOT) && (seen & CC_DIGIT) && n >= 7) {
+            j = start;
+            while (j < end) {
+                while (j < end && !(char_class[data[j]] & CC_DIGIT)) j++;
+                size_t s = j;
+                size_t dots = 0;
+                while (j < end && (char_class[data[j]] & (CC_DIGIT | CC_DOT))) {
+                    if (data[j] == '.') dots++;
+                    j++;
+                }
+                if (dots == 3 && j - s >= 7 && j - s <= 15) {
+                    on_token(IOC_IP_ADDRESS, s, j);
+                }
+            }
+        }
+
+        // Domains: pieces between underscores, starting at an alphanumeric, with a dot
+        if ((seen & CC_DOT) && n >= 4) {
+            j = start;
+            while (j < end) {
+                while (j < end && !(char_class[data[j]] & (CC_DIGIT | CC_ALPHA))) j++;
+                size_t s = j;
+                size_t dots = 0;
+                while (j < end && (char_class[data[j]] & CC_DOMAIN)) {
+                    if (data[j] == '.') dots++;
+                    j++;
+                }
+                if (dots > 0 && j - s >= 4) {
+                    on_token(IOC_DOMAIN, s, j);
+                }
+            }
+        }
+
+        // Hashes: maximal hex pieces of a hash length
+        if ((seen & CC_HEX) && n >= 32) {
+            j = start;
+            while (j < end) {
+                while (j < end && !(char_class[data[j]] & CC_HEX)) j++;
+                size_t s = j;
+                while (j < end && (char_class[data[j]] & CC_HEX)) j++;
+                if (j - s == 32) on_token(IOC_FILE_HASH_MD5, s, j);
+                else if (j - s == 40) on_token(IOC_FILE_HASH_SHA1, s, j);
+                else if (j - s == 64) on_token(IOC_FILE_HASH_SHA256, s, j);
+            }
+        }
+
+        // CVE ids: "CVE-" followed by digits and hyphens
+        if ((seen & CC_HYPHEN) && n >= 13) {
+            j = start;
+            while (j + 13 <= end) {
+                const uint8_t* c = (const uint8_t*)memchr(data + j, 'C', end - 13 - j + 1);
+                if (!c) break;
+                j = c - data;
+                if (memcmp(c, "CVE-", 4) != 0) {
+                    j++;
+                    continue;
+                }
+                size_t s = j;
+                j += 4;
+                while (j < end && (char_class[data[j]] & CC_CVE)) j++;
+                on_token(IOC_CVE, s, j);
+            }
+        }
+    }
+
+    template <typename TokenSink>
+    void lexEmail(const uint8_t* data, size_t len, size_t local_start, size_t at, TokenSink& on_token) const {
+        // Domain part after '@' must contain a dot
+        size_t j = at + 1;
+        bool dot = false;
+        while (j < len && (char_class[data[j]] & CC_DOMAIN)) {
+            if (data[j] == '.') dot = true;
+            j++;
+        }
+        if (dot) {
+            on_token(IOC_EMAIL, local_start, j);
+        }
+    }
+
+    template <typename TokenSink>
+    void lexPrefixes(const uint8_t* data, size_t len, size_t i, size_t* span_until, TokenSink& on_token) const {
+        uint32_t candidates = prefix_index[data[i]];
+        while (candidates) {
+            const Prefix& prefix = prefixes[__builtin_ctz(candidates)];
+            candidates &= candidates - 1;
+
+            if (i < prefix.trigger) continue;
+            size_t start = i - prefix.trigger;
+            if (start < span_until[prefix.kind] || len - start < prefix.length ||
+                memcmp(data + start, prefix.text, prefix.length) != 0) {
+                continue;
+            }
+
+            size_t end = start + prefix.length;
+            while (end < len && (char_class[data[end]] & span_keep[prefix.kind])) end++;
+            span_until[prefix.kind] = end;
+            if (end - start > prefix.min_length) {
+                on_token(span_type[prefix.kind], start, end);
+            }
+        }
+    }
+};
+
+#endif // IOC_LEXER_H
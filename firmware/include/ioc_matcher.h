@@ -3,6 +3,12 @@
 
 #include <Arduino.h>
 #include <vector>
+#include <deque>
+#include "multi_pattern_matcher.h"
+#include "hex_pattern_matcher.h"
+#include "regex_matcher.h"
+#include "rule_image.h"
+#include "performance_monitor.h"
 
 // Simplified YARA-like rule structure
 struct IOCRule {
@@ -14,35 +20,118 @@ struct IOCRule {
     String condition; // "any", "all", or count like "2 of them"
 };
 
+// Upper bound on strings + hexPatterns per rule (hits are tracked as a 64-bit mask)
+#define IOC_MAX_PATTERNS_PER_RULE 64
+
+// Bytes read per block by scanFile
+#define IOC_SCAN_BLOCK_SIZE 8192
+
+// Rule image regex strings: expressions compiled per image, and the DFA cache each one gets
+#define IOC_MAX_IMAGE_REGEXES 32
+#define IOC_REGEX_CACHE_SIZE (16 * 1024)
+
 struct IOCMatch {
     String ruleName;
     String fileName;
     String severity;
     std::vector<String> matchedStrings;
+    std::vector<uint64_t> offsets;      // Offset of the first occurrence of each matched string
     unsigned long timestamp;
 };
 
 class IOCMatcher {
 private:
+    FRFDStorage* storage;
+
+    // Compiled rules executed in place (flash or PSRAM); they come first in rule order
+    RuleImage image;
+    MultiPatternMatcher image_automaton;
+    HexPatternMatcher image_hex;
+    uint8_t* image_buffer;                  // Owned copy when loaded from a file
+    size_t image_exact_max;                 // Longest exact-case image pattern - 1
+    std::deque<RegexMatcher> image_regexes; // Parallel to the image's regex patterns, compiled on attach
+
+    // Rules added at runtime
     std::vector<IOCRule> rules;
     std::vector<IOCMatch> matches;
 
-    bool matchRule(const String& content, const IOCRule& rule);
-    bool containsString(const String& content, const String& pattern);
-    bool containsHex(const String& content, const String& hexPattern);
+    // All rule strings compiled into one automaton; pattern id -> (rule, slot)
+    struct PatternRef {
+        uint16_t rule;
+        uint8_t slot;
+        bool exact;                         // Re-check exact_bytes after the case-folded match
+        uint16_t length;
+        uint32_t bytes;                     // Offset into exact_bytes
+    };
+    MultiPatternMatcher automaton;
+    std::vector<PatternRef> pattern_refs;
+    HexPatternMatcher hex_automaton;        // Hex patterns with wildcards or jumps
+    std::vector<PatternRef> hex_refs;       // length = minimum match length
+    std::vector<uint8_t> exact_bytes;
+    size_t heap_exact_max;
+    std::vector<uint8_t> rule_thresholds;   // Hits needed per runtime rule (0 = never matches)
+    std::vector<uint64_t> rule_hits;        // Per-rule bitmask of matched slots (image rules first)
+    bool automaton_dirty;
+
+    // Streaming scan state, carried from block to block
+    struct SlotHit {
+        uint32_t rule;
+        uint8_t slot;
+        uint64_t offset;
+    };
+    std::vector<SlotHit> first_hits;        // First occurrence of every matched slot
+    uint32_t image_state;
+    uint32_t heap_state;
+    std::vector<uint64_t> image_hex_state;
+    std::vector<uint64_t> hex_state;
+    std::vector<RegexMatcher::Cursor> regex_cursors;
+    uint64_t stream_offset;
+    uint64_t block_offset;                  // Start of the last block scanned
+    std::vector<uint8_t> history;           // Tail of earlier blocks for exact-case checks
+    size_t history_limit;
+    std::vector<uint8_t> rule_needed;       // Per rule: hits still needed to fire, 0 once decided
+    size_t pending_rules;                   // Rules not decided yet; the scan stops at 0
+
+    // Per-rule profiling of the current scan
+    PerformanceMonitor* performance_monitor;
+    std::vector<uint32_t> rule_candidates;  // Automaton hits per rule, before exact-case checks
+    uint32_t scan_time_us;
+
+    bool attachImage(const uint8_t* data, size_t size);
+    void compileImageRegexes();
+    void releaseImage();
+    bool compileRules();
+    uint8_t parseCondition(const IOCRule& rule);
+    bool parseHexPattern(const String& hexPattern, std::vector<uint8_t>& bytes);
+    uint8_t ruleThreshold(size_t rule_index) const;
+    bool evaluateRule(size_t rule_index);
+
+    void beginScan();
+    void scanBlock(const uint8_t* data, size_t len);
+    bool finishScan(const String& fileName);
+    void recordRuleStats();
+    bool verifyExact(const uint8_t* pattern, size_t pattern_len, const uint8_t* block, size_t end) const;
+    void markHit(size_t rule_index, uint8_t slot, uint64_t offset);
 
 public:
     IOCMatcher();
+    ~IOCMatcher();
+
+    // Storage that rule images and scanned artifacts are read through
+    void begin(FRFDStorage* storage_ptr);
 
     // Rule management
-    bool loadRulesFromFile(const String& filePath);
+    bool loadRulesFromFile(const String& filePath);   // Compiled image from scripts/compile_rules.py
     bool addRule(const IOCRule& rule);
     void clearRules();
     size_t getRuleCount();
+    void setPerformanceMonitor(PerformanceMonitor* monitor) { performance_monitor = monitor; }
 
     // Scanning
     bool scanContent(const String& content, const String& fileName);
-    bool scanFile(const String& filePath);
+    bool scanBuffer(const uint8_t* data, size_t len, const String& fileName);  // e.g. artifacts already in PSRAM
+    bool scanFile(const String& filePath);                                    // Streams fixed-size blocks from storage
+                                                                              // until every rule is decided
 
     // Results
     std::vector<IOCMatch> getMatches();
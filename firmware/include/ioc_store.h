@@ -0,0 +1,132 @@
+#ifndef IOC_STORE_H
+#define IOC_STORE_H
+
+#include <Arduino.h>
+#include <vector>
+#include <deque>
+#include <map>
+#include "storage.h"
+
+/**
+ * @brief Compact, deduplicating store for extracted indicators
+ *
+ * Every distinct (type, value) pair is interned once in a character arena and
+ * found again through an open-addressing hash index, so deduplication happens
+ * on insert and unique counts are O(1). Each sighting is a fixed 16-byte
+ * occurrence record: the interned entry, a small source artifact id and the
+ * location of its context in that artifact. Context bytes are only read back
+ * from the artifact when they are needed (see ContextReader).
+ *
+ * Types are plain small integers (IOCType in practice), so the store has no
+ * dependency on the extractor.
+ */
+class IOCStore {
+public:
+    static const uint8_t MAX_TYPES = 16;
+    static const uint16_t NO_SOURCE = 0xFFFF;
+    static const uint8_t INLINE_CONTEXT = 0xFF;     // Occurrence::before marker: context is in the arena
+
+    /**
+     * @brief One distinct indicator
+     */
+    struct Entry {
+        uint32_t value;             // Arena offset, NUL-terminated
+        uint32_t hash;
+        uint32_t first;             // Index of the first occurrence
+        uint32_t count;             // Occurrences seen
+        uint16_t length;
+        uint8_t type;
+        uint8_t confidence;
+    };
+
+    /**
+     * @brief One sighting of an indicator
+     *
+     * The context is `before` bytes before the indicator at `offset` in the
+     * source artifact, the indicator itself and `after` bytes following it.
+     * With before == INLINE_CONTEXT, `offset` is the arena offset of a
+     * NUL-terminated context string instead.
+     */
+    struct Occurrence {
+        uint32_t entry;
+        uint32_t offset;
+        uint32_t timestamp;
+        uint16_t source;
+        uint8_t before;
+        uint8_t after;
+    };
+
+    /**
+     * @brief Reads occurrence contexts back from their artifacts
+     *
+     * Keeps the last artifact open, so walking occurrences in insertion order
+     * opens each file once.
+     */
+    class ContextReader {
+    public:
+        ContextReader(const IOCStore& store, FRFDStorage* storage);
+        ~ContextReader();
+
+        String read(const Occurrence& occurrence);
+
+    private:
+        const IOCStore& store;
+        FRFDStorage* storage;
+        File file;
+        uint16_t open_source;
+    };
+
+    IOCStore();
+
+    void clear();
+
+    // Artifacts are referred to by small ids
+    uint16_t internSource(const String& path);
+    const String& getSource(uint16_t id) const;
+
+    /**
+     * @brief Record a sighting, interning the value if it is new
+     * @return Entry index of the value
+     */
+    uint32_t add(uint8_t type, const char* value, size_t length, uint8_t confidence,
+                 uint16_t source, uint32_t offset, uint8_t before, uint8_t after, uint32_t timestamp);
+
+    // As add(), with the context text kept in the arena rather than in an artifact
+    uint32_t addWithContext(uint8_t type, const char* value, size_t length, uint8_t confidence,
+                            uint16_t source, const String& context, uint32_t timestamp);
+
+    // Counts, all O(1)
+    size_t getOccurrenceCount() const { return occurrences.size(); }
+    size_t getUniqueCount() const { return entries.size(); }
+    size_t getTypeCount(uint8_t type) const { return type < MAX_TYPES ? type_counts[type] : 0; }
+
+    const Occurrence& getOccurrence(size_t index) const { return occurrences[index]; }
+    const Entry& getEntry(uint32_t index) const { return entries[index]; }
+    const char* getValue(const Entry& entry) const { return &arena[entry.value]; }
+
+    /**
+     * @brief Look up a value without adding it
+     * @return Entry index, or -1 if the value was never seen
+     */
+    int32_t find(uint8_t type, const char* value, size_t length) const;
+
+    size_t getMemoryUsage() const;
+
+private:
+    std::vector<char> arena;
+    std::vector<Entry> entries;
+    std::deque<Occurrence> occurrences;   // Grows in blocks: no doubling slack or copies
+    std::vector<uint32_t> index;    // Entry index + 1 per slot, 0 = empty; size is a power of two
+    std::vector<String> sources;
+    std::map<String, uint16_t> source_ids;
+    uint16_t last_source;
+    uint32_t type_counts[MAX_TYPES];
+
+    static uint32_t hashValue(uint8_t type, const char* value, size_t length);
+    size_t probe(uint32_t hash, uint8_t type, const char* value, size_t length) const;
+    uint32_t intern(uint8_t type, const char* value, size_t length, uint8_t confidence);
+    uint32_t appendArena(const char* text, size_t length);
+    void growIndex();
+};
+
+#endif // IOC_STORE_H
@@ -0,0 +1,138 @@
+#ifndef MULTI_PATTERN_MATCHER_H
+#define MULTI_PATTERN_MATCHER_H
+
+#include <Arduino.h>
+#include <vector>
+
+/**
+ * @brief Case-folded Aho-Corasick multi-pattern matcher
+ *
+ * All literal patterns are compiled into a single automaton over byte
+ * equivalence classes. One forward pass over the input reports every
+ * occurrence of every pattern, ASCII case-insensitively, without
+ * copying or lowercasing the input.
+ *
+ * States are numbered breadth-first. The shallow states, where a scan
+ * spends almost all of its time, get full DFA rows; deeper states keep
+ * only their trie edges plus a failure link. This keeps large rule packs
+ * compact while the common path stays a single table lookup.
+ *
+ * The tables are plain arrays, so an automaton compiled on the build host
+ * (see rule_image.h) can be attached and executed in place from flash.
+ *
+ * The scan state is a plain integer, so callers can feed a large
+ * artifact block by block and still find matches that straddle blocks.
+ */
+class MultiPatternMatcher {
+public:
+    static const uint32_t START_STATE = 0;
+    static const uint32_t OUTPUT_FLAG = 0x80000000UL;  // Set on transitions into states with matches
+    static const uint32_t STATE_MASK = 0x7FFFFFFFUL;
+
+    // Upper bound for the dense transition rows built by compile()
+    static const size_t DEFAULT_DENSE_BUDGET = 64 * 1024;
+
+    /**
+     * @brief Compiled automaton tables
+     */
+    struct Tables {
+        const uint8_t* class_map;       // 256 entries; class 0 never occurs in a pattern
+        const uint32_t* dense;          // dense_states * num_classes transitions
+        const uint32_t* sparse_begin;   // Per sparse state, offsets into sparse_class/sparse_next
+        const uint8_t* sparse_class;
+        const uint32_t* sparse_next;
+        const uint32_t* fail;           // Failure link per sparse state
+        const uint32_t* output_begin;   // num_states + 1 offsets into output_ids
+        const uint16_t* output_ids;
+        uint32_t num_states;
+        uint32_t dense_states;
+        uint32_t pattern_count;
+        uint16_t num_classes;
+    };
+
+    MultiPatternMatcher();
+
+    // Pattern management
+    int addPattern(const uint8_t* bytes, size_t len);   // Returns pattern id, or -1
+    int addPattern(const String& pattern);
+    void clear();
+    bool compile(size_t dense_budget = DEFAULT_DENSE_BUDGET);
+
+    // Execute externally owned tables in place (nothing is copied)
+    bool attach(const Tables& external);
+
+    bool isCompiled() const { return compiled; }
+    size_t getPatternCount() const { return tables.pattern_count; }
+    uint32_t getStateCount() const { return tables.num_states; }
+    uint16_t getClassCount() const { return tables.num_classes; }
+    size_t getMemoryUsage() const;
+
+    /**
+     * @brief Scan a block of bytes
+     *
+     * @param state State returned by the previous block (START_STATE for a new stream)
+     * @param on_match Called as on_match(pattern_id, end_offset) for every occurrence,
+     *                 where end_offset is one past the last matched byte in this block
+     * @return State to pass with the next block of the same stream
+     */
+    template <typename MatchSink>
+    uint32_t scan(const uint8_t* data, size_t len, uint32_t state, MatchSink&& on_match) const {
+        if (!compiled) return state;
+
+        state &= STATE_MASK;
+        for (size_t i = 0; i < len; i++) {
+            uint8_t c = tables.class_map[data[i]];
+            if (c == 0) {
+                // Byte occurs in no pattern: back to the root, which never accepts
+                state = START_STATE;
+                continue;
+            }
+
+            uint32_t next = step(state, c);
+            state = next & STATE_MASK;
+            if (next & OUTPUT_FLAG) {
+                for (uint32_t o = tables.output_begin[state]; o < tables.output_begin[state + 1]; o++) {
+                    on_match(tables.output_ids[o], i + 1);
+                }
+            }
+        }
+
+        return state;
+    }
+
+private:
+    Tables tables;
+    bool compiled;
+
+    // Patterns as added (case-folded), consumed by compile()
+    std::vector<uint8_t> pattern_bytes;
+    std::vector<uint32_t> pattern_offsets;
+    std::vector<uint16_t> pattern_lengths;
+
+    // Storage behind `tables` when compiled locally
+    uint8_t class_map[256];
+    std::vector<uint32_t> dense;
+    std::vector<uint32_t> sparse_begin;
+    std::vector<uint8_t> sparse_class;
+    std::vector<uint32_t> sparse_next;
+    std::vector<uint32_t> fail;
+    std::vector<uint32_t> output_begin;
+    std::vector<uint16_t> output_ids;
+
+    inline uint32_t step(uint32_t state, uint8_t c) const {
+        while (state >= tables.dense_states) {
+            uint32_t k = state - tables.dense_states;
+            for (uint32_t e = tables.sparse_begin[k]; e < tables.sparse_begin[k + 1]; e++) {
+                if (tables.sparse_class[e] == c) return tables.sparse_next[e];
+            }
+            state = tables.fail[k];
+        }
+        return tables.dense[state * tables.num_classes + c];
+    }
+
+    static uint8_t foldByte(uint8_t b) { return (b >= 'A' && b <= 'Z') ? b + 32 : b; }
+    void buildClassMap();
+    void resetTables();
+};
+
+#endif // MULTI_PATTERN_MATCHER_H
@@ -50,6 +50,19 @@ struct ModuleStats {
     float success_rate;
 };
 
+/**
+ * @brief Per-rule scan statistics (IOCMatcher, ThreatDetector)
+ */
+struct RuleScanStats {
+    String engine;
+    String rule_name;
+    uint32_t scan_count;
+    uint64_t bytes_scanned;
+    uint64_t time_us;
+    uint32_t candidate_hits;     // Pattern occurrences found before the condition is evaluated
+    uint32_t confirmed_hits;     // Scans in which the rule fired
+};
+
 /**
  * @brief System Resource Statistics
  */
@@ -140,6 +153,13 @@ public:
     std::vector<String> getSlowestModules(uint8_t count = 5);
     std::vector<String> getFastestModules(uint8_t count = 5);
 
+    // Rule Scan Profiling
+    void recordRuleScan(const String& engine, const String& rule_name, uint64_t bytes,
+                        uint32_t time_us, uint32_t candidates, bool confirmed);
+    std::vector<RuleScanStats> getRuleStats();
+    std::vector<String> getCostliestRules(uint8_t count = 5);
+    void clearRuleStats();
+
     // System Resource Monitoring
     SystemStats getSystemStats();
     void updateSystemStats();
@@ -181,6 +201,7 @@ public:
     String exportToCSV();
     String exportModuleStatsJSON();
     String exportSystemStatsJSON();
+    String exportRuleStatsJSON(uint8_t limit = 0);   // Costliest first; 0 = all rules
     bool saveToFile(const String& filename);
 
     // Configuration
@@ -192,6 +213,7 @@ public:
 private:
     std::vector<PerformanceMetric> metrics;
     std::map<String, ModuleStats> module_stats;
+    std::map<String, RuleScanStats> rule_stats;      // Keyed by "engine/rule"
     std::map<String, PerformanceProfile> profiles;
     std::map<String, uint32_t> memory_by_source;
     std::vector<PerformanceAlert> alerts;
@@ -221,6 +243,7 @@ private:
     void createAlert(const String& type, const String& message,
                     const String& severity, const String& recommendation);
     void updateModuleStats(const String& module_name, unsigned long duration, bool success);
+    std::vector<const RuleScanStats*> sortRuleStatsByCost() const;
     void cleanupOldMetrics();
     String getMetricTypeName(MetricType type);
     uint32_t calculateMemoryUsed(uint32_t metric_id);
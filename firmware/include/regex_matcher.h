@@ -0,0 +1,159 @@
+#ifndef REGEX_MATCHER_H
+#define REGEX_MATCHER_H
+
+#include <Arduino.h>
+#include <vector>
+
+#define REGEX_MAX_STATES 2048               // NFA states per expression
+#define REGEX_MAX_REPEAT 255                // Largest count in {n,m}
+#define REGEX_MAX_DEPTH 32                  // Group nesting
+#define REGEX_DFA_CACHE_SIZE (32 * 1024)    // Default DFA cache per expression, bytes
+
+/**
+ * @brief Linear-time regular expressions for threat rules
+ *
+ * A pattern is parsed once into a Thompson NFA. Searches run a DFA that is
+ * built lazily, one state the first time the input reaches it, inside a
+ * single fixed-size cache (PSRAM when there is some). When the cache is full
+ * it is flushed and rebuilt from the current state, so memory never grows
+ * past the budget and each input byte costs at most one state construction.
+ * There is no backtracking: a search is linear in the input whatever the
+ * pattern.
+ *
+ * Searches can be fed block by block through a Cursor, so a match that
+ * straddles two blocks of a file is still found. A cache flush invalidates
+ * other cursors on the same expression, so keep one cursor per expression.
+ *
+ * Match extents (find) come from a Pike VM over the same NFA and are
+ * leftmost-longest.
+ *
+ * Syntax: literals, ., [...] and [^...] with ranges, \d \w \s \D \W \S,
+ * \xHH, \t \n \r \f \v, groups (...) and (?:...), |, * + ? {n} {n,} {n,m}
+ * (a lazy ? suffix is accepted and ignored), ^ and $ at line boundaries,
+ * \b \B, and leading (?i) / (?s) flags. Backreferences and lookaround are
+ * not supported.
+ */
+class RegexMatcher {
+public:
+    /**
+     * @brief Position of a streaming search
+     */
+    struct Cursor {
+        uint32_t state;         // DFA state, 0 before the first byte
+        uint32_t generation;    // Cache generation the state belongs to
+        uint8_t context;        // What the last byte fed was (CTX_*)
+        bool matched;
+    };
+
+    RegexMatcher();
+    ~RegexMatcher();
+    RegexMatcher(const RegexMatcher&) = delete;
+    RegexMatcher& operator=(const RegexMatcher&) = delete;
+
+    bool compile(const String& pattern, bool case_insensitive = false,
+                 size_t cache_size = REGEX_DFA_CACHE_SIZE);
+    void clear();
+
+    bool isCompiled() const { return compiled; }
+    const String& getError() const { return error; }
+    size_t getStateCount() const { return nfa.size(); }
+    size_t getDfaStateCount() const { return dfa_states; }
+    uint32_t getCacheFlushes() const { return cache_flushes; }
+    size_t getMemoryUsage() const;
+
+    // Streaming search over consecutive blocks of one input
+    void begin(Cursor& cursor) const;
+    bool feed(Cursor& cursor, const uint8_t* data, size_t len);
+    bool finish(Cursor& cursor);        // Settles matches that need end of input ($, \b)
+
+    // Does the pattern occur anywhere in the buffer
+    bool search(const uint8_t* data, size_t len);
+    bool search(const String& text) {
+        return search((const uint8_t*)text.c_str(), text.length());
+    }
+
+    // Leftmost-longest match starting at or after `from`
+    bool find(const uint8_t* data, size_t len, size_t from, size_t& match_start, size_t& match_end);
+
+private:
+    enum Op : uint8_t {
+        OP_SET,         // Consume a byte in sets[set]
+        OP_SPLIT,       // Continue at out and out1
+        OP_JUMP,
+        OP_ASSERT,      // Continue at out if the assertion holds
+        OP_MATCH
+    };
+
+    struct State {
+        uint8_t op;
+        uint8_t assertion;
+        uint16_t set;
+        uint32_t out;
+        uint32_t out1;
+    };
+
+    struct Thread {
+        uint32_t state;
+        uint32_t start;
+    };
+
+    String error;
+    bool compiled;
+    bool uses_context;                  // Has ^ $ \b \B, so states track the previous byte
+
+    std::vector<State> nfa;
+    std::vector<uint8_t> sets;          // 32-byte bitmaps
+    uint32_t start_state;
+
+    uint8_t class_map[256];             // Byte -> equivalence class
+    std::vector<uint8_t> class_byte;    // A representative byte per class
+    std::vector<uint8_t> class_kind;    // KIND_* per class
+    uint16_t num_classes;
+
+    // DFA cache: a slot table, then state records
+    // [hash, core size | context << 16, transitions..., core NFA states as uint16 pairs]
+    uint32_t* cache;                    // Allocated on the first search
+    size_t cache_budget;
+    size_t cache_words;
+    size_t cache_used;
+    size_t slot_count;
+    size_t dfa_states;
+    uint32_t generation;
+    uint32_t cache_flushes;
+
+    // Scratch reused across transitions and finds
+    std::vector<uint32_t> visit_mark;
+    uint32_t visit_stamp;
+    std::vector<uint32_t> stack;
+    std::vector<uint32_t> set_states;
+    std::vector<uint16_t> next_core;
+    std::vector<Thread> threads;
+    std::vector<Thread> next_threads;
+    std::vector<Thread> thread_stack;
+
+    bool parse(const String& pattern, bool case_insensitive);
+    void buildClasses();
+    bool allocateCache();
+    void flushCache();
+
+    uint32_t startState(uint8_t context);
+    uint32_t findOrAddState(uint8_t context, const uint16_t* core, size_t core_size);
+    uint32_t computeTransition(uint32_t state, uint16_t byte_class);
+    bool closure(uint32_t state, uint8_t kind);
+    void nextVisit();
+    bool visit(uint32_t state) {
+        if (visit_mark[state] == visit_stamp) return false;
+        visit_mark[state] = visit_stamp;
+        return true;
+    }
+    bool assertionHolds(uint8_t assertion, uint8_t context, uint8_t kind) const;
+    uint8_t contextOf(uint8_t kind) const;
+
+    bool inSet(uint16_t set, uint8_t byte) const {
+        return sets[set * 32 + (byte >> 3)] & (1 << (byte & 7));
+    }
+
+    friend struct RegexCompiler;
+};
+
+#endif // REGEX_MATCHER_H
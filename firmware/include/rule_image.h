@@ -0,0 +1,163 @@
+#ifndef RULE_IMAGE_H
+#define RULE_IMAGE_H
+
+#include <Arduino.h>
+#include "multi_pattern_matcher.h"
+#include "hex_pattern_matcher.h"
+#include "storage.h"
+
+/**
+ * @brief Compiled rule image format
+ *
+ * Produced on the build host by scripts/compile_rules.py from the YARA
+ * subset used in rules/default.yar (strings, nocase, ascii/wide, hex, regex,
+ * "N of them", meta). The image carries the rule tables, a precompiled
+ * Aho-Corasick automaton for literal strings and shift-and tables for hex
+ * strings with wildcards or jumps, so those run in place from flash or PSRAM
+ * without building anything on the heap. Regex strings are carried as text
+ * and compiled by RegexMatcher when the image is attached.
+ *
+ * Layout (little-endian, every section 4-byte aligned, hex tables 8-byte aligned):
+ *   RuleImageHeader | rules | strings | patterns | automaton tables |
+ *   hex patterns | hex tables | regex patterns | string pool
+ */
+
+#define RULE_IMAGE_MAGIC   0x49525246UL   // "FRRI"
+#define RULE_IMAGE_VERSION 3
+
+// RuleImageString::kind
+#define RULE_STRING_TEXT 0
+#define RULE_STRING_HEX  1
+#define RULE_STRING_REGEX 2
+
+// RuleImageString::flags
+#define RULE_STRING_NOCASE 0x01
+#define RULE_STRING_ASCII  0x02
+#define RULE_STRING_WIDE   0x04
+#define RULE_STRING_DOTALL 0x08   // Regex: . matches newlines
+
+// Strings per rule: matchers keep one hit bit per string in a uint64_t
+#define RULE_IMAGE_MAX_STRINGS 64
+
+// RuleImagePattern::flags
+#define RULE_PATTERN_EXACT_CASE 0x01   // Automaton match must be re-checked case-sensitively
+
+struct RuleImageHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t header_size;
+    uint32_t image_size;
+    uint32_t checksum;            // CRC-32 of everything after the header
+    uint32_t rule_count;
+    uint32_t string_count;
+    uint32_t pattern_count;       // Automaton patterns (a wide+ascii string yields two)
+    uint32_t rules_offset;
+    uint32_t strings_offset;
+    uint32_t patterns_offset;
+    uint32_t pool_offset;
+    uint32_t pool_size;
+    uint32_t num_states;
+    uint32_t dense_states;
+    uint16_t num_classes;
+    uint16_t reserved;
+    uint32_t class_map_offset;    // 256 bytes
+    uint32_t dense_offset;        // dense_states * num_classes uint32
+    uint32_t sparse_begin_offset; // (num_states - dense_states + 1) uint32
+    uint32_t sparse_class_offset; // sparse_edge_count bytes
+    uint32_t sparse_next_offset;  // sparse_edge_count uint32
+    uint32_t fail_offset;         // (num_states - dense_states) uint32
+    uint32_t output_begin_offset; // (num_states + 1) uint32
+    uint32_t output_ids_offset;   // output_count uint16
+    uint32_t sparse_edge_count;
+    uint32_t output_count;
+    uint32_t hex_pattern_count;   // Hex strings run by HexPatternMatcher
+    uint32_t hex_word_count;
+    uint32_t hex_patterns_offset; // hex_pattern_count RuleImagePattern (length = minimum match length)
+    uint32_t hex_masks_offset;    // hex_word_count * 256 uint64
+    uint32_t hex_bits_offset;     // hex_word_count * WORD_BITS_COUNT uint64
+    uint32_t hex_accept_offset;   // hex_word_count * 64 uint16
+    uint32_t hex_first_offset;    // 32 bytes
+    uint32_t regex_pattern_count; // Regex strings run by RegexMatcher
+    uint32_t regex_patterns_offset; // regex_pattern_count RuleImagePattern (bytes = NUL-terminated body)
+};
+
+struct RuleImageRule {
+    uint32_t name;                // Pool offsets of NUL-terminated strings
+    uint32_t description;
+    uint32_t severity;
+    uint32_t category;
+    uint32_t platform;
+    uint32_t first_string;        // Index into the strings table
+    uint16_t string_count;
+    uint8_t threshold;            // Strings needed to match (0 = never)
+    uint8_t flags;
+};
+
+struct RuleImageString {
+    uint32_t text;                // Pool offset of the string as written in the rule
+    uint16_t length;
+    uint8_t kind;
+    uint8_t flags;
+};
+
+struct RuleImagePattern {
+    uint32_t bytes;               // Pool offset of the exact pattern bytes
+    uint16_t length;
+    uint16_t rule;
+    uint8_t slot;                 // String index within the rule
+    uint8_t flags;
+    uint16_t reserved;
+};
+
+/**
+ * @brief Read-only view over a compiled rule image
+ */
+class RuleImage {
+public:
+    RuleImage();
+
+    bool attach(const uint8_t* data, size_t size);
+    void detach();
+    bool isLoaded() const { return header != nullptr; }
+
+    uint32_t getRuleCount() const { return header ? header->rule_count : 0; }
+    uint32_t getStringCount() const { return header ? header->string_count : 0; }
+    uint32_t getPatternCount() const { return header ? header->pattern_count : 0; }
+    uint32_t getHexPatternCount() const { return header ? header->hex_pattern_count : 0; }
+    uint32_t getRegexPatternCount() const { return header ? header->regex_pattern_count : 0; }
+    size_t getImageSize() const { return header ? header->image_size : 0; }
+
+    const RuleImageRule& getRule(uint32_t index) const { return rules[index]; }
+    const RuleImageString& getString(uint32_t index) const { return strings[index]; }
+    const RuleImagePattern& getPattern(uint32_t index) const { return patterns[index]; }
+    const RuleImagePattern& getHexPattern(uint32_t index) const { return hex_patterns[index]; }
+    const RuleImagePattern& getRegexPattern(uint32_t index) const { return regex_patterns[index]; }
+    const char* getText(uint32_t pool_offset) const { return (const char*)(pool + pool_offset); }
+    const uint8_t* getBytes(uint32_t pool_offset) const { return pool + pool_offset; }
+
+    // Matcher tables, ready for MultiPatternMatcher::attach() / HexPatternMatcher::attach()
+    MultiPatternMatcher::Tables getAutomatonTables() const;
+    HexPatternMatcher::Tables getHexTables() const;
+
+    // Read an image file into PSRAM (internal RAM as fallback), 8-byte aligned; release with heap_caps_free()
+    static uint8_t* loadFile(FRFDStorage* storage, const String& path, size_t* size);
+
+private:
+    const RuleImageHeader* header;
+    const RuleImageRule* rules;
+    const RuleImageString* strings;
+    const RuleImagePattern* patterns;
+    const RuleImagePattern* hex_patterns;
+    const RuleImagePattern* regex_patterns;
+    const uint8_t* pool;
+    uint32_t text_limit;                // Pool offsets below this are NUL-terminated
+
+    static bool sectionFits(uint32_t offset, uint64_t count, uint32_t item_size, uint32_t image_size,
+                            uint32_t alignment = 4);
+    bool referencesValid();
+    bool patternsValid(const RuleImagePattern* table, uint32_t count, bool exact, bool text) const;
+    bool textValid(uint32_t pool_offset) const { return pool_offset < text_limit; }
+    static bool automatonInvalid();
+};
+
+#endif // RULE_IMAGE_H
@@ -0,0 +1,199 @@
+#ifndef SIGMA_RULES_H
+#define SIGMA_RULES_H
+
+#include <Arduino.h>
+#include <vector>
+#include <map>
+#include "storage.h"
+#include "timeline_generator.h"
+#include "multi_pattern_matcher.h"
+#include "regex_matcher.h"
+
+#define SIGMA_MAX_RULES 4096
+#define SIGMA_MAX_ATOMS 65535               // Distinct (field, modifier, value) tests
+#define SIGMA_MAX_CONDITION_DEPTH 32
+#define SIGMA_REGEX_CACHE_SIZE (8 * 1024)   // DFA cache per |re expression
+
+/**
+ * @brief Timeline event fields a Sigma rule can test
+ */
+enum SigmaField {
+    SIGMA_FIELD_ACTOR,          // actor, User, Image, ParentImage
+    SIGMA_FIELD_TARGET,         // target, TargetFilename, TargetObject, DestinationHostname
+    SIGMA_FIELD_DESCRIPTION,    // description, Description
+    SIGMA_FIELD_DETAILS,        // details, CommandLine, Details
+    SIGMA_FIELD_SOURCE,         // source (source_artifact)
+    SIGMA_FIELD_TYPE,           // type, compared with TimelineGenerator::getEventTypeName
+    SIGMA_FIELD_COUNT
+};
+
+/**
+ * @brief Metadata of a loaded Sigma rule
+ */
+struct SigmaRule {
+    String id;
+    String title;
+    String description;
+    String level;                   // informational, low, medium, high, critical
+    String status;
+    std::vector<String> tags;       // attack.execution, attack.t1059.001, ...
+};
+
+/**
+ * @brief Sigma rules compiled to predicate bytecode over timeline events
+ *
+ * Rules are read from YAML (one rule per document, documents separated by
+ * "---"). Every field test in a detection, such as `actor|endswith: '\cmd.exe'`,
+ * becomes an atom shared by all rules that use it, and the detection's
+ * selections and condition become a short postfix program over those atoms.
+ *
+ * Atoms are indexed per field: the literals of all atoms on a field share
+ * one case-folded Aho-Corasick automaton, so matching an event costs one
+ * pass over each of its fields whatever the number of rules, and event
+ * types are looked up in a table built at compile time. A rule's program
+ * only runs when one of its trigger atoms is found: the indexed atoms it
+ * tests outside any `not`, or all of its indexed atoms when those are not
+ * enough to rule it out. A rule that could be true with none of its indexed
+ * atoms present (a bare `not`, or only |re tests) runs on every event.
+ *
+ * Supported subset:
+ *   detection: selections as maps (fields ANDed, value lists ORed),
+ *              lists of maps (ORed) and keyword lists (searched in actor,
+ *              target, description and details)
+ *   modifiers: contains, startswith, endswith, all, re (with i, m, s),
+ *              cased, exists
+ *   values:    * and ? wildcards (\* \? \\ escape them), null
+ *   condition: and, or, not, parentheses, "1 of" / "all of" with
+ *              selection name patterns or "them"
+ * Matching is case-insensitive unless |cased. logsource is ignored;
+ * aggregations (| count() ...) and timeframe are rejected.
+ */
+class SigmaRuleSet {
+public:
+    SigmaRuleSet();
+
+    void clear();
+
+    // Parse and add rules; compile() must run again before matching
+    bool loadFile(FRFDStorage* storage, const String& path);
+    int addRule(const String& yaml);        // Rule index, or -1 (see getError)
+    bool compile();
+
+    bool isCompiled() const { return compiled; }
+    size_t getRuleCount() const { return rules.size(); }
+    const SigmaRule& getRule(size_t index) const { return rules[index]; }
+    const String& getError() const { return error; }
+
+    /**
+     * @brief Rules matching one event
+     *
+     * @param matched Cleared, then filled with matching rule indexes in ascending order
+     * @return true if any rule matched
+     */
+    bool match(const TimelineEvent& event, std::vector<uint16_t>& matched);
+    bool match(const TimelineStore& store, uint32_t index, std::vector<uint16_t>& matched);   // Without copying the event out
+
+    // Statistics
+    size_t getAtomCount() const { return atoms.size(); }
+    size_t getUnindexedRuleCount() const { return unindexed_rules.size(); }
+    uint64_t getEventsScanned() const { return events_scanned; }
+    uint64_t getProgramsRun() const { return programs_run; }
+    size_t getMemoryUsage() const;
+
+    static const char* getFieldName(SigmaField field);
+
+private:
+    enum Op : uint8_t {
+        OP_ATOM,
+        OP_NOT,
+        OP_AND,
+        OP_OR
+    };
+
+    enum Match : uint8_t {
+        MATCH_CONTAINS,
+        MATCH_STARTS,
+        MATCH_ENDS,
+        MATCH_EQUALS,
+        MATCH_GLOB,         // Wildcards inside the value
+        MATCH_REGEX,
+        MATCH_EXISTS        // Field is not empty
+    };
+
+    static const uint8_t ATOM_INDEXED = 0x01;   // Can only be true when its literal was found
+    static const uint8_t ATOM_VERIFY = 0x02;    // A found literal is a candidate, checked in full
+    static const uint8_t ATOM_CASED = 0x04;
+
+    struct Atom {
+        uint8_t field;
+        uint8_t match;
+        uint8_t flags;
+        uint16_t pattern;           // Literal id in the field automaton when ATOM_INDEXED
+        uint16_t length;            // Literal length
+        String value;               // Folded unless ATOM_CASED; glob with WILDCARD_* bytes
+        RegexMatcher* regex;
+    };
+
+    // The text fields of one event, wherever they are stored
+    struct EventFields {
+        const char* text[SIGMA_FIELD_TYPE];
+        size_t length[SIGMA_FIELD_TYPE];
+        uint8_t type;
+    };
+
+    struct Program {
+        uint32_t begin;             // Offsets into `code`
+        uint32_t end;
+    };
+
+    String error;
+    bool compiled;
+
+    std::vector<SigmaRule> rules;
+    std::vector<Program> programs;              // Parallel to `rules`
+    std::vector<uint32_t> code;                 // op << 24 | operand
+    size_t max_stack;
+
+    std::vector<Atom> atoms;
+    std::map<String, uint32_t> atom_ids;        // Dedup key -> atom
+    std::map<String, RegexMatcher> regex_cache;
+
+    // Indexes built by compile()
+    MultiPatternMatcher field_automata[SIGMA_FIELD_COUNT];
+    std::map<String, uint16_t> field_literals[SIGMA_FIELD_COUNT];
+    std::vector<uint32_t> pattern_atom_begin[SIGMA_FIELD_COUNT];    // Per literal, into pattern_atoms
+    std::vector<uint32_t> pattern_atoms[SIGMA_FIELD_COUNT];
+    std::vector<uint32_t> type_atoms[EVENT_UNKNOWN + 1];
+    std::vector<uint32_t> atom_rule_begin;      // Per atom, into atom_rules
+    std::vector<uint16_t> atom_rules;
+    std::vector<uint16_t> unindexed_rules;
+
+    // Per-event scratch; marks compare against `stamp`
+    uint32_t stamp;
+    std::vector<uint32_t> atom_hit;
+    std::vector<uint32_t> atom_checked;
+    std::vector<uint8_t> atom_result;
+    std::vector<uint32_t> rule_mark;
+    std::vector<uint16_t> candidates;
+    std::vector<uint8_t> stack;
+
+    uint64_t events_scanned;
+    uint64_t programs_run;
+
+    uint32_t addAtom(uint8_t field, uint8_t match, const String& value, uint8_t flags);
+    void hitAtom(uint32_t atom);
+    bool matchFields(const EventFields& event, std::vector<uint16_t>& matched);
+    bool atomValue(uint32_t atom, const EventFields& event);
+    bool runProgram(const Program& program, const EventFields& event);
+    uint8_t programWithoutHits(const Program& program, const std::vector<uint8_t>* triggers) const;
+    void markPositiveAtoms(const Program& program, std::vector<uint8_t>& positive) const;
+    void nextStamp();
+
+    static String atomLiteral(const Atom& atom);
+    static bool matchText(const Atom& atom, const char* data, size_t length);
+    static bool globMatch(const char* text, size_t length, const char* glob, bool cased);
+
+    friend struct SigmaCompiler;
+};
+
+#endif // SIGMA_RULES_H
@@ -2,6 +2,7 @@
 #define STORAGE_H
 
 #include <Arduino.h>
+#include <vector>
 #include <SD.h>
 #include <FS.h>
 #include <SPIFFS.h>
@@ -46,6 +47,7 @@ public:
     bool writeFile(const String& path, const uint8_t* data, size_t len);
     bool appendFile(const String& path, const String& data);
     String readFile(const String& path);
+    File openFile(const String& path, const char* mode = FILE_READ);
     bool fileExists(const String& path);
     bool deleteFile(const String& path);
     size_t getFileSize(const String& path);
@@ -3,10 +3,30 @@
 
 #include <Arduino.h>
 #include <vector>
+#include <deque>
 #include <map>
 #include "storage.h"
 #include "ioc_extractor.h"
 #include "timeline_generator.h"
+#include "performance_monitor.h"
+#include "multi_pattern_matcher.h"
+#include "cidr_tree.h"
+#include "regex_matcher.h"
+#include "sigma_rules.h"
+
+// Bytes read per block by scanFile
+#define THREAT_SCAN_BLOCK_SIZE 4096
+
+// Regex patterns: distinct expressions kept compiled, and the DFA cache each one gets
+#define THREAT_MAX_REGEX_PATTERNS 64
+#define THREAT_REGEX_CACHE_SIZE (16 * 1024)
+#define THREAT_MAX_EXTRACTED_MATCHES 64
+
+// Alert store: critical and high alerts are always kept, one per (rule, source), so they are
+// not capped and can take the store past THREAT_MAX_ALERTS. Lower severities are kept up to
+// THREAT_ALERTS_PER_RULE per rule and THREAT_MAX_ALERTS overall, then rolled up per rule
+#define THREAT_MAX_ALERTS 512
+#define THREAT_ALERTS_PER_RULE 16
 
 /**
  * @brief Threat Rule Types
@@ -19,7 +39,9 @@ enum ThreatRuleType {
     RULE_REGISTRY_PATTERN,   // Registry key/value matching
     RULE_BEHAVIORAL,         // Behavioral analysis
     RULE_COMPOSITE,          // Multiple conditions
-    RULE_IOC_MATCH          // IOC database matching
+    RULE_IOC_MATCH,         // IOC database matching
+    RULE_SIGMA,              // Sigma detection over timeline events (sigma_rules.h)
+    RULE_TYPE_COUNT
 };
 
 /**
@@ -102,10 +124,24 @@ struct DetectionStatistics {
     uint32_t medium_alerts;
     uint32_t low_alerts;
     uint32_t false_positives;
+    uint32_t suppressed_alerts;          // Rolled up instead of stored
     std::map<String, uint16_t> alerts_by_rule;
     std::map<MITRETactic, uint16_t> alerts_by_tactic;
 };
 
+/**
+ * @brief Alerts of one rule that were counted but not stored
+ */
+struct AlertRollup {
+    String rule_id;
+    String rule_name;
+    ThreatSeverity severity;
+    uint32_t count;                      // Alerts rolled up
+    unsigned long first_timestamp;
+    unsigned long last_timestamp;
+    String last_source;                  // Artifact of the latest one
+};
+
 /**
  * @brief Automated Threat Detection Engine
  *
@@ -119,16 +155,20 @@ public:
 
     // Initialization
     void begin(FRFDStorage* storage_ptr, IOCExtractor* ioc_ptr, TimelineGenerator* timeline_ptr);
+    void setPerformanceMonitor(PerformanceMonitor* monitor) { performance_monitor = monitor; }
 
     // Rule Management
     bool loadRule(const ThreatRule& rule);
     bool loadRulesFromFile(const String& filename);
+    bool loadSigmaRules(const String& filename);
     bool loadDefaultRules();
     void clearRules();
     void enableRule(const String& rule_id);
     void disableRule(const String& rule_id);
     std::vector<ThreatRule> getRules() const { return rules; }
-    ThreatRule* getRule(const String& rule_id);
+    const ThreatRule* findRule(const String& rule_id) const;
+    ThreatRule* getRule(const String& rule_id);         // For editing: the rule index is rebuilt before the next scan
+    const std::vector<uint16_t>& getRulesByType(ThreatRuleType type);
 
     // Scanning Methods
     bool scanAllArtifacts();
@@ -140,7 +180,7 @@ public:
     bool matchFilePattern(const ThreatRule& rule, const String& file_path);
     bool matchContentPattern(const ThreatRule& rule, const String& content);
     bool matchNetworkPattern(const ThreatRule& rule, const std::vector<IOC>& iocs);
-    bool matchProcessPattern(const ThreatRule& rule, const std::vector<TimelineEvent>& events);
+    bool matchProcessPattern(const ThreatRule& rule, const TimelineStore& events);
     bool matchRegistryPattern(const ThreatRule& rule, const String& content);
     bool matchBehavioralPattern(const ThreatRule& rule);
     bool matchCompositeRule(const ThreatRule& rule);
@@ -148,7 +188,8 @@ public:
     // Alert Management
     void addAlert(const ThreatAlert& alert);
     void clearAlerts();
-    std::vector<ThreatAlert> getAlerts() const { return alerts; }
+    const std::vector<ThreatAlert>& getAlerts() const { return alerts; }
+    std::vector<AlertRollup> getAlertRollups() const;
     std::vector<ThreatAlert> getAlertsBySeverity(ThreatSeverity severity) const;
     std::vector<ThreatAlert> getAlertsByTactic(MITRETactic tactic) const;
     void markFalsePositive(const String& alert_id);
@@ -156,6 +197,7 @@ public:
     // Statistics
     DetectionStatistics getStatistics() const;
     uint32_t getAlertCount() const { return alerts.size(); }
+    uint32_t getSuppressedAlertCount() const { return suppressed_alerts; }
     uint32_t getCriticalAlertCount() const;
 
     // Export Methods
@@ -177,6 +219,89 @@ private:
     std::vector<ThreatRule> rules;
     std::vector<ThreatAlert> alerts;
     uint32_t scan_count;
+    PerformanceMonitor* performance_monitor;
+
+    // Per rule (parallel to `rules`): patterns folded when the index is built, and scan counters
+    struct RuleProfile {
+        uint64_t bytes_scanned;
+        uint32_t candidate_hits;
+        std::vector<String> patterns_lower;
+        std::vector<uint32_t> pattern_hits;
+        int32_t network_ranges;                 // Index in network_ranges, -1 if no CIDR patterns
+        std::vector<uint16_t> network_substrings;   // Patterns matched as substrings by network rules
+    };
+    std::vector<RuleProfile> profiles;
+    std::vector<CidrTree> network_ranges;       // CIDR patterns of network rules, one tree per rule
+
+    // Rule index, rebuilt when rules change. Enabled rules are bucketed by type, and the
+    // patterns of all content and registry rules share one case-folded automaton
+    struct PatternRef {
+        uint16_t rule;
+        uint16_t pattern;
+    };
+    std::vector<uint16_t> rules_by_type[RULE_TYPE_COUNT];
+    std::vector<uint16_t> artifact_rules;       // File, content and registry rules, in rule order
+    MultiPatternMatcher content_automaton;
+    std::vector<PatternRef> pattern_refs;       // Automaton pattern id -> (rule, pattern)
+    std::vector<uint32_t> pattern_base;         // First slot of each rule in pattern_seen
+    bool index_dirty;
+
+    // Regex patterns ("/body/flags") are compiled once per distinct pattern and run beside
+    // the automaton, one streaming cursor per expression
+    struct RegexRef {
+        RegexMatcher* regex;
+        std::vector<PatternRef> owners;
+    };
+    std::map<String, RegexMatcher> regex_cache;
+    std::vector<RegexRef> regex_refs;
+    std::vector<RegexMatcher::Cursor> regex_cursors;
+
+    // Timeline rules are evaluated together, one pass over the events per matcher. Event
+    // fields are fed to the automaton one after another, so no event text is built or folded
+    struct EventMatcher {
+        MultiPatternMatcher automaton;
+        std::vector<PatternRef> refs;           // Automaton pattern id -> (rule, pattern)
+        std::vector<RegexRef> regexes;
+        size_t slots;                           // Patterns matched by this matcher
+        std::vector<bool> seen;                 // Per pattern slot, set by evaluateEventRules
+    };
+    EventMatcher behavior_events;               // "description target" of every event
+    EventMatcher process_events;                // "target description details" of process events
+
+    // Sigma rules run against every timeline event through their own field indexes
+    SigmaRuleSet sigma_rules;
+    std::vector<uint16_t> sigma_rule_index;     // Sigma rule -> index in `rules`, NO_RULE if rejected
+
+    // Alert store. alert_index maps (rule id, source) of stored alerts to alert + 1 by open
+    // addressing (power of two, 0 = empty), and rolled_up_keys holds the 64-bit hashes of the
+    // keys rolled up instead (0 = empty), so each finding is counted once. Alerts below
+    // THREAT_HIGH are queued per severity, oldest first; an evicted one stays in `alerts`,
+    // marked in alert_evicted, until compactAlerts drops it
+    static const uint16_t NO_RULE = 0xFFFF;
+    std::map<String, uint16_t> rule_ids;        // Rule id -> index in `rules`
+    std::vector<uint16_t> alerts_kept;          // Per rule: stored alerts below THREAT_HIGH
+    std::vector<uint64_t> alert_hashes;         // Parallel to `alerts`
+    std::vector<bool> alert_evicted;            // Parallel to `alerts`
+    std::vector<uint32_t> alert_index;
+    std::vector<uint64_t> rolled_up_keys;
+    size_t rolled_up_count;
+    std::deque<uint32_t> eviction_queues[THREAT_HIGH];  // Per severity: positions in `alerts`
+    uint32_t evicted_alerts;                    // Marked in alert_evicted, not yet dropped
+    std::map<String, AlertRollup> rollups;
+    uint32_t alerts_by_severity[THREAT_CRITICAL + 1];
+    uint32_t suppressed_alerts;
+
+    // Content scan state, reused from artifact to artifact
+    std::vector<uint16_t> content_required;     // Distinct patterns needed per rule (0 = not scanned)
+    std::vector<uint16_t> content_hits;
+    std::vector<uint32_t> content_candidates;
+    std::vector<bool> pattern_seen;
+    size_t content_pending;                     // Rules still undecided
+    std::vector<uint8_t> scan_buffer;
+    String fold_buffer;
+    std::vector<String> fold_patterns;
+    CidrTree network_scratch;                   // Rules not held by the detector
+    std::vector<uint16_t> network_scratch_substrings;
 
     // Built-in threat rules
     void initializeDefaultRules();
@@ -195,12 +320,57 @@ private:
     ThreatRule createSuspiciousScheduledTaskRule();
     ThreatRule createSuspiciousNetworkConnectionRule();
 
+    // Compiled rule image conversion (scripts/compile_rules.py)
+    ThreatSeverity parseSeverityName(const String& name) const;
+    MITRETactic parseCategoryTactic(const String& category) const;
+
+    // Rule index and the shared content scan
+    void buildRuleIndex();
+    void beginContentScan(bool is_registry);
+    uint32_t scanContentBlock(const uint8_t* data, size_t len, uint32_t state);
+    bool contentMatched(size_t rule_index) const;
+    void finishContentScan(uint64_t bytes, uint32_t time_us);
+    bool addRegexRef(std::vector<RegexRef>& refs, const PatternRef& ref);
+    void markRegexMatch(size_t regex_index);
+    bool regexPending(size_t regex_index) const;
+    bool raiseArtifactAlerts(const String& source, bool is_registry);
+    const String& foldText(const String& text);
+    const std::vector<String>& foldedPatterns(const ThreatRule& rule);
+    static bool splitNetworkPatterns(const ThreatRule& rule, CidrTree& ranges, std::vector<uint16_t>& substrings);
+
+    // Timeline rules
+    void addEventPatterns(EventMatcher& matcher, uint16_t rule_index);
+    void evaluateEventRules();
+    size_t scanEvent(EventMatcher& matcher, const TimelineStore& events, uint32_t index,
+                     const TimelineField* fields, size_t field_count);
+    uint16_t eventPatternsSeen(const EventMatcher& matcher, size_t rule_index) const;
+    bool compositeMatched(size_t rule_index, const std::vector<IOC>& iocs);
+    void evaluateSigmaRules();
+
     // Pattern matching helpers
+    uint16_t requiredContentMatches(const ThreatRule& rule) const;
     bool containsPattern(const String& content, const String& pattern);
+    bool patternMatches(const String& content_lower, const String& pattern);
+    static bool isRegexPattern(const String& pattern);
+    RegexMatcher* getRegex(const String& pattern);
     bool matchesRegex(const String& content, const String& regex);
     std::vector<String> extractMatches(const String& content, const String& pattern);
 
     // Alert generation
+    void raiseAlert(uint16_t rule_index, const String& source,
+                    const String& matched_content, uint8_t confidence);
+    bool admitAlert(ThreatSeverity severity, uint16_t rule_index);
+    bool evictAlert(ThreatSeverity below);
+    void compactAlerts();
+    void storeAlert(const ThreatAlert& alert, uint64_t hash, uint16_t rule_index);
+    void rollUpAlert(uint64_t hash, const String& rule_id, const String& rule_name,
+                     ThreatSeverity severity, const String& source, unsigned long timestamp);
+    int32_t findAlert(uint64_t hash, const String& rule_id, const String& source) const;
+    bool wasRolledUp(uint64_t hash) const;
+    void indexAlert(size_t position);
+    void rebuildAlertIndex();
+    static uint64_t hashAlertKey(const String& rule_id, const String& source);
+    static void insertRolledUpKey(std::vector<uint64_t>& table, uint64_t hash);
     ThreatAlert createAlert(const ThreatRule& rule, const String& source,
                            const String& matched_content, uint8_t confidence);
     String generateAlertId();
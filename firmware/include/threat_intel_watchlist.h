@@ -0,0 +1,117 @@
+#ifndef THREAT_INTEL_WATCHLIST_H
+#define THREAT_INTEL_WATCHLIST_H
+
+#include <Arduino.h>
+#include "storage.h"
+
+/**
+ * @brief Threat-intel watchlist file format
+ *
+ * Built on a Linux host by scripts/build_watchlist.py from a CSV or STIX 2.1
+ * feed. Entries are keyed by a 64-bit FNV-1a hash of their type and
+ * normalized value, sorted by key and packed into fixed-size blocks. Only the
+ * header, the Bloom filter and the sparse index (first key of every block)
+ * are loaded into RAM; the blocks stay on the SD card.
+ *
+ * Layout (little-endian):
+ *   WatchlistHeader | Bloom filter bits | index (block_count uint64) |
+ *   padding | blocks (each block_size bytes, starting at blocks_offset)
+ *
+ * Block:  WatchlistBlockHeader | records, sorted by key
+ * Record: key (uint64) | type | severity | value_len | label_len | value | label
+ *
+ * Types use the IOCType numbering. Values are ASCII-lowercased before hashing
+ * and stored lowercased, so matching is case-insensitive.
+ */
+
+#define WATCHLIST_MAGIC          0x4C575246UL   // "FRWL"
+#define WATCHLIST_VERSION        1
+#define WATCHLIST_RECORD_HEADER  12
+
+struct WatchlistHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t header_size;
+    uint32_t block_size;
+    uint32_t block_count;
+    uint32_t entry_count;
+    uint32_t bloom_bits;          // Multiple of 64
+    uint32_t bloom_hashes;
+    uint32_t bloom_offset;
+    uint32_t index_offset;
+    uint32_t blocks_offset;
+    uint32_t checksum;            // CRC-32 of the Bloom filter and the index
+    uint32_t created;             // Unix time of the import
+};
+
+struct WatchlistBlockHeader {
+    uint16_t record_count;
+    uint16_t used;                // Bytes of records after this header
+    uint32_t checksum;            // CRC-32 of those bytes
+};
+
+/**
+ * @brief A watchlist entry matched by an extracted indicator
+ */
+struct WatchlistHit {
+    uint8_t type;
+    uint8_t severity;             // 0-100, from the feed
+    String value;
+    String label;                 // Feed-provided name or description
+};
+
+/**
+ * @brief Lookup counters
+ */
+struct WatchlistStats {
+    uint32_t lookups;
+    uint32_t bloom_rejects;       // Answered from RAM
+    uint32_t block_reads;         // SD reads
+    uint32_t hits;
+};
+
+/**
+ * @brief Membership tests against a large on-card threat-intel watchlist
+ *
+ * A lookup first asks the Bloom filter; most misses end there. Otherwise the
+ * sparse index names the single block that can hold the key, which is read
+ * (or reused from the one-block cache), checked and searched. A positive
+ * therefore costs at most one SD block read.
+ */
+class ThreatIntelWatchlist {
+public:
+    ThreatIntelWatchlist();
+    ~ThreatIntelWatchlist();
+
+    bool load(FRFDStorage* storage, const String& path);
+    void unload();
+    bool isLoaded() const { return bloom != nullptr; }
+
+    bool lookup(uint8_t type, const char* value, size_t length, WatchlistHit* hit = nullptr);
+    bool lookup(uint8_t type, const String& value, WatchlistHit* hit = nullptr) {
+        return lookup(type, value.c_str(), value.length(), hit);
+    }
+
+    uint32_t getEntryCount() const { return isLoaded() ? header.entry_count : 0; }
+    size_t getMemoryUsage() const;
+    WatchlistStats getStats() const { return stats; }
+    void resetStats();
+
+    // Key of a (type, value) pair, as computed by the importer
+    static uint64_t makeKey(uint8_t type, const char* value, size_t length);
+
+private:
+    WatchlistHeader header;
+    File file;
+    uint8_t* bloom;
+    uint64_t* index;
+    uint8_t* block;
+    int32_t cached_block;
+    WatchlistStats stats;
+
+    bool mayContain(uint64_t key) const;
+    int32_t findBlock(uint64_t key) const;
+    bool readBlock(int32_t number);
+};
+
+#endif // THREAT_INTEL_WATCHLIST_H
@@ -0,0 +1,248 @@
+#ifndef TIMELINE_FILE_H
+#define TIMELINE_FILE_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include <map>
+#include <vector>
+#include "timeline_store.h"
+#include "storage.h"
+
+/**
+ * @brief Persistent timeline file format
+ *
+ * Keeps a case's timeline on SD between analysis runs. The file is only ever
+ * appended to, in blocks of block_size bytes (a block holding one very long
+ * event spans several). An event changed after it was written (a duplicate
+ * merged into it) is superseded by an update record rather than rewritten.
+ * Reopening reads the header, the trailer and the index, nothing else; a
+ * time-window query reads only the event blocks whose time range overlaps
+ * the window. scripts/read_timeline.py reads the same format on a Linux host.
+ *
+ * Layout (little-endian):
+ *   TimelineFileHeader, padded to block_size |
+ *   blocks ... | index block | blocks ... | index block
+ *
+ * Every block starts with a TimelineBlockHeader and is padded to a multiple
+ * of block_size. Each save appends the new event and update blocks and then,
+ * if it wrote any, a fresh index block listing every block so far (a save
+ * with nothing new writes nothing); the last 16 bytes of an
+ * index block's padding are a TimelineFileTrailer, so a cleanly saved file
+ * ends with one. Earlier index blocks are left in place and ignored. A file
+ * without a valid trailer is recovered by walking the blocks from the start.
+ *
+ * Event block: TimelineBlockHeader | records | string table
+ * Record:      timestamp (int64) | type | significance | reserved (uint16) |
+ *              datetime, description, source_artifact, actor, target,
+ *              details (uint32 each: offset of the string in the table)
+ * String:      length (uint32) | bytes
+ *
+ * Each block carries its own string table, right after its records, so a
+ * block decodes on its own. Offset 0 of a table is always the empty string;
+ * other strings repeated within a block are stored once.
+ *
+ * Update block: TimelineBlockHeader | event number (uint32) per record |
+ *               records | string table
+ *
+ * Events are numbered in file order from 0. An update record replaces the
+ * event with its number, whole; of several updates to one event the last
+ * written wins. An update keeps the event's timestamp, so its block's time
+ * range is that of the events it replaces.
+ *
+ * Index block: TimelineIndexHeader | TimelineIndexEntry per event block |
+ *              TimelineIndexEntry per update block | padding |
+ *              TimelineFileTrailer
+ */
+
+#define TIMELINE_FILE_MAGIC         0x4C545246UL    // "FRTL"
+#define TIMELINE_FILE_TRAILER_MAGIC 0x49545246UL    // "FRTI"
+#define TIMELINE_FILE_VERSION       2               // 1 had no update blocks, and is still read
+#define TIMELINE_FILE_BLOCK_SIZE    4096
+#define TIMELINE_FILE_RECORD_SIZE   36
+#define TIMELINE_FILE_NAME          "timeline.frtl" // Default file in the case directory
+
+enum TimelineBlockKind : uint8_t {
+    TIMELINE_BLOCK_EVENTS = 1,
+    TIMELINE_BLOCK_INDEX = 2,
+    TIMELINE_BLOCK_UPDATES = 3
+};
+
+struct TimelineFileHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t header_size;
+    uint32_t block_size;
+    uint32_t created;             // Unix time the file was started
+};
+
+struct TimelineBlockHeader {
+    uint8_t kind;                 // TimelineBlockKind
+    uint8_t reserved[3];
+    uint32_t record_count;        // Events, updates, or index entries
+    uint32_t used;                // Bytes after this header
+    uint32_t checksum;            // CRC-32 of those bytes
+    int64_t first_time;           // Earliest event timestamp in the block
+    int64_t last_time;            // Latest
+};
+
+struct TimelineIndexHeader {
+    uint32_t event_count;         // In all event blocks
+    uint32_t update_blocks;       // Entries after the event blocks'; always 0 in version 1
+};
+
+struct TimelineIndexEntry {
+    uint32_t offset;              // Of the block's header
+    uint32_t event_count;         // Or update count
+    int64_t first_time;
+    int64_t last_time;
+};
+
+struct TimelineFileTrailer {
+    uint32_t magic;
+    uint32_t index_offset;        // Of the last index block's header
+    uint32_t event_count;
+    uint32_t checksum;            // CRC-32 of the fields above
+};
+
+/**
+ * @brief Appends events to a timeline file
+ *
+ * Events are packed into one block buffer and updates into another, each
+ * flushed as its block fills; the index and trailer are written by save().
+ * Opening an existing file reads its index (see TimelineFileReader) and
+ * carries on after its last block.
+ */
+class TimelineFileWriter {
+public:
+    TimelineFileWriter();
+    ~TimelineFileWriter();
+    TimelineFileWriter(const TimelineFileWriter&) = delete;
+    TimelineFileWriter& operator=(const TimelineFileWriter&) = delete;
+
+    bool open(FRFDStorage& storage, const String& path);   // Creates the file, or appends to it
+    bool append(const TimelineStore& store, uint32_t index);    // As event number getEventCount()
+    bool update(const TimelineStore& store, uint32_t index, uint32_t event);    // Supersedes event number `event`
+    bool save();                    // Flush the open block, then the index and the trailer
+    void close();                   // Saves first
+    bool isOpen() const { return (bool)file; }
+
+    const String& getPath() const { return path; }
+    uint32_t getEventCount() const { return event_count; }
+    uint32_t getBlockCount() const { return blocks.size(); }
+    uint32_t getUpdateCount() const { return update_count; }
+
+private:
+    // A block being filled: records, and its string table separately
+    struct BlockBuffer {
+        std::vector<uint8_t> numbers;           // Update blocks: the event number of each record
+        std::vector<uint8_t> records;
+        std::vector<uint8_t> strings;
+        std::vector<uint32_t> string_slots;     // Offsets in `strings` by content hash, for reuse within the block
+        uint32_t string_count;
+        int64_t first_time;
+        int64_t last_time;
+
+        void reset();
+        uint32_t addString(const char* text, uint32_t length);
+    };
+
+    File file;
+    String path;
+    uint32_t block_size;
+    uint32_t end_offset;                    // Where the next block goes: the file size, block-aligned
+    std::vector<TimelineIndexEntry> blocks;
+    std::vector<TimelineIndexEntry> update_blocks;
+    uint32_t event_count;                   // Written and buffered
+    uint32_t update_count;                  // Written and buffered
+    bool index_stale;                       // Blocks written since the last index, or none yet
+    bool failed;
+    BlockBuffer events;
+    BlockBuffer updates;
+
+    bool addRecord(BlockBuffer& buffer, TimelineBlockKind kind, const TimelineStore& store, uint32_t index);
+    bool flushBlock(BlockBuffer& buffer, TimelineBlockKind kind);
+    bool writeBlock(TimelineBlockKind kind, uint32_t record_count, int64_t first_time, int64_t last_time,
+                    const uint8_t* head, uint32_t head_bytes, const uint8_t* tail, uint32_t tail_bytes);
+    void writePadding(uint32_t bytes);
+};
+
+/**
+ * @brief Reads a timeline file by time window
+ *
+ * open() keeps only the index in RAM. A query first reads the update blocks
+ * whose time range overlaps the window and keeps their events. It then walks
+ * the index, reads each event block whose time range overlaps the window,
+ * checks its CRC and decodes the events inside the window, in file order,
+ * an updated event in its latest version.
+ */
+class TimelineFileReader {
+public:
+    TimelineFileReader();
+    ~TimelineFileReader();
+    TimelineFileReader(const TimelineFileReader&) = delete;
+    TimelineFileReader& operator=(const TimelineFileReader&) = delete;
+
+    bool open(File opened);
+    void close();
+    bool isOpen() const { return (bool)file; }
+
+    // Calls emit(const TimelineEvent&, uint32_t number) for each event with start <= timestamp <= end
+    template <typename Emit>
+    uint32_t query(int64_t start, int64_t end, Emit emit) {
+        loadUpdates(start, end);
+        uint32_t matched = 0;
+        uint32_t number = 0;
+        TimelineEvent event;
+        for (uint32_t b = 0; b < blocks.size(); b++) {
+            uint32_t first = number;
+            number += blocks[b].event_count;
+            if (blocks[b].last_time < start || blocks[b].first_time > end) continue;
+            if (!loadBlock(blocks[b], TIMELINE_BLOCK_EVENTS)) continue;
+            for (uint32_t r = 0; r < block_records; r++) {
+                if (!decodeEvent(r, start, end, event)) continue;
+                auto update = updates.find(first + r);
+                const TimelineEvent& latest = update != updates.end() ? update->second : event;
+                emit(latest, first + r);
+                matched++;
+            }
+        }
+        std::map<uint32_t, TimelineEvent>().swap(updates);
+        return matched;
+    }
+
+    uint32_t getBlockSize() const { return header.block_size; }
+    uint32_t getEventCount() const { return event_count; }
+    const std::vector<TimelineIndexEntry>& getBlocks() const { return blocks; }
+    const std::vector<TimelineIndexEntry>& getUpdateBlocks() const { return update_blocks; }
+    uint32_t getEndOffset() const { return end_offset; }   // After the last valid block
+    bool wasRecovered() const { return recovered; }         // No valid trailer: the blocks were walked
+    uint32_t getBlocksRead() const { return blocks_read; }
+    uint32_t getBadBlocks() const { return bad_blocks; }
+
+private:
+    File file;
+    TimelineFileHeader header;
+    std::vector<TimelineIndexEntry> blocks;
+    std::vector<TimelineIndexEntry> update_blocks;
+    uint32_t event_count;
+    uint32_t end_offset;
+    bool recovered;
+
+    std::vector<uint8_t> block;             // Payload of the loaded block
+    uint32_t loaded_offset;                 // Its offset, 0 for none
+    uint32_t block_records;
+    uint32_t records_at;                    // Where its records start: after the event numbers of an update block
+    uint32_t blocks_read;
+    uint32_t bad_blocks;
+    std::map<uint32_t, TimelineEvent> updates;     // Latest update by event number, during a query
+
+    bool readAt(uint32_t offset, void* data, size_t length);
+    bool readIndex(uint32_t offset);
+    bool scanBlocks();
+    bool loadBlock(const TimelineIndexEntry& entry, TimelineBlockKind kind);
+    void loadUpdates(int64_t start, int64_t end);
+    bool decodeEvent(uint32_t record, int64_t start, int64_t end, TimelineEvent& event) const;
+    bool readString(uint32_t offset, String& value) const;
+};
+
+#endif // TIMELINE_FILE_H
@@ -5,62 +5,83 @@
 #include <vector>
 #include <map>
 #include "storage.h"
+#include "timestamp_parser.h"
+#include "timeline_store.h"
+#include "timeline_index.h"
+#include "timeline_file.h"
+#include "csv_reader.h"
+#include "hyperloglog.h"
+
+#define TIMELINE_SORT_MEMORY_BUDGET (2 * 1024 * 1024)   // Default bytes of buffered events before a run is spilled
+#define TIMELINE_SORT_IO_BUFFER     (16 * 1024)         // Read buffer per run file, and the write buffer
+#define TIMELINE_SORT_MIN_BUDGET    (4 * TIMELINE_POOL_BLOCK_SIZE)  // Floor: an empty store already holds a pool block
+#define TIMELINE_SORT_MAX_FANIN     12                  // Runs merged at once; each holds an open file
+#define TIMELINE_SORT_DIR           "timeline_sort"     // Run directory under the case directory
+#define TIMELINE_SORT_DEDUP_WINDOW  256                 // Events of one timestamp held back to merge duplicates across runs
+
+#define TIMELINE_SNIFF_BYTES        1024                // Head of a file read to recognise its format
+#define TIMELINE_PARSE_MAX_WORKERS  8                   // Parser threads for a directory, at most
+#define TIMELINE_PARSE_BATCH_EVENTS 2048                // Events a parser thread hands over at a time
+#define TIMELINE_PARSE_QUEUE_DEPTH  2                   // Batches per parser thread: one filling, the rest waiting
+#define TIMELINE_PARSE_STACK_SIZE   (12 * 1024)         // Parser thread stack on the ESP32
 
 /**
- * @brief Timeline Event Types
+ * @brief Artifact formats the timeline parsers understand
  */
-enum TimelineEventType {
-    EVENT_FILE_CREATED,
-    EVENT_FILE_MODIFIED,
-    EVENT_FILE_ACCESSED,
-    EVENT_FILE_DELETED,
-    EVENT_REGISTRY_CREATED,
-    EVENT_REGISTRY_MODIFIED,
-    EVENT_REGISTRY_DELETED,
-    EVENT_PROCESS_STARTED,
-    EVENT_PROCESS_TERMINATED,
-    EVENT_NETWORK_CONNECTION,
-    EVENT_LOGIN_SUCCESS,
-    EVENT_LOGIN_FAILURE,
-    EVENT_SERVICE_STARTED,
-    EVENT_SERVICE_STOPPED,
-    EVENT_SCHEDULED_TASK,
-    EVENT_BROWSER_NAVIGATION,
-    EVENT_EMAIL_SENT,
-    EVENT_EMAIL_RECEIVED,
-    EVENT_USB_CONNECTED,
-    EVENT_USB_DISCONNECTED,
-    EVENT_SYSTEM_BOOT,
-    EVENT_SYSTEM_SHUTDOWN,
-    EVENT_UNKNOWN
+enum TimelineArtifactFormat : uint8_t {
+    ARTIFACT_MFT,
+    ARTIFACT_USN_JOURNAL,
+    ARTIFACT_PREFETCH,
+    ARTIFACT_EVENT_LOG,
+    ARTIFACT_REGISTRY,
+    ARTIFACT_BROWSER_HISTORY,
+    ARTIFACT_NETWORK,
+    ARTIFACT_AUTH_LOG,
+    ARTIFACT_PROCESS_LIST,
+    ARTIFACT_SHIMCACHE,
+    ARTIFACT_AMCACHE,
+    ARTIFACT_JUMPLIST,
+    ARTIFACT_UNKNOWN
 };
 
 /**
- * @brief Timeline Event
+ * @brief Where an artifact parser puts its events
+ *
+ * The generator itself when a file is parsed in place, or a batch when it is
+ * parsed on a worker thread. Each sink parses timestamps with its own
+ * TimestampParser, so parsers running side by side share no state.
  */
-struct TimelineEvent {
-    unsigned long timestamp;      // Unix timestamp or millis since boot
-    String datetime;              // Human-readable datetime (ISO 8601)
-    TimelineEventType type;
-    String description;           // Event description
-    String source_artifact;       // Which artifact this came from
-    String actor;                 // User/process that caused event
-    String target;                // Target file/registry key/etc.
-    String details;               // Additional details (JSON or text)
-    uint8_t significance;         // 1-10 (1=low, 10=critical)
+class TimelineEventSink {
+public:
+    explicit TimelineEventSink(TimestampParser& timestamps) : timestamps(timestamps) {}
+    virtual ~TimelineEventSink() {}
+
+    virtual void add(const TimelineEvent& event) = 0;
+    int64_t parseTimestamp(const CSVField& field) {     // 0 when not a recognised timestamp
+        int64_t micros;
+        return timestamps.parse(field.data, field.length, micros) ? micros : 0;
+    }
+
+private:
+    TimestampParser& timestamps;
 };
 
 /**
  * @brief Timeline Statistics
+ *
+ * Cover every event added since the timeline was last cleared, spilled ones
+ * included. The distinct actor and target counts are HyperLogLog estimates
+ * with a standard error of about 1.6%; sources are few and counted exactly.
  */
 struct TimelineStatistics {
     uint32_t total_events;
     uint32_t unique_actors;
     uint32_t unique_targets;
-    unsigned long earliest_timestamp;
-    unsigned long latest_timestamp;
-    std::map<TimelineEventType, uint16_t> events_by_type;
-    std::map<String, uint16_t> events_by_source;
+    uint32_t unique_sources;
+    int64_t earliest_timestamp;
+    int64_t latest_timestamp;
+    uint32_t events_by_type[EVENT_UNKNOWN + 1];
+    std::map<String, uint32_t> events_by_source;    // Events each source reported, duplicates merged from it included
 };
 
 /**
@@ -79,41 +100,109 @@ public:
 
     // Timeline Building
     bool buildTimelineFromFile(const String& file_path);
-    bool buildTimelineFromDirectory(const String& dir_path);
+    bool buildTimelineFromDirectory(const String& dir_path);   // Files parsed in parallel, added in list order
     bool buildTimelineFromAllArtifacts();
+    void setParseWorkers(uint8_t workers) { parse_workers = workers; }    // 0: one per core; 1: no threads
+
+    /**
+     * @brief Artifact format detection
+     *
+     * A format is recognised from the head of the file: the columns of its
+     * header row weigh most, then text only that format contains. The file
+     * name weighs least: it decides only when the content says nothing, or
+     * ties. A CSV file nothing recognises is read as a generic event log.
+     */
+    static TimelineArtifactFormat detectArtifactFormat(const char* head, size_t length, const String& file_name);
+    static const char* getArtifactFormatName(TimelineArtifactFormat format);
 
-    // Artifact Parsers
-    std::vector<TimelineEvent> parseMFTTimeline(const String& content, const String& source);
-    std::vector<TimelineEvent> parseUSNJournal(const String& content, const String& source);
-    std::vector<TimelineEvent> parsePrefetchTimeline(const String& content, const String& source);
-    std::vector<TimelineEvent> parseEventLogTimeline(const String& content, const String& source);
-    std::vector<TimelineEvent> parseRegistryTimeline(const String& content, const String& source);
-    std::vector<TimelineEvent> parseBrowserHistory(const String& content, const String& source);
-    std::vector<TimelineEvent> parseNetworkConnections(const String& content, const String& source);
-    std::vector<TimelineEvent> parseAuthLogs(const String& content, const String& source);
-    std::vector<TimelineEvent> parseProcessList(const String& content, const String& source);
-    std::vector<TimelineEvent> parseShimCache(const String& content, const String& source);
-    std::vector<TimelineEvent> parseAmCache(const String& content, const String& source);
-    std::vector<TimelineEvent> parseJumpLists(const String& content, const String& source);
+    // Recognises and parses one file into the sink; returns the events added
+    static uint32_t parseArtifactFile(FRFDStorage& storage, const String& file_path, TimelineEventSink& sink);
+    static uint32_t parseArtifact(TimelineArtifactFormat format, CSVReader& reader, const String& source,
+                                  TimelineEventSink& sink);
+
+    // Artifact Parsers: each reads its rows from the reader, adds the events to the sink and returns how many
+    static uint32_t parseMFTTimeline(CSVReader& reader, const String& source, TimelineEventSink& sink);
+    static uint32_t parseUSNJournal(CSVReader& reader, const String& source, TimelineEventSink& sink);
+    static uint32_t parsePrefetchTimeline(CSVReader& reader, const String& source, TimelineEventSink& sink);
+    static uint32_t parseEventLogTimeline(CSVReader& reader, const String& source, TimelineEventSink& sink);
+    static uint32_t parseRegistryTimeline(CSVReader& reader, const String& source, TimelineEventSink& sink);
+    static uint32_t parseBrowserHistory(CSVReader& reader, const String& source, TimelineEventSink& sink);
+    static uint32_t parseNetworkConnections(CSVReader& reader, const String& source, TimelineEventSink& sink);
+    static uint32_t parseAuthLogs(CSVReader& reader, const String& source, TimelineEventSink& sink);
+    static uint32_t parseProcessList(CSVReader& reader, const String& source, TimelineEventSink& sink);
+    static uint32_t parseShimCache(CSVReader& reader, const String& source, TimelineEventSink& sink);
+    static uint32_t parseAmCache(CSVReader& reader, const String& source, TimelineEventSink& sink);
+    static uint32_t parseJumpLists(CSVReader& reader, const String& source, TimelineEventSink& sink);
 
     // Event Management
-    void addEvent(const TimelineEvent& event);
+    void addEvent(const TimelineEvent& event);      // Merged into an identical earlier event, if any
     void clearTimeline();
-    std::vector<TimelineEvent> getEvents() const { return events; }
-    std::vector<TimelineEvent> getEventsByType(TimelineEventType type) const;
-    std::vector<TimelineEvent> getEventsByTimeRange(unsigned long start, unsigned long end) const;
-    std::vector<TimelineEvent> getEventsByActor(const String& actor) const;
-    std::vector<TimelineEvent> getEventsByTarget(const String& target) const;
+    void setDeduplication(bool enabled) { deduplicate = enabled; }
+    uint32_t getDuplicateCount() const { return duplicates_merged; }
+    const TimelineStore& getStore() const { return store; }
+    TimelineEvent getEvent(uint32_t index) const { return store.getEvent(index); }
+
+    // Queries return spans of positions in getStore(), valid until the timeline next changes
+    TimelineSpan getEventsByType(TimelineEventType type) const { return index.byType(type); }      // Timeline order
+    TimelineSpan getEventsByTimeRange(int64_t start, int64_t end) const { return index.byTimeRange(start, end); }  // Time order
+    TimelineSpan getEventsByActor(const String& actor) const;         // Timeline order
+    TimelineSpan getEventsByTarget(const String& target) const;       // Timeline order
+    const TimelineIndex& getIndex() const { return index; }           // Also looks up actors and targets by pool id
 
     // Sorting
     void sortByTimestamp();
     void sortBySignificance();
     void sortByType();
 
+    /**
+     * @brief External sort for timelines larger than RAM
+     *
+     * While active, addEvent() keeps events in memory only up to the sort memory
+     * budget; beyond it the buffered events are sorted by timestamp and written
+     * to SD as a run. saveSortedToFile() merges the runs and the events still in
+     * memory with a k-way heap and streams the result to the export file, so the
+     * whole timeline is never in memory. getStore() and the queries only see
+     * the events not yet spilled. With deduplication on, copies of an event
+     * spilled in different runs are merged when the runs are; the statistics
+     * count each copy until then.
+     *
+     * @param run_dir Directory for the run files, by default TIMELINE_SORT_DIR in the case directory
+     */
+    bool beginExternalSort(const String& run_dir = "");
+    void endExternalSort();         // Drops the spilled events and deletes their runs; buffered events stay
+    void setSortMemoryBudget(size_t bytes) { sort_memory_budget = bytes > TIMELINE_SORT_MIN_BUDGET ? bytes : TIMELINE_SORT_MIN_BUDGET; }
+    size_t getSortMemoryBudget() const { return sort_memory_budget; }
+    bool isExternalSortActive() const { return !sort_run_dir.isEmpty(); }
+    uint32_t getSpilledRunCount() const { return sort_runs.size(); }
+    uint32_t getSpilledEventCount() const { return spilled_events; }
+
+    /**
+     * @brief Persistent timeline file (see timeline_file.h)
+     *
+     * While a file is open, saveTimelineFile() appends the events added since
+     * the previous save, and an update record for each written event a
+     * duplicate has since been merged into, then a new index if there were
+     * any. Both are also written before a sort or a spill renumbers the
+     * events, so none are missed; clearTimeline() drops the ones not written
+     * yet.
+     *
+     * Opening an existing file matches the events in memory against its
+     * events first: only the ones it lacks are appended. Events added later
+     * are deduplicated against memory only, so to merge new artifacts into a
+     * file from an earlier run, load it with loadTimelineFile() first.
+     *
+     * @param path Timeline file, by default TIMELINE_FILE_NAME in the case directory; an existing one is appended to
+     */
+    bool openTimelineFile(const String& path = "");
+    bool saveTimelineFile();
+    void closeTimelineFile();       // Saves first
+    bool isTimelineFileOpen() const { return timeline_file.isOpen(); }
+    uint32_t loadTimelineFile(const String& path, int64_t start = INT64_MIN, int64_t end = INT64_MAX);   // Adds the events of a time window
+
     // Filtering
     void filterByEventType(TimelineEventType type);
     void filterBySignificance(uint8_t min_significance);
-    void filterByTimeRange(unsigned long start, unsigned long end);
+    void filterByTimeRange(int64_t start, int64_t end);
 
     // Export Methods
     String exportToJSON();
@@ -121,40 +210,113 @@ public:
     String exportToHTML();
     String exportToBodyFile(); // Sleuth Kit body file format
     bool saveToFile(const String& filename, const String& format);
+    bool saveSortedToFile(const String& filename, const String& format);   // All events, spilled or not, by timestamp
 
-    // Statistics
-    TimelineStatistics getStatistics() const;
-    uint32_t getEventCount() const { return events.size(); }
+    // Statistics, kept up to date as events are added
+    const TimelineStatistics& getStatistics() const { return statistics; }
+    uint32_t getEventCount() const { return store.size(); }
 
     // Utility
-    String getEventTypeName(TimelineEventType type) const;
+    static String getEventTypeName(TimelineEventType type);
     TimelineEventType detectEventType(const String& description);
-    unsigned long parseTimestamp(const String& timestamp_str);
-    String formatTimestamp(unsigned long timestamp);
+    int64_t parseTimestamp(const String& timestamp_str);           // 0 when not a recognised timestamp
+    int64_t parseTimestamp(const CSVField& field);
+    static String formatTimestamp(int64_t timestamp);              // ISO 8601, UTC
+    static int64_t currentTimestamp();                             // Wall clock if set, else uptime
+    TimestampParser& getTimestampParser() { return timestamp_parser; }
 
 private:
     FRFDStorage* storage;
-    std::vector<TimelineEvent> events;
+    TimelineStore store;
+    TimelineIndex index;            // Kept in step with `store`
+    bool deduplicate;
+    uint32_t duplicates_merged;
+    uint8_t parse_workers;
+
+    // Sink for parsing a file in place, straight into the timeline
+    class DirectSink : public TimelineEventSink {
+    public:
+        explicit DirectSink(TimelineGenerator& generator)
+            : TimelineEventSink(generator.timestamp_parser), generator(generator) {}
+        void add(const TimelineEvent& event) override { generator.addEvent(event); }
+
+    private:
+        TimelineGenerator& generator;
+    };
+
+    void mergeDuplicate(uint32_t position, const TimelineEvent& event);
+
+    // Statistics state
+    TimelineStatistics statistics;
+    HyperLogLog actor_sketch;
+    HyperLogLog target_sketch;
+    String counted_source;              // Source of the last event counted, and its counter
+    uint32_t* counted_source_events;
+
+    void countEvent(uint32_t position);
+    void countSource(const char* source, size_t length);
+    void resetStatistics();
+    void recountStatistics();           // From the events in memory
+
+    // Timeline file state
+    TimelineFileWriter timeline_file;
+    uint32_t file_persisted;        // Events of `store` before this position are in the file
+    std::vector<uint32_t> file_numbers;     // While a file is open: event number in the file by position, FILE_UPDATE_PENDING set when stale
+    std::vector<uint32_t> file_updates;     // Positions whose file copy a merge has made stale
+
+    void persistPending();
+    void markFileStale(uint32_t position);
+    uint32_t matchFileEvents(const String& path);
+
+    // Sorting: events are ordered by an integer key, ties kept in insertion order
+    struct SortKey {
+        int64_t key;
+        uint32_t index;         // Position in `store` before the sort
+    };
+    void sortEvents(std::vector<SortKey>& keys);
+
+    // External sort state
+    String sort_run_dir;                // Empty when external sort is off
+    std::vector<String> sort_runs;      // Run files in spill order
+    size_t sort_memory_budget;
+    uint32_t spilled_events;
+    uint32_t next_run_id;
+    bool spill_failed;
+
+    bool spillRun();
+    bool mergeRunFiles(size_t begin, size_t end, String& merged_path);
+    void deleteRuns();
+    String nextRunPath();
+    size_t sortFanIn() const;
+
+    // Export formatting, shared by the String exports and the streaming export
+    enum ExportFormat {
+        EXPORT_JSON,
+        EXPORT_CSV,
+        EXPORT_HTML,
+        EXPORT_BODYFILE,
+        EXPORT_INVALID
+    };
+    static ExportFormat exportFormatFromName(const String& format);
+    static String exportHeader(ExportFormat format);
+    static void appendExportEvent(String& out, const TimelineEvent& event, ExportFormat format, bool first);
+    static String exportFooter(ExportFormat format, uint32_t event_count);    // The count goes last: a merge only knows it at the end
 
     // Helper methods
-    bool isCSVFile(const String& filename);
+    uint32_t parseWorkerCount(size_t files) const;
+    static bool isCSVFile(const String& filename);
     bool isTXTFile(const String& filename);
     bool isJSONFile(const String& filename);
 
-    // Timestamp parsing helpers
-    unsigned long parseISO8601(const String& timestamp);
-    unsigned long parseWindowsFileTime(const String& timestamp);
-    unsigned long parseUnixTimestamp(const String& timestamp);
+    // Timestamp parsing, with the day cache shared by all parsers
+    TimestampParser timestamp_parser;
 
     // CSV parsing helpers
-    std::vector<String> parseCSVLine(const String& line);
     String extractCSVField(const String& line, int field_index);
 
     // Significance calculation
     uint8_t calculateSignificance(const TimelineEvent& event);
 
-    // Deduplication
-    void deduplicateEvents();
 };
 
 #endif // TIMELINE_GENERATOR_H
@@ -0,0 +1,126 @@
+#ifndef TIMELINE_INDEX_H
+#define TIMELINE_INDEX_H
+
+#include <Arduino.h>
+#include <vector>
+#include "timeline_store.h"
+
+/**
+ * @brief Event positions borrowed from a TimelineIndex
+ *
+ * Valid until the timeline next changes: an event is added, or the events
+ * are sorted or cleared.
+ */
+struct TimelineSpan {
+    const uint32_t* ids;
+    uint32_t count;
+
+    const uint32_t* begin() const { return ids; }
+    const uint32_t* end() const { return ids + count; }
+    uint32_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    uint32_t operator[](uint32_t i) const { return ids[i]; }
+};
+
+/**
+ * @brief Query indexes over the events of a TimelineStore
+ *
+ * - By type: one position list per event type.
+ * - By actor and by target: one position list per distinct pool id, found
+ *   through an open-addressing table keyed by the id. The lists lie back to
+ *   back in one postings array with an offset per id (CSR), so a distinct
+ *   actor or target costs one offset, not an allocation. Events with an
+ *   empty actor or target are not listed.
+ * - By time: every position, ordered by timestamp and then position, so a
+ *   range is two binary searches.
+ * - By identity: a 64-bit hash of timestamp, type, target and actor in an
+ *   open-addressing table, to find an earlier copy of an event on insert.
+ *
+ * add() keeps all of them current as events are appended. Positions only
+ * grow, so the type lists stay in timeline order by appending. Entity
+ * positions added since the last actor or target query are held in a
+ * pending list, which the next such query merges into the postings in place.
+ * An event earlier than the last one in the time order is held in an
+ * unsorted tail, which the next time query sorts and merges in; a timeline
+ * parsed mostly in order never needs it. Sorting or clearing the store
+ * renumbers the events: call rebuild() or clear() after it.
+ */
+class TimelineIndex {
+public:
+    static const uint32_t NO_EVENT = 0xFFFFFFFF;
+
+    explicit TimelineIndex(const TimelineStore& store);
+    TimelineIndex(const TimelineIndex&) = delete;
+    TimelineIndex& operator=(const TimelineIndex&) = delete;
+
+    void add(uint32_t index);       // Position just returned by TimelineStore::add()
+    void add(uint32_t index, uint64_t identity);   // Same, identity already computed
+    void rebuild();                 // From every event in the store
+    void clear();
+
+    TimelineSpan byType(TimelineEventType type) const;              // Timeline order
+    TimelineSpan byActor(uint32_t actor_id) const { return actors.find(actor_id); }   // Timeline order
+    TimelineSpan byTarget(uint32_t target_id) const { return targets.find(target_id); }
+    TimelineSpan byTimeRange(int64_t start, int64_t end) const;     // Both ends included; time order
+
+    // Position of an indexed event with the same timestamp, type, target and actor, or NO_EVENT
+    static uint64_t identityOf(const TimelineEvent& event);
+    uint32_t findIdentical(const TimelineEvent& event, uint64_t identity) const;
+
+    size_t getMemoryUsage() const;
+
+private:
+    // Position lists keyed by a pool id; list n is postings[offsets[n], offsets[n + 1])
+    class EntityIndex {
+    public:
+        EntityIndex() { clear(); }
+        void add(uint32_t text_id, uint32_t index);
+        TimelineSpan find(uint32_t text_id) const;
+        void mergePending() const;
+        void clear();
+        size_t getMemoryUsage() const;
+
+    private:
+        static const uint32_t NO_LIST = 0xFFFFFFFF;
+
+        struct Pending {
+            uint32_t list;
+            uint32_t index;
+        };
+
+        std::vector<uint32_t> slots;                // List number per slot; size is a power of two
+        std::vector<uint32_t> text_ids;             // Pool id of each list
+
+        // Merged lazily by the const queries
+        mutable std::vector<uint32_t> offsets;      // Lists merged so far, plus the end
+        mutable std::vector<uint32_t> postings;
+        mutable std::vector<Pending> pending;       // Added since the last merge, in position order
+
+        size_t probe(uint32_t text_id) const;
+        void grow();
+    };
+
+    struct IdentitySlot {
+        uint64_t identity;
+        uint32_t index;             // NO_EVENT = empty
+    };
+
+    const TimelineStore& store;
+    std::vector<uint32_t> types[EVENT_UNKNOWN + 1];
+    EntityIndex actors;
+    EntityIndex targets;
+    std::vector<IdentitySlot> identities;   // Size is a power of two
+    uint32_t identity_count;
+
+    static uint64_t identityOf(int64_t timestamp, uint8_t type, const char* target, uint32_t target_length,
+                               const char* actor, uint32_t actor_length);
+    void addIdentity(uint64_t identity, uint32_t index);
+
+    // Time order, merged lazily by the const queries
+    mutable std::vector<uint32_t> by_time;
+    mutable size_t time_sorted;                     // Leading entries of by_time in order; the rest are pending
+
+    void mergePending() const;
+};
+
+#endif // TIMELINE_INDEX_H
@@ -0,0 +1,189 @@
+#ifndef TIMELINE_STORE_H
+#define TIMELINE_STORE_H
+
+#include <Arduino.h>
+#include <vector>
+#include <string.h>
+
+#define TIMELINE_POOL_BLOCK_SIZE (64 * 1024)    // String pool arena block, at most 64 KB (16-bit offsets); longer strings get their own
+
+/**
+ * @brief Timeline Event Types
+ */
+enum TimelineEventType {
+    EVENT_FILE_CREATED,
+    EVENT_FILE_MODIFIED,
+    EVENT_FILE_ACCESSED,
+    EVENT_FILE_DELETED,
+    EVENT_REGISTRY_CREATED,
+    EVENT_REGISTRY_MODIFIED,
+    EVENT_REGISTRY_DELETED,
+    EVENT_PROCESS_STARTED,
+    EVENT_PROCESS_TERMINATED,
+    EVENT_NETWORK_CONNECTION,
+    EVENT_LOGIN_SUCCESS,
+    EVENT_LOGIN_FAILURE,
+    EVENT_SERVICE_STARTED,
+    EVENT_SERVICE_STOPPED,
+    EVENT_SCHEDULED_TASK,
+    EVENT_BROWSER_NAVIGATION,
+    EVENT_EMAIL_SENT,
+    EVENT_EMAIL_RECEIVED,
+    EVENT_USB_CONNECTED,
+    EVENT_USB_DISCONNECTED,
+    EVENT_SYSTEM_BOOT,
+    EVENT_SYSTEM_SHUTDOWN,
+    EVENT_UNKNOWN
+};
+
+/**
+ * @brief Timeline Event
+ *
+ * The exchange form of an event: parsers produce these and the store hands
+ * them back on request. The timeline itself is kept in a TimelineStore.
+ */
+struct TimelineEvent {
+    int64_t timestamp;            // UTC microseconds since the Unix epoch
+    String datetime;              // Human-readable datetime (ISO 8601)
+    TimelineEventType type;
+    String description;           // Event description
+    String source_artifact;       // Which artifact this came from
+    String actor;                 // User/process that caused event
+    String target;                // Target file/registry key/etc.
+    String details;               // Additional details (JSON or text)
+    uint8_t significance;         // 1-10 (1=low, 10=critical)
+};
+
+/**
+ * @brief String columns of the timeline
+ */
+enum TimelineField {
+    TIMELINE_FIELD_DATETIME,
+    TIMELINE_FIELD_DESCRIPTION,
+    TIMELINE_FIELD_SOURCE,
+    TIMELINE_FIELD_ACTOR,
+    TIMELINE_FIELD_TARGET,
+    TIMELINE_FIELD_DETAILS,
+    TIMELINE_FIELD_COUNT
+};
+
+/**
+ * @brief Append-only pool of distinct strings with 32-bit ids
+ *
+ * Strings are copied into fixed-size arena blocks (PSRAM when there is some)
+ * as a 32-bit length followed by the NUL-terminated text, and found again
+ * through an open-addressing hash index. An id is where the string sits,
+ * (block + 1) << 16 | offset, so there is no per-string table: a distinct
+ * string costs its text, five bytes and an index slot. Id 0 is the empty
+ * string. Strings are only released all at once by clear().
+ */
+class TimelineStringPool {
+public:
+    static const uint32_t EMPTY = 0;
+    static const uint32_t NOT_FOUND = 0xFFFFFFFF;
+
+    TimelineStringPool();
+    ~TimelineStringPool();
+    TimelineStringPool(const TimelineStringPool&) = delete;
+    TimelineStringPool& operator=(const TimelineStringPool&) = delete;
+
+    uint32_t intern(const char* text, size_t length);
+    uint32_t find(const char* text, size_t length) const;      // Id, or NOT_FOUND
+
+    const char* get(uint32_t id) const { return id == EMPTY ? "" : header(id) + sizeof(uint32_t); }
+    uint32_t length(uint32_t id) const {
+        uint32_t length = 0;
+        if (id != EMPTY) memcpy(&length, header(id), sizeof(length));
+        return length;
+    }
+    size_t size() const { return count; }
+
+    void clear();
+    size_t getMemoryUsage() const;
+    size_t getTextBytes() const { return text_bytes; }
+
+private:
+    std::vector<uint32_t> index;    // Id per slot, NOT_FOUND = empty; size is a power of two
+    std::vector<char*> blocks;      // Every allocation; an id's block number is its position + 1
+    size_t current_block;           // Position of the block short strings are appended to, + 1
+    size_t block_used;              // Bytes used in that block
+    size_t arena_bytes;             // Bytes allocated for blocks
+    size_t text_bytes;              // Bytes of strings, terminators included
+    size_t count;                   // Distinct strings, the empty one included
+
+    const char* header(uint32_t id) const { return blocks[(id >> 16) - 1] + (id & 0xFFFF); }
+
+    static uint32_t hashText(const char* text, size_t length);
+    size_t probe(uint32_t hash, const char* text, size_t length) const;
+    char* allocate(size_t bytes, uint32_t& id);
+    void growIndex();
+};
+
+/**
+ * @brief Columnar timeline: one array per event attribute
+ *
+ * An event is a position in the columns: a 64-bit timestamp, 8-bit type and
+ * significance, and a 32-bit pool id for each string field. Sources, actors
+ * and the fixed descriptions of each parser repeat across thousands of
+ * events and are stored once; comparing two events' actors is comparing
+ * two integers. Scans over one attribute only touch that column.
+ */
+class TimelineStore {
+public:
+    TimelineStore() {}
+    TimelineStore(const TimelineStore&) = delete;
+    TimelineStore& operator=(const TimelineStore&) = delete;
+
+    uint32_t add(const TimelineEvent& event);   // Position of the new event
+    void clear();
+
+    uint32_t size() const { return timestamps.size(); }
+    bool empty() const { return timestamps.empty(); }
+
+    int64_t getTimestamp(uint32_t index) const { return timestamps[index]; }
+    TimelineEventType getType(uint32_t index) const { return (TimelineEventType)types[index]; }
+    uint8_t getSignificance(uint32_t index) const { return significance[index]; }
+
+    uint32_t getTextId(TimelineField field, uint32_t index) const { return text_ids[field][index]; }
+    const char* getText(TimelineField field, uint32_t index) const { return pool.get(text_ids[field][index]); }
+    uint32_t getTextLength(TimelineField field, uint32_t index) const { return pool.length(text_ids[field][index]); }
+    String getString(TimelineField field, uint32_t index) const { return String(getText(field, index)); }
+
+    // Whole columns, for scans
+    const std::vector<int64_t>& getTimestamps() const { return timestamps; }
+    const std::vector<uint32_t>& getTextIds(TimelineField field) const { return text_ids[field]; }
+
+    // Update an event in place; a TimelineIndex over the store does not cover these fields
+    void setSignificance(uint32_t index, uint8_t value) { significance[index] = value; }
+    void setText(TimelineField field, uint32_t index, const char* text, size_t length) {
+        text_ids[field][index] = pool.intern(text, length);
+    }
+
+    // Materialise an event; the second form reuses the Strings' buffers
+    TimelineEvent getEvent(uint32_t index) const;
+    void getEvent(uint32_t index, TimelineEvent& event) const;
+
+    // Pool id of a string, NOT_FOUND if no event has it in any field
+    uint32_t findText(const String& text) const { return pool.find(text.c_str(), text.length()); }
+    const TimelineStringPool& getPool() const { return pool; }
+
+    /**
+     * @brief Reorder the events
+     * @param order order[k] is the current position of the event to put at k
+     */
+    void permute(const std::vector<uint32_t>& order);
+
+    size_t getMemoryUsage() const;
+
+private:
+    std::vector<int64_t> timestamps;
+    std::vector<uint8_t> types;
+    std::vector<uint8_t> significance;
+    std::vector<uint32_t> text_ids[TIMELINE_FIELD_COUNT];
+    TimelineStringPool pool;
+
+    static const String& fieldOf(const TimelineEvent& event, TimelineField field);
+    static String& fieldOf(TimelineEvent& event, TimelineField field);
+};
+
+#endif // TIMELINE_STORE_H
@@ -0,0 +1,100 @@
+#ifndef TIMESTAMP_PARSER_H
+#define TIMESTAMP_PARSER_H
+
+#include <Arduino.h>
+
+#define TIMESTAMP_MICROS_PER_SECOND 1000000LL
+#define TIMESTAMP_FILETIME_EPOCH_OFFSET 11644473600000000LL   // 1601-01-01 to 1970-01-01, microseconds
+
+/**
+ * @brief Timestamp formats the parser recognises
+ */
+enum TimestampFormat {
+    TS_FORMAT_UNKNOWN,
+    TS_FORMAT_ISO8601,      // 2024-03-15T10:22:33.123456+02:00, also with a space or no zone
+    TS_FORMAT_FILETIME,     // Windows FILETIME, 100 ns ticks since 1601, decimal or 0x hex
+    TS_FORMAT_SYSLOG,       // Mar 15 10:22:33, year inferred
+    TS_FORMAT_US_DATE,      // 3/15/2024 10:22:33 AM, as PowerShell exports it in en-US
+    TS_FORMAT_EPOCH         // Unix seconds, milliseconds, microseconds or nanoseconds
+};
+
+/**
+ * @brief Fixed-format timestamp parser producing UTC microseconds
+ *
+ * Every format is recognised by its shape and parsed with hand-rolled digit
+ * scanning, no sscanf or mktime. The day number of the last date prefix seen
+ * ("2024-03-15", "Mar 15", "3/15/2024") is cached per format, so a run of
+ * same-day log lines only pays for the time of day: a prefix compare and a
+ * few multiply-adds.
+ *
+ * Times without a zone (ISO 8601 without an offset, syslog, US dates) are
+ * taken to be at the default offset, UTC unless setDefaultOffset() says
+ * otherwise. Syslog lines carry no year: it is the reference year, or the
+ * year before when the month is later than the reference month, which
+ * handles a December log read in January.
+ *
+ * Bare numbers are told apart by magnitude: below 1e11 seconds, below 1e14
+ * milliseconds, below 1e17 microseconds, below 1e18 FILETIME ticks (1918 to
+ * 4770), above that nanoseconds. A fractional part is accepted on seconds.
+ */
+class TimestampParser {
+public:
+    TimestampParser();
+
+    /**
+     * @brief Parse any supported format
+     *
+     * @param micros Set to UTC microseconds since the Unix epoch
+     * @return false if the text is not a valid timestamp in any format
+     */
+    bool parse(const char* text, size_t length, int64_t& micros);
+    bool parse(const String& text, int64_t& micros) { return parse(text.c_str(), text.length(), micros); }
+
+    // Single formats; leading and trailing blanks are skipped by parse() only
+    bool parseISO8601(const char* text, size_t length, int64_t& micros);
+    bool parseFileTime(const char* text, size_t length, int64_t& micros);
+    bool parseSyslog(const char* text, size_t length, int64_t& micros);
+    bool parseUSDate(const char* text, size_t length, int64_t& micros);
+    bool parseEpoch(const char* text, size_t length, int64_t& micros);
+
+    TimestampFormat getLastFormat() const { return last_format; }
+
+    // Context for zone-less and year-less formats
+    void setDefaultOffset(int32_t seconds_east) { default_offset = (int64_t)seconds_east * TIMESTAMP_MICROS_PER_SECOND; }
+    void setReferenceTime(int64_t micros);
+    int getReferenceYear() const { return reference_year; }
+
+    // Calendar arithmetic, proleptic Gregorian
+    static int64_t daysFromCivil(int64_t year, unsigned month, unsigned day);
+    static void civilFromDays(int64_t days, int64_t& year, unsigned& month, unsigned& day);
+    static int64_t fileTimeToMicros(uint64_t filetime) { return (int64_t)(filetime / 10) - TIMESTAMP_FILETIME_EPOCH_OFFSET; }
+    static String format(int64_t micros);          // 2024-03-15T10:22:33Z, with .ffffff when not whole seconds
+
+private:
+    /**
+     * @brief Last date prefix of one format and its day number
+     */
+    struct DayCache {
+        char prefix[12];
+        uint8_t length;         // 0 when empty
+        int64_t day;
+    };
+
+    TimestampFormat last_format;
+    int64_t default_offset;     // Microseconds east of UTC
+    int reference_year;
+    unsigned reference_month;
+
+    DayCache iso_day;
+    DayCache syslog_day;
+    DayCache us_day;
+
+    bool parseTimeOfDay(const char*& p, const char* end, bool seconds_required, int64_t& micros);
+    bool cachedDay(DayCache& cache, const char* prefix, size_t length, int64_t& day) const;
+    void storeDay(DayCache& cache, const char* prefix, size_t length, int64_t day);
+
+    static unsigned daysInMonth(int64_t year, unsigned month);
+    static int syslogMonth(const char* name);
+};
+
+#endif // TIMESTAMP_PARSER_H
@@ -8,12 +8,14 @@
 #include "config.h"
 #include "storage.h"
 #include "evidence_container.h"
+#include "performance_monitor.h"
 
 class WiFiManager {
 private:
     WebServer* server;
     FRFDStorage* storage;
     EvidenceContainer* evidence_container;
+    PerformanceMonitor* performance_monitor;
 
     bool apActive;
     String apSSID;
@@ -113,6 +115,9 @@ public:
     // Evidence container integration
     void setEvidenceContainer(EvidenceContainer* container);
 
+    // Rule scan statistics in the status JSON
+    void setPerformanceMonitor(PerformanceMonitor* monitor);
+
     // Network info
     String getAPIP();
     String getAPSSID();
@@ -0,0 +1,402 @@
+#include "cidr_tree.h"
+
+const uint16_t CidrTree::NO_LABEL;
+
+static const uint64_t IPV4_MAPPED = 0x0000FFFF00000000ULL;
+
+CidrTree::CidrTree() {
+    clear();
+}
+
+void CidrTree::clear() {
+    nodes.clear();
+    labels.clear();
+    range_count = 0;
+
+    CidrAddress any = {0, 0};
+    newNode(any, 0, CIDR_NONE);
+}
+
+void CidrTree::addDefaultRanges() {
+    add("10.0.0.0/8", CIDR_PRIVATE);
+    add("172.16.0.0/12", CIDR_PRIVATE);
+    add("192.168.0.0/16", CIDR_PRIVATE);
+    add("169.254.0.0/16", CIDR_PRIVATE);
+    add("fc00::/7", CIDR_PRIVATE);
+    add("fe80::/10", CIDR_PRIVATE);
+    add("127.0.0.0/8", CIDR_LOOPBACK);
+    add("::1/128", CIDR_LOOPBACK);
+}
+
+size_t CidrTree::getMemoryUsage() const {
+    size_t usage = sizeof(*this) + nodes.capacity() * sizeof(Node) + labels.capacity() * sizeof(String);
+    for (const auto& label : labels) {
+        usage += label.length() + 1;
+    }
+    return usage;
+}
+
+// ===========================
+// Bit helpers
+// ===========================
+
+CidrAddress CidrTree::maskAddress(const CidrAddress& address, uint8_t prefix_len) {
+    CidrAddress masked;
+    masked.hi = prefix_len == 0 ? 0 : prefix_len >= 64 ? address.hi : address.hi & (~0ULL << (64 - prefix_len));
+    masked.lo = prefix_len <= 64 ? 0 : prefix_len >= 128 ? address.lo : address.lo & (~0ULL << (128 - prefix_len));
+    return masked;
+}
+
+bool CidrTree::matchesPrefix(const CidrAddress& address, const Node& node) {
+    uint8_t len = node.prefix_len;
+    if (len <= 64) {
+        return len == 0 || ((address.hi ^ node.hi) >> (64 - len)) == 0;
+    }
+    return address.hi == node.hi &&
+           (len == 128 ? address.lo == node.lo : ((address.lo ^ node.lo) >> (128 - len)) == 0);
+}
+
+uint8_t CidrTree::commonPrefix(const CidrAddress& a, const CidrAddress& b, uint8_t limit) {
+    uint8_t common;
+    if (a.hi != b.hi) {
+        common = __builtin_clzll(a.hi ^ b.hi);
+    } else if (a.lo != b.lo) {
+        common = 64 + __builtin_clzll(a.lo ^ b.lo);
+    } else {
+        common = 128;
+    }
+    return common < limit ? common : limit;
+}
+
+// ===========================
+// Insertion
+// ===========================
+
+int32_t CidrTree::newNode(const CidrAddress& address, uint8_t prefix_len, CidrTag tag) {
+    Node node;
+    node.hi = address.hi;
+    node.lo = address.lo;
+    node.child[0] = -1;
+    node.child[1] = -1;
+    node.label = NO_LABEL;
+    node.prefix_len = prefix_len;
+    node.tag = tag;
+    node.severity = 0;
+    nodes.push_back(node);
+    return nodes.size() - 1;
+}
+
+void CidrTree::setRange(int32_t node, CidrTag tag, uint8_t severity, const String& label) {
+    if (nodes[node].tag == CIDR_NONE) range_count++;
+
+    nodes[node].tag = tag;
+    nodes[node].severity = severity;
+    nodes[node].label = NO_LABEL;
+    if (label.length() > 0 && labels.size() < NO_LABEL) {
+        nodes[node].label = labels.size();
+        labels.push_back(label);
+    }
+}
+
+bool CidrTree::add(const CidrAddress& address, uint8_t prefix_len, CidrTag tag,
+                   uint8_t severity, const String& label) {
+    if (prefix_len > 128 || tag == CIDR_NONE) return false;
+
+    CidrAddress key = maskAddress(address, prefix_len);
+    int32_t n = 0;
+
+    // Invariant: key lies inside node n's prefix, which is no longer than prefix_len
+    while (true) {
+        if (nodes[n].prefix_len == prefix_len) {
+            setRange(n, tag, severity, label);
+            return true;
+        }
+
+        int bit = bitAt(key, nodes[n].prefix_len);
+        int32_t c = nodes[n].child[bit];
+        if (c < 0) {
+            int32_t leaf = newNode(key, prefix_len, CIDR_NONE);
+            setRange(leaf, tag, severity, label);
+            nodes[n].child[bit] = leaf;
+            return true;
+        }
+
+        CidrAddress child = {nodes[c].hi, nodes[c].lo};
+        uint8_t child_len = nodes[c].prefix_len;
+        uint8_t common = commonPrefix(key, child, prefix_len < child_len ? prefix_len : child_len);
+        if (common == child_len) {
+            n = c;
+            continue;
+        }
+
+        // The child branches off inside the new range, or both branch off a new inner node
+        int32_t split;
+        if (common == prefix_len) {
+            split = newNode(key, prefix_len, CIDR_NONE);
+            setRange(split, tag, severity, label);
+            nodes[split].child[bitAt(child, prefix_len)] = c;
+        } else {
+            split = newNode(maskAddress(key, common), common, CIDR_NONE);
+            int32_t leaf = newNode(key, prefix_len, CIDR_NONE);
+            setRange(leaf, tag, severity, label);
+            nodes[split].child[bitAt(child, common)] = c;
+            nodes[split].child[bitAt(key, common)] = leaf;
+        }
+        nodes[n].child[bit] = split;
+        return true;
+    }
+}
+
+bool CidrTree::add(const String& cidr, CidrTag tag, uint8_t severity, const String& label) {
+    CidrAddress address;
+    uint8_t prefix_len;
+    if (!parseCidr(cidr, address, prefix_len)) {
+        return false;
+    }
+    return add(address, prefix_len, tag, severity, label);
+}
+
+bool CidrTree::loadFile(FRFDStorage* storage, const String& path) {
+    if (!storage) return false;
+
+    File file = storage->openFile(path);
+    if (!file) {
+        Serial.printf("[CIDR] Cannot open %s\n", path.c_str());
+        return false;
+    }
+
+    size_t loaded = 0;
+    size_t line_number = 0;
+    while (file.available()) {
+        String line = file.readStringUntil('\n');
+        line_number++;
+        line.trim();
+        if (line.length() == 0 || line[0] == '#') continue;
+
+        // tag,cidr[,severity[,label]]
+        int first = line.indexOf(',');
+        int second = first < 0 ? -1 : line.indexOf(',', first + 1);
+        int third = second < 0 ? -1 : line.indexOf(',', second + 1);
+
+        String tag_name = first < 0 ? line : line.substring(0, first);
+        String cidr = first < 0 ? "" : line.substring(first + 1, second < 0 ? line.length() : second);
+        String severity = second < 0 ? "" : line.substring(second + 1, third < 0 ? line.length() : third);
+        String label = third < 0 ? "" : line.substring(third + 1);
+        tag_name.trim();
+        cidr.trim();
+        severity.trim();
+        label.trim();
+
+        CidrTag tag = parseTag(tag_name);
+        if (tag == CIDR_NONE || !add(cidr, tag, constrain(severity.toInt(), 0, 100), label)) {
+            Serial.printf("[CIDR] %s:%u: bad range '%s'\n", path.c_str(), (unsigned)line_number, line.c_str());
+            continue;
+        }
+        loaded++;
+    }
+    file.close();
+
+    Serial.printf("[CIDR] Loaded %u ranges from %s (%u nodes)\n",
+                  (unsigned)loaded, path.c_str(), (unsigned)nodes.size());
+    return true;
+}
+
+// ===========================
+// Lookup
+// ===========================
+
+CidrTag CidrTree::lookup(const CidrAddress& address, CidrMatch* match) const {
+    const Node* best = nullptr;
+    int32_t n = 0;
+
+    while (n >= 0) {
+        const Node& node = nodes[n];
+        if (!matchesPrefix(address, node)) break;
+        if (node.tag != CIDR_NONE) best = &node;
+        if (node.prefix_len == 128) break;
+        n = node.child[bitAt(address, node.prefix_len)];
+    }
+
+    if (match) {
+        static const String no_label;
+        match->tag = best ? (CidrTag)best->tag : CIDR_NONE;
+        match->prefix_len = best ? best->prefix_len : 0;
+        match->severity = best ? best->severity : 0;
+        match->label = best && best->label != NO_LABEL ? &labels[best->label] : &no_label;
+    }
+    return best ? (CidrTag)best->tag : CIDR_NONE;
+}
+
+CidrTag CidrTree::lookup(const char* ip, size_t length, CidrMatch* match) const {
+    CidrAddress address;
+    if (!parseAddress(ip, length, address)) {
+        if (match) lookup(CidrAddress{0xFFFFFFFFFFFFFFFFULL, 0}, match);  // Outside every range but ::/0
+        return CIDR_NONE;
+    }
+    return lookup(address, match);
+}
+
+// ===========================
+// Parsing
+// ===========================
+
+static bool parseIPv4(const char* text, size_t length, uint32_t& value) {
+    uint32_t result = 0;
+    int octets = 0;
+    size_t i = 0;
+
+    while (octets < 4) {
+        uint32_t octet = 0;
+        size_t digits = 0;
+        while (i < length && text[i] >= '0' && text[i] <= '9' && digits < 3) {
+            octet = octet * 10 + (text[i] - '0');
+            i++;
+            digits++;
+        }
+        if (digits == 0 || octet > 255) return false;
+
+        result = (result << 8) | octet;
+        octets++;
+        if (octets < 4) {
+            if (i >= length || text[i] != '.') return false;
+            i++;
+        }
+    }
+
+    value = result;
+    return i == length;
+}
+
+static int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+static bool parseIPv6(const char* text, size_t length, CidrAddress& address) {
+    uint16_t groups[8] = {0};
+    int count = 0;
+    int gap = -1;           // Group index where "::" stands
+    size_t i = 0;
+
+    if (length >= 2 && text[0] == ':' && text[1] == ':') {
+        gap = 0;
+        i = 2;
+    } else if (length > 0 && text[0] == ':') {
+        return false;
+    }
+
+    while (i < length) {
+        // Embedded IPv4 in the last 32 bits
+        size_t end = i;
+        while (end < length && text[end] != ':') end++;
+        bool dotted = false;
+        for (size_t k = i; k < end; k++) {
+            if (text[k] == '.') dotted = true;
+        }
+        if (dotted) {
+            uint32_t v4;
+            if (end != length || count > 6 || !parseIPv4(text + i, end - i, v4)) return false;
+            groups[count++] = v4 >> 16;
+            groups[count++] = v4 & 0xFFFF;
+            i = end;
+            break;
+        }
+
+        if (end == i || end - i > 4 || count >= 8) return false;
+        uint16_t group = 0;
+        for (size_t k = i; k < end; k++) {
+            int h = hexValue(text[k]);
+            if (h < 0) return false;
+            group = (group << 4) | h;
+        }
+        groups[count++] = group;
+        i = end;
+
+        if (i < length) {
+            i++;    // ':'
+            if (i < length && text[i] == ':') {
+                if (gap >= 0) return false;
+                gap = count;
+                i++;
+            } else if (i == length) {
+                return false;
+            }
+        }
+    }
+
+    uint16_t expanded[8] = {0};
+    if (gap >= 0) {
+        if (count > 7) return false;
+        for (int g = 0; g < gap; g++) expanded[g] = groups[g];
+        for (int g = gap; g < count; g++) expanded[8 - (count - g)] = groups[g];
+    } else {
+        if (count != 8) return false;
+        memcpy(expanded, groups, sizeof(expanded));
+    }
+
+    address.hi = 0;
+    address.lo = 0;
+    for (int g = 0; g < 4; g++) address.hi = (address.hi << 16) | expanded[g];
+    for (int g = 4; g < 8; g++) address.lo = (address.lo << 16) | expanded[g];
+    return true;
+}
+
+bool CidrTree::parseAddress(const char* text, size_t length, CidrAddress& address, bool* is_ipv4) {
+    uint32_t v4;
+    if (parseIPv4(text, length, v4)) {
+        address.hi = 0;
+        address.lo = IPV4_MAPPED | v4;
+        if (is_ipv4) *is_ipv4 = true;
+        return true;
+    }
+
+    if (is_ipv4) *is_ipv4 = false;
+    return parseIPv6(text, length, address);
+}
+
+bool CidrTree::parseCidr(const String& cidr, CidrAddress& address, uint8_t& prefix_len) {
+    int slash = cidr.indexOf('/');
+    size_t address_len = slash < 0 ? cidr.length() : slash;
+
+    bool is_ipv4;
+    if (!parseAddress(cidr.c_str(), address_len, address, &is_ipv4)) {
+        return false;
+    }
+
+    int max_len = is_ipv4 ? 32 : 128;
+    int len = max_len;
+    if (slash >= 0) {
+        String bits = cidr.substring(slash + 1);
+        if (bits.length() == 0 || bits.length() > 3) return false;
+        for (size_t i = 0; i < bits.length(); i++) {
+            if (!isdigit(bits[i])) return false;
+        }
+        len = bits.toInt();
+        if (len > max_len) return false;
+    }
+
+    prefix_len = is_ipv4 ? 96 + len : len;
+    return true;
+}
+
+CidrTag CidrTree::parseTag(const String& name) {
+    if (name.equalsIgnoreCase("allow")) return CIDR_ALLOW;
+    if (name.equalsIgnoreCase("deny")) return CIDR_DENY;
+    if (name.equalsIgnoreCase("intel")) return CIDR_INTEL;
+    if (name.equalsIgnoreCase("private")) return CIDR_PRIVATE;
+    if (name.equalsIgnoreCase("loopback")) return CIDR_LOOPBACK;
+    return CIDR_NONE;
+}
+
+const char* CidrTree::getTagName(CidrTag tag) {
+    switch (tag) {
+        case CIDR_PRIVATE: return "private";
+        case CIDR_LOOPBACK: return "loopback";
+        case CIDR_ALLOW: return "allow";
+        case CIDR_DENY: return "deny";
+        case CIDR_INTEL: return "intel";
+        default: return "none";
+    }
+}
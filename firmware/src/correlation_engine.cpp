@@ -63,18 +63,19 @@ bool CorrelationEngine::analyzeProcessCorrelations() {
     if (!timeline_generator) return false;
 
     // Find processes that executed in sequence
-    auto events = timeline_generator->getEventsByType(EVENT_PROCESS_STARTED);
+    const TimelineStore& store = timeline_generator->getStore();
+    const auto& events = timeline_generator->getEventsByType(EVENT_PROCESS_STARTED);
 
     for (size_t i = 0; i < events.size(); i++) {
         for (size_t j = i + 1; j < events.size() && j < i + 10; j++) {
-            if (isTimeProximate(events[i].timestamp, events[j].timestamp, 60000)) {
+            if (isTimeProximate(store.getTimestamp(events[i]), store.getTimestamp(events[j]), 60000)) {
                 Correlation corr;
                 corr.type = CORR_PROCESS;
-                corr.entity1 = events[i].target;
-                corr.entity2 = events[j].target;
+                corr.entity1 = store.getString(TIMELINE_FIELD_TARGET, events[i]);
+                corr.entity2 = store.getString(TIMELINE_FIELD_TARGET, events[j]);
                 corr.relationship = "Sequential process execution";
                 corr.confidence = 70;
-                corr.timestamp = events[i].timestamp;
+                corr.timestamp = store.getTimestamp(events[i]);
                 corr.evidence.push_back("Executed within 60s of each other");
                 addCorrelation(corr);
             }
@@ -88,26 +89,32 @@ bool CorrelationEngine::analyzeFileCorrelations() {
     if (!timeline_generator) return false;
 
     // Find files accessed by same user/process
-    auto file_events = timeline_generator->getEventsByType(EVENT_FILE_ACCESSED);
-
-    // Group by actor
-    std::map<String, std::vector<TimelineEvent>> actor_files;
-    for (const auto& event : file_events) {
-        if (!event.actor.isEmpty()) {
-            actor_files[event.actor].push_back(event);
+    const TimelineStore& store = timeline_generator->getStore();
+    const auto& file_events = timeline_generator->getEventsByType(EVENT_FILE_ACCESSED);
+
+    // Group by actor id, then by name so correlations come out in name order
+    std::map<uint32_t, uint32_t> actor_ids;
+    for (uint32_t event : file_events) {
+        uint32_t actor = store.getTextId(TIMELINE_FIELD_ACTOR, event);
+        if (actor != TimelineStringPool::EMPTY) {
+            actor_ids[actor]++;
         }
     }
+    std::map<String, uint32_t> actor_files;
+    for (const auto& pair : actor_ids) {
+        actor_files[String(store.getPool().get(pair.first))] = pair.second;
+    }
 
     // Correlate files accessed by same actor
     for (const auto& pair : actor_files) {
-        if (pair.second.size() > 1) {
+        if (pair.second > 1) {
             Correlation corr;
             corr.type = CORR_FILE;
             corr.entity1 = pair.first; // Actor
-            corr.entity2 = String(pair.second.size()) + " files";
+            corr.entity2 = String(pair.second) + " files";
             corr.relationship = "Multiple file access by same actor";
             corr.confidence = 60;
-            corr.timestamp = millis();
+            corr.timestamp = TimelineGenerator::currentTimestamp();
             addCorrelation(corr);
         }
     }
@@ -119,23 +126,25 @@ bool CorrelationEngine::analyzeUserCorrelations() {
     if (!timeline_generator) return false;
 
     // Correlate user logins with subsequent activities
-    auto logins = timeline_generator->getEventsByType(EVENT_LOGIN_SUCCESS);
-    auto all_events = timeline_generator->getEvents();
-
-    for (const auto& login : logins) {
-        // Find events within 1 hour of login
-        for (const auto& event : all_events) {
-            if (event.timestamp > login.timestamp &&
-                event.timestamp < login.timestamp + 3600000 && // 1 hour
-                event.actor == login.actor) {
+    const TimelineStore& store = timeline_generator->getStore();
+    const TimelineIndex& index = timeline_generator->getIndex();
+    const auto& logins = timeline_generator->getEventsByType(EVENT_LOGIN_SUCCESS);
+    const std::vector<int64_t>& timestamps = store.getTimestamps();
+
+    for (uint32_t login : logins) {
+        // Find events within 1 hour of login among the same actor's events
+        int64_t login_time = timestamps[login];
+        for (uint32_t event : index.byActor(store.getTextId(TIMELINE_FIELD_ACTOR, login))) {
+            if (timestamps[event] > login_time &&
+                timestamps[event] < login_time + 3600000000LL) { // 1 hour
 
                 Correlation corr;
                 corr.type = CORR_USER;
-                corr.entity1 = login.actor;
-                corr.entity2 = event.description;
+                corr.entity1 = store.getString(TIMELINE_FIELD_ACTOR, login);
+                corr.entity2 = store.getString(TIMELINE_FIELD_DESCRIPTION, event);
                 corr.relationship = "Activity after login";
                 corr.confidence = 75;
-                corr.timestamp = login.timestamp;
+                corr.timestamp = login_time;
                 addCorrelation(corr);
             }
         }
@@ -172,18 +181,21 @@ bool CorrelationEngine::detectLateralMovement() {
     if (!timeline_generator) return false;
 
     // Look for network connections + remote execution indicators
-    auto network_events = timeline_generator->getEventsByType(EVENT_NETWORK_CONNECTION);
-    auto process_events = timeline_generator->getEventsByType(EVENT_PROCESS_STARTED);
-
-    for (const auto& net : network_events) {
-        for (const auto& proc : process_events) {
-            if (isTimeProximate(net.timestamp, proc.timestamp, 300000)) { // 5 min
+    const TimelineStore& store = timeline_generator->getStore();
+    const auto& network_events = timeline_generator->getEventsByType(EVENT_NETWORK_CONNECTION);
+
+    for (uint32_t net : network_events) {
+        // Processes started within 5 min either side of the connection
+        int64_t net_time = store.getTimestamp(net);
+        for (uint32_t proc : timeline_generator->getEventsByTimeRange(net_time - 300000000LL, net_time + 300000000LL)) {
+            if (store.getType(proc) == EVENT_PROCESS_STARTED) {
                 // Check for lateral movement keywords
-                if (containsKeyword(proc.target, "psexec") ||
-                    containsKeyword(proc.target, "wmic") ||
-                    containsKeyword(proc.target, "schtasks") ||
-                    containsKeyword(proc.target, "ssh") ||
-                    containsKeyword(proc.target, "rdp")) {
+                const char* target = store.getText(TIMELINE_FIELD_TARGET, proc);
+                if (containsKeyword(target, "psexec") ||
+                    containsKeyword(target, "wmic") ||
+                    containsKeyword(target, "schtasks") ||
+                    containsKeyword(target, "ssh") ||
+                    containsKeyword(target, "rdp")) {
 
                     PatternDetection pattern = createPattern(
                         PATTERN_LATERAL_MOVEMENT,
@@ -193,14 +205,14 @@ bool CorrelationEngine::detectLateralMovement() {
 
                     Correlation corr;
                     corr.type = CORR_TEMPORAL;
-                    corr.entity1 = net.description;
-                    corr.entity2 = proc.target;
+                    corr.entity1 = store.getString(TIMELINE_FIELD_DESCRIPTION, net);
+                    corr.entity2 = target;
                     corr.relationship = "Network connection followed by remote execution tool";
                     corr.confidence = 85;
-                    corr.timestamp = net.timestamp;
+                    corr.timestamp = store.getTimestamp(net);
 
                     addPatternCorrelation(pattern, corr);
-                    addPatternIndicator(pattern, "Remote execution tool: " + proc.target);
+                    addPatternIndicator(pattern, "Remote execution tool: " + corr.entity2);
                     pattern.recommendation = "Investigate remote execution activity. Review network connections and verify legitimacy.";
 
                     detected_patterns.push_back(pattern);
@@ -216,10 +228,21 @@ bool CorrelationEngine::detectDataExfiltration() {
     if (!ioc_extractor || !timeline_generator) return false;
 
     // Look for large file operations + network connections to external IPs
-    auto file_events = timeline_generator->getEventsByType(EVENT_FILE_ACCESSED);
-    auto network_events = timeline_generator->getEventsByType(EVENT_NETWORK_CONNECTION);
-
-    auto external_ips = ioc_extractor->getIOCsByType(IOC_IP_ADDRESS);
+    const auto& file_events = timeline_generator->getEventsByType(EVENT_FILE_ACCESSED);
+    const auto& network_events = timeline_generator->getEventsByType(EVENT_NETWORK_CONNECTION);
+
+    // Unique addresses outside the private, loopback and whitelisted ranges
+    std::vector<String> external_ips;
+    const IOCStore& store = ioc_extractor->getStore();
+    for (size_t i = 0; i < store.getUniqueCount(); i++) {
+        const IOCStore::Entry& entry = store.getEntry(i);
+        if (entry.type != IOC_IP_ADDRESS) continue;
+
+        String ip = store.getValue(entry);
+        if (ioc_extractor->isExternalIP(ip)) {
+            external_ips.push_back(ip);
+        }
+    }
 
     if (file_events.size() > 10 && network_events.size() > 0 && external_ips.size() > 0) {
         PatternDetection pattern = createPattern(
@@ -242,14 +265,17 @@ bool CorrelationEngine::detectPrivilegeEscalation() {
     if (!timeline_generator) return false;
 
     // Look for failed logins followed by successful login (credential stuffing)
-    auto failed_logins = timeline_generator->getEventsByType(EVENT_LOGIN_FAILURE);
-    auto success_logins = timeline_generator->getEventsByType(EVENT_LOGIN_SUCCESS);
-
-    for (const auto& failed : failed_logins) {
-        for (const auto& success : success_logins) {
-            if (success.timestamp > failed.timestamp &&
-                success.timestamp < failed.timestamp + 3600000 && // 1 hour
-                success.actor == failed.actor) {
+    const TimelineStore& store = timeline_generator->getStore();
+    const TimelineIndex& index = timeline_generator->getIndex();
+    const auto& failed_logins = timeline_generator->getEventsByType(EVENT_LOGIN_FAILURE);
+
+    for (uint32_t failed : failed_logins) {
+        // Successful logins among the same actor's events
+        int64_t failed_time = store.getTimestamp(failed);
+        for (uint32_t success : index.byActor(store.getTextId(TIMELINE_FIELD_ACTOR, failed))) {
+            if (store.getType(success) == EVENT_LOGIN_SUCCESS &&
+                store.getTimestamp(success) > failed_time &&
+                store.getTimestamp(success) < failed_time + 3600000000LL) { // 1 hour
 
                 PatternDetection pattern = createPattern(
                     PATTERN_PRIVILEGE_ESCALATION,
@@ -257,7 +283,7 @@ bool CorrelationEngine::detectPrivilegeEscalation() {
                     "Failed login attempts followed by successful login"
                 );
 
-                addPatternIndicator(pattern, "User: " + failed.actor);
+                addPatternIndicator(pattern, "User: " + store.getString(TIMELINE_FIELD_ACTOR, failed));
                 addPatternIndicator(pattern, "Multiple failed attempts before success");
                 pattern.recommendation = "Investigate authentication activity for user. Review for credential compromise.";
 
@@ -274,14 +300,16 @@ bool CorrelationEngine::detectPersistence() {
     if (!timeline_generator) return false;
 
     // Look for registry modifications, scheduled tasks, services
-    auto registry_events = timeline_generator->getEventsByType(EVENT_REGISTRY_MODIFIED);
-    auto service_events = timeline_generator->getEventsByType(EVENT_SERVICE_STARTED);
+    const TimelineStore& store = timeline_generator->getStore();
+    const auto& registry_events = timeline_generator->getEventsByType(EVENT_REGISTRY_MODIFIED);
+    const auto& service_events = timeline_generator->getEventsByType(EVENT_SERVICE_STARTED);
 
     if (registry_events.size() > 0 || service_events.size() > 0) {
-        for (const auto& event : registry_events) {
-            if (containsKeyword(event.target, "Run") ||
-                containsKeyword(event.target, "RunOnce") ||
-                containsKeyword(event.target, "Startup")) {
+        for (uint32_t event : registry_events) {
+            const char* target = store.getText(TIMELINE_FIELD_TARGET, event);
+            if (containsKeyword(target, "Run") ||
+                containsKeyword(target, "RunOnce") ||
+                containsKeyword(target, "Startup")) {
 
                 PatternDetection pattern = createPattern(
                     PATTERN_PERSISTENCE,
@@ -289,21 +317,21 @@ bool CorrelationEngine::detectPersistence() {
                     "Registry-based persistence mechanism detected"
                 );
 
-                addPatternIndicator(pattern, "Registry key: " + event.target);
+                addPatternIndicator(pattern, "Registry key: " + String(target));
                 pattern.recommendation = "Review autorun registry keys. Remove unauthorized entries.";
 
                 detected_patterns.push_back(pattern);
             }
         }
 
-        for (const auto& event : service_events) {
+        for (uint32_t event : service_events) {
             PatternDetection pattern = createPattern(
                 PATTERN_PERSISTENCE,
                 70,
                 "Service-based persistence detected"
             );
 
-            addPatternIndicator(pattern, "Service started: " + event.target);
+            addPatternIndicator(pattern, "Service started: " + store.getString(TIMELINE_FIELD_TARGET, event));
             pattern.recommendation = "Review newly created or modified services.";
 
             detected_patterns.push_back(pattern);
@@ -317,15 +345,17 @@ bool CorrelationEngine::detectReconnaissance() {
     if (!timeline_generator) return false;
 
     // Look for enumeration commands
-    auto process_events = timeline_generator->getEventsByType(EVENT_PROCESS_STARTED);
-
-    for (const auto& event : process_events) {
-        if (containsKeyword(event.target, "net view") ||
-            containsKeyword(event.target, "net user") ||
-            containsKeyword(event.target, "whoami") ||
-            containsKeyword(event.target, "ipconfig") ||
-            containsKeyword(event.target, "nslookup") ||
-            containsKeyword(event.target, "netstat")) {
+    const TimelineStore& store = timeline_generator->getStore();
+    const auto& process_events = timeline_generator->getEventsByType(EVENT_PROCESS_STARTED);
+
+    for (uint32_t event : process_events) {
+        const char* target = store.getText(TIMELINE_FIELD_TARGET, event);
+        if (containsKeyword(target, "net view") ||
+            containsKeyword(target, "net user") ||
+            containsKeyword(target, "whoami") ||
+            containsKeyword(target, "ipconfig") ||
+            containsKeyword(target, "nslookup") ||
+            containsKeyword(target, "netstat")) {
 
             PatternDetection pattern = createPattern(
                 PATTERN_RECONNAISSANCE,
@@ -333,7 +363,7 @@ bool CorrelationEngine::detectReconnaissance() {
                 "Reconnaissance activity detected: System enumeration commands"
             );
 
-            addPatternIndicator(pattern, "Command: " + event.target);
+            addPatternIndicator(pattern, "Command: " + String(target));
             pattern.recommendation = "Investigate enumeration activity. Review for unauthorized information gathering.";
 
             detected_patterns.push_back(pattern);
@@ -347,19 +377,22 @@ bool CorrelationEngine::detectC2Activity() {
     if (!ioc_extractor || !timeline_generator) return false;
 
     // Look for periodic network connections (beaconing)
-    auto network_events = timeline_generator->getEventsByType(EVENT_NETWORK_CONNECTION);
+    const TimelineStore& store = timeline_generator->getStore();
+    const auto& network_events = timeline_generator->getEventsByType(EVENT_NETWORK_CONNECTION);
 
     // Simple beaconing detection: multiple connections to same destination
     std::map<String, int> connection_counts;
 
-    for (const auto& event : network_events) {
-        auto ips = extractIPsFromString(event.details);
+    for (uint32_t event : network_events) {
+        auto ips = extractIPsFromString(store.getString(TIMELINE_FIELD_DETAILS, event));
         for (const auto& ip : ips) {
             connection_counts[ip]++;
         }
     }
 
     for (const auto& pair : connection_counts) {
+        if (!ioc_extractor->isExternalIP(pair.first)) continue;
+
         if (pair.second >= 5) { // 5+ connections to same IP
             PatternDetection pattern = createPattern(
                 PATTERN_COMMAND_CONTROL,
@@ -382,13 +415,15 @@ bool CorrelationEngine::detectCredentialTheft() {
     if (!timeline_generator) return false;
 
     // Look for credential dumping tools
-    auto process_events = timeline_generator->getEventsByType(EVENT_PROCESS_STARTED);
+    const TimelineStore& store = timeline_generator->getStore();
+    const auto& process_events = timeline_generator->getEventsByType(EVENT_PROCESS_STARTED);
 
-    for (const auto& event : process_events) {
-        if (containsKeyword(event.target, "mimikatz") ||
-            containsKeyword(event.target, "procdump") ||
-            containsKeyword(event.target, "lsass") ||
-            containsKeyword(event.target, "secretsdump")) {
+    for (uint32_t event : process_events) {
+        const char* target = store.getText(TIMELINE_FIELD_TARGET, event);
+        if (containsKeyword(target, "mimikatz") ||
+            containsKeyword(target, "procdump") ||
+            containsKeyword(target, "lsass") ||
+            containsKeyword(target, "secretsdump")) {
 
             PatternDetection pattern = createPattern(
                 PATTERN_CREDENTIAL_THEFT,
@@ -396,7 +431,7 @@ bool CorrelationEngine::detectCredentialTheft() {
                 "Credential theft tool detected"
             );
 
-            addPatternIndicator(pattern, "Tool: " + event.target);
+            addPatternIndicator(pattern, "Tool: " + String(target));
             pattern.recommendation = "IMMEDIATE ACTION: Credential compromise likely. Reset credentials and investigate.";
 
             detected_patterns.push_back(pattern);
@@ -461,9 +496,10 @@ std::vector<PatternDetection> CorrelationEngine::getPatternsByType(AttackPattern
     return filtered;
 }
 
-bool CorrelationEngine::isTimeProximate(unsigned long time1, unsigned long time2, unsigned long threshold_ms) {
-    unsigned long diff = time1 > time2 ? time1 - time2 : time2 - time1;
-    return diff <= threshold_ms;
+bool CorrelationEngine::isTimeProximate(int64_t time1, int64_t time2, unsigned long threshold_ms) {
+    // Event times are in microseconds
+    int64_t diff = time1 > time2 ? time1 - time2 : time2 - time1;
+    return diff <= (int64_t)threshold_ms * 1000;
 }
 
 PatternDetection CorrelationEngine::createPattern(AttackPattern type, uint8_t confidence, const String& desc) {
@@ -497,17 +533,18 @@ void CorrelationEngine::correlateDomainWithNetwork() {
 void CorrelationEngine::correlateTemporalEvents(unsigned long window_ms) {
     if (!timeline_generator) return;
 
-    auto events = timeline_generator->getEvents();
-    for (size_t i = 0; i < events.size(); i++) {
-        for (size_t j = i + 1; j < events.size() && j < i + 20; j++) {
-            if (isTimeProximate(events[i].timestamp, events[j].timestamp, window_ms)) {
+    const TimelineStore& store = timeline_generator->getStore();
+    const std::vector<int64_t>& timestamps = store.getTimestamps();
+    for (size_t i = 0; i < timestamps.size(); i++) {
+        for (size_t j = i + 1; j < timestamps.size() && j < i + 20; j++) {
+            if (isTimeProximate(timestamps[i], timestamps[j], window_ms)) {
                 Correlation corr;
                 corr.type = CORR_TEMPORAL;
-                corr.entity1 = events[i].description;
-                corr.entity2 = events[j].description;
+                corr.entity1 = store.getString(TIMELINE_FIELD_DESCRIPTION, i);
+                corr.entity2 = store.getString(TIMELINE_FIELD_DESCRIPTION, j);
                 corr.relationship = "Occurred within " + String((unsigned long)(window_ms / 1000)) + "s";
                 corr.confidence = 60;
-                corr.timestamp = events[i].timestamp;
+                corr.timestamp = timestamps[i];
                 addCorrelation(corr);
             }
         }
@@ -542,6 +579,17 @@ bool CorrelationEngine::containsKeyword(const String& text, const String& keywor
     return lower_text.indexOf(lower_keyword) >= 0;
 }
 
+bool CorrelationEngine::containsKeyword(const char* text, const char* keyword) {
+    // Case-insensitive substring search in place, for text borrowed from the timeline store
+    size_t keyword_length = strlen(keyword);
+    for (; *text; text++) {
+        size_t k = 0;
+        while (k < keyword_length && text[k] && tolower((uint8_t)text[k]) == tolower((uint8_t)keyword[k])) k++;
+        if (k == keyword_length) return true;
+    }
+    return keyword_length == 0;
+}
+
 std::vector<String> CorrelationEngine::extractIPsFromString(const String& text) {
     std::vector<String> ips;
     // Simplified - would use proper IP extraction
@@ -0,0 +1,210 @@
+#include "csv_reader.h"
+#include "esp_heap_caps.h"
+#include <algorithm>
+
+const CSVField CSVReader::empty_field = {"", 0};
+
+CSVReader::CSVReader() : memory(nullptr), memory_left(0), buffer(nullptr), capacity(0) {
+    reset();
+}
+
+CSVReader::~CSVReader() {
+    close();
+}
+
+void CSVReader::reset() {
+    pos = 0;
+    filled = 0;
+    eof = false;
+    failed = false;
+    field_count = 0;
+    row_number = 0;
+}
+
+bool CSVReader::open(File opened) {
+    close();
+    file = opened;
+    if (!file) {
+        failed = true;
+        return false;
+    }
+    return true;
+}
+
+void CSVReader::open(const char* data, size_t length) {
+    close();
+    memory = data;
+    memory_left = length;
+}
+
+void CSVReader::close() {
+    if (file) file.close();
+    file = File();
+    memory = nullptr;
+    memory_left = 0;
+    if (buffer) heap_caps_free(buffer);
+    buffer = nullptr;
+    capacity = 0;
+    reset();
+}
+
+bool CSVReader::fill() {
+    // Move the unread part to the front, grow only when it already fills the buffer
+    if (pos > 0) {
+        memmove(buffer, buffer + pos, filled - pos);
+        filled -= pos;
+        pos = 0;
+    }
+    if (filled == capacity) {
+        if (capacity >= CSV_READER_MAX_RECORD) {
+            Serial.printf("[CSV] Record over %u KB after row %u\n", (unsigned)(CSV_READER_MAX_RECORD / 1024), (unsigned)row_number);
+            failed = true;
+            return false;
+        }
+
+        // One spare byte so a record ending the input can still be terminated; PSRAM when there is some
+        size_t grown = capacity == 0 ? CSV_READER_BLOCK_SIZE : std::min(capacity * 2, (size_t)CSV_READER_MAX_RECORD);
+        char* resized = (char*)heap_caps_realloc(buffer, grown + 1, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (!resized) {
+            resized = (char*)heap_caps_realloc(buffer, grown + 1, MALLOC_CAP_8BIT);
+        }
+        if (!resized) {
+            Serial.println("[CSV] Out of memory for the read buffer");
+            failed = true;
+            return false;
+        }
+        buffer = resized;
+        capacity = grown;
+    }
+
+    size_t n = 0;
+    if (file) {
+        n = file.read((uint8_t*)buffer + filled, capacity - filled);
+    } else if (memory) {
+        n = std::min(memory_left, capacity - filled);
+        memcpy(buffer + filled, memory, n);
+        memory += n;
+        memory_left -= n;
+    }
+    filled += n;
+    eof = n == 0;
+    return n > 0;
+}
+
+bool CSVReader::nextRow() {
+    field_count = 0;
+    if (failed) return false;
+
+    while (true) {
+        // Offsets are from the record start, which fill() may move
+        size_t r = 0;                   // Read
+        size_t w = 0;                   // Write: unescaped text is moved down, never up
+        size_t field_start = 0;
+        size_t cr_at = SIZE_MAX;        // Where an unquoted '\r' was written
+        bool quoted_any = false;
+        ScanState state = SCAN_FIELD_START;
+        field_bounds.clear();
+
+        while (true) {
+            if (pos + r == filled && (eof || !fill())) {
+                if (failed) return false;
+                if (r == 0) return false;   // End of input
+                break;                      // Last record has no line break
+            }
+
+            char* record = buffer + pos;
+            char c = record[r++];
+            if (state == SCAN_QUOTED) {
+                if (c == '"') state = SCAN_QUOTE_IN_QUOTED;
+                else record[w++] = c;
+                continue;
+            }
+            if (state == SCAN_QUOTE_IN_QUOTED && c == '"') {
+                record[w++] = '"';
+                state = SCAN_QUOTED;
+                continue;
+            }
+            if (state == SCAN_FIELD_START && c == '"') {
+                state = SCAN_QUOTED;
+                quoted_any = true;
+                continue;
+            }
+
+            if (c == ',') {
+                record[w] = '\0';
+                field_bounds.push_back(field_start);
+                field_bounds.push_back(w);
+                field_start = ++w;
+                state = SCAN_FIELD_START;
+            } else if (c == '\n') {
+                break;
+            } else {
+                if (c == '\r') cr_at = w;
+                record[w++] = c;
+                state = SCAN_UNQUOTED;
+            }
+        }
+
+        // CRLF: drop the CR if it came straight before the LF
+        if (cr_at != SIZE_MAX && cr_at + 1 == w) w--;
+        buffer[pos + w] = '\0';
+        field_bounds.push_back(field_start);
+        field_bounds.push_back(w);
+
+        char* record = buffer + pos;
+        pos += r;
+        if (field_bounds.size() == 2 && w == 0 && !quoted_any) continue;    // Empty line
+
+        field_count = field_bounds.size() / 2;
+        if (fields.size() < field_count) fields.resize(field_count);
+        for (size_t f = 0; f < field_count; f++) {
+            fields[f].data = record + field_bounds[2 * f];
+            fields[f].length = field_bounds[2 * f + 1] - field_bounds[2 * f];
+        }
+        row_number++;
+        return true;
+    }
+}
+
+bool CSVReader::nextLine() {
+    field_count = 0;
+    if (failed) return false;
+
+    while (true) {
+        size_t scanned = 0;
+        char* newline = nullptr;
+        while (true) {
+            size_t available = filled - pos;
+            if (available > scanned) {
+                newline = (char*)memchr(buffer + pos + scanned, '\n', available - scanned);
+                if (newline) break;
+            }
+            scanned = available;
+            if (eof || !fill()) break;
+        }
+        if (failed) return false;
+
+        size_t length = newline ? newline - (buffer + pos) : filled - pos;
+        if (!newline && length == 0) return false;  // End of input
+
+        char* line = buffer + pos;
+        pos += newline ? length + 1 : length;
+        if (length > 0 && line[length - 1] == '\r') length--;
+        line[length] = '\0';
+        if (length == 0) continue;
+
+        if (fields.empty()) fields.resize(1);
+        fields[0].data = line;
+        fields[0].length = length;
+        field_count = 1;
+        row_number++;
+        return true;
+    }
+}
+
+bool CSVReader::rowContains(const char* text) const {
+    for (size_t f = 0; f < field_count; f++) {
+        if (fields[f].contains(text)) return true;
+    }
+    return false;
+}
@@ -0,0 +1,363 @@
+#include "domain_suffix_trie.h"
+
+const uint8_t DomainSuffixTrie::PSL_RULE;
+const uint8_t DomainSuffixTrie::PSL_WILDCARD;
+const uint8_t DomainSuffixTrie::PSL_EXCEPTION;
+const uint32_t DomainSuffixTrie::NO_NODE;
+
+static const size_t INITIAL_INDEX_SIZE = 64;
+static const size_t MAX_LABEL_LENGTH = 63;
+
+DomainSuffixTrie::DomainSuffixTrie() {
+    clear();
+}
+
+void DomainSuffixTrie::clear() {
+    nodes.clear();
+    arena.clear();
+    index.assign(INITIAL_INDEX_SIZE, 0);
+    labels.clear();
+    entry_count = 0;
+    psl_rule_count = 0;
+
+    Node root;
+    root.parent = NO_NODE;
+    root.text = 0;
+    root.length = 0;
+    root.tag = DOMAIN_NONE;
+    root.psl = 0;
+    root.severity = 0;
+    nodes.push_back(root);
+}
+
+void DomainSuffixTrie::compact() {
+    // Drop the slack left by vector growth once a list is loaded
+    nodes.shrink_to_fit();
+    arena.shrink_to_fit();
+}
+
+size_t DomainSuffixTrie::getMemoryUsage() const {
+    size_t usage = sizeof(*this) +
+                   nodes.capacity() * sizeof(Node) +
+                   arena.capacity() +
+                   index.capacity() * sizeof(uint32_t);
+
+    for (const auto& label : labels) {
+        usage += sizeof(label) + label.second.length() + 1;
+    }
+    return usage;
+}
+
+// ===========================
+// Label hashing
+// ===========================
+
+uint32_t DomainSuffixTrie::hashLabel(uint32_t parent, const char* label, size_t length) {
+    // FNV-1a over the parent node and the lowercased label
+    uint32_t hash = 2166136261UL;
+    for (int shift = 0; shift < 32; shift += 8) {
+        hash = (hash ^ ((parent >> shift) & 0xFF)) * 16777619UL;
+    }
+    for (size_t i = 0; i < length; i++) {
+        hash = (hash ^ (uint8_t)tolower(label[i])) * 16777619UL;
+    }
+    return hash;
+}
+
+uint32_t DomainSuffixTrie::findChild(uint32_t parent, const char* label, size_t length) const {
+    size_t mask = index.size() - 1;
+    for (size_t slot = hashLabel(parent, label, length) & mask; index[slot] != 0; slot = (slot + 1) & mask) {
+        const Node& node = nodes[index[slot] - 1];
+        if (node.parent != parent || node.length != length) continue;
+
+        const char* text = &arena[node.text];
+        size_t i = 0;
+        while (i < length && text[i] == tolower(label[i])) i++;
+        if (i == length) return index[slot] - 1;
+    }
+    return NO_NODE;
+}
+
+void DomainSuffixTrie::growIndex() {
+    std::vector<uint32_t> grown(index.size() * 2, 0);
+    size_t mask = grown.size() - 1;
+
+    for (uint32_t n = 1; n < nodes.size(); n++) {
+        size_t slot = hashLabel(nodes[n].parent, &arena[nodes[n].text], nodes[n].length) & mask;
+        while (grown[slot] != 0) slot = (slot + 1) & mask;
+        grown[slot] = n + 1;
+    }
+    index.swap(grown);
+}
+
+size_t DomainSuffixTrie::trimDomain(const char* domain, size_t length) {
+    // A fully qualified name may end in the root dot
+    return length > 0 && domain[length - 1] == '.' ? length - 1 : length;
+}
+
+// ===========================
+// Insertion
+// ===========================
+
+uint32_t DomainSuffixTrie::insertPath(const char* suffix, size_t length) {
+    length = trimDomain(suffix, length);
+    if (length == 0) return NO_NODE;
+
+    uint32_t node = 0;
+    size_t end = length;
+    while (true) {
+        size_t start = end;
+        while (start > 0 && suffix[start - 1] != '.') start--;
+
+        size_t label_length = end - start;
+        if (label_length == 0 || label_length > MAX_LABEL_LENGTH) return NO_NODE;
+
+        uint32_t child = findChild(node, suffix + start, label_length);
+        if (child == NO_NODE) {
+            Node entry;
+            entry.parent = node;
+            entry.text = arena.size();
+            entry.length = label_length;
+            entry.tag = DOMAIN_NONE;
+            entry.psl = 0;
+            entry.severity = 0;
+            for (size_t i = start; i < end; i++) {
+                arena.push_back(tolower(suffix[i]));
+            }
+            nodes.push_back(entry);
+            child = nodes.size() - 1;
+
+            size_t mask = index.size() - 1;
+            size_t slot = hashLabel(node, suffix + start, label_length) & mask;
+            while (index[slot] != 0) slot = (slot + 1) & mask;
+            index[slot] = child + 1;
+
+            // Keep the load factor under 3/4
+            if (nodes.size() * 4 > index.size() * 3) {
+                growIndex();
+            }
+        }
+
+        node = child;
+        if (start == 0) return node;
+        end = start - 1;
+    }
+}
+
+bool DomainSuffixTrie::add(const char* suffix, size_t length, DomainTag tag, uint8_t severity, const String& label) {
+    if (tag == DOMAIN_NONE) return false;
+
+    uint32_t node = insertPath(suffix, length);
+    if (node == NO_NODE) return false;
+
+    if (nodes[node].tag == DOMAIN_NONE) entry_count++;
+    nodes[node].tag = tag;
+    nodes[node].severity = severity;
+    if (label.length() > 0) {
+        labels[node] = label;
+    } else {
+        labels.erase(node);
+    }
+    return true;
+}
+
+bool DomainSuffixTrie::loadFile(FRFDStorage* storage, const String& path) {
+    if (!storage) return false;
+
+    File file = storage->openFile(path);
+    if (!file) {
+        Serial.printf("[Domains] Cannot open %s\n", path.c_str());
+        return false;
+    }
+
+    size_t loaded = 0;
+    size_t line_number = 0;
+    while (file.available()) {
+        String line = file.readStringUntil('\n');
+        line_number++;
+        line.trim();
+        if (line.length() == 0 || line[0] == '#') continue;
+
+        // tag,suffix[,severity[,label]]
+        int first = line.indexOf(',');
+        int second = first < 0 ? -1 : line.indexOf(',', first + 1);
+        int third = second < 0 ? -1 : line.indexOf(',', second + 1);
+
+        String tag_name = first < 0 ? line : line.substring(0, first);
+        String suffix = first < 0 ? "" : line.substring(first + 1, second < 0 ? line.length() : second);
+        String severity = second < 0 ? "" : line.substring(second + 1, third < 0 ? line.length() : third);
+        String label = third < 0 ? "" : line.substring(third + 1);
+        tag_name.trim();
+        suffix.trim();
+        severity.trim();
+        label.trim();
+
+        // "*.example.com" and ".example.com" mean the same as "example.com" here
+        if (suffix.startsWith("*.")) suffix = suffix.substring(2);
+        if (suffix.startsWith(".")) suffix = suffix.substring(1);
+
+        DomainTag tag = parseTag(tag_name);
+        if (tag == DOMAIN_NONE || !add(suffix, tag, constrain(severity.toInt(), 0, 100), label)) {
+            Serial.printf("[Domains] %s:%u: bad entry '%s'\n", path.c_str(), (unsigned)line_number, line.c_str());
+            continue;
+        }
+        loaded++;
+    }
+    file.close();
+    compact();
+
+    Serial.printf("[Domains] Loaded %u suffixes from %s (%u nodes, %u bytes)\n",
+                  (unsigned)loaded, path.c_str(), (unsigned)nodes.size(), (unsigned)getMemoryUsage());
+    return true;
+}
+
+bool DomainSuffixTrie::loadPublicSuffixList(FRFDStorage* storage, const String& path) {
+    if (!storage) return false;
+
+    File file = storage->openFile(path);
+    if (!file) {
+        Serial.printf("[Domains] Cannot open %s\n", path.c_str());
+        return false;
+    }
+
+    size_t loaded = 0;
+    while (file.available()) {
+        String line = file.readStringUntil('\n');
+        line.trim();
+        if (line.length() == 0 || line.startsWith("//")) continue;
+
+        // A rule is the first whitespace-delimited token
+        int space = line.indexOf(' ');
+        if (space > 0) line = line.substring(0, space);
+
+        uint8_t flag = PSL_RULE;
+        const char* rule = line.c_str();
+        size_t length = line.length();
+        if (rule[0] == '!') {
+            flag = PSL_EXCEPTION;
+            rule++;
+            length--;
+        } else if (length > 2 && rule[0] == '*' && rule[1] == '.') {
+            flag = PSL_WILDCARD;
+            rule += 2;
+            length -= 2;
+        }
+
+        uint32_t node = insertPath(rule, length);
+        if (node == NO_NODE) continue;
+
+        nodes[node].psl |= flag;
+        loaded++;
+    }
+    file.close();
+    compact();
+
+    psl_rule_count += loaded;
+    Serial.printf("[Domains] Loaded %u public suffix rules from %s (%u nodes, %u bytes)\n",
+                  (unsigned)loaded, path.c_str(), (unsigned)nodes.size(), (unsigned)getMemoryUsage());
+    return true;
+}
+
+// ===========================
+// Lookup
+// ===========================
+
+DomainTag DomainSuffixTrie::lookup(const char* domain, size_t length, DomainMatch* match) const {
+    length = trimDomain(domain, length);
+
+    uint32_t best = NO_NODE;
+    size_t best_start = length;
+    uint32_t node = 0;
+    size_t end = length;
+
+    while (end > 0) {
+        size_t start = end;
+        while (start > 0 && domain[start - 1] != '.') start--;
+
+        node = findChild(node, domain + start, end - start);
+        if (node == NO_NODE) break;
+
+        if (nodes[node].tag != DOMAIN_NONE) {
+            best = node;
+            best_start = start;
+        }
+        if (start == 0) break;
+        end = start - 1;
+    }
+
+    if (match) {
+        static const String no_label;
+        match->tag = best != NO_NODE ? (DomainTag)nodes[best].tag : DOMAIN_NONE;
+        match->severity = best != NO_NODE ? nodes[best].severity : 0;
+        match->suffix_length = length - best_start;
+        match->label = &no_label;
+        if (best != NO_NODE) {
+            auto it = labels.find(best);
+            if (it != labels.end()) match->label = &it->second;
+        }
+    }
+    return best != NO_NODE ? (DomainTag)nodes[best].tag : DOMAIN_NONE;
+}
+
+size_t DomainSuffixTrie::getPublicSuffixStart(const char* domain, size_t length, bool* listed) const {
+    length = trimDomain(domain, length);
+
+    size_t suffix_start = length;
+    size_t last_label = length;
+    uint32_t node = 0;
+    size_t end = length;
+
+    while (end > 0) {
+        size_t start = end;
+        while (start > 0 && domain[start - 1] != '.') start--;
+        if (end == length) last_label = start;
+
+        bool wildcard = nodes[node].psl & PSL_WILDCARD;
+        uint32_t child = findChild(node, domain + start, end - start);
+
+        // An exception makes its parent the public suffix, and wins over everything else
+        if (child != NO_NODE && (nodes[child].psl & PSL_EXCEPTION)) {
+            suffix_start = end + 1;
+            break;
+        }
+        if (wildcard || (child != NO_NODE && (nodes[child].psl & PSL_RULE))) {
+            suffix_start = start;
+        }
+
+        if (child == NO_NODE || start == 0) break;
+        node = child;
+        end = start - 1;
+    }
+
+    if (listed) *listed = suffix_start < length;
+
+    // The implicit "*" rule: the last label is a public suffix
+    return suffix_start < length ? suffix_start : last_label;
+}
+
+String DomainSuffixTrie::getRegistrableDomain(const String& domain) const {
+    size_t length = trimDomain(domain.c_str(), domain.length());
+    size_t suffix_start = getPublicSuffixStart(domain.c_str(), length);
+    if (suffix_start < 2) return "";
+
+    // One more label to the left of the public suffix
+    size_t start = suffix_start - 1;
+    while (start > 0 && domain[start - 1] != '.') start--;
+    return domain.substring(start, length);
+}
+
+DomainTag DomainSuffixTrie::parseTag(const String& name) {
+    if (name.equalsIgnoreCase("allow")) return DOMAIN_ALLOW;
+    if (name.equalsIgnoreCase("deny")) return DOMAIN_DENY;
+    if (name.equalsIgnoreCase("intel")) return DOMAIN_INTEL;
+    return DOMAIN_NONE;
+}
+
+const char* DomainSuffixTrie::getTagName(DomainTag tag) {
+    switch (tag) {
+        case DOMAIN_ALLOW: return "allow";
+        case DOMAIN_DENY: return "deny";
+        case DOMAIN_INTEL: return "intel";
+        default: return "none";
+    }
+}
@@ -9,6 +9,9 @@ FRFD::FRFD() {
     hid_automation = new HIDAutomation();
     evidence_container = nullptr;  // Created per case
     wifi_manager = nullptr;  // Initialized after storage is ready
+    performance_monitor = new PerformanceMonitor();
+    ioc_matcher = new IOCMatcher();
+    threat_detector = new ThreatDetector();
     state.mode = MODE_IDLE;
     state.os = OS_UNKNOWN;
     state.risk = RISK_UNKNOWN;
@@ -32,6 +35,9 @@ FRFD::~FRFD() {
     if (wifi_manager) {
         delete wifi_manager;
     }
+    delete threat_detector;
+    delete ioc_matcher;
+    delete performance_monitor;
 }
 
 bool FRFD::begin() {
@@ -54,6 +60,9 @@ bool FRFD::begin() {
     // Initialize storage
     storage->begin();
 
+    // Initialize analysis engines (rules are read through storage)
+    initializeAnalysis();
+
     // Initialize HID automation
     if (hid_automation->begin(storage)) {
         Serial.println("HID Automation enabled");
@@ -102,6 +111,19 @@ void FRFD::loadConfiguration() {
     Serial.println(organization);
 }
 
+void FRFD::initializeAnalysis() {
+    Serial.println("Initializing analysis engines...");
+
+    performance_monitor->begin();
+
+    ioc_matcher->begin(storage);
+    ioc_matcher->loadDefaultRules();
+    ioc_matcher->setPerformanceMonitor(performance_monitor);
+
+    threat_detector->begin(storage, nullptr, nullptr);
+    threat_detector->setPerformanceMonitor(performance_monitor);
+}
+
 void FRFD::initializeUSB() {
     Serial.println("Initializing USB...");
     serialActive = true;
@@ -124,6 +146,9 @@ void FRFD::initializeWiFi() {
         wifi_manager->setEvidenceContainer(evidence_container);
     }
 
+    // Rule scan costs for the status page
+    wifi_manager->setPerformanceMonitor(performance_monitor);
+
     // Start WiFi AP with web server
     bool success = wifi_manager->begin(WIFI_AP_SSID, WIFI_AP_PASSWORD);
 
@@ -364,9 +389,32 @@ void FRFD::runAnalysis() {
     display->showSuccess("Analysis Complete");
 }
 
+std::vector<String> FRFD::getCaseFiles() {
+    std::vector<String> files;
+    String caseDir = storage->getCaseDirectory();
+    if (caseDir.isEmpty()) {
+        Serial.println("No case directory, nothing to analyze");
+        return files;
+    }
+
+    for (const String& name : storage->getFileList(caseDir)) {
+        files.push_back(name.startsWith("/") ? name : caseDir + "/" + name);
+    }
+    return files;
+}
+
 void FRFD::matchIOCs() {
     Serial.println("Matching IOCs...");
-    // Execute IOC matching with YARA rules
+
+    // YARA rules from the compiled image, one streamed pass per file
+    performance_monitor->startModule("ioc_matching");
+    ioc_matcher->clearMatches();
+    for (const String& path : getCaseFiles()) {
+        ioc_matcher->scanFile(path);
+    }
+    performance_monitor->endModule("ioc_matching", true);
+
+    Serial.printf("IOC matches: %u\n", (unsigned)ioc_matcher->getMatchCount());
 }
 
 void FRFD::generateTimeline() {
@@ -376,7 +424,16 @@ void FRFD::generateTimeline() {
 
 void FRFD::detectAnomalies() {
     Serial.println("Detecting anomalies...");
-    // Run anomaly detection algorithms
+
+    performance_monitor->startModule("threat_detection");
+    threat_detector->clearAlerts();
+    for (const String& path : getCaseFiles()) {
+        threat_detector->scanFile(path);
+    }
+    threat_detector->scanAllArtifacts();
+    performance_monitor->endModule("threat_detection", true);
+
+    Serial.printf("Threat alerts: %u\n", (unsigned)threat_detector->getAlertCount());
 }
 
 bool FRFD::executeScript(const char* scriptPath) {
@@ -0,0 +1,206 @@
+#include "hex_pattern_matcher.h"
+
+const size_t HexPatternMatcher::MAX_POSITIONS;
+
+HexPatternMatcher::HexPatternMatcher() : compiled(false), single_first_byte(-1) {
+    memset(first_bytes, 0, sizeof(first_bytes));
+    resetTables();
+}
+
+void HexPatternMatcher::resetTables() {
+    memset(&tables, 0, sizeof(tables));
+    tables.first_bytes = first_bytes;
+    single_first_byte = -1;
+}
+
+static int hexNibble(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+bool HexPatternMatcher::parse(const String& hex, std::vector<Position>& positions) {
+    positions.clear();
+    size_t i = 0;
+    size_t n = hex.length();
+    bool jump_last = false;
+
+    while (i < n) {
+        char c = hex[i];
+        if (c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '{' || c == '}') {
+            i++;
+            continue;
+        }
+
+        if (c == '[') {
+            // Bounded jump [n] or [n-m]; a jump can neither start nor end a string
+            int close = hex.indexOf(']', i);
+            if (close < 0 || positions.empty()) return false;
+            String range = hex.substring(i + 1, close);
+            range.trim();
+            int dash = range.indexOf('-');
+            long low, high;
+            if (dash < 0) {
+                low = high = range.toInt();
+            } else {
+                String low_text = range.substring(0, dash);
+                String high_text = range.substring(dash + 1);
+                low_text.trim();
+                high_text.trim();
+                if (high_text.length() == 0) return false;   // Unbounded
+                low = low_text.length() ? low_text.toInt() : 0;
+                high = high_text.toInt();
+            }
+            if (low < 0 || high < low || positions.size() + high > MAX_POSITIONS) return false;
+
+            Position any = {0, 0, false};
+            for (long k = 0; k < low; k++) positions.push_back(any);
+            any.optional = true;
+            for (long k = low; k < high; k++) positions.push_back(any);
+            i = close + 1;
+            jump_last = true;
+            continue;
+        }
+
+        // Byte with optional nibble wildcards
+        if (i + 1 >= n) return false;
+        char hi = hex[i];
+        char lo = hex[i + 1];
+        Position pos = {0, 0, false};
+        if (hi != '?') {
+            int v = hexNibble(hi);
+            if (v < 0) return false;
+            pos.value |= v << 4;
+            pos.mask |= 0xF0;
+        }
+        if (lo != '?') {
+            int v = hexNibble(lo);
+            if (v < 0) return false;
+            pos.value |= v;
+            pos.mask |= 0x0F;
+        }
+        positions.push_back(pos);
+        i += 2;
+        jump_last = false;
+
+        if (positions.size() > MAX_POSITIONS) return false;
+    }
+
+    return !positions.empty() && !jump_last;
+}
+
+int HexPatternMatcher::addPattern(const String& hex) {
+    std::vector<Position> positions;
+    if (!parse(hex, positions) || patterns.size() >= 0xFFFF) {
+        return -1;
+    }
+
+    uint16_t min_length = 0;
+    for (const Position& pos : positions) {
+        if (!pos.optional) min_length++;
+    }
+
+    patterns.push_back(positions);
+    min_lengths.push_back(min_length);
+    compiled = false;
+    return (int)patterns.size() - 1;
+}
+
+void HexPatternMatcher::clear() {
+    patterns.clear();
+    min_lengths.clear();
+    byte_masks.clear();
+    word_bits.clear();
+    accept_ids.clear();
+    memset(first_bytes, 0, sizeof(first_bytes));
+    resetTables();
+    compiled = false;
+}
+
+bool HexPatternMatcher::attach(const Tables& external) {
+    if (!external.byte_masks || !external.word_bits || !external.accept_ids || !external.first_bytes) {
+        return false;
+    }
+
+    clear();
+    tables = external;
+    findSingleFirstByte();
+    compiled = true;
+    return true;
+}
+
+void HexPatternMatcher::findSingleFirstByte() {
+    single_first_byte = -1;
+    for (int b = 0; b < 256; b++) {
+        if (!(tables.first_bytes[b >> 3] & (1 << (b & 7)))) continue;
+        if (single_first_byte >= 0) {
+            single_first_byte = -1;
+            return;
+        }
+        single_first_byte = b;
+    }
+}
+
+bool HexPatternMatcher::compile() {
+    byte_masks.clear();
+    word_bits.clear();
+    accept_ids.clear();
+    memset(first_bytes, 0, sizeof(first_bytes));
+
+    // Pack patterns into 64-bit words, first fit in insertion order
+    size_t used = MAX_POSITIONS;
+    for (size_t p = 0; p < patterns.size(); p++) {
+        const std::vector<Position>& positions = patterns[p];
+
+        if (used + positions.size() > MAX_POSITIONS) {
+            byte_masks.resize(byte_masks.size() + 256, 0);
+            word_bits.resize(word_bits.size() + WORD_BITS_COUNT, 0);
+            accept_ids.resize(accept_ids.size() + 64, 0);
+            used = 0;
+        }
+
+        size_t w = word_bits.size() / WORD_BITS_COUNT - 1;
+        uint64_t* masks = &byte_masks[w * 256];
+        uint64_t* bits = &word_bits[w * WORD_BITS_COUNT];
+
+        for (size_t j = 0; j < positions.size(); j++) {
+            const Position& pos = positions[j];
+            uint64_t bit = 1ULL << (used + j);
+
+            for (int c = 0; c < 256; c++) {
+                if ((c & pos.mask) == pos.value) masks[c] |= bit;
+            }
+
+            if (pos.optional) {
+                bits[WORD_OPTIONAL] |= bit;
+                if (!positions[j - 1].optional) bits[WORD_OPT_BEFORE] |= bit >> 1;
+                if (!positions[j + 1].optional) bits[WORD_OPT_LAST] |= bit;
+            }
+        }
+
+        bits[WORD_STARTS] |= 1ULL << used;
+        bits[WORD_ACCEPTS] |= 1ULL << (used + positions.size() - 1);
+        accept_ids[w * 64 + used + positions.size() - 1] = (uint16_t)p;
+
+        const Position& first = positions[0];
+        for (int c = 0; c < 256; c++) {
+            if ((c & first.mask) == first.value) first_bytes[c >> 3] |= 1 << (c & 7);
+        }
+
+        used += positions.size();
+    }
+
+    tables.byte_masks = byte_masks.data();
+    tables.word_bits = word_bits.data();
+    tables.accept_ids = accept_ids.data();
+    tables.first_bytes = first_bytes;
+    tables.word_count = word_bits.size() / WORD_BITS_COUNT;
+    tables.pattern_count = patterns.size();
+    findSingleFirstByte();
+    compiled = true;
+
+    Serial.printf("[HexMatcher] Compiled %u hex patterns into %u words\n",
+                  (unsigned)patterns.size(), (unsigned)tables.word_count);
+    return true;
+}
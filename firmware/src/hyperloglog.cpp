@@ -0,0 +1,106 @@
+#include "hyperloglog.h"
+#include <math.h>
+#include <string.h>
+
+HyperLogLog::HyperLogLog(uint8_t precision) {
+    if (precision < HLL_MIN_PRECISION) precision = HLL_MIN_PRECISION;
+    if (precision > HLL_MAX_PRECISION) precision = HLL_MAX_PRECISION;
+    this->precision = precision;
+    clear();
+}
+
+void HyperLogLog::clear() {
+    registers.assign((size_t)1 << precision, 0);
+    memset(histogram, 0, sizeof(histogram));
+    histogram[0] = registers.size();
+    cached_estimate = 0;
+}
+
+uint64_t HyperLogLog::hashText(const char* text, size_t length) {
+    // 64-bit FNV-1a, then the MurmurHash3 finaliser so every bit depends on every byte
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < length; i++) {
+        hash = (hash ^ (uint8_t)text[i]) * 1099511628211ULL;
+    }
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDULL;
+    hash ^= hash >> 33;
+    hash *= 0xC4CEB9FE1A85EC53ULL;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+void HyperLogLog::add(uint64_t hash) {
+    size_t index = hash >> (64 - precision);
+
+    // Leading zeros of the remaining bits, plus one; a sentinel bit caps the run
+    uint64_t rest = (hash << precision) | ((uint64_t)1 << (precision - 1));
+    uint8_t rank = __builtin_clzll(rest) + 1;
+
+    if (rank > registers[index]) {
+        setRegister(index, rank);
+        updateEstimate();
+    }
+}
+
+void HyperLogLog::merge(const HyperLogLog& other) {
+    if (other.precision != precision) return;
+
+    for (size_t i = 0; i < registers.size(); i++) {
+        if (other.registers[i] > registers[i]) {
+            setRegister(i, other.registers[i]);
+        }
+    }
+    updateEstimate();
+}
+
+void HyperLogLog::setRegister(size_t index, uint8_t value) {
+    histogram[registers[index]]--;
+    histogram[value]++;
+    registers[index] = value;
+}
+
+// sigma(x) = x + sum over k >= 1 of x^(2^k) * 2^(k-1); accounts for the empty registers
+static double hllSigma(double x) {
+    if (x == 1.0) return INFINITY;
+    double y = 1.0;
+    double z = x;
+    double previous;
+    do {
+        x *= x;
+        previous = z;
+        z += x * y;
+        y += y;
+    } while (z != previous);
+    return z;
+}
+
+// tau(x) = (1 - x - sum over k >= 1 of (1 - x^(2^-k))^2 * 2^-k) / 3; accounts for the full registers
+static double hllTau(double x) {
+    if (x == 0.0 || x == 1.0) return 0.0;
+    double y = 1.0;
+    double z = 1.0 - x;
+    double previous;
+    do {
+        x = sqrt(x);
+        previous = z;
+        y *= 0.5;
+        z -= (1.0 - x) * (1.0 - x) * y;
+    } while (z != previous);
+    return z / 3.0;
+}
+
+void HyperLogLog::updateEstimate() {
+    double m = registers.size();
+    int q = 64 - precision;
+
+    double z = m * hllTau(1.0 - histogram[q + 1] / m);
+    for (int k = q; k >= 1; k--) {
+        z = 0.5 * (z + histogram[k]);
+    }
+    z += m * hllSigma(histogram[0] / m);
+
+    // alpha_inf = 1 / (2 ln 2)
+    double estimate = 0.5 / log(2.0) * m * m / z;
+    cached_estimate = estimate < 4294967295.0 ? (uint32_t)(estimate + 0.5) : 0xFFFFFFFF;
+}
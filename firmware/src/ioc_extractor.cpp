@@ -1,11 +1,17 @@
 #include "ioc_extractor.h"
-#include <regex>
+#include "ioc_lexer.h"
+
+// Built once; the tables are read-only afterwards
+static const IOCLexer ioc_lexer;
 
 IOCExtractor::IOCExtractor() {
     storage = nullptr;
+    watchlist = nullptr;
     filter_private_ips = true;
     filter_localhost = true;
     min_confidence = 50;
+    marks_loaded = false;
+    marks_dirty = false;
 }
 
 IOCExtractor::~IOCExtractor() {
@@ -17,22 +23,25 @@ void IOCExtractor::begin(FRFDStorage* storage_ptr) {
 }
 
 void IOCExtractor::initializeWhitelists() {
-    // Common legitimate domains to filter out
-    domain_whitelist.insert("microsoft.com");
-    domain_whitelist.insert("windows.com");
-    domain_whitelist.insert("apple.com");
-    domain_whitelist.insert("google.com");
-    domain_whitelist.insert("mozilla.org");
-    domain_whitelist.insert("ubuntu.com");
-    domain_whitelist.insert("debian.org");
-    domain_whitelist.insert("redhat.com");
-    domain_whitelist.insert("localhost");
-    domain_whitelist.insert("local");
-
-    // Localhost IPs
-    ip_whitelist.insert("127.0.0.1");
-    ip_whitelist.insert("::1");
-    ip_whitelist.insert("0.0.0.0");
+    // Common legitimate domains to filter out, with all their subdomains
+    domain_suffixes.clear();
+    domain_suffixes.add("microsoft.com", DOMAIN_ALLOW);
+    domain_suffixes.add("windows.com", DOMAIN_ALLOW);
+    domain_suffixes.add("apple.com", DOMAIN_ALLOW);
+    domain_suffixes.add("google.com", DOMAIN_ALLOW);
+    domain_suffixes.add("mozilla.org", DOMAIN_ALLOW);
+    domain_suffixes.add("ubuntu.com", DOMAIN_ALLOW);
+    domain_suffixes.add("debian.org", DOMAIN_ALLOW);
+    domain_suffixes.add("redhat.com", DOMAIN_ALLOW);
+    domain_suffixes.add("localhost", DOMAIN_ALLOW);
+    domain_suffixes.add("local", DOMAIN_ALLOW);
+
+    // Private and loopback ranges, plus addresses that are never worth reporting
+    ip_ranges.clear();
+    ip_ranges.addDefaultRanges();
+    ip_ranges.add("127.0.0.1", CIDR_ALLOW);
+    ip_ranges.add("::1", CIDR_ALLOW);
+    ip_ranges.add("0.0.0.0", CIDR_ALLOW);
 }
 
 bool IOCExtractor::extractFromFile(const String& file_path) {
@@ -40,33 +49,114 @@ bool IOCExtractor::extractFromFile(const String& file_path) {
         return false;
     }
 
-    String content = storage->readFile(file_path);
-    if (content.isEmpty()) {
+    File file = storage->openFile(file_path);
+    if (!file) {
+        return false;
+    }
+
+    uint32_t size = file.size();
+    if (size == 0) {
+        file.close();
         return false;
     }
 
-    // Extract all IOC types
-    auto ips = extractIPAddresses(content, file_path);
-    auto domains = extractDomains(content, file_path);
-    auto urls = extractURLs(content, file_path);
-    auto hashes = extractFileHashes(content, file_path);
-    auto emails = extractEmails(content, file_path);
-    auto registry = extractRegistryKeys(content, file_path);
-    auto paths = extractFilePaths(content, file_path);
-    auto mutexes = extractMutexes(content, file_path);
-    auto cves = extractCVEs(content, file_path);
-
-    // Add all to master list
-    for (const auto& ioc : ips) addIOC(ioc);
-    for (const auto& ioc : domains) addIOC(ioc);
-    for (const auto& ioc : urls) addIOC(ioc);
-    for (const auto& ioc : hashes) addIOC(ioc);
-    for (const auto& ioc : emails) addIOC(ioc);
-    for (const auto& ioc : registry) addIOC(ioc);
-    for (const auto& ioc : paths) addIOC(ioc);
-    for (const auto& ioc : mutexes) addIOC(ioc);
-    for (const auto& ioc : cves) addIOC(ioc);
+    // Resume after the high-water mark if the part already seen is unchanged
+    uint32_t offset = 0;
+    uint32_t seen_size = 0;
+    auto mark = file_marks.find(file_path);
+    if (mark != file_marks.end()) {
+        if (size >= mark->second.size && hashFileTail(file, mark->second.size) == mark->second.tail_hash) {
+            if (size == mark->second.size) {
+                file.close();
+                return true;
+            }
+            offset = mark->second.offset;
+            seen_size = mark->second.size;
+        } else {
+            Serial.printf("[IOC] %s changed, extracting from the start\n", file_path.c_str());
+        }
+    }
+
+    // Window: partial line carried over | new chunk
+    const size_t window_size = IOC_EXTRACT_MAX_LINE + IOC_EXTRACT_CHUNK_SIZE;
+    char* window = (char*)malloc(window_size);
+    if (!window) {
+        file.close();
+        return false;
+    }
 
+    if (!file.seek(offset)) {
+        free(window);
+        file.close();
+        return false;
+    }
+
+    uint16_t source = store.internSource(file_path);
+    uint32_t window_pos = offset;       // File offset of window[0], a line start unless a long line was split
+    uint32_t line_start = offset;       // File offset of the start of the last unterminated line
+    size_t filled = 0;
+
+    while (true) {
+        // Less than IOC_EXTRACT_MAX_LINE is ever carried over, so a whole chunk fits
+        size_t n = file.read((uint8_t*)window + filled, min(window_size - filled, (size_t)IOC_EXTRACT_CHUNK_SIZE));
+        bool eof = n == 0;
+        filled += n;
+
+        size_t nl = filled;
+        while (nl > 0 && window[nl - 1] != '\n') nl--;
+        if (nl > 0) line_start = window_pos + nl;
+
+        // Lex whole lines only; no IOC spans a line break, so nothing is cut in two.
+        // A line too long to carry over is split at its last blank, or where the
+        // chunk ends if the rest of it would still be too long.
+        size_t cut = filled;
+        if (!eof) {
+            if (nl > 0 && filled - nl < IOC_EXTRACT_MAX_LINE) {
+                cut = nl;
+            } else if (nl == 0 && filled < IOC_EXTRACT_MAX_LINE) {
+                continue;
+            } else {
+                size_t blank = filled;
+                while (blank > 0 && window[blank - 1] != ' ' && window[blank - 1] != '\t') blank--;
+                if (blank > 0 && filled - blank < IOC_EXTRACT_MAX_LINE) cut = blank;
+            }
+        }
+
+        // Only the location of each IOC is kept; its context stays in the artifact
+        size_t min_end = seen_size > window_pos ? seen_size - window_pos : 0;
+        uint32_t now = millis();
+        ioc_lexer.scan((const uint8_t*)window, cut,
+            [&](IOCType type, size_t start, size_t end) {
+                if (end <= min_end) return;
+
+                String value;
+                uint8_t confidence;
+                if (!checkIOC(type, window, start, end, value, confidence)) return;
+
+                uint32_t position = window_pos + start;
+                uint32_t entry = store.add(type, value.c_str(), value.length(), confidence, source, position,
+                                           min(position, (uint32_t)IOC_CONTEXT_CHARS), IOC_CONTEXT_CHARS, now);
+                checkWatchlist(entry);
+            });
+
+        if (eof) break;
+
+        // Carry over what was not lexed: a partial line, or the rest of a split one
+        memmove(window, window + cut, filled - cut);
+        window_pos += cut;
+        filled -= cut;
+    }
+
+    free(window);
+
+    // Resume at the start of the unterminated line, even if it was split
+    IOCFileMark& new_mark = file_marks[file_path];
+    new_mark.offset = line_start;
+    new_mark.size = window_pos + filled;
+    new_mark.tail_hash = hashFileTail(file, new_mark.size);
+    marks_dirty = true;
+
+    file.close();
     return true;
 }
 
@@ -74,9 +164,11 @@ bool IOCExtractor::extractFromDirectory(const String& dir_path) {
     if (!storage) return false;
 
     std::vector<String> files = storage->getFileList(dir_path);
+    String marks_path = getMarksPath();
 
     for (const auto& file : files) {
         String full_path = dir_path + "/" + file;
+        if (full_path == marks_path) continue;
         extractFromFile(full_path);
     }
 
@@ -89,439 +181,342 @@ bool IOCExtractor::extractFromAllArtifacts() {
     String case_dir = storage->getCaseDirectory();
     if (case_dir.isEmpty()) return false;
 
-    return extractFromDirectory(case_dir);
-}
+    if (!marks_loaded) loadFileMarks();
 
-std::vector<IOC> IOCExtractor::extractIPAddresses(const String& content, const String& source) {
-    std::vector<IOC> found_iocs;
+    bool result = extractFromDirectory(case_dir);
+    if (marks_dirty) saveFileMarks();
+
+    return result;
+}
 
-    // IPv4 pattern: xxx.xxx.xxx.xxx
-    int pos = 0;
-    while (pos < content.length()) {
-        // Find potential IP start (digit after non-alphanumeric)
-        while (pos < content.length() && !isdigit(content[pos])) pos++;
-        if (pos >= content.length()) break;
+// High-water marks
 
-        int start = pos;
-        String potential_ip = "";
+String IOCExtractor::getMarksPath() const {
+    if (!storage) return "";
 
-        // Extract potential IP (digits and dots)
-        while (pos < content.length() && (isdigit(content[pos]) || content[pos] == '.')) {
-            potential_ip += content[pos];
-            pos++;
-        }
+    String case_dir = storage->getCaseDirectory();
+    if (case_dir.isEmpty()) return "";
 
-        // Validate IP
-        if (isValidIPv4(potential_ip)) {
-            // Apply filters
-            if (filter_localhost && (potential_ip == "127.0.0.1" || potential_ip.startsWith("127."))) {
-                continue;
-            }
-            if (filter_private_ips && isPrivateIP(potential_ip)) {
-                continue;
-            }
-            if (isInWhitelist(potential_ip, IOC_IP_ADDRESS)) {
-                continue;
-            }
+    return case_dir + "/" + IOC_MARKS_FILE;
+}
 
-            IOC ioc;
-            ioc.type = IOC_IP_ADDRESS;
-            ioc.value = potential_ip;
-            ioc.source_artifact = source;
-            ioc.context = content.substring(max(0, start - 20), min((int)content.length(), pos + 20));
-            ioc.timestamp = millis();
-            ioc.confidence = calculateConfidence(potential_ip, IOC_IP_ADDRESS);
+uint32_t IOCExtractor::hashFileTail(File& file, uint32_t end) {
+    uint32_t start = end > IOC_MARK_HASH_BYTES ? end - IOC_MARK_HASH_BYTES : 0;
+    uint8_t tail[IOC_MARK_HASH_BYTES];
 
-            if (ioc.confidence >= min_confidence) {
-                found_iocs.push_back(ioc);
-            }
-        }
+    uint32_t hash = 2166136261UL;
+    if (!file.seek(start) || file.read(tail, end - start) != end - start) {
+        return hash ^ 1;    // Unreadable never matches an empty tail
     }
-
-    return found_iocs;
+    for (uint32_t i = 0; i < end - start; i++) {
+        hash = (hash ^ tail[i]) * 16777619UL;
+    }
+    return hash;
 }
 
-std::vector<IOC> IOCExtractor::extractDomains(const String& content, const String& source) {
-    std::vector<IOC> found_iocs;
+bool IOCExtractor::loadFileMarks() {
+    file_marks.clear();
+    marks_loaded = true;
+    marks_dirty = false;
 
-    // Domain pattern: word.word.tld
-    int pos = 0;
-    while (pos < content.length()) {
-        // Find potential domain start
-        if (isalnum(content[pos])) {
-            int start = pos;
-            String potential_domain = "";
-
-            // Extract potential domain (alphanumeric, dots, hyphens)
-            while (pos < content.length() &&
-                   (isalnum(content[pos]) || content[pos] == '.' || content[pos] == '-')) {
-                potential_domain += content[pos];
-                pos++;
-            }
+    String path = getMarksPath();
+    if (path.isEmpty() || !storage->fileExists(path)) return false;
 
-            // Validate domain
-            if (isValidDomain(potential_domain) && !isInWhitelist(potential_domain, IOC_DOMAIN)) {
-                IOC ioc;
-                ioc.type = IOC_DOMAIN;
-                ioc.value = potential_domain;
-                ioc.source_artifact = source;
-                ioc.context = content.substring(max(0, start - 20), min((int)content.length(), pos + 20));
-                ioc.timestamp = millis();
-                ioc.confidence = calculateConfidence(potential_domain, IOC_DOMAIN);
-
-                if (ioc.confidence >= min_confidence) {
-                    found_iocs.push_back(ioc);
-                }
-            }
-        } else {
-            pos++;
+    // One mark per line: offset size tail_hash path
+    File file = storage->openFile(path);
+    if (!file) return false;
+
+    while (file.available()) {
+        String line = file.readStringUntil('\n');
+        unsigned long offset, size, hash;
+        int path_start = 0;
+        if (sscanf(line.c_str(), "%lu %lu %lx %n", &offset, &size, &hash, &path_start) != 3 ||
+            path_start == 0 || path_start >= (int)line.length()) {
+            continue;
         }
+
+        IOCFileMark& mark = file_marks[line.substring(path_start)];
+        mark.offset = offset;
+        mark.size = size;
+        mark.tail_hash = hash;
     }
+    file.close();
 
-    return found_iocs;
+    Serial.printf("[IOC] Loaded %u extraction marks\n", (unsigned)file_marks.size());
+    return true;
 }
 
-std::vector<IOC> IOCExtractor::extractURLs(const String& content, const String& source) {
-    std::vector<IOC> found_iocs;
+bool IOCExtractor::saveFileMarks() {
+    String path = getMarksPath();
+    if (path.isEmpty()) return false;
 
-    // URL patterns
-    const char* protocols[] = {"http://", "https://", "ftp://", "file://"};
-
-    for (const char* proto : protocols) {
-        int pos = content.indexOf(proto);
-        while (pos >= 0) {
-            int start = pos;
-            int end = pos + strlen(proto);
-
-            // Extract URL until whitespace or quote
-            while (end < content.length() &&
-                   content[end] != ' ' && content[end] != '\n' &&
-                   content[end] != '\r' && content[end] != '"' &&
-                   content[end] != '\'' && content[end] != '<' && content[end] != '>') {
-                end++;
-            }
+    String content;
+    char fields[40];
+    for (const auto& entry : file_marks) {
+        snprintf(fields, sizeof(fields), "%lu %lu %08lx ", (unsigned long)entry.second.offset,
+                 (unsigned long)entry.second.size, (unsigned long)entry.second.tail_hash);
+        content += fields;
+        content += entry.first;
+        content += "\n";
+    }
 
-            String url = content.substring(start, end);
+    if (!storage->writeFile(path, content)) return false;
+    marks_dirty = false;
+    return true;
+}
 
-            IOC ioc;
-            ioc.type = IOC_URL;
-            ioc.value = url;
-            ioc.source_artifact = source;
-            ioc.context = content.substring(max(0, start - 20), min((int)content.length(), end + 20));
-            ioc.timestamp = millis();
-            ioc.confidence = calculateConfidence(url, IOC_URL);
+void IOCExtractor::resetFileMarks() {
+    file_marks.clear();
+    marks_loaded = true;
+    marks_dirty = true;
+}
 
-            if (ioc.confidence >= min_confidence) {
-                found_iocs.push_back(ioc);
-            }
+// Lexing
 
-            pos = content.indexOf(proto, end);
-        }
+// Length of "CVE-YYYY-NNNN..." at the start of a candidate span, or 0
+static size_t cveLength(const char* text, size_t len) {
+    if (len < 13) return 0;
+    for (size_t i = 4; i < 8; i++) {
+        if (!isdigit(text[i])) return 0;
     }
+    if (text[8] != '-') return 0;
 
-    return found_iocs;
+    size_t end = 9;
+    while (end < len && isdigit(text[end])) end++;
+    return end - 9 >= 4 ? end : 0;
 }
 
-std::vector<IOC> IOCExtractor::extractFileHashes(const String& content, const String& source) {
-    std::vector<IOC> found_iocs;
-
-    // Look for hash patterns (hex strings of specific lengths)
-    int pos = 0;
-    while (pos < content.length()) {
-        if (isxdigit(content[pos])) {
-            int start = pos;
-            String hex_string = "";
-
-            // Extract hex characters
-            while (pos < content.length() && isxdigit(content[pos])) {
-                hex_string += content[pos];
-                pos++;
-            }
+void IOCExtractor::lexContent(const String& content, const String& source, uint32_t type_mask,
+                              std::vector<IOC>& found_iocs) {
+    // One pass classifies every indicator type; only the candidate spans are validated
+    const char* data = content.c_str();
+    ioc_lexer.scan((const uint8_t*)data, content.length(),
+        [&](IOCType type, size_t start, size_t end) {
+            if (!(type_mask & (1UL << type))) return;
 
-            IOCType hash_type = IOC_UNKNOWN;
+            IOC ioc;
+            if (!checkIOC(type, data, start, end, ioc.value, ioc.confidence)) return;
 
-            // Determine hash type by length
-            if (hex_string.length() == 32 && isValidMD5(hex_string)) {
-                hash_type = IOC_FILE_HASH_MD5;
-            } else if (hex_string.length() == 40 && isValidSHA1(hex_string)) {
-                hash_type = IOC_FILE_HASH_SHA1;
-            } else if (hex_string.length() == 64 && isValidSHA256(hex_string)) {
-                hash_type = IOC_FILE_HASH_SHA256;
-            }
+            ioc.type = type;
+            ioc.source_artifact = source;
+            ioc.context = content.substring(start >= IOC_CONTEXT_CHARS ? start - IOC_CONTEXT_CHARS : 0,
+                                            min((size_t)content.length(), end + IOC_CONTEXT_CHARS));
+            ioc.timestamp = millis();
+            found_iocs.push_back(ioc);
+        });
+}
 
-            if (hash_type != IOC_UNKNOWN) {
-                IOC ioc;
-                ioc.type = hash_type;
-                ioc.value = hex_string;
-                ioc.source_artifact = source;
-                ioc.context = content.substring(max(0, start - 20), min((int)content.length(), pos + 20));
-                ioc.timestamp = millis();
-                ioc.confidence = calculateConfidence(hex_string, hash_type);
-
-                if (ioc.confidence >= min_confidence) {
-                    found_iocs.push_back(ioc);
-                }
-            }
-        } else {
-            pos++;
-        }
+bool IOCExtractor::checkIOC(IOCType type, const char* data, size_t start, size_t& end,
+                            String& value, uint8_t& confidence) {
+    if (type == IOC_CVE) {
+        end = start + cveLength(data + start, end - start);
+        if (end == start) return false;
     }
 
-    return found_iocs;
-}
-
-std::vector<IOC> IOCExtractor::extractEmails(const String& content, const String& source) {
-    std::vector<IOC> found_iocs;
+    value = "";
+    value.concat(data + start, end - start);
 
-    // Email pattern: word@domain.tld
-    int pos = 0;
-    while (pos < content.length()) {
-        int at_pos = content.indexOf('@', pos);
-        if (at_pos < 0) break;
-
-        // Extract backwards to start
-        int start = at_pos - 1;
-        while (start >= 0 && (isalnum(content[start]) || content[start] == '.' ||
-                              content[start] == '_' || content[start] == '-')) {
-            start--;
+    switch (type) {
+        case IOC_IP_ADDRESS: {
+            if (!isValidIPv4(value)) return false;
+
+            // One longest-prefix lookup covers the loopback, private and whitelist filters;
+            // a deny range inside a private one still gets reported
+            CidrTag range = ip_ranges.lookup(value);
+            if (range == CIDR_ALLOW) return false;
+            if (filter_localhost && range == CIDR_LOOPBACK) return false;
+            if (filter_private_ips && range == CIDR_PRIVATE) return false;
+            break;
         }
-        start++;
 
-        // Extract forwards to end
-        int end = at_pos + 1;
-        while (end < content.length() && (isalnum(content[end]) || content[end] == '.' ||
-                                          content[end] == '-')) {
-            end++;
-        }
+        case IOC_DOMAIN:
+            if (!isValidDomain(value) || isInWhitelist(value, IOC_DOMAIN)) return false;
+            break;
 
-        String email = content.substring(start, end);
+        case IOC_EMAIL:
+            if (!isValidEmail(value)) return false;
+            break;
 
-        if (isValidEmail(email)) {
-            IOC ioc;
-            ioc.type = IOC_EMAIL;
-            ioc.value = email;
-            ioc.source_artifact = source;
-            ioc.context = content.substring(max(0, start - 20), min((int)content.length(), end + 20));
-            ioc.timestamp = millis();
-            ioc.confidence = calculateConfidence(email, IOC_EMAIL);
+        default:
+            break;
+    }
 
-            if (ioc.confidence >= min_confidence) {
-                found_iocs.push_back(ioc);
-            }
-        }
+    confidence = calculateConfidence(value, type);
+    return confidence >= min_confidence;
+}
 
-        pos = at_pos + 1;
-    }
+// Pattern matching, one IOC type at a time
 
+std::vector<IOC> IOCExtractor::extractIPAddresses(const String& content, const String& source) {
+    std::vector<IOC> found_iocs;
+    lexContent(content, source, 1UL << IOC_IP_ADDRESS, found_iocs);
     return found_iocs;
 }
 
-std::vector<IOC> IOCExtractor::extractRegistryKeys(const String& content, const String& source) {
+std::vector<IOC> IOCExtractor::extractDomains(const String& content, const String& source) {
     std::vector<IOC> found_iocs;
+    lexContent(content, source, 1UL << IOC_DOMAIN, found_iocs);
+    return found_iocs;
+}
 
-    // Registry key patterns: HKLM\, HKCU\, HKEY_
-    const char* prefixes[] = {"HKLM\\", "HKCU\\", "HKCR\\", "HKU\\", "HKEY_LOCAL_MACHINE\\", "HKEY_CURRENT_USER\\"};
-
-    for (const char* prefix : prefixes) {
-        int pos = content.indexOf(prefix);
-        while (pos >= 0) {
-            int start = pos;
-            int end = pos + strlen(prefix);
-
-            // Extract until newline or certain characters
-            while (end < content.length() && content[end] != '\n' && content[end] != '\r' &&
-                   content[end] != '"' && content[end] != '<' && content[end] != '>') {
-                end++;
-            }
-
-            String reg_key = content.substring(start, end);
-
-            IOC ioc;
-            ioc.type = IOC_REGISTRY_KEY;
-            ioc.value = reg_key;
-            ioc.source_artifact = source;
-            ioc.context = content.substring(max(0, start - 20), min((int)content.length(), end + 20));
-            ioc.timestamp = millis();
-            ioc.confidence = calculateConfidence(reg_key, IOC_REGISTRY_KEY);
+std::vector<IOC> IOCExtractor::extractURLs(const String& content, const String& source) {
+    std::vector<IOC> found_iocs;
+    lexContent(content, source, 1UL << IOC_URL, found_iocs);
+    return found_iocs;
+}
 
-            if (ioc.confidence >= min_confidence) {
-                found_iocs.push_back(ioc);
-            }
+std::vector<IOC> IOCExtractor::extractFileHashes(const String& content, const String& source) {
+    std::vector<IOC> found_iocs;
+    lexContent(content, source,
+               (1UL << IOC_FILE_HASH_MD5) | (1UL << IOC_FILE_HASH_SHA1) | (1UL << IOC_FILE_HASH_SHA256),
+               found_iocs);
+    return found_iocs;
+}
 
-            pos = content.indexOf(prefix, end);
-        }
-    }
+std::vector<IOC> IOCExtractor::extractEmails(const String& content, const String& source) {
+    std::vector<IOC> found_iocs;
+    lexContent(content, source, 1UL << IOC_EMAIL, found_iocs);
+    return found_iocs;
+}
 
+std::vector<IOC> IOCExtractor::extractRegistryKeys(const String& content, const String& source) {
+    std::vector<IOC> found_iocs;
+    lexContent(content, source, 1UL << IOC_REGISTRY_KEY, found_iocs);
     return found_iocs;
 }
 
 std::vector<IOC> IOCExtractor::extractFilePaths(const String& content, const String& source) {
     std::vector<IOC> found_iocs;
-
-    // Windows paths: C:\, D:\, etc.
-    // Linux paths: /usr/, /etc/, /tmp/, etc.
-    const char* path_indicators[] = {"C:\\", "D:\\", "E:\\", "F:\\", "/usr/", "/etc/", "/tmp/", "/var/", "/home/"};
-
-    for (const char* indicator : path_indicators) {
-        int pos = content.indexOf(indicator);
-        while (pos >= 0) {
-            int start = pos;
-            int end = pos + strlen(indicator);
-
-            // Extract path
-            while (end < content.length() && content[end] != '\n' && content[end] != '\r' &&
-                   content[end] != '"' && content[end] != '<' && content[end] != '>' &&
-                   content[end] != ' ') {
-                end++;
-            }
-
-            String file_path = content.substring(start, end);
-
-            // Filter out very short paths
-            if (file_path.length() > strlen(indicator) + 3) {
-                IOC ioc;
-                ioc.type = IOC_FILE_PATH;
-                ioc.value = file_path;
-                ioc.source_artifact = source;
-                ioc.context = content.substring(max(0, start - 20), min((int)content.length(), end + 20));
-                ioc.timestamp = millis();
-                ioc.confidence = calculateConfidence(file_path, IOC_FILE_PATH);
-
-                if (ioc.confidence >= min_confidence) {
-                    found_iocs.push_back(ioc);
-                }
-            }
-
-            pos = content.indexOf(indicator, end);
-        }
-    }
-
+    lexContent(content, source, 1UL << IOC_FILE_PATH, found_iocs);
     return found_iocs;
 }
 
 std::vector<IOC> IOCExtractor::extractMutexes(const String& content, const String& source) {
     std::vector<IOC> found_iocs;
+    lexContent(content, source, 1UL << IOC_MUTEX, found_iocs);
+    return found_iocs;
+}
 
-    // Look for mutex patterns (often have specific prefixes)
-    const char* mutex_indicators[] = {"Global\\", "Local\\", "Session\\", "BaseNamedObjects\\"};
-
-    for (const char* indicator : mutex_indicators) {
-        int pos = content.indexOf(indicator);
-        while (pos >= 0) {
-            int start = pos;
-            int end = pos + strlen(indicator);
-
-            // Extract mutex name
-            while (end < content.length() && (isalnum(content[end]) || content[end] == '_' ||
-                                               content[end] == '-' || content[end] == '{' ||
-                                               content[end] == '}')) {
-                end++;
-            }
-
-            String mutex = content.substring(start, end);
+std::vector<IOC> IOCExtractor::extractCVEs(const String& content, const String& source) {
+    std::vector<IOC> found_iocs;
+    lexContent(content, source, 1UL << IOC_CVE, found_iocs);
+    return found_iocs;
+}
 
-            if (mutex.length() > strlen(indicator) + 3) {
-                IOC ioc;
-                ioc.type = IOC_MUTEX;
-                ioc.value = mutex;
-                ioc.source_artifact = source;
-                ioc.context = content.substring(max(0, start - 20), min((int)content.length(), end + 20));
-                ioc.timestamp = millis();
-                ioc.confidence = calculateConfidence(mutex, IOC_MUTEX);
+void IOCExtractor::addIOC(const IOC& ioc) {
+    uint32_t entry = store.addWithContext(ioc.type, ioc.value.c_str(), ioc.value.length(), ioc.confidence,
+                                          store.internSource(ioc.source_artifact), ioc.context, ioc.timestamp);
+    checkWatchlist(entry);
+}
 
-                if (ioc.confidence >= min_confidence) {
-                    found_iocs.push_back(ioc);
-                }
-            }
+void IOCExtractor::clearIOCs() {
+    store.clear();
+    ioc_list.clear();
+    unique_list.clear();
+    watchlist_hits.clear();
+}
+
+void IOCExtractor::checkWatchlist(uint32_t entry) {
+    // Only the first sighting of a value is looked up
+    const IOCStore::Entry& e = store.getEntry(entry);
+    if (e.count != 1) return;
+
+    WatchlistHit hit;
+    if (e.type == IOC_IP_ADDRESS) {
+        CidrMatch range;
+        ip_ranges.lookup(store.getValue(e), e.length, &range);
+        if (range.tag == CIDR_DENY || range.tag == CIDR_INTEL) {
+            hit.type = e.type;
+            hit.severity = range.severity;
+            hit.value = store.getValue(e);
+            hit.label = *range.label;
+            Serial.printf("[IOC] IP range hit: %s (%s)\n", hit.value.c_str(), hit.label.c_str());
+            watchlist_hits.push_back(hit);
+        }
+    }
 
-            pos = content.indexOf(indicator, end);
+    if (e.type == IOC_DOMAIN) {
+        DomainMatch suffix;
+        domain_suffixes.lookup(store.getValue(e), e.length, &suffix);
+        if (suffix.tag == DOMAIN_DENY || suffix.tag == DOMAIN_INTEL) {
+            hit.type = e.type;
+            hit.severity = suffix.severity;
+            hit.value = store.getValue(e);
+            hit.label = *suffix.label;
+            Serial.printf("[IOC] Domain suffix hit: %s (%s)\n", hit.value.c_str(), hit.label.c_str());
+            watchlist_hits.push_back(hit);
         }
     }
 
-    return found_iocs;
-}
+    if (!watchlist || !watchlist->isLoaded()) return;
 
-std::vector<IOC> IOCExtractor::extractCVEs(const String& content, const String& source) {
-    std::vector<IOC> found_iocs;
-
-    // CVE pattern: CVE-YYYY-NNNNN
-    int pos = content.indexOf("CVE-");
-    while (pos >= 0) {
-        int start = pos;
-        int end = pos + 4; // "CVE-"
-
-        // Extract year (4 digits)
-        if (end + 4 < content.length() && isdigit(content[end])) {
-            end += 4;
-
-            if (content[end] == '-') {
-                end++;
-
-                // Extract number (at least 4 digits)
-                int num_start = end;
-                while (end < content.length() && isdigit(content[end])) {
-                    end++;
-                }
-
-                if (end - num_start >= 4) {
-                    String cve = content.substring(start, end);
-
-                    IOC ioc;
-                    ioc.type = IOC_CVE;
-                    ioc.value = cve;
-                    ioc.source_artifact = source;
-                    ioc.context = content.substring(max(0, start - 20), min((int)content.length(), end + 20));
-                    ioc.timestamp = millis();
-                    ioc.confidence = 95; // CVEs are highly structured
-
-                    found_iocs.push_back(ioc);
-                }
-            }
-        }
+    switch (e.type) {
+        case IOC_IP_ADDRESS:
+        case IOC_DOMAIN:
+        case IOC_URL:
+        case IOC_FILE_HASH_MD5:
+        case IOC_FILE_HASH_SHA1:
+        case IOC_FILE_HASH_SHA256:
+            break;
+        default:
+            return;
+    }
 
-        pos = content.indexOf("CVE-", end);
+    if (watchlist->lookup(e.type, store.getValue(e), e.length, &hit)) {
+        Serial.printf("[IOC] Watchlist hit: %s (%s)\n", hit.value.c_str(), hit.label.c_str());
+        watchlist_hits.push_back(hit);
     }
+}
 
-    return found_iocs;
+IOC IOCExtractor::getIOC(size_t index) const {
+    const IOCStore::Occurrence& occurrence = store.getOccurrence(index);
+    const IOCStore::Entry& entry = store.getEntry(occurrence.entry);
+
+    IOC ioc;
+    ioc.type = (IOCType)entry.type;
+    ioc.value = store.getValue(entry);
+    ioc.source_artifact = store.getSource(occurrence.source);
+    ioc.timestamp = occurrence.timestamp;
+    ioc.confidence = entry.confidence;
+    return ioc;
 }
 
-void IOCExtractor::addIOC(const IOC& ioc) {
-    iocs.push_back(ioc);
+String IOCExtractor::getIOCContext(size_t index) const {
+    IOCStore::ContextReader reader(store, storage);
+    return reader.read(store.getOccurrence(index));
 }
 
-void IOCExtractor::clearIOCs() {
-    iocs.clear();
+const std::vector<IOC>& IOCExtractor::getIOCs() const {
+    // The store only grows until it is cleared, so only new occurrences are added
+    for (size_t i = ioc_list.size(); i < store.getOccurrenceCount(); i++) {
+        ioc_list.push_back(getIOC(i));
+    }
+    return ioc_list;
 }
 
 std::vector<IOC> IOCExtractor::getIOCsByType(IOCType type) const {
     std::vector<IOC> filtered;
-    for (const auto& ioc : iocs) {
-        if (ioc.type == type) {
-            filtered.push_back(ioc);
+    filtered.reserve(store.getTypeCount(type));
+    for (size_t i = 0; i < store.getOccurrenceCount(); i++) {
+        if (store.getEntry(store.getOccurrence(i).entry).type == type) {
+            filtered.push_back(getIOC(i));
         }
     }
     return filtered;
 }
 
-std::vector<IOC> IOCExtractor::getUniqueIOCs() const {
-    std::vector<IOC> unique;
-    std::set<String> seen;
-
-    for (const auto& ioc : iocs) {
-        String key = String(ioc.type) + ":" + ioc.value;
-        if (seen.find(key) == seen.end()) {
-            unique.push_back(ioc);
-            seen.insert(key);
-        }
+const std::vector<IOC>& IOCExtractor::getUniqueIOCs() const {
+    // Values are deduplicated on insert, and new values get new entries at the end
+    for (uint32_t e = unique_list.size(); e < store.getUniqueCount(); e++) {
+        unique_list.push_back(getIOC(store.getEntry(e).first));
     }
-
-    return unique;
+    return unique_list;
 }
 
 String IOCExtractor::exportToJSON() {
     String json = "{";
     json += "\"extraction_timestamp\":" + String(millis()) + ",";
-    json += "\"total_iocs\":" + String(iocs.size()) + ",";
+    json += "\"total_iocs\":" + String(store.getOccurrenceCount()) + ",";
 
     // Statistics
     auto stats = getStatistics();
@@ -533,25 +528,55 @@ String IOCExtractor::exportToJSON() {
     json += "\"emails\":" + String(stats.emails) + ",";
     json += "\"registry_keys\":" + String(stats.registry_keys) + ",";
     json += "\"file_paths\":" + String(stats.file_paths) + ",";
-    json += "\"unique_iocs\":" + String(stats.unique_iocs);
+    json += "\"unique_iocs\":" + String(stats.unique_iocs) + ",";
+    json += "\"watchlist_hits\":" + String(stats.watchlist_hits);
     json += "},";
 
-    // IOC list
+    // Threat-intel matches
+    json += "\"watchlist_hits\":[";
+    for (size_t i = 0; i < watchlist_hits.size(); i++) {
+        if (i > 0) json += ",";
+
+        String escapedLabel = watchlist_hits[i].label;
+        escapedLabel.replace("\\", "\\\\");
+        escapedLabel.replace("\"", "\\\"");
+
+        json += "{";
+        json += "\"type\":\"" + getIOCTypeName((IOCType)watchlist_hits[i].type) + "\",";
+        json += "\"value\":\"" + watchlist_hits[i].value + "\",";
+        json += "\"severity\":" + String(watchlist_hits[i].severity) + ",";
+        json += "\"label\":\"" + escapedLabel + "\"";
+        json += "}";
+    }
+    json += "],";
+
+    // IOC list; contexts are read back from the artifacts here
+    IOCStore::ContextReader contexts(store, storage);
     json += "\"iocs\":[";
-    for (size_t i = 0; i < iocs.size(); i++) {
+    for (size_t i = 0; i < store.getOccurrenceCount(); i++) {
+        const IOCStore::Occurrence& occurrence = store.getOccurrence(i);
+        const IOCStore::Entry& entry = store.getEntry(occurrence.entry);
         if (i > 0) json += ",";
 
         json += "{";
-        json += "\"type\":\"" + getIOCTypeName(iocs[i].type) + "\",";
+        json += "\"type\":\"" + getIOCTypeName((IOCType)entry.type) + "\",";
 
-        String escapedValue = iocs[i].value;
+        String escapedValue = store.getValue(entry);
         escapedValue.replace("\\", "\\\\");
         escapedValue.replace("\"", "\\\"");
         json += "\"value\":\"" + escapedValue + "\",";
 
-        json += "\"source\":\"" + iocs[i].source_artifact + "\",";
-        json += "\"confidence\":" + String(iocs[i].confidence) + ",";
-        json += "\"timestamp\":" + String(iocs[i].timestamp);
+        String escapedContext = contexts.read(occurrence);
+        escapedContext.replace("\\", "\\\\");
+        escapedContext.replace("\"", "\\\"");
+        escapedContext.replace("\r", " ");
+        escapedContext.replace("\n", " ");
+        escapedContext.replace("\t", " ");
+        json += "\"context\":\"" + escapedContext + "\",";
+
+        json += "\"source\":\"" + store.getSource(occurrence.source) + "\",";
+        json += "\"confidence\":" + String(entry.confidence) + ",";
+        json += "\"timestamp\":" + String(occurrence.timestamp);
         json += "}";
     }
     json += "]";
@@ -563,15 +588,18 @@ String IOCExtractor::exportToJSON() {
 String IOCExtractor::exportToCSV() {
     String csv = "Type,Value,Source,Confidence,Timestamp\n";
 
-    for (const auto& ioc : iocs) {
-        String escapedValue = ioc.value;
+    for (size_t i = 0; i < store.getOccurrenceCount(); i++) {
+        const IOCStore::Occurrence& occurrence = store.getOccurrence(i);
+        const IOCStore::Entry& entry = store.getEntry(occurrence.entry);
+
+        String escapedValue = store.getValue(entry);
         escapedValue.replace("\"", "\"\"");
 
-        csv += getIOCTypeName(ioc.type) + ",";
+        csv += getIOCTypeName((IOCType)entry.type) + ",";
         csv += "\"" + escapedValue + "\",";
-        csv += "\"" + ioc.source_artifact + "\",";
-        csv += String(ioc.confidence) + ",";
-        csv += String(ioc.timestamp) + "\n";
+        csv += "\"" + store.getSource(occurrence.source) + "\",";
+        csv += String(entry.confidence) + ",";
+        csv += String(occurrence.timestamp) + "\n";
     }
 
     return csv;
@@ -582,13 +610,15 @@ String IOCExtractor::exportToSTIX() {
     String stix = "{\"type\":\"bundle\",\"id\":\"bundle--" + String(millis()) + "\",";
     stix += "\"objects\":[";
 
-    for (size_t i = 0; i < iocs.size(); i++) {
+    for (size_t i = 0; i < store.getOccurrenceCount(); i++) {
+        const IOCStore::Occurrence& occurrence = store.getOccurrence(i);
+        const IOCStore::Entry& entry = store.getEntry(occurrence.entry);
         if (i > 0) stix += ",";
 
         stix += "{\"type\":\"indicator\",";
-        stix += "\"id\":\"indicator--" + String(iocs[i].timestamp) + "-" + String(i) + "\",";
-        stix += "\"pattern\":\"" + getIOCTypeName(iocs[i].type) + ":" + iocs[i].value + "\",";
-        stix += "\"confidence\":" + String(iocs[i].confidence) + "}";
+        stix += "\"id\":\"indicator--" + String(occurrence.timestamp) + "-" + String(i) + "\",";
+        stix += "\"pattern\":\"" + getIOCTypeName((IOCType)entry.type) + ":" + store.getValue(entry) + "\",";
+        stix += "\"confidence\":" + String(entry.confidence) + "}";
     }
 
     stix += "]}";
@@ -601,15 +631,17 @@ String IOCExtractor::exportToOpenIOC() {
     xml += "<ioc>\n";
     xml += "  <metadata>\n";
     xml += "    <timestamp>" + String(millis()) + "</timestamp>\n";
-    xml += "    <count>" + String(iocs.size()) + "</count>\n";
+    xml += "    <count>" + String(store.getOccurrenceCount()) + "</count>\n";
     xml += "  </metadata>\n";
     xml += "  <indicators>\n";
 
-    for (const auto& ioc : iocs) {
+    for (size_t i = 0; i < store.getOccurrenceCount(); i++) {
+        const IOCStore::Entry& entry = store.getEntry(store.getOccurrence(i).entry);
+
         xml += "    <indicator>\n";
-        xml += "      <type>" + getIOCTypeName(ioc.type) + "</type>\n";
-        xml += "      <value>" + ioc.value + "</value>\n";
-        xml += "      <confidence>" + String(ioc.confidence) + "</confidence>\n";
+        xml += "      <type>" + getIOCTypeName((IOCType)entry.type) + "</type>\n";
+        xml += "      <value>" + String(store.getValue(entry)) + "</value>\n";
+        xml += "      <confidence>" + String(entry.confidence) + "</confidence>\n";
         xml += "    </indicator>\n";
     }
 
@@ -638,47 +670,23 @@ bool IOCExtractor::saveToFile(const String& filename, const String& format) {
 }
 
 IOCStatistics IOCExtractor::getStatistics() const {
-    IOCStatistics stats = {0};
-    stats.total_iocs = iocs.size();
-
-    for (const auto& ioc : iocs) {
-        switch (ioc.type) {
-            case IOC_IP_ADDRESS:
-                stats.ip_addresses++;
-                break;
-            case IOC_DOMAIN:
-                stats.domains++;
-                break;
-            case IOC_URL:
-                stats.urls++;
-                break;
-            case IOC_FILE_HASH_MD5:
-            case IOC_FILE_HASH_SHA1:
-            case IOC_FILE_HASH_SHA256:
-                stats.file_hashes++;
-                break;
-            case IOC_EMAIL:
-                stats.emails++;
-                break;
-            case IOC_REGISTRY_KEY:
-                stats.registry_keys++;
-                break;
-            case IOC_FILE_PATH:
-                stats.file_paths++;
-                break;
-            default:
-                break;
-        }
-    }
-
-    stats.unique_iocs = getUniqueIOCCount();
+    // Per-type counts are kept by the store as IOCs are added
+    IOCStatistics stats;
+    stats.total_iocs = store.getOccurrenceCount();
+    stats.ip_addresses = store.getTypeCount(IOC_IP_ADDRESS);
+    stats.domains = store.getTypeCount(IOC_DOMAIN);
+    stats.urls = store.getTypeCount(IOC_URL);
+    stats.file_hashes = store.getTypeCount(IOC_FILE_HASH_MD5) +
+                        store.getTypeCount(IOC_FILE_HASH_SHA1) +
+                        store.getTypeCount(IOC_FILE_HASH_SHA256);
+    stats.emails = store.getTypeCount(IOC_EMAIL);
+    stats.registry_keys = store.getTypeCount(IOC_REGISTRY_KEY);
+    stats.file_paths = store.getTypeCount(IOC_FILE_PATH);
+    stats.unique_iocs = store.getUniqueCount();
+    stats.watchlist_hits = watchlist_hits.size();
     return stats;
 }
 
-uint16_t IOCExtractor::getUniqueIOCCount() const {
-    return getUniqueIOCs().size();
-}
-
 // Validation methods
 bool IOCExtractor::isValidIPv4(const String& ip) {
     int octets = 0;
@@ -722,7 +730,15 @@ bool IOCExtractor::isValidDomain(const String& domain) {
     }
 
     // Must end with known TLD or have multiple segments
-    return domain.lastIndexOf('.') < domain.length() - 2;
+    if (domain.lastIndexOf('.') >= domain.length() - 2) return false;
+
+    // With a public suffix list, the suffix must be listed and there must be a label in front of it
+    if (domain_suffixes.hasPublicSuffixList()) {
+        bool listed;
+        size_t suffix_start = domain_suffixes.getPublicSuffixStart(domain.c_str(), domain.length(), &listed);
+        return listed && suffix_start > 0;
+    }
+    return true;
 }
 
 bool IOCExtractor::isValidMD5(const String& hash) {
@@ -750,22 +766,19 @@ bool IOCExtractor::isValidEmail(const String& email) {
 }
 
 bool IOCExtractor::isPrivateIP(const String& ip) {
-    // 10.0.0.0/8
-    if (ip.startsWith("10.")) return true;
+    // RFC 1918, link-local and unique local ranges, unless a more specific range overrides them
+    return ip_ranges.lookup(ip) == CIDR_PRIVATE;
+}
 
-    // 172.16.0.0/12
-    if (ip.startsWith("172.")) {
-        int second_octet = ip.substring(4, ip.indexOf('.', 4)).toInt();
-        if (second_octet >= 16 && second_octet <= 31) return true;
+bool IOCExtractor::isExternalIP(const String& ip) const {
+    switch (ip_ranges.lookup(ip)) {
+        case CIDR_PRIVATE:
+        case CIDR_LOOPBACK:
+        case CIDR_ALLOW:
+            return false;
+        default:
+            return true;
     }
-
-    // 192.168.0.0/16
-    if (ip.startsWith("192.168.")) return true;
-
-    // 169.254.0.0/16 (APIPA)
-    if (ip.startsWith("169.254.")) return true;
-
-    return false;
 }
 
 String IOCExtractor::getIOCTypeName(IOCType type) const {
@@ -800,7 +813,18 @@ uint8_t IOCExtractor::calculateConfidence(const String& value, IOCType type) {
             confidence = 95; // CVEs are structured
             break;
         case IOC_IP_ADDRESS:
-            confidence = !isPrivateIP(value) ? 80 : 60;
+            switch (ip_ranges.lookup(value)) {
+                case CIDR_DENY:
+                case CIDR_INTEL:
+                    confidence = 95; // Known-bad range
+                    break;
+                case CIDR_PRIVATE:
+                case CIDR_LOOPBACK:
+                    confidence = 60;
+                    break;
+                default:
+                    confidence = 80;
+            }
             break;
         case IOC_EMAIL:
             confidence = 75;
@@ -809,7 +833,14 @@ uint8_t IOCExtractor::calculateConfidence(const String& value, IOCType type) {
             confidence = 85;
             break;
         case IOC_DOMAIN:
-            confidence = value.length() > 10 ? 70 : 60;
+            switch (domain_suffixes.lookup(value)) {
+                case DOMAIN_DENY:
+                case DOMAIN_INTEL:
+                    confidence = 95; // Known-bad suffix
+                    break;
+                default:
+                    confidence = value.length() > 10 ? 70 : 60;
+            }
             break;
         case IOC_REGISTRY_KEY:
             confidence = 70;
@@ -826,16 +857,10 @@ uint8_t IOCExtractor::calculateConfidence(const String& value, IOCType type) {
 
 bool IOCExtractor::isInWhitelist(const String& value, IOCType type) {
     if (type == IOC_DOMAIN) {
-        // Check if domain ends with whitelisted domain
-        for (const auto& whitelisted : domain_whitelist) {
-            if (value.endsWith(whitelisted) || value == whitelisted) {
-                return true;
-            }
-        }
+        // The most specific listed suffix decides, so a deny entry can carve a subdomain out of an allowed one
+        return domain_suffixes.lookup(value) == DOMAIN_ALLOW;
     } else if (type == IOC_IP_ADDRESS) {
-        if (ip_whitelist.find(value) != ip_whitelist.end()) {
-            return true;
-        }
+        return ip_ranges.lookup(value) == CIDR_ALLOW;
     }
 
     return false;
@@ -0,0 +1,79 @@
+#include "ioc_lexer.h"
+
+// Span prefixes, matched case-sensitively
+const IOCLexer::Prefix IOCLexer::prefix_table[IOCLexer::PREFIX_COUNT] = {
+    {"http://", 7, SPAN_URL, 0, 0},
+    {"https://", 8, SPAN_URL, 0, 0},
+    {"ftp://", 6, SPAN_URL, 0, 0},
+    {"file://", 7, SPAN_URL, 0, 0},
+    {"HKLM\\", 5, SPAN_REGISTRY, 0, 0},
+    {"HKCU\\", 5, SPAN_REGISTRY, 0, 0},
+    {"HKCR\\", 5, SPAN_REGISTRY, 0, 0},
+    {"HKU\\", 4, SPAN_REGISTRY, 0, 0},
+    {"HKEY_LOCAL_MACHINE\\", 19, SPAN_REGISTRY, 0, 0},
+    {"HKEY_CURRENT_USER\\", 18, SPAN_REGISTRY, 0, 0},
+    {"C:\\", 3, SPAN_PATH, 6, 0},
+    {"D:\\", 3, SPAN_PATH, 6, 0},
+    {"E:\\", 3, SPAN_PATH, 6, 0},
+    {"F:\\", 3, SPAN_PATH, 6, 0},
+    {"/usr/", 5, SPAN_PATH, 8, 0},
+    {"/etc/", 5, SPAN_PATH, 8, 0},
+    {"/tmp/", 5, SPAN_PATH, 8, 0},
+    {"/var/", 5, SPAN_PATH, 8, 0},
+    {"/home/", 6, SPAN_PATH, 9, 0},
+    {"Global\\", 7, SPAN_MUTEX, 10, 0},
+    {"Local\\", 6, SPAN_MUTEX, 9, 0},
+    {"Session\\", 8, SPAN_MUTEX, 11, 0},
+    {"BaseNamedObjects\\", 17, SPAN_MUTEX, 20, 0}
+};
+
+const uint8_t IOCLexer::PREFIX_COUNT;
+
+const uint16_t IOCLexer::span_keep[SPAN_COUNT] = {
+    CC_URL_BODY,
+    CC_KEY_BODY,
+    CC_PATH_BODY,
+    CC_MUTEX
+};
+
+const IOCType IOCLexer::span_type[SPAN_COUNT] = {
+    IOC_URL,
+    IOC_REGISTRY_KEY,
+    IOC_FILE_PATH,
+    IOC_MUTEX
+};
+
+IOCLexer::IOCLexer() {
+    for (int c = 0; c < 256; c++) {
+        uint16_t cls = 0;
+
+        if (c >= '0' && c <= '9') cls |= CC_DIGIT | CC_HEX;
+        if ((c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F')) cls |= CC_HEX;
+        if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z')) cls |= CC_ALPHA;
+        if (c == '.') cls |= CC_DOT;
+        if (c == '-') cls |= CC_HYPHEN;
+        if (c == '_') cls |= CC_UNDERSCORE;
+        if (c == '{' || c == '}') cls |= CC_BRACE;
+        if (c == '@') cls |= CC_AT;
+
+        bool key_end = c == '\n' || c == '\r' || c == '"' || c == '<' || c == '>';
+        if (!key_end) cls |= CC_KEY_BODY;
+        if (!key_end && c != ' ') cls |= CC_PATH_BODY;
+        if (!key_end && c != ' ' && c != '\'') cls |= CC_URL_BODY;
+
+        char_class[c] = cls;
+        prefix_index[c] = 0;
+    }
+
+    // Each prefix is anchored on its first non-word byte, where the word before it has just ended
+    for (uint8_t p = 0; p < PREFIX_COUNT; p++) {
+        prefixes[p] = prefix_table[p];
+        uint8_t t = 0;
+        while (char_class[(uint8_t)prefixes[p].text[t]] & CC_WORD) t++;
+        prefixes[p].trigger = t;
+
+        uint8_t separator = (uint8_t)prefixes[p].text[t];
+        prefix_index[separator] |= 1UL << p;
+        char_class[separator] |= CC_PREFIX;
+    }
+}
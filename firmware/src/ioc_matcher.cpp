@@ -1,88 +1,488 @@
 #include "ioc_matcher.h"
+#include "default_rule_image.h"
+#include "esp_heap_caps.h"
+#include <algorithm>
+
+IOCMatcher::IOCMatcher()
+    : storage(nullptr),
+      image_buffer(nullptr),
+      image_exact_max(0),
+      heap_exact_max(0),
+      automaton_dirty(false),
+      image_state(MultiPatternMatcher::START_STATE),
+      heap_state(MultiPatternMatcher::START_STATE),
+      stream_offset(0),
+      block_offset(0),
+      history_limit(0),
+      pending_rules(0),
+      performance_monitor(nullptr),
+      scan_time_us(0) {
+}
+
+IOCMatcher::~IOCMatcher() {
+    releaseImage();
+}
 
-IOCMatcher::IOCMatcher() {
+void IOCMatcher::begin(FRFDStorage* storage_ptr) {
+    storage = storage_ptr;
 }
 
+// ===========================
+// Rule Image
+// ===========================
+
+bool IOCMatcher::attachImage(const uint8_t* data, size_t size) {
+    image_automaton.clear();
+    if (!image.attach(data, size)) {
+        return false;
+    }
+
+    if (!image_automaton.attach(image.getAutomatonTables())) {
+        Serial.println("[IOC] Rule image has no usable automaton");
+        image.detach();
+        return false;
+    }
+
+    if (!image_hex.attach(image.getHexTables())) {
+        Serial.println("[IOC] Rule image has no usable hex tables");
+        image_automaton.clear();
+        image.detach();
+        return false;
+    }
+
+    image_exact_max = 0;
+    for (uint32_t p = 0; p < image.getPatternCount(); p++) {
+        const RuleImagePattern& pattern = image.getPattern(p);
+        if ((pattern.flags & RULE_PATTERN_EXACT_CASE) && pattern.length - 1u > image_exact_max) {
+            image_exact_max = pattern.length - 1u;
+        }
+    }
+
+    compileImageRegexes();
+    return true;
+}
+
+void IOCMatcher::compileImageRegexes() {
+    // Regexes cannot run from flash: each gets its NFA and a fixed DFA cache on the heap,
+    // so their number bounds the memory. A rejected one never matches its slot
+    image_regexes.clear();
+    uint32_t count = image.getRegexPatternCount();
+    if (count > IOC_MAX_IMAGE_REGEXES) {
+        Serial.printf("[IOC] Rule image has %u regexes, only the first %d are used\n",
+                      (unsigned)count, IOC_MAX_IMAGE_REGEXES);
+        count = IOC_MAX_IMAGE_REGEXES;
+    }
+
+    for (uint32_t x = 0; x < count; x++) {
+        const RuleImagePattern& pattern = image.getRegexPattern(x);
+        const RuleImageString& str = image.getString(image.getRule(pattern.rule).first_string + pattern.slot);
+        String body = image.getText(pattern.bytes);
+        if (str.flags & RULE_STRING_DOTALL) body = "(?s)" + body;
+
+        image_regexes.emplace_back();
+        if (!image_regexes.back().compile(body, str.flags & RULE_STRING_NOCASE, IOC_REGEX_CACHE_SIZE)) {
+            Serial.printf("[IOC] Bad regex %s in rule %s: %s\n", image.getText(str.text),
+                          image.getText(image.getRule(pattern.rule).name),
+                          image_regexes.back().getError().c_str());
+        }
+    }
+}
+
+void IOCMatcher::releaseImage() {
+    image_exact_max = 0;
+    image_automaton.clear();
+    image_hex.clear();
+    image_regexes.clear();
+    image.detach();
+    if (image_buffer) {
+        heap_caps_free(image_buffer);
+        image_buffer = nullptr;
+    }
+}
+
+bool IOCMatcher::loadRulesFromFile(const String& filePath) {
+    unsigned long start = millis();
+
+    size_t size = 0;
+    uint8_t* buffer = RuleImage::loadFile(storage, filePath, &size);
+    if (!buffer) {
+        return false;
+    }
+
+    // Replaces the current image; runtime rules are kept
+    releaseImage();
+    if (!attachImage(buffer, size)) {
+        heap_caps_free(buffer);
+        return false;
+    }
+    image_buffer = buffer;
+
+    Serial.printf("[IOC] Loaded %u rules from %s in %lu ms\n",
+                  (unsigned)image.getRuleCount(), filePath.c_str(), millis() - start);
+    return true;
+}
+
+// ===========================
+// Rule Management
+// ===========================
+
 bool IOCMatcher::addRule(const IOCRule& rule) {
+    if (rule.strings.size() + rule.hexPatterns.size() > IOC_MAX_PATTERNS_PER_RULE) {
+        Serial.printf("[IOC] Rule %s has too many patterns (max %d)\n",
+                     rule.name.c_str(), IOC_MAX_PATTERNS_PER_RULE);
+        return false;
+    }
+
     rules.push_back(rule);
+    automaton_dirty = true;
     Serial.printf("[IOC] Added rule: %s\n", rule.name.c_str());
     return true;
 }
 
 void IOCMatcher::clearRules() {
+    releaseImage();
     rules.clear();
+    automaton.clear();
+    pattern_refs.clear();
+    hex_automaton.clear();
+    hex_refs.clear();
+    rule_thresholds.clear();
+    rule_hits.clear();
+    exact_bytes.clear();
+    heap_exact_max = 0;
+    automaton_dirty = false;
 }
 
 size_t IOCMatcher::getRuleCount() {
-    return rules.size();
+    return image.getRuleCount() + rules.size();
 }
 
-bool IOCMatcher::containsString(const String& content, const String& pattern) {
-    // Case-insensitive search
-    String contentLower = content;
-    String patternLower = pattern;
-    contentLower.toLowerCase();
-    patternLower.toLowerCase();
+uint8_t IOCMatcher::parseCondition(const IOCRule& rule) {
+    size_t total = rule.strings.size() + rule.hexPatterns.size();
+
+    if (rule.condition == "any" || rule.condition.startsWith("any of")) {
+        return 1;
+    }
+    if (rule.condition == "all" || rule.condition.startsWith("all of")) {
+        return total;
+    }
+
+    // "N of them"
+    int of_pos = rule.condition.indexOf(" of");
+    if (of_pos > 0) {
+        long count = rule.condition.substring(0, of_pos).toInt();
+        if (count > 0 && count <= IOC_MAX_PATTERNS_PER_RULE) {
+            return (uint8_t)count;
+        }
+    }
+
+    return 0;
+}
 
-    return contentLower.indexOf(patternLower) >= 0;
+bool IOCMatcher::parseHexPattern(const String& hexPattern, std::vector<uint8_t>& bytes) {
+    // "4D 5A 90 00", "4d5a9000" or "{ 4D 5A }"
+    bytes.clear();
+    int high = -1;
+    for (size_t i = 0; i < hexPattern.length(); i++) {
+        char c = hexPattern[i];
+        if (c == ' ' || c == '{' || c == '}') continue;
+
+        int nibble;
+        if (c >= '0' && c <= '9') nibble = c - '0';
+        else if (c >= 'a' && c <= 'f') nibble = c - 'a' + 10;
+        else if (c >= 'A' && c <= 'F') nibble = c - 'A' + 10;
+        else return false;
+
+        if (high < 0) {
+            high = nibble;
+        } else {
+            bytes.push_back((uint8_t)((high << 4) | nibble));
+            high = -1;
+        }
+    }
+    return high < 0 && !bytes.empty();
 }
 
-bool IOCMatcher::containsHex(const String& content, const String& hexPattern) {
-    // Simple hex pattern matching
-    // Convert hex pattern to bytes and search
-    // This is a simplified implementation
-    return content.indexOf(hexPattern) >= 0;
+static bool hasLetters(const uint8_t* bytes, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        uint8_t b = bytes[i] | 0x20;
+        if (b >= 'a' && b <= 'z') return true;
+    }
+    return false;
 }
 
-bool IOCMatcher::matchRule(const String& content, const IOCRule& rule) {
-    std::vector<String> matched;
+bool IOCMatcher::compileRules() {
+    automaton.clear();
+    pattern_refs.clear();
+    hex_automaton.clear();
+    hex_refs.clear();
+    exact_bytes.clear();
+    heap_exact_max = 0;
+    rule_thresholds.assign(rules.size(), 0);
+
+    for (size_t r = 0; r < rules.size(); r++) {
+        const IOCRule& rule = rules[r];
+        rule_thresholds[r] = parseCondition(rule);
+
+        for (size_t i = 0; i < rule.strings.size(); i++) {
+            if (automaton.addPattern(rule.strings[i]) < 0) {
+                // Keep pattern ids aligned with pattern_refs
+                Serial.printf("[IOC] Skipping empty pattern in rule %s\n", rule.name.c_str());
+                continue;
+            }
+            PatternRef ref;
+            ref.rule = (uint16_t)r;
+            ref.slot = (uint8_t)i;
+            ref.exact = false;
+            ref.length = rule.strings[i].length();
+            ref.bytes = 0;
+            pattern_refs.push_back(ref);
+        }
 
-    // Check string patterns
-    for (const String& pattern : rule.strings) {
-        if (containsString(content, pattern)) {
-            matched.push_back(pattern);
+        // Literal hex patterns go into the automaton and are byte-exact, so letters are
+        // re-checked after the case-folded match; wildcards and jumps need the shift-and matcher
+        std::vector<uint8_t> bytes;
+        for (size_t i = 0; i < rule.hexPatterns.size(); i++) {
+            PatternRef ref;
+            if (!parseHexPattern(rule.hexPatterns[i], bytes)) {
+                int id = hex_automaton.addPattern(rule.hexPatterns[i]);
+                if (id < 0) {
+                    Serial.printf("[IOC] Skipping invalid hex pattern in rule %s: %s\n",
+                                 rule.name.c_str(), rule.hexPatterns[i].c_str());
+                    continue;
+                }
+                ref.rule = (uint16_t)r;
+                ref.slot = (uint8_t)(rule.strings.size() + i);
+                ref.exact = false;
+                ref.length = hex_automaton.getMinLength(id);
+                ref.bytes = 0;
+                hex_refs.push_back(ref);
+                continue;
+            }
+            if (automaton.addPattern(bytes.data(), bytes.size()) < 0) {
+                continue;
+            }
+            ref.rule = (uint16_t)r;
+            ref.slot = (uint8_t)(rule.strings.size() + i);
+            ref.exact = hasLetters(bytes.data(), bytes.size());
+            ref.length = bytes.size();
+            ref.bytes = exact_bytes.size();
+            if (ref.exact) {
+                exact_bytes.insert(exact_bytes.end(), bytes.begin(), bytes.end());
+                if (ref.length - 1u > heap_exact_max) heap_exact_max = ref.length - 1u;
+            }
+            pattern_refs.push_back(ref);
         }
     }
 
-    // Check hex patterns
-    for (const String& hexPattern : rule.hexPatterns) {
-        if (containsHex(content, hexPattern)) {
-            matched.push_back(hexPattern);
+    automaton_dirty = false;
+    return automaton.compile() && hex_automaton.compile();
+}
+
+uint8_t IOCMatcher::ruleThreshold(size_t rule_index) const {
+    size_t image_rules = image.getRuleCount();
+    return rule_index < image_rules ? image.getRule(rule_index).threshold
+                                    : rule_thresholds[rule_index - image_rules];
+}
+
+bool IOCMatcher::evaluateRule(size_t rule_index) {
+    uint8_t threshold = ruleThreshold(rule_index);
+    if (threshold == 0) return false;
+
+    return __builtin_popcountll(rule_hits[rule_index]) >= threshold;
+}
+
+// ===========================
+// Streaming Scan
+// ===========================
+
+void IOCMatcher::beginScan() {
+    rule_hits.assign(image.getRuleCount() + rules.size(), 0);
+    rule_candidates.assign(rule_hits.size(), 0);
+    scan_time_us = 0;
+
+    // Conditions only count matched strings, so a rule is decided once it has enough of them.
+    // A rule that can never have enough (threshold 0, or above its string count) starts decided
+    size_t image_rules = image.getRuleCount();
+    rule_needed.resize(rule_hits.size());
+    pending_rules = 0;
+    for (size_t r = 0; r < rule_hits.size(); r++) {
+        size_t strings;
+        if (r < image_rules) {
+            strings = image.getRule(r).string_count;
+        } else {
+            strings = rules[r - image_rules].strings.size() + rules[r - image_rules].hexPatterns.size();
         }
+        uint8_t threshold = ruleThreshold(r);
+        rule_needed[r] = threshold <= strings ? threshold : 0;
+        if (rule_needed[r] > 0) pending_rules++;
     }
+    first_hits.clear();
+    history.clear();
+    history_limit = image_exact_max > heap_exact_max ? image_exact_max : heap_exact_max;
+    image_state = MultiPatternMatcher::START_STATE;
+    heap_state = MultiPatternMatcher::START_STATE;
+    image_hex_state.assign(image_hex.getWordCount(), 0);
+    hex_state.assign(hex_automaton.getWordCount(), 0);
+    regex_cursors.resize(image_regexes.size());
+    for (size_t x = 0; x < image_regexes.size(); x++) {
+        image_regexes[x].begin(regex_cursors[x]);
+    }
+    stream_offset = 0;
+    block_offset = 0;
+}
 
-    // Evaluate condition
-    bool ruleMatched = false;
+bool IOCMatcher::verifyExact(const uint8_t* pattern, size_t pattern_len, const uint8_t* block, size_t end) const {
+    // The match may start in an earlier block; those bytes are in the history tail
+    if (end >= pattern_len) {
+        return memcmp(block + end - pattern_len, pattern, pattern_len) == 0;
+    }
 
-    if (rule.condition == "any" && matched.size() > 0) {
-        ruleMatched = true;
-    } else if (rule.condition == "all") {
-        size_t totalPatterns = rule.strings.size() + rule.hexPatterns.size();
-        ruleMatched = (matched.size() == totalPatterns);
-    } else if (rule.condition.startsWith("2 of")) {
-        ruleMatched = (matched.size() >= 2);
-    } else if (rule.condition.startsWith("3 of")) {
-        ruleMatched = (matched.size() >= 3);
+    size_t from_history = pattern_len - end;
+    if (from_history > history.size()) return false;
+    return memcmp(history.data() + history.size() - from_history, pattern, from_history) == 0 &&
+           memcmp(block, pattern + from_history, end) == 0;
+}
+
+void IOCMatcher::markHit(size_t rule_index, uint8_t slot, uint64_t offset) {
+    uint64_t bit = 1ULL << slot;
+    if (rule_hits[rule_index] & bit) return;
+
+    rule_hits[rule_index] |= bit;
+    if (rule_needed[rule_index] > 0 && --rule_needed[rule_index] == 0) pending_rules--;
+    SlotHit hit;
+    hit.rule = rule_index;
+    hit.slot = slot;
+    hit.offset = offset;
+    first_hits.push_back(hit);
+}
+
+void IOCMatcher::scanBlock(const uint8_t* data, size_t len) {
+    // Every rule has fired or can never fire: nothing later in the stream can change the result
+    if (pending_rules == 0) return;
+
+    size_t image_rules = image.getRuleCount();
+    unsigned long start = micros();
+
+    // Strings that already matched are not re-verified
+    image_state = image_automaton.scan(data, len, image_state,
+        [this, data](uint16_t pattern_id, size_t end) {
+            const RuleImagePattern& pattern = image.getPattern(pattern_id);
+            rule_candidates[pattern.rule]++;
+            if (rule_hits[pattern.rule] & (1ULL << pattern.slot)) return;
+            if ((pattern.flags & RULE_PATTERN_EXACT_CASE) &&
+                !verifyExact(image.getBytes(pattern.bytes), pattern.length, data, end)) {
+                return;
+            }
+            markHit(pattern.rule, pattern.slot, stream_offset + end - pattern.length);
+        });
+
+    heap_state = automaton.scan(data, len, heap_state,
+        [this, data, image_rules](uint16_t pattern_id, size_t end) {
+            const PatternRef& ref = pattern_refs[pattern_id];
+            rule_candidates[image_rules + ref.rule]++;
+            if (rule_hits[image_rules + ref.rule] & (1ULL << ref.slot)) return;
+            if (ref.exact && !verifyExact(&exact_bytes[ref.bytes], ref.length, data, end)) {
+                return;
+            }
+            markHit(image_rules + ref.rule, ref.slot, stream_offset + end - ref.length);
+        });
+
+    // Hex match offsets assume the shortest jump lengths
+    image_hex.scan(data, len, image_hex_state.data(), [this](uint16_t pattern_id, size_t end) {
+        const RuleImagePattern& pattern = image.getHexPattern(pattern_id);
+        rule_candidates[pattern.rule]++;
+        markHit(pattern.rule, pattern.slot, stream_offset + end - pattern.length);
+    });
+
+    hex_automaton.scan(data, len, hex_state.data(), [this, image_rules](uint16_t pattern_id, size_t end) {
+        const PatternRef& ref = hex_refs[pattern_id];
+        rule_candidates[image_rules + ref.rule]++;
+        markHit(image_rules + ref.rule, ref.slot, stream_offset + end - ref.length);
+    });
+
+    // Regexes stream through their own DFA. The match is located in the block it ends in;
+    // one that began in an earlier block is reported at the start of this one. Regexes of
+    // decided rules are not run at all
+    for (size_t x = 0; x < image_regexes.size(); x++) {
+        const RuleImagePattern& pattern = image.getRegexPattern(x);
+        if (rule_needed[pattern.rule] == 0 || (rule_hits[pattern.rule] & (1ULL << pattern.slot))) continue;
+        RegexMatcher& regex = image_regexes[x];
+        if (!regex.isCompiled() || !regex.feed(regex_cursors[x], data, len)) continue;
+
+        size_t match_start = 0;
+        size_t match_end;
+        if (!regex.find(data, len, 0, match_start, match_end)) match_start = 0;
+        rule_candidates[pattern.rule]++;
+        markHit(pattern.rule, pattern.slot, stream_offset + match_start);
     }
 
-    return ruleMatched && matched.size() > 0;
+    // Keep just enough of the stream to verify exact-case matches that straddle blocks
+    if (history_limit > 0) {
+        if (len >= history_limit) {
+            history.assign(data + len - history_limit, data + len);
+        } else {
+            history.insert(history.end(), data, data + len);
+            if (history.size() > history_limit) {
+                history.erase(history.begin(), history.end() - history_limit);
+            }
+        }
+    }
+
+    block_offset = stream_offset;
+    stream_offset += len;
+    scan_time_us += micros() - start;
 }
 
-bool IOCMatcher::scanContent(const String& content, const String& fileName) {
+bool IOCMatcher::finishScan(const String& fileName) {
+    size_t image_rules = image.getRuleCount();
     bool foundMatch = false;
 
-    for (const IOCRule& rule : rules) {
-        if (matchRule(content, rule)) {
+    // Regex matches that need the end of input ($, \b) settle here, in the last block
+    for (size_t x = 0; x < image_regexes.size() && pending_rules > 0; x++) {
+        const RuleImagePattern& pattern = image.getRegexPattern(x);
+        if (rule_needed[pattern.rule] == 0 || (rule_hits[pattern.rule] & (1ULL << pattern.slot))) continue;
+        if (image_regexes[x].isCompiled() && image_regexes[x].finish(regex_cursors[x])) {
+            rule_candidates[pattern.rule]++;
+            markHit(pattern.rule, pattern.slot, block_offset);
+        }
+    }
+
+    // Group first occurrences by rule, in rule then string order
+    std::sort(first_hits.begin(), first_hits.end(), [](const SlotHit& a, const SlotHit& b) {
+        return a.rule != b.rule ? a.rule < b.rule : a.slot < b.slot;
+    });
+
+    size_t i = 0;
+    while (i < first_hits.size()) {
+        size_t r = first_hits[i].rule;
+        size_t group_end = i;
+        while (group_end < first_hits.size() && first_hits[group_end].rule == r) group_end++;
+
+        if (evaluateRule(r)) {
             IOCMatch match;
-            match.ruleName = rule.name;
             match.fileName = fileName;
-            match.severity = rule.severity;
             match.timestamp = millis();
 
-            // Collect matched strings
-            for (const String& pattern : rule.strings) {
-                if (containsString(content, pattern)) {
-                    match.matchedStrings.push_back(pattern);
+            if (r < image_rules) {
+                const RuleImageRule& rule = image.getRule(r);
+                match.ruleName = image.getText(rule.name);
+                match.severity = image.getText(rule.severity);
+                for (size_t h = i; h < group_end; h++) {
+                    const RuleImageString& str = image.getString(rule.first_string + first_hits[h].slot);
+                    match.matchedStrings.push_back(image.getText(str.text));
+                    match.offsets.push_back(first_hits[h].offset);
+                }
+            } else {
+                const IOCRule& rule = rules[r - image_rules];
+                match.ruleName = rule.name;
+                match.severity = rule.severity;
+                for (size_t h = i; h < group_end; h++) {
+                    uint8_t slot = first_hits[h].slot;
+                    match.matchedStrings.push_back(slot < rule.strings.size()
+                                                   ? rule.strings[slot]
+                                                   : rule.hexPatterns[slot - rule.strings.size()]);
+                    match.offsets.push_back(first_hits[h].offset);
                 }
             }
 
@@ -90,20 +490,96 @@ bool IOCMatcher::scanContent(const String& content, const String& fileName) {
             foundMatch = true;
 
             Serial.printf("[IOC] ⚠️  MATCH: %s in %s (Severity: %s)\n",
-                         rule.name.c_str(),
+                         match.ruleName.c_str(),
                          fileName.c_str(),
-                         rule.severity.c_str());
+                         match.severity.c_str());
         }
+
+        i = group_end;
     }
 
+    recordRuleStats();
     return foundMatch;
 }
 
+void IOCMatcher::recordRuleStats() {
+    if (!performance_monitor) return;
+
+    // All rules share one automaton pass, so its time is attributed to rules by their
+    // share of candidate hits; the pass as a whole is recorded as "(scan)"
+    size_t image_rules = image.getRuleCount();
+    uint64_t total_candidates = 0;
+    bool any_fired = false;
+    for (size_t r = 0; r < rule_candidates.size(); r++) {
+        total_candidates += rule_candidates[r];
+    }
+
+    for (size_t r = 0; r < rule_candidates.size(); r++) {
+        uint32_t time_share = total_candidates > 0
+            ? (uint32_t)((uint64_t)scan_time_us * rule_candidates[r] / total_candidates) : 0;
+        bool fired = evaluateRule(r);
+        any_fired |= fired;
+
+        String name = r < image_rules ? String(image.getText(image.getRule(r).name))
+                                      : rules[r - image_rules].name;
+        performance_monitor->recordRuleScan("ioc", name, stream_offset, time_share, rule_candidates[r], fired);
+    }
+
+    performance_monitor->recordRuleScan("ioc", "(scan)", stream_offset, scan_time_us,
+                                        (uint32_t)total_candidates, any_fired);
+}
+
+bool IOCMatcher::scanContent(const String& content, const String& fileName) {
+    return scanBuffer((const uint8_t*)content.c_str(), content.length(), fileName);
+}
+
+bool IOCMatcher::scanBuffer(const uint8_t* data, size_t len, const String& fileName) {
+    if (automaton_dirty && !compileRules()) {
+        return false;
+    }
+
+    beginScan();
+    scanBlock(data, len);
+    return finishScan(fileName);
+}
+
 bool IOCMatcher::scanFile(const String& filePath) {
-    // This would read the file and scan its content
-    // For now, placeholder
+    if (automaton_dirty && !compileRules()) {
+        return false;
+    }
+
+    if (!storage) {
+        return false;
+    }
+
+    File file = storage->openFile(filePath);
+    if (!file) {
+        Serial.printf("[IOC] Cannot open file: %s\n", filePath.c_str());
+        return false;
+    }
+
+    uint8_t* block = (uint8_t*)malloc(IOC_SCAN_BLOCK_SIZE);
+    if (!block) {
+        file.close();
+        return false;
+    }
+
     Serial.printf("[IOC] Scanning file: %s\n", filePath.c_str());
-    return false;
+    unsigned long start = millis();
+
+    // Constant memory: one block plus a short history tail, whatever the file size
+    beginScan();
+    size_t n;
+    while (pending_rules > 0 && (n = file.read(block, IOC_SCAN_BLOCK_SIZE)) > 0) {
+        scanBlock(block, n);
+    }
+    file.close();
+    free(block);
+
+    unsigned long elapsed = millis() - start;
+    Serial.printf("[IOC] Scanned %llu bytes in %lu ms\n", (unsigned long long)stream_offset, elapsed);
+
+    return finishScan(filePath);
 }
 
 std::vector<IOCMatch> IOCMatcher::getMatches() {
@@ -124,6 +600,13 @@ bool IOCMatcher::hasMatches() {
 
 void IOCMatcher::loadDefaultRules() {
     Serial.println("[IOC] Loading default rules...");
+
+    // rules/default.yar, compiled at build time and executed from flash
+    if (attachImage(FRFD_DEFAULT_RULE_IMAGE, sizeof(FRFD_DEFAULT_RULE_IMAGE))) {
+        return;
+    }
+
+    Serial.println("[IOC] Default rule image unusable, building rules on the heap");
     loadWindowsRules();
     loadLinuxRules();
     loadWebshellRules();
@@ -361,7 +844,7 @@ String IOCMatcher::generateMatchReport() {
     String report = "\n=== IOC Match Report ===\n";
     report += "Timestamp: " + String(millis()) + "\n";
     report += "Total Matches: " + String(matches.size()) + "\n";
-    report += "Rules Loaded: " + String(rules.size()) + "\n\n";
+    report += "Rules Loaded: " + String(getRuleCount()) + "\n\n";
 
     if (matches.size() == 0) {
         report += "No IOC matches found.\n";
@@ -375,8 +858,12 @@ String IOCMatcher::generateMatchReport() {
         report += "  Severity: " + match.severity + "\n";
         report += "  Matched Patterns:\n";
 
-        for (const String& pattern : match.matchedStrings) {
-            report += "    - " + pattern + "\n";
+        for (size_t i = 0; i < match.matchedStrings.size(); i++) {
+            report += "    - " + match.matchedStrings[i];
+            if (i < match.offsets.size()) {
+                report += " @ " + String((unsigned long long)match.offsets[i]);
+            }
+            report += "\n";
         }
 
         report += "\n";
@@ -0,0 +1,216 @@
+#include "ioc_store.h"
+
+const uint8_t IOCStore::MAX_TYPES;
+const uint16_t IOCStore::NO_SOURCE;
+const uint8_t IOCStore::INLINE_CONTEXT;
+
+static const size_t INITIAL_INDEX_SIZE = 256;
+
+IOCStore::IOCStore() {
+    clear();
+}
+
+void IOCStore::clear() {
+    arena.clear();
+    entries.clear();
+    occurrences.clear();
+    index.assign(INITIAL_INDEX_SIZE, 0);
+    sources.clear();
+    source_ids.clear();
+    last_source = NO_SOURCE;
+    memset(type_counts, 0, sizeof(type_counts));
+}
+
+uint16_t IOCStore::internSource(const String& path) {
+    // Extraction adds runs of occurrences from the same artifact
+    if (last_source != NO_SOURCE && sources[last_source] == path) {
+        return last_source;
+    }
+
+    auto it = source_ids.find(path);
+    if (it != source_ids.end()) {
+        last_source = it->second;
+        return last_source;
+    }
+
+    if (sources.size() >= NO_SOURCE) {
+        return NO_SOURCE;
+    }
+
+    last_source = sources.size();
+    sources.push_back(path);
+    source_ids[path] = last_source;
+    return last_source;
+}
+
+const String& IOCStore::getSource(uint16_t id) const {
+    static const String unknown;
+    return id < sources.size() ? sources[id] : unknown;
+}
+
+uint32_t IOCStore::hashValue(uint8_t type, const char* value, size_t length) {
+    // FNV-1a over the type and the value bytes
+    uint32_t hash = (2166136261UL ^ type) * 16777619UL;
+    for (size_t i = 0; i < length; i++) {
+        hash = (hash ^ (uint8_t)value[i]) * 16777619UL;
+    }
+    return hash;
+}
+
+size_t IOCStore::probe(uint32_t hash, uint8_t type, const char* value, size_t length) const {
+    // Slot holding the value, or the empty slot where it belongs
+    size_t mask = index.size() - 1;
+    size_t slot = hash & mask;
+    for (; index[slot] != 0; slot = (slot + 1) & mask) {
+        const Entry& entry = entries[index[slot] - 1];
+        if (entry.hash == hash && entry.type == type && entry.length == length &&
+            memcmp(&arena[entry.value], value, length) == 0) {
+            break;
+        }
+    }
+    return slot;
+}
+
+int32_t IOCStore::find(uint8_t type, const char* value, size_t length) const {
+    if (length > 0xFFFF) length = 0xFFFF;
+
+    size_t slot = probe(hashValue(type, value, length), type, value, length);
+    return (int32_t)index[slot] - 1;
+}
+
+uint32_t IOCStore::appendArena(const char* text, size_t length) {
+    uint32_t offset = arena.size();
+    arena.insert(arena.end(), text, text + length);
+    arena.push_back('\0');
+    return offset;
+}
+
+void IOCStore::growIndex() {
+    std::vector<uint32_t> grown(index.size() * 2, 0);
+    size_t mask = grown.size() - 1;
+
+    for (uint32_t e = 0; e < entries.size(); e++) {
+        size_t slot = entries[e].hash & mask;
+        while (grown[slot] != 0) slot = (slot + 1) & mask;
+        grown[slot] = e + 1;
+    }
+    index.swap(grown);
+}
+
+uint32_t IOCStore::intern(uint8_t type, const char* value, size_t length, uint8_t confidence) {
+    if (length > 0xFFFF) length = 0xFFFF;
+
+    uint32_t hash = hashValue(type, value, length);
+    size_t slot = probe(hash, type, value, length);
+    if (index[slot] != 0) {
+        return index[slot] - 1;
+    }
+
+    Entry entry;
+    entry.value = appendArena(value, length);
+    entry.hash = hash;
+    entry.first = occurrences.size();
+    entry.count = 0;
+    entry.length = length;
+    entry.type = type;
+    entry.confidence = confidence;
+    entries.push_back(entry);
+    index[slot] = entries.size();
+
+    // Keep the load factor under 3/4
+    if (entries.size() * 4 > index.size() * 3) {
+        growIndex();
+    }
+
+    return entries.size() - 1;
+}
+
+uint32_t IOCStore::add(uint8_t type, const char* value, size_t length, uint8_t confidence,
+                       uint16_t source, uint32_t offset, uint8_t before, uint8_t after, uint32_t timestamp) {
+    uint32_t e = intern(type, value, length, confidence);
+    entries[e].count++;
+    if (type < MAX_TYPES) type_counts[type]++;
+
+    Occurrence occurrence;
+    occurrence.entry = e;
+    occurrence.offset = offset;
+    occurrence.timestamp = timestamp;
+    occurrence.source = source;
+    occurrence.before = before == INLINE_CONTEXT ? INLINE_CONTEXT - 1 : before;
+    occurrence.after = after;
+    occurrences.push_back(occurrence);
+
+    return e;
+}
+
+uint32_t IOCStore::addWithContext(uint8_t type, const char* value, size_t length, uint8_t confidence,
+                                  uint16_t source, const String& context, uint32_t timestamp) {
+    uint32_t e = add(type, value, length, confidence, source, 0, 0, 0, timestamp);
+
+    Occurrence& occurrence = occurrences.back();
+    occurrence.offset = appendArena(context.c_str(), context.length());
+    occurrence.before = INLINE_CONTEXT;
+
+    return e;
+}
+
+size_t IOCStore::getMemoryUsage() const {
+    size_t usage = sizeof(*this) +
+                   arena.capacity() +
+                   entries.capacity() * sizeof(Entry) +
+                   occurrences.size() * sizeof(Occurrence) +
+                   index.capacity() * sizeof(uint32_t) +
+                   sources.capacity() * sizeof(String);
+
+    for (const auto& source : sources) {
+        usage += source.length() + 1;
+    }
+    return usage;
+}
+
+// Context reader
+
+IOCStore::ContextReader::ContextReader(const IOCStore& store_ref, FRFDStorage* storage_ptr)
+    : store(store_ref), storage(storage_ptr), open_source(NO_SOURCE) {
+}
+
+IOCStore::ContextReader::~ContextReader() {
+    if (file) file.close();
+}
+
+String IOCStore::ContextReader::read(const Occurrence& occurrence) {
+    String context;
+
+    if (occurrence.before == INLINE_CONTEXT) {
+        context = &store.arena[occurrence.offset];
+        return context;
+    }
+
+    if (!storage || occurrence.source == NO_SOURCE) {
+        return context;
+    }
+
+    if (occurrence.source != open_source) {
+        if (file) file.close();
+        file = storage->openFile(store.getSource(occurrence.source));
+        open_source = occurrence.source;
+    }
+    if (!file) {
+        return context;
+    }
+
+    const Entry& entry = store.getEntry(occurrence.entry);
+    size_t length = occurrence.before + entry.length + occurrence.after;
+    char* buffer = (char*)malloc(length);
+    if (!buffer) {
+        return context;
+    }
+
+    if (file.seek(occurrence.offset - occurrence.before)) {
+        size_t n = file.read((uint8_t*)buffer, length);
+        context.concat(buffer, n);
+    }
+    free(buffer);
+
+    return context;
+}
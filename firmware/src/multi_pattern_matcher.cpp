@@ -0,0 +1,265 @@
+#include "multi_pattern_matcher.h"
+
+static const uint32_t NO_TRANSITION = 0xFFFFFFFFUL;
+
+const uint32_t MultiPatternMatcher::START_STATE;
+const uint32_t MultiPatternMatcher::OUTPUT_FLAG;
+const uint32_t MultiPatternMatcher::STATE_MASK;
+const size_t MultiPatternMatcher::DEFAULT_DENSE_BUDGET;
+
+MultiPatternMatcher::MultiPatternMatcher() : compiled(false) {
+    memset(class_map, 0, sizeof(class_map));
+    resetTables();
+}
+
+int MultiPatternMatcher::addPattern(const uint8_t* bytes, size_t len) {
+    if (len == 0 || len > 0xFFFF || pattern_lengths.size() >= 0xFFFF) {
+        return -1;
+    }
+
+    pattern_offsets.push_back(pattern_bytes.size());
+    pattern_lengths.push_back((uint16_t)len);
+    for (size_t i = 0; i < len; i++) {
+        pattern_bytes.push_back(foldByte(bytes[i]));
+    }
+
+    compiled = false;
+    return (int)pattern_lengths.size() - 1;
+}
+
+int MultiPatternMatcher::addPattern(const String& pattern) {
+    return addPattern((const uint8_t*)pattern.c_str(), pattern.length());
+}
+
+void MultiPatternMatcher::clear() {
+    pattern_bytes.clear();
+    pattern_offsets.clear();
+    pattern_lengths.clear();
+    dense.clear();
+    sparse_begin.clear();
+    sparse_class.clear();
+    sparse_next.clear();
+    fail.clear();
+    output_begin.clear();
+    output_ids.clear();
+    memset(class_map, 0, sizeof(class_map));
+    resetTables();
+    compiled = false;
+}
+
+void MultiPatternMatcher::resetTables() {
+    memset(&tables, 0, sizeof(tables));
+    tables.class_map = class_map;
+    tables.num_classes = 1;
+}
+
+bool MultiPatternMatcher::attach(const Tables& external) {
+    if (!external.class_map || !external.output_begin || external.num_states == 0 ||
+        external.dense_states == 0 || external.dense_states > external.num_states ||
+        !external.dense || external.num_classes == 0) {
+        return false;
+    }
+
+    clear();
+    tables = external;
+    compiled = true;
+    return true;
+}
+
+size_t MultiPatternMatcher::getMemoryUsage() const {
+    return sizeof(*this) +
+           pattern_bytes.capacity() +
+           pattern_offsets.capacity() * sizeof(uint32_t) +
+           pattern_lengths.capacity() * sizeof(uint16_t) +
+           dense.capacity() * sizeof(uint32_t) +
+           sparse_begin.capacity() * sizeof(uint32_t) +
+           sparse_class.capacity() +
+           sparse_next.capacity() * sizeof(uint32_t) +
+           fail.capacity() * sizeof(uint32_t) +
+           output_begin.capacity() * sizeof(uint32_t) +
+           output_ids.capacity() * sizeof(uint16_t);
+}
+
+void MultiPatternMatcher::buildClassMap() {
+    // Every byte that occurs in a pattern gets its own class (both cases share
+    // one); all other bytes fall into class 0, which always leads back to the root
+    memset(class_map, 0, sizeof(class_map));
+    tables.num_classes = 1;
+
+    bool used[256] = {false};
+    for (uint8_t b : pattern_bytes) {
+        used[b] = true;
+    }
+
+    for (int b = 0; b < 256; b++) {
+        if (!used[b]) continue;
+        class_map[b] = (uint8_t)tables.num_classes;
+        if (b >= 'a' && b <= 'z') {
+            class_map[b - 32] = (uint8_t)tables.num_classes;
+        }
+        tables.num_classes++;
+    }
+}
+
+bool MultiPatternMatcher::compile(size_t dense_budget) {
+    std::vector<uint8_t> keep_bytes;
+    std::vector<uint32_t> keep_offsets;
+    std::vector<uint16_t> keep_lengths;
+    keep_bytes.swap(pattern_bytes);
+    keep_offsets.swap(pattern_offsets);
+    keep_lengths.swap(pattern_lengths);
+    clear();
+    pattern_bytes.swap(keep_bytes);
+    pattern_offsets.swap(keep_offsets);
+    pattern_lengths.swap(keep_lengths);
+
+    buildClassMap();
+    const uint16_t num_classes = tables.num_classes;
+
+    // Trie with sparse child lists, in insertion order
+    struct Edge {
+        uint8_t cls;
+        uint32_t next;
+    };
+    std::vector<std::vector<Edge>> children(1);
+    std::vector<std::vector<uint16_t>> outputs(1);
+
+    for (size_t p = 0; p < pattern_lengths.size(); p++) {
+        uint32_t state = START_STATE;
+        const uint8_t* bytes = &pattern_bytes[pattern_offsets[p]];
+
+        for (uint16_t i = 0; i < pattern_lengths[p]; i++) {
+            uint8_t c = class_map[bytes[i]];
+            uint32_t next = NO_TRANSITION;
+            for (const Edge& e : children[state]) {
+                if (e.cls == c) {
+                    next = e.next;
+                    break;
+                }
+            }
+            if (next == NO_TRANSITION) {
+                next = children.size();
+                children.emplace_back();
+                outputs.emplace_back();
+                Edge e = {c, next};
+                children[state].push_back(e);
+            }
+            state = next;
+        }
+        outputs[state].push_back((uint16_t)p);
+    }
+
+    // Renumber states breadth-first so that shallow states come first
+    uint32_t num_states = children.size();
+    std::vector<uint32_t> order;
+    std::vector<uint32_t> rank(num_states);
+    order.reserve(num_states);
+    order.push_back(START_STATE);
+    for (size_t head = 0; head < order.size(); head++) {
+        for (const Edge& e : children[order[head]]) {
+            order.push_back(e.next);
+        }
+    }
+    for (uint32_t i = 0; i < num_states; i++) {
+        rank[order[i]] = i;
+    }
+
+    size_t row_bytes = (size_t)num_classes * sizeof(uint32_t);
+    uint32_t dense_states = dense_budget / row_bytes;
+    if (dense_states < 1) dense_states = 1;
+    if (dense_states > num_states) dense_states = num_states;
+
+    // Failure links (in new numbering) and merged outputs, breadth-first;
+    // dense rows are completed as we go since a failure state is always shallower
+    std::vector<uint32_t> fail_all(num_states, START_STATE);
+    std::vector<std::vector<uint16_t>> merged(num_states);
+    dense.assign((size_t)dense_states * num_classes, START_STATE);
+
+    for (uint32_t s = 0; s < num_states; s++) {
+        uint32_t old_state = order[s];
+        merged[s] = outputs[old_state];
+        if (s != START_STATE) {
+            const std::vector<uint16_t>& inherited = merged[fail_all[s]];
+            merged[s].insert(merged[s].end(), inherited.begin(), inherited.end());
+        }
+
+        if (s < dense_states && s != START_STATE) {
+            memcpy(&dense[(size_t)s * num_classes], &dense[(size_t)fail_all[s] * num_classes], row_bytes);
+        }
+
+        for (const Edge& e : children[old_state]) {
+            uint32_t child = rank[e.next];
+            if (s < dense_states) {
+                dense[(size_t)s * num_classes + e.cls] = child;
+            }
+
+            // Failure of the child: follow our own failure chain until it has an edge on e.cls
+            uint32_t f = fail_all[s];
+            uint32_t target = START_STATE;
+            if (s != START_STATE) {
+                while (true) {
+                    if (f < dense_states) {
+                        target = dense[(size_t)f * num_classes + e.cls];
+                        break;
+                    }
+                    bool found = false;
+                    for (const Edge& fe : children[order[f]]) {
+                        if (fe.cls == e.cls) {
+                            target = rank[fe.next];
+                            found = true;
+                            break;
+                        }
+                    }
+                    if (found) break;
+                    f = fail_all[f];
+                }
+            }
+            fail_all[child] = target;
+        }
+    }
+
+    // Flatten outputs
+    output_begin.resize(num_states + 1);
+    for (uint32_t s = 0; s < num_states; s++) {
+        output_begin[s] = output_ids.size();
+        output_ids.insert(output_ids.end(), merged[s].begin(), merged[s].end());
+    }
+    output_begin[num_states] = output_ids.size();
+
+    // Tag transitions into accepting states
+    for (uint32_t& next : dense) {
+        if (!merged[next].empty()) next |= OUTPUT_FLAG;
+    }
+
+    // Sparse edges and failure links for the deeper states
+    sparse_begin.reserve(num_states - dense_states + 1);
+    fail.reserve(num_states - dense_states);
+    for (uint32_t s = dense_states; s < num_states; s++) {
+        sparse_begin.push_back(sparse_next.size());
+        fail.push_back(fail_all[s]);
+        for (const Edge& e : children[order[s]]) {
+            uint32_t child = rank[e.next];
+            sparse_class.push_back(e.cls);
+            sparse_next.push_back(merged[child].empty() ? child : (child | OUTPUT_FLAG));
+        }
+    }
+    sparse_begin.push_back(sparse_next.size());
+
+    tables.class_map = class_map;
+    tables.dense = dense.data();
+    tables.sparse_begin = sparse_begin.data();
+    tables.sparse_class = sparse_class.data();
+    tables.sparse_next = sparse_next.data();
+    tables.fail = fail.data();
+    tables.output_begin = output_begin.data();
+    tables.output_ids = output_ids.data();
+    tables.num_states = num_states;
+    tables.dense_states = dense_states;
+    tables.pattern_count = pattern_lengths.size();
+    compiled = true;
+
+    Serial.printf("[MPM] Compiled %u patterns: %u states (%u dense), %u classes, %u bytes\n",
+                  (unsigned)pattern_lengths.size(), (unsigned)num_states, (unsigned)dense_states,
+                  (unsigned)num_classes, (unsigned)getMemoryUsage());
+    return true;
+}
@@ -33,6 +33,7 @@ void PerformanceMonitor::begin() {
 void PerformanceMonitor::reset() {
     metrics.clear();
     module_stats.clear();
+    rule_stats.clear();
     profiles.clear();
     alerts.clear();
     memory_by_source.clear();
@@ -211,6 +212,71 @@ std::vector<String> PerformanceMonitor::getFastestModules(uint8_t count) {
     return fastest;
 }
 
+// ===========================
+// Rule Scan Profiling
+// ===========================
+
+void PerformanceMonitor::recordRuleScan(const String& engine, const String& rule_name, uint64_t bytes,
+                                        uint32_t time_us, uint32_t candidates, bool confirmed) {
+    String key = engine + "/" + rule_name;
+    auto it = rule_stats.find(key);
+    if (it == rule_stats.end()) {
+        RuleScanStats stats;
+        stats.engine = engine;
+        stats.rule_name = rule_name;
+        stats.scan_count = 0;
+        stats.bytes_scanned = 0;
+        stats.time_us = 0;
+        stats.candidate_hits = 0;
+        stats.confirmed_hits = 0;
+        it = rule_stats.insert(std::make_pair(key, stats)).first;
+    }
+
+    RuleScanStats& stats = it->second;
+    stats.scan_count++;
+    stats.bytes_scanned += bytes;
+    stats.time_us += time_us;
+    stats.candidate_hits += candidates;
+    if (confirmed) {
+        stats.confirmed_hits++;
+    }
+}
+
+std::vector<RuleScanStats> PerformanceMonitor::getRuleStats() {
+    std::vector<RuleScanStats> result;
+    for (const auto& pair : rule_stats) {
+        result.push_back(pair.second);
+    }
+    return result;
+}
+
+std::vector<const RuleScanStats*> PerformanceMonitor::sortRuleStatsByCost() const {
+    std::vector<const RuleScanStats*> sorted_rules;
+    for (const auto& pair : rule_stats) {
+        sorted_rules.push_back(&pair.second);
+    }
+
+    // Sort by total time (descending)
+    std::sort(sorted_rules.begin(), sorted_rules.end(),
+             [](const RuleScanStats* a, const RuleScanStats* b) { return a->time_us > b->time_us; });
+    return sorted_rules;
+}
+
+std::vector<String> PerformanceMonitor::getCostliestRules(uint8_t count) {
+    std::vector<const RuleScanStats*> sorted_rules = sortRuleStatsByCost();
+
+    std::vector<String> costliest;
+    for (size_t i = 0; i < std::min((size_t)count, sorted_rules.size()); i++) {
+        costliest.push_back(sorted_rules[i]->engine + "/" + sorted_rules[i]->rule_name);
+    }
+
+    return costliest;
+}
+
+void PerformanceMonitor::clearRuleStats() {
+    rule_stats.clear();
+}
+
 // ===========================
 // System Resource Monitoring
 // ===========================
@@ -440,6 +506,7 @@ String PerformanceMonitor::exportToJSON() {
     String json = "{\n";
     json += "  \"system_stats\": " + exportSystemStatsJSON() + ",\n";
     json += "  \"module_stats\": " + exportModuleStatsJSON() + ",\n";
+    json += "  \"rule_stats\": " + exportRuleStatsJSON() + ",\n";
     json += "  \"metrics_count\": " + String(metrics.size()) + ",\n";
     json += "  \"active_metrics\": " + String(getActiveMetrics()) + ",\n";
     json += "  \"total_profiled_time_ms\": " + String(getTotalProfiledTime()) + ",\n";
@@ -474,6 +541,46 @@ String PerformanceMonitor::exportModuleStatsJSON() {
     return json;
 }
 
+// Rule names come from rule files (Sigma titles, YARA identifiers), so escape them
+static String escapeJSON(const String& text) {
+    String escaped = text;
+    escaped.replace("\\", "\\\\");
+    escaped.replace("\"", "\\\"");
+    escaped.replace("\n", "\\n");
+    escaped.replace("\r", "\\r");
+    escaped.replace("\t", "\\t");
+    return escaped;
+}
+
+String PerformanceMonitor::exportRuleStatsJSON(uint8_t limit) {
+    std::vector<const RuleScanStats*> sorted_rules = sortRuleStatsByCost();
+    if (limit > 0 && sorted_rules.size() > limit) {
+        sorted_rules.resize(limit);
+    }
+
+    String json = "[\n";
+
+    for (size_t i = 0; i < sorted_rules.size(); i++) {
+        const RuleScanStats& stats = *sorted_rules[i];
+
+        json += "    {\n";
+        json += "      \"engine\": \"" + escapeJSON(stats.engine) + "\",\n";
+        json += "      \"rule\": \"" + escapeJSON(stats.rule_name) + "\",\n";
+        json += "      \"scans\": " + String(stats.scan_count) + ",\n";
+        json += "      \"bytes_scanned\": " + String((unsigned long long)stats.bytes_scanned) + ",\n";
+        json += "      \"time_us\": " + String((unsigned long long)stats.time_us) + ",\n";
+        json += "      \"candidate_hits\": " + String(stats.candidate_hits) + ",\n";
+        json += "      \"confirmed_hits\": " + String(stats.confirmed_hits) + "\n";
+        json += "    }";
+
+        if (i < sorted_rules.size() - 1) json += ",";
+        json += "\n";
+    }
+
+    json += "  ]";
+    return json;
+}
+
 String PerformanceMonitor::exportSystemStatsJSON() {
     updateSystemStats();
 
@@ -0,0 +1,950 @@
+#include "regex_matcher.h"
+#include "esp_heap_caps.h"
+#include <algorithm>
+
+// What the byte before the current position was
+static const uint8_t CTX_LINE_START = 0;    // Start of input or '\n'; also the only context without ^ $ \b
+static const uint8_t CTX_WORD = 1;
+static const uint8_t CTX_OTHER = 2;
+
+// What the byte at the current position is
+static const uint8_t KIND_NEWLINE = 0;
+static const uint8_t KIND_WORD = 1;
+static const uint8_t KIND_OTHER = 2;
+static const uint8_t KIND_END = 3;
+
+static const uint8_t ASSERT_LINE_START = 0;
+static const uint8_t ASSERT_LINE_END = 1;
+static const uint8_t ASSERT_WORD_BOUNDARY = 2;
+static const uint8_t ASSERT_NOT_WORD_BOUNDARY = 3;
+
+static const uint32_t MATCH_FLAG = 0x80000000UL;    // Set on transitions taken right after a match
+static const uint32_t NO_POSITION = 0xFFFFFFFFUL;
+static const size_t MIN_SLOTS = 64;
+
+static inline bool isWordByte(uint8_t c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+// ===========================
+// Byte sets
+// ===========================
+
+struct ByteSet {
+    uint8_t bits[32];
+
+    ByteSet() { memset(bits, 0, sizeof(bits)); }
+    void add(uint8_t c) { bits[c >> 3] |= 1 << (c & 7); }
+    void addRange(uint8_t lo, uint8_t hi) {
+        for (int c = lo; c <= hi; c++) add(c);
+    }
+    bool has(uint8_t c) const { return bits[c >> 3] & (1 << (c & 7)); }
+    void merge(const ByteSet& other) {
+        for (int i = 0; i < 32; i++) bits[i] |= other.bits[i];
+    }
+    void invert() {
+        for (int i = 0; i < 32; i++) bits[i] = ~bits[i];
+    }
+    void foldCase() {
+        for (int c = 'a'; c <= 'z'; c++) {
+            if (has(c) || has(c - 32)) {
+                add(c);
+                add(c - 32);
+            }
+        }
+    }
+};
+
+static ByteSet digitSet() {
+    ByteSet set;
+    set.addRange('0', '9');
+    return set;
+}
+
+static ByteSet wordSet() {
+    ByteSet set;
+    set.addRange('a', 'z');
+    set.addRange('A', 'Z');
+    set.addRange('0', '9');
+    set.add('_');
+    return set;
+}
+
+static ByteSet spaceSet() {
+    ByteSet set;
+    set.add(' ');
+    set.addRange('\t', '\r');   // \t \n \v \f \r
+    return set;
+}
+
+static int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+// ===========================
+// Parser and NFA construction
+// ===========================
+
+/**
+ * @brief Pattern text -> syntax tree -> Thompson NFA
+ *
+ * Concatenations and alternations keep their operands in a flat list, so
+ * recursion depth follows group nesting rather than pattern length.
+ */
+struct RegexCompiler {
+    enum NodeType : uint8_t { AST_EMPTY, AST_SET, AST_ASSERT, AST_CONCAT, AST_ALT, AST_REPEAT };
+
+    struct Node {
+        uint8_t type;
+        uint8_t assertion;
+        uint16_t set;
+        uint16_t min;
+        uint16_t max;           // UNBOUNDED for * and +
+        uint32_t first;         // CONCAT/ALT: offset in operands; REPEAT: the repeated node
+        uint32_t count;
+    };
+
+    static const uint16_t UNBOUNDED = 0xFFFF;
+
+    RegexMatcher& re;
+    const char* p;
+    const char* end;
+    bool fold_case;
+    bool dot_all;
+    int depth;
+    std::vector<Node> nodes;
+    std::vector<uint32_t> operands;
+
+    RegexCompiler(RegexMatcher& target, const char* text, size_t length, bool icase)
+        : re(target), p(text), end(text + length), fold_case(icase), dot_all(false), depth(0) {}
+
+    bool fail(const char* message) {
+        if (re.error.length() == 0) re.error = message;
+        return false;
+    }
+
+    int newNode(uint8_t type) {
+        Node node;
+        memset(&node, 0, sizeof(node));
+        node.type = type;
+        nodes.push_back(node);
+        return nodes.size() - 1;
+    }
+
+    int newList(uint8_t type, const std::vector<uint32_t>& items) {
+        int node = newNode(type);
+        nodes[node].first = operands.size();
+        nodes[node].count = items.size();
+        operands.insert(operands.end(), items.begin(), items.end());
+        return node;
+    }
+
+    int newSet(ByteSet set) {
+        if (fold_case) set.foldCase();
+
+        // Identical sets share one bitmap, which keeps the byte classes few
+        size_t count = re.sets.size() / 32;
+        size_t index = 0;
+        while (index < count && memcmp(&re.sets[index * 32], set.bits, 32) != 0) index++;
+        if (index == count) {
+            if (count >= 0xFFFF) {
+                fail("too many character sets");
+                return -1;
+            }
+            re.sets.insert(re.sets.end(), set.bits, set.bits + 32);
+        }
+
+        int node = newNode(AST_SET);
+        nodes[node].set = index;
+        return node;
+    }
+
+    int newAssert(uint8_t assertion) {
+        re.uses_context = true;
+        int node = newNode(AST_ASSERT);
+        nodes[node].assertion = assertion;
+        return node;
+    }
+
+    void parseFlags() {
+        // Leading (?i), (?s), (?is)
+        while (end - p >= 4 && p[0] == '(' && p[1] == '?') {
+            const char* q = p + 2;
+            bool icase = fold_case;
+            bool dotall = dot_all;
+            while (q < end && (*q == 'i' || *q == 's')) {
+                if (*q == 'i') icase = true;
+                else dotall = true;
+                q++;
+            }
+            if (q == p + 2 || q >= end || *q != ')') return;
+            fold_case = icase;
+            dot_all = dotall;
+            p = q + 1;
+        }
+    }
+
+    int parseAlternation() {
+        std::vector<uint32_t> branches;
+        while (true) {
+            int branch = parseConcatenation();
+            if (branch < 0) return -1;
+            branches.push_back(branch);
+            if (p >= end || *p != '|') break;
+            p++;
+        }
+        return branches.size() == 1 ? (int)branches[0] : newList(AST_ALT, branches);
+    }
+
+    int parseConcatenation() {
+        std::vector<uint32_t> items;
+        while (p < end && *p != '|' && *p != ')') {
+            int item = parseRepeat();
+            if (item < 0) return -1;
+            items.push_back(item);
+        }
+        if (items.empty()) return newNode(AST_EMPTY);
+        return items.size() == 1 ? (int)items[0] : newList(AST_CONCAT, items);
+    }
+
+    bool parseCount(const char*& q, int& value) {
+        if (q >= end || *q < '0' || *q > '9') return false;
+        value = 0;
+        while (q < end && *q >= '0' && *q <= '9') {
+            value = value * 10 + (*q - '0');
+            if (value > REGEX_MAX_REPEAT) value = REGEX_MAX_REPEAT + 1;
+            q++;
+        }
+        return true;
+    }
+
+    // {n} {n,} {n,m}; anything else leaves the '{' to be read as a literal
+    bool parseBraces(int& min, int& max) {
+        const char* q = p + 1;
+        if (!parseCount(q, min)) return false;
+        max = min;
+        if (q < end && *q == ',') {
+            q++;
+            max = UNBOUNDED;
+            if (q < end && *q != '}' && !parseCount(q, max)) return false;
+        }
+        if (q >= end || *q != '}') return false;
+        p = q + 1;
+        return true;
+    }
+
+    int parseRepeat() {
+        int atom = parseAtom();
+        if (atom < 0) return -1;
+
+        while (p < end) {
+            int min, max;
+            if (*p == '*') {
+                min = 0;
+                max = UNBOUNDED;
+                p++;
+            } else if (*p == '+') {
+                min = 1;
+                max = UNBOUNDED;
+                p++;
+            } else if (*p == '?') {
+                min = 0;
+                max = 1;
+                p++;
+            } else if (*p != '{' || !parseBraces(min, max)) {
+                break;
+            }
+
+            if (min > REGEX_MAX_REPEAT || (max != UNBOUNDED && max > REGEX_MAX_REPEAT)) {
+                fail("repeat count too large");
+                return -1;
+            }
+            if (max < min) {
+                fail("bad repeat range");
+                return -1;
+            }
+
+            // Lazy and possessive suffixes do not change what matches
+            if (p < end && (*p == '?' || *p == '+')) p++;
+
+            int node = newNode(AST_REPEAT);
+            nodes[node].first = atom;
+            nodes[node].min = min;
+            nodes[node].max = max;
+            atom = node;
+        }
+        return atom;
+    }
+
+    /**
+     * @brief One escape after the backslash
+     * @return The byte it stands for, -1 for a set or assertion, -2 on error
+     */
+    int parseEscape(ByteSet& set, bool in_class, int& assertion) {
+        assertion = -1;
+        if (p >= end) {
+            fail("trailing backslash");
+            return -2;
+        }
+
+        char c = *p++;
+        switch (c) {
+            case 'd': set = digitSet(); return -1;
+            case 'D': set = digitSet(); set.invert(); return -1;
+            case 'w': set = wordSet(); return -1;
+            case 'W': set = wordSet(); set.invert(); return -1;
+            case 's': set = spaceSet(); return -1;
+            case 'S': set = spaceSet(); set.invert(); return -1;
+            case 'n': return '\n';
+            case 'r': return '\r';
+            case 't': return '\t';
+            case 'f': return '\f';
+            case 'v': return '\v';
+            case '0': return 0;
+            case 'x': {
+                int hi = p < end ? hexValue(p[0]) : -1;
+                int lo = p + 1 < end ? hexValue(p[1]) : -1;
+                if (hi < 0 || lo < 0) {
+                    fail("bad \\x escape");
+                    return -2;
+                }
+                p += 2;
+                return hi * 16 + lo;
+            }
+            case 'b':
+                if (in_class) return '\b';
+                assertion = ASSERT_WORD_BOUNDARY;
+                return -1;
+            case 'B':
+                if (in_class) break;
+                assertion = ASSERT_NOT_WORD_BOUNDARY;
+                return -1;
+            default:
+                if (!isWordByte(c)) return (uint8_t)c;
+                break;
+        }
+
+        fail("unsupported escape");
+        return -2;
+    }
+
+    int parseClass() {
+        ByteSet set;
+        bool negate = p < end && *p == '^';
+        if (negate) p++;
+
+        bool first = true;
+        while (p < end && (*p != ']' || first)) {
+            first = false;
+
+            ByteSet escaped;
+            int assertion;
+            int lo;
+            if (*p == '\\') {
+                p++;
+                lo = parseEscape(escaped, true, assertion);
+                if (lo == -2) return -1;
+            } else {
+                lo = (uint8_t)*p++;
+            }
+
+            if (lo < 0) {
+                set.merge(escaped);
+                continue;
+            }
+
+            if (end - p >= 2 && p[0] == '-' && p[1] != ']') {
+                p++;
+                int hi;
+                if (*p == '\\') {
+                    p++;
+                    hi = parseEscape(escaped, true, assertion);
+                    if (hi == -2) return -1;
+                } else {
+                    hi = (uint8_t)*p++;
+                }
+                if (hi < lo) {
+                    fail("bad character range");
+                    return -1;
+                }
+                set.addRange(lo, hi);
+            } else {
+                set.add(lo);
+            }
+        }
+
+        if (p >= end) {
+            fail("missing ]");
+            return -1;
+        }
+        p++;
+
+        // Fold before negating, so [^a] excludes 'A' too under (?i)
+        if (fold_case) set.foldCase();
+        if (negate) set.invert();
+        return newSet(set);
+    }
+
+    int parseAtom() {
+        char c = *p++;
+        switch (c) {
+            case '(': {
+                if (++depth > REGEX_MAX_DEPTH) {
+                    fail("groups nested too deep");
+                    return -1;
+                }
+                if (p < end && *p == '?') {
+                    if (p + 1 < end && p[1] == ':') {
+                        p += 2;
+                    } else {
+                        fail("unsupported group");
+                        return -1;
+                    }
+                }
+                int inner = parseAlternation();
+                if (inner < 0) return -1;
+                if (p >= end || *p != ')') {
+                    fail("missing )");
+                    return -1;
+                }
+                p++;
+                depth--;
+                return inner;
+            }
+
+            case '*':
+            case '+':
+            case '?':
+                fail("nothing to repeat");
+                return -1;
+
+            case '.': {
+                ByteSet set;
+                set.invert();
+                if (!dot_all) set.bits['\n' >> 3] &= ~(1 << ('\n' & 7));
+                return newSet(set);
+            }
+
+            case '^':
+                return newAssert(ASSERT_LINE_START);
+
+            case '$':
+                return newAssert(ASSERT_LINE_END);
+
+            case '[':
+                return parseClass();
+
+            case '\\': {
+                ByteSet set;
+                int assertion;
+                int literal = parseEscape(set, false, assertion);
+                if (literal == -2) return -1;
+                if (assertion >= 0) return newAssert(assertion);
+                if (literal >= 0) set.add(literal);
+                return newSet(set);
+            }
+
+            default: {
+                ByteSet set;
+                set.add(c);
+                return newSet(set);
+            }
+        }
+    }
+
+    // NFA construction runs back to front: each node is compiled knowing where it continues
+    uint32_t newState(uint8_t op, uint32_t out, uint32_t out1 = 0) {
+        RegexMatcher::State state;
+        state.op = op;
+        state.assertion = 0;
+        state.set = 0;
+        state.out = out;
+        state.out1 = out1;
+        re.nfa.push_back(state);
+        return re.nfa.size() - 1;
+    }
+
+    bool emit(uint32_t index, uint32_t next, uint32_t& start) {
+        if (re.nfa.size() >= REGEX_MAX_STATES) return fail("pattern too large");
+
+        const Node node = nodes[index];
+        switch (node.type) {
+            case AST_EMPTY:
+                start = next;
+                return true;
+
+            case AST_SET:
+                start = newState(RegexMatcher::OP_SET, next);
+                re.nfa[start].set = node.set;
+                return true;
+
+            case AST_ASSERT:
+                start = newState(RegexMatcher::OP_ASSERT, next);
+                re.nfa[start].assertion = node.assertion;
+                return true;
+
+            case AST_CONCAT:
+                for (uint32_t i = node.count; i > 0; i--) {
+                    if (!emit(operands[node.first + i - 1], next, next)) return false;
+                }
+                start = next;
+                return true;
+
+            case AST_ALT: {
+                uint32_t branch;
+                if (!emit(operands[node.first + node.count - 1], next, start)) return false;
+                for (uint32_t i = node.count - 1; i > 0; i--) {
+                    if (!emit(operands[node.first + i - 1], next, branch)) return false;
+                    start = newState(RegexMatcher::OP_SPLIT, branch, start);
+                }
+                return true;
+            }
+
+            case AST_REPEAT: {
+                uint32_t tail = next;
+                if (node.max == UNBOUNDED) {
+                    // x* as a loop through one split
+                    uint32_t loop = newState(RegexMatcher::OP_SPLIT, 0, next);
+                    uint32_t body;
+                    if (!emit(node.first, loop, body)) return false;
+                    re.nfa[loop].out = body;
+                    tail = loop;
+                } else {
+                    // x{0,k} as nested optionals, each able to skip to the end
+                    for (uint32_t i = node.min; i < node.max; i++) {
+                        uint32_t body;
+                        if (!emit(node.first, tail, body)) return false;
+                        tail = newState(RegexMatcher::OP_SPLIT, body, next);
+                    }
+                }
+                for (uint32_t i = 0; i < node.min; i++) {
+                    if (!emit(node.first, tail, tail)) return false;
+                }
+                start = tail;
+                return true;
+            }
+        }
+        return fail("bad syntax tree");
+    }
+};
+
+const uint16_t RegexCompiler::UNBOUNDED;
+
+// ===========================
+// Compilation
+// ===========================
+
+RegexMatcher::RegexMatcher() : cache(nullptr) {
+    clear();
+}
+
+RegexMatcher::~RegexMatcher() {
+    clear();
+}
+
+void RegexMatcher::clear() {
+    if (cache) {
+        heap_caps_free(cache);
+        cache = nullptr;
+    }
+    error = "";
+    compiled = false;
+    uses_context = false;
+    nfa.clear();
+    sets.clear();
+    start_state = 0;
+    memset(class_map, 0, sizeof(class_map));
+    class_byte.clear();
+    class_kind.clear();
+    num_classes = 1;
+    cache_budget = REGEX_DFA_CACHE_SIZE;
+    cache_words = 0;
+    cache_used = 0;
+    slot_count = 0;
+    dfa_states = 0;
+    generation = 0;
+    cache_flushes = 0;
+    visit_mark.clear();
+    visit_stamp = 0;
+}
+
+bool RegexMatcher::compile(const String& pattern, bool case_insensitive, size_t cache_size) {
+    clear();
+    cache_budget = cache_size;
+
+    if (!parse(pattern, case_insensitive)) {
+        nfa.clear();
+        sets.clear();
+        return false;
+    }
+
+    buildClasses();
+    visit_mark.assign(nfa.size(), 0);
+    compiled = true;
+    return true;
+}
+
+bool RegexMatcher::parse(const String& pattern, bool case_insensitive) {
+    RegexCompiler compiler(*this, pattern.c_str(), pattern.length(), case_insensitive);
+    compiler.parseFlags();
+
+    int root = compiler.parseAlternation();
+    if (root < 0) return false;
+    if (compiler.p < compiler.end) {
+        error = "unmatched )";
+        return false;
+    }
+
+    uint32_t match = compiler.newState(OP_MATCH, 0);
+    return compiler.emit(root, match, start_state);
+}
+
+void RegexMatcher::buildClasses() {
+    // Bytes no set tells apart share a class, so DFA rows stay short
+    std::vector<const uint8_t*> splits;
+    for (size_t i = 0; i < sets.size(); i += 32) {
+        splits.push_back(&sets[i]);
+    }
+
+    ByteSet word = wordSet();
+    ByteSet newline;
+    newline.add('\n');
+    if (uses_context) {
+        splits.push_back(word.bits);
+        splits.push_back(newline.bits);
+    }
+
+    num_classes = 1;
+    memset(class_map, 0, sizeof(class_map));
+    for (const uint8_t* split : splits) {
+        int16_t remap[512];
+        uint16_t count = 0;
+        memset(remap, 0xFF, sizeof(remap));
+        for (int c = 0; c < 256; c++) {
+            int key = class_map[c] * 2 + ((split[c >> 3] >> (c & 7)) & 1);
+            if (remap[key] < 0) remap[key] = count++;
+            class_map[c] = remap[key];
+        }
+        num_classes = count;
+    }
+
+    class_byte.assign(num_classes, 0);
+    class_kind.assign(num_classes, KIND_OTHER);
+    for (int c = 255; c >= 0; c--) {
+        class_byte[class_map[c]] = c;
+        class_kind[class_map[c]] = c == '\n' ? KIND_NEWLINE : isWordByte(c) ? KIND_WORD : KIND_OTHER;
+    }
+}
+
+size_t RegexMatcher::getMemoryUsage() const {
+    return sizeof(*this) +
+           nfa.capacity() * sizeof(State) +
+           sets.capacity() +
+           class_byte.capacity() + class_kind.capacity() +
+           visit_mark.capacity() * sizeof(uint32_t) +
+           (cache ? cache_words * sizeof(uint32_t) : 0);
+}
+
+// ===========================
+// DFA cache
+// ===========================
+
+bool RegexMatcher::allocateCache() {
+    // The cache must hold a handful of the largest possible states
+    size_t largest = 2 + num_classes + (nfa.size() + 1) / 2;
+    size_t words = cache_budget / sizeof(uint32_t);
+    if (words < MIN_SLOTS + 4 * largest) words = MIN_SLOTS + 4 * largest;
+
+    // PSRAM when there is some; under memory pressure settle for less
+    while (!cache) {
+        cache = (uint32_t*)heap_caps_malloc(words * sizeof(uint32_t), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (!cache) {
+            cache = (uint32_t*)heap_caps_malloc(words * sizeof(uint32_t), MALLOC_CAP_8BIT);
+        }
+        if (cache) break;
+        if (words / 2 < MIN_SLOTS + 4 * largest) {
+            error = "no memory for DFA cache";
+            return false;
+        }
+        words /= 2;
+    }
+
+    cache_words = words;
+    slot_count = MIN_SLOTS;
+    while (slot_count * 2 <= words / 16) slot_count *= 2;
+    flushCache();
+    cache_flushes = 0;
+    return true;
+}
+
+void RegexMatcher::flushCache() {
+    memset(cache, 0, slot_count * sizeof(uint32_t));
+    cache_used = slot_count;
+    dfa_states = 0;
+    generation++;
+    cache_flushes++;
+}
+
+uint32_t RegexMatcher::findOrAddState(uint8_t context, const uint16_t* core, size_t core_size) {
+    uint32_t hash = 2166136261UL ^ context;
+    for (size_t i = 0; i < core_size; i++) {
+        hash = (hash ^ core[i]) * 16777619UL;
+    }
+
+    uint32_t header = core_size | ((uint32_t)context << 16);
+    size_t mask = slot_count - 1;
+    size_t slot = hash & mask;
+    for (; cache[slot] != 0; slot = (slot + 1) & mask) {
+        uint32_t record = cache[slot];
+        if (cache[record] == hash && cache[record + 1] == header &&
+            memcmp(cache + record + 2 + num_classes, core, core_size * sizeof(uint16_t)) == 0) {
+            return record;
+        }
+    }
+
+    // Out of room: start over, keeping memory fixed. Callers hold no records across this
+    size_t record_words = 2 + num_classes + (core_size + 1) / 2;
+    if (cache_used + record_words > cache_words || (dfa_states + 1) * 4 > slot_count * 3) {
+        flushCache();
+        for (slot = hash & mask; cache[slot] != 0; slot = (slot + 1) & mask) {}
+    }
+
+    uint32_t record = cache_used;
+    cache_used += record_words;
+    cache[record] = hash;
+    cache[record + 1] = header;
+    memset(cache + record + 2, 0, (record_words - 2) * sizeof(uint32_t));
+    memcpy(cache + record + 2 + num_classes, core, core_size * sizeof(uint16_t));
+    cache[slot] = record;
+    dfa_states++;
+    return record;
+}
+
+uint32_t RegexMatcher::startState(uint8_t context) {
+    return findOrAddState(context, nullptr, 0);
+}
+
+void RegexMatcher::nextVisit() {
+    if (++visit_stamp == 0) {
+        std::fill(visit_mark.begin(), visit_mark.end(), 0);
+        visit_stamp = 1;
+    }
+}
+
+uint8_t RegexMatcher::contextOf(uint8_t kind) const {
+    if (!uses_context || kind == KIND_NEWLINE) return CTX_LINE_START;
+    return kind == KIND_WORD ? CTX_WORD : CTX_OTHER;
+}
+
+bool RegexMatcher::assertionHolds(uint8_t assertion, uint8_t context, uint8_t kind) const {
+    switch (assertion) {
+        case ASSERT_LINE_START: return context == CTX_LINE_START;
+        case ASSERT_LINE_END: return kind == KIND_NEWLINE || kind == KIND_END;
+        case ASSERT_WORD_BOUNDARY: return (context == CTX_WORD) != (kind == KIND_WORD);
+        case ASSERT_NOT_WORD_BOUNDARY: return (context == CTX_WORD) == (kind == KIND_WORD);
+        default: return false;
+    }
+}
+
+bool RegexMatcher::closure(uint32_t state, uint8_t kind) {
+    // Epsilon closure of a DFA state's core plus a fresh start (the search is unanchored),
+    // with the next byte's kind as lookahead for $ and \b. Leaves the consuming states in
+    // set_states and reports whether a match ends here
+    uint32_t header = cache[state + 1];
+    uint8_t context = header >> 16;
+    const uint16_t* core = (const uint16_t*)(cache + state + 2 + num_classes);
+
+    nextVisit();
+    set_states.clear();
+    stack.clear();
+    stack.push_back(start_state);
+    for (size_t i = (header & 0xFFFF); i > 0; i--) {
+        stack.push_back(core[i - 1]);
+    }
+
+    bool matched = false;
+    while (!stack.empty()) {
+        uint32_t s = stack.back();
+        stack.pop_back();
+        if (!visit(s)) continue;
+
+        const State& nfa_state = nfa[s];
+        switch (nfa_state.op) {
+            case OP_SET:
+                set_states.push_back(s);
+                break;
+            case OP_SPLIT:
+                stack.push_back(nfa_state.out1);
+                stack.push_back(nfa_state.out);
+                break;
+            case OP_JUMP:
+                stack.push_back(nfa_state.out);
+                break;
+            case OP_ASSERT:
+                if (assertionHolds(nfa_state.assertion, context, kind)) stack.push_back(nfa_state.out);
+                break;
+            case OP_MATCH:
+                matched = true;
+                break;
+        }
+    }
+    return matched;
+}
+
+uint32_t RegexMatcher::computeTransition(uint32_t state, uint16_t byte_class) {
+    bool matched = closure(state, class_kind[byte_class]);
+
+    uint8_t byte = class_byte[byte_class];
+    next_core.clear();
+    for (uint32_t s : set_states) {
+        if (inSet(nfa[s].set, byte)) next_core.push_back(nfa[s].out);
+    }
+    std::sort(next_core.begin(), next_core.end());
+    next_core.erase(std::unique(next_core.begin(), next_core.end()), next_core.end());
+
+    uint32_t before = generation;
+    uint32_t next = findOrAddState(contextOf(class_kind[byte_class]), next_core.data(), next_core.size());
+    if (matched) next |= MATCH_FLAG;
+
+    // A flush dropped the source state, so there is nothing to record the edge in
+    if (generation == before) {
+        cache[state + 2 + byte_class] = next;
+    }
+    return next;
+}
+
+// ===========================
+// Searching
+// ===========================
+
+void RegexMatcher::begin(Cursor& cursor) const {
+    cursor.state = 0;
+    cursor.generation = generation;
+    cursor.context = CTX_LINE_START;
+    cursor.matched = false;
+}
+
+bool RegexMatcher::feed(Cursor& cursor, const uint8_t* data, size_t len) {
+    if (cursor.matched) return true;
+    if (!compiled || (!cache && !allocateCache())) return false;
+
+    // A cursor from before a flush restarts; only a match straddling the flush point is lost
+    uint32_t state = cursor.state;
+    if (state == 0 || cursor.generation != generation) {
+        state = startState(cursor.context);
+    }
+
+    const uint32_t* transitions = cache + 2;
+    for (size_t i = 0; i < len; i++) {
+        uint8_t byte_class = class_map[data[i]];
+        uint32_t next = transitions[state + byte_class];
+        if (next == 0) {
+            next = computeTransition(state, byte_class);
+        }
+        if (next & MATCH_FLAG) {
+            cursor.matched = true;
+            return true;
+        }
+        state = next;
+    }
+
+    cursor.state = state;
+    cursor.generation = generation;
+    cursor.context = cache[state + 1] >> 16;
+    return false;
+}
+
+bool RegexMatcher::finish(Cursor& cursor) {
+    if (cursor.matched) return true;
+    if (!compiled || (!cache && !allocateCache())) return false;
+
+    uint32_t state = cursor.state;
+    if (state == 0 || cursor.generation != generation) {
+        state = startState(cursor.context);
+    }
+    cursor.matched = closure(state, KIND_END);
+    return cursor.matched;
+}
+
+bool RegexMatcher::search(const uint8_t* data, size_t len) {
+    Cursor cursor;
+    begin(cursor);
+    return feed(cursor, data, len) || finish(cursor);
+}
+
+bool RegexMatcher::find(const uint8_t* data, size_t len, size_t from, size_t& match_start, size_t& match_end) {
+    if (!compiled || from > len) return false;
+
+    // Pike VM: threads advance in lockstep, ordered by start; a state already reached by
+    // an earlier-starting thread is not entered again, so each step is O(NFA states)
+    uint32_t best_start = NO_POSITION;
+    uint32_t best_end = 0;
+    uint8_t context = from > 0 ? contextOf(class_kind[class_map[data[from - 1]]]) : CTX_LINE_START;
+
+    auto follow = [&](uint32_t state, uint32_t start, uint8_t kind, uint32_t position) {
+        thread_stack.clear();
+        thread_stack.push_back({state, start});
+        while (!thread_stack.empty()) {
+            Thread thread = thread_stack.back();
+            thread_stack.pop_back();
+            if (!visit(thread.state)) continue;
+
+            const State& nfa_state = nfa[thread.state];
+            switch (nfa_state.op) {
+                case OP_SET:
+                    next_threads.push_back(thread);
+                    break;
+                case OP_SPLIT:
+                    thread_stack.push_back({nfa_state.out1, start});
+                    thread_stack.push_back({nfa_state.out, start});
+                    break;
+                case OP_JUMP:
+                    thread_stack.push_back({nfa_state.out, start});
+                    break;
+                case OP_ASSERT:
+                    if (assertionHolds(nfa_state.assertion, context, kind)) {
+                        thread_stack.push_back({nfa_state.out, start});
+                    }
+                    break;
+                case OP_MATCH:
+                    if (start < best_start || (start == best_start && position > best_end)) {
+                        best_start = start;
+                        best_end = position;
+                    }
+                    break;
+            }
+        }
+    };
+
+    threads.clear();
+    for (size_t i = from; ; i++) {
+        uint8_t kind = i < len ? class_kind[class_map[data[i]]] : KIND_END;
+
+        nextVisit();
+        next_threads.clear();
+        for (const Thread& thread : threads) {
+            follow(thread.state, thread.start, kind, i);
+        }
+        if (best_start == NO_POSITION) {
+            follow(start_state, i, kind, i);
+        }
+        if (i >= len) break;
+
+        threads.clear();
+        for (const Thread& thread : next_threads) {
+            if (thread.start <= best_start && inSet(nfa[thread.state].set, data[i])) {
+                threads.push_back({nfa[thread.state].out, thread.start});
+            }
+        }
+        if (threads.empty() && best_start != NO_POSITION) break;
+        context = contextOf(kind);
+    }
+
+    if (best_start == NO_POSITION) return false;
+    match_start = best_start;
+    match_end = best_end;
+    return true;
+}
@@ -1,4 +1,5 @@
 #include "report_generator.h"
+#include <algorithm>
 
 ReportGenerator::ReportGenerator() {
     storage = nullptr;
@@ -298,7 +299,7 @@ String ReportGenerator::generateIOCSection() {
     ioc_html += "</div>\n";
 
     // Top IOCs table (first 20)
-    auto iocs = ioc_extractor->getIOCs();
+    const auto& iocs = ioc_extractor->getIOCs();
     if (iocs.size() > 0) {
         ioc_html += "<h3>Top Indicators</h3>\n";
         ioc_html += "<table class=\"ioc-table\">\n";
@@ -332,29 +333,32 @@ String ReportGenerator::generateTimelineSection() {
     auto timeline_stats = timeline_generator->getStatistics();
 
     timeline_html += "<p>Total timeline events: <strong>" + String(timeline_stats.total_events) + "</strong></p>\n";
-    timeline_html += "<p>Time range: " + formatTimestamp(timeline_stats.earliest_timestamp) + " to " + formatTimestamp(timeline_stats.latest_timestamp) + "</p>\n";
-
-    // Key events (first 10 high-significance events)
-    auto events = timeline_generator->getEvents();
-
-    // Sort by significance
-    timeline_generator->sortBySignificance();
+    timeline_html += "<p>Time range: " + TimelineGenerator::formatTimestamp(timeline_stats.earliest_timestamp) + " to " + TimelineGenerator::formatTimestamp(timeline_stats.latest_timestamp) + "</p>\n";
+
+    // Key events: the 10 most significant of those rated 7 or more, earliest first among equals.
+    // Ranked on positions, so the timeline's own order is left alone
+    const TimelineStore& store = timeline_generator->getStore();
+    std::vector<uint32_t> key_events;
+    for (uint32_t i = 0; i < store.size(); i++) {
+        if (store.getSignificance(i) >= 7) key_events.push_back(i);
+    }
+    std::stable_sort(key_events.begin(), key_events.end(), [&](uint32_t a, uint32_t b) {
+        return store.getSignificance(a) > store.getSignificance(b);
+    });
+    if (key_events.size() > 10) key_events.resize(10);
 
-    if (events.size() > 0) {
+    if (store.size() > 0) {
         timeline_html += "<h3>Key Events</h3>\n";
         timeline_html += "<table class=\"ioc-table\">\n";
         timeline_html += "<tr><th>Time</th><th>Type</th><th>Description</th><th>Target</th></tr>\n";
 
-        size_t count = 0;
-        for (const auto& event : events) {
-            if (event.significance >= 7 && count++ < 10) {
-                timeline_html += "<tr>";
-                timeline_html += "<td>" + event.datetime + "</td>";
-                timeline_html += "<td>" + timeline_generator->getEventTypeName(event.type) + "</td>";
-                timeline_html += "<td>" + event.description + "</td>";
-                timeline_html += "<td>" + event.target + "</td>";
-                timeline_html += "</tr>\n";
-            }
+        for (uint32_t event : key_events) {
+            timeline_html += "<tr>";
+            timeline_html += "<td>" + store.getString(TIMELINE_FIELD_DATETIME, event) + "</td>";
+            timeline_html += "<td>" + timeline_generator->getEventTypeName(store.getType(event)) + "</td>";
+            timeline_html += "<td>" + store.getString(TIMELINE_FIELD_DESCRIPTION, event) + "</td>";
+            timeline_html += "<td>" + store.getString(TIMELINE_FIELD_TARGET, event) + "</td>";
+            timeline_html += "</tr>\n";
         }
 
         timeline_html += "</table>\n";
@@ -0,0 +1,291 @@
+#include "rule_image.h"
+#include "esp_rom_crc.h"
+#include "esp_heap_caps.h"
+
+static_assert(sizeof(RuleImageHeader) == 136, "RuleImageHeader layout must match scripts/compile_rules.py");
+static_assert(sizeof(RuleImageRule) == 28, "RuleImageRule layout must match scripts/compile_rules.py");
+static_assert(sizeof(RuleImageString) == 8, "RuleImageString layout must match scripts/compile_rules.py");
+static_assert(sizeof(RuleImagePattern) == 12, "RuleImagePattern layout must match scripts/compile_rules.py");
+
+RuleImage::RuleImage()
+    : header(nullptr),
+      rules(nullptr),
+      strings(nullptr),
+      patterns(nullptr),
+      hex_patterns(nullptr),
+      regex_patterns(nullptr),
+      pool(nullptr),
+      text_limit(0) {
+}
+
+bool RuleImage::sectionFits(uint32_t offset, uint64_t count, uint32_t item_size, uint32_t image_size,
+                            uint32_t alignment) {
+    // Counts are products of header fields, so they are taken as 64-bit and cannot wrap
+    if (offset % alignment != 0 || offset > image_size) return false;
+    return count <= (image_size - offset) / item_size;
+}
+
+bool RuleImage::attach(const uint8_t* data, size_t size) {
+    detach();
+
+    if (!data || size < sizeof(RuleImageHeader) || ((uintptr_t)data & 3) != 0) {
+        Serial.println("[RuleImage] Invalid image buffer");
+        return false;
+    }
+
+    const RuleImageHeader* h = (const RuleImageHeader*)data;
+    if (h->magic != RULE_IMAGE_MAGIC || h->version != RULE_IMAGE_VERSION ||
+        h->header_size != sizeof(RuleImageHeader) || h->image_size > size ||
+        h->image_size < h->header_size) {
+        Serial.println("[RuleImage] Bad header (magic/version/size)");
+        return false;
+    }
+
+    uint32_t n = h->image_size;
+    uint64_t sparse_states = (uint64_t)h->num_states - h->dense_states;
+    if (h->num_states == 0 || h->num_states > MultiPatternMatcher::STATE_MASK ||
+        h->dense_states == 0 || h->dense_states > h->num_states ||
+        h->num_classes == 0 || h->num_classes > 256 ||
+        !sectionFits(h->rules_offset, h->rule_count, sizeof(RuleImageRule), n) ||
+        !sectionFits(h->strings_offset, h->string_count, sizeof(RuleImageString), n) ||
+        !sectionFits(h->patterns_offset, h->pattern_count, sizeof(RuleImagePattern), n) ||
+        !sectionFits(h->pool_offset, h->pool_size, 1, n) ||
+        !sectionFits(h->class_map_offset, 256, 1, n) ||
+        !sectionFits(h->dense_offset, (uint64_t)h->dense_states * h->num_classes, sizeof(uint32_t), n) ||
+        !sectionFits(h->sparse_begin_offset, sparse_states + 1, sizeof(uint32_t), n) ||
+        !sectionFits(h->sparse_class_offset, h->sparse_edge_count, 1, n) ||
+        !sectionFits(h->sparse_next_offset, h->sparse_edge_count, sizeof(uint32_t), n) ||
+        !sectionFits(h->fail_offset, sparse_states, sizeof(uint32_t), n) ||
+        !sectionFits(h->output_begin_offset, (uint64_t)h->num_states + 1, sizeof(uint32_t), n) ||
+        !sectionFits(h->output_ids_offset, h->output_count, sizeof(uint16_t), n) ||
+        !sectionFits(h->hex_patterns_offset, h->hex_pattern_count, sizeof(RuleImagePattern), n) ||
+        !sectionFits(h->hex_masks_offset, (uint64_t)h->hex_word_count * 256, sizeof(uint64_t), n, 8) ||
+        !sectionFits(h->hex_bits_offset, (uint64_t)h->hex_word_count * HexPatternMatcher::WORD_BITS_COUNT,
+                     sizeof(uint64_t), n, 8) ||
+        !sectionFits(h->hex_accept_offset, (uint64_t)h->hex_word_count * 64, sizeof(uint16_t), n) ||
+        !sectionFits(h->hex_first_offset, 32, 1, n) ||
+        !sectionFits(h->regex_patterns_offset, h->regex_pattern_count, sizeof(RuleImagePattern), n)) {
+        Serial.println("[RuleImage] Section out of bounds");
+        return false;
+    }
+
+    // The 64-bit hex tables are read in place
+    if (h->hex_word_count > 0 && ((uintptr_t)data & 7) != 0) {
+        Serial.println("[RuleImage] Image with hex tables must be 8-byte aligned");
+        return false;
+    }
+
+    uint32_t crc = esp_rom_crc32_le(0, data + h->header_size, n - h->header_size);
+    if (crc != h->checksum) {
+        Serial.printf("[RuleImage] Checksum mismatch (0x%08x != 0x%08x)\n",
+                      (unsigned)crc, (unsigned)h->checksum);
+        return false;
+    }
+
+    header = h;
+    rules = (const RuleImageRule*)(data + h->rules_offset);
+    strings = (const RuleImageString*)(data + h->strings_offset);
+    patterns = (const RuleImagePattern*)(data + h->patterns_offset);
+    hex_patterns = (const RuleImagePattern*)(data + h->hex_patterns_offset);
+    regex_patterns = (const RuleImagePattern*)(data + h->regex_patterns_offset);
+    pool = data + h->pool_offset;
+
+    // The checksum only catches damage: an edited image can carry a valid one, so every
+    // index the matchers follow without checking is checked here, once
+    if (!referencesValid()) {
+        detach();
+        return false;
+    }
+
+    Serial.printf("[RuleImage] Attached %u rules, %u patterns, %u hex patterns, %u regexes (%u bytes)\n",
+                  (unsigned)h->rule_count, (unsigned)h->pattern_count,
+                  (unsigned)h->hex_pattern_count, (unsigned)h->regex_pattern_count, (unsigned)n);
+    return true;
+}
+
+bool RuleImage::patternsValid(const RuleImagePattern* table, uint32_t count, bool exact, bool text) const {
+    for (uint32_t p = 0; p < count; p++) {
+        const RuleImagePattern& pattern = table[p];
+        if (pattern.rule >= header->rule_count || pattern.slot >= rules[pattern.rule].string_count) return false;
+        if (exact && (pattern.length == 0 || (uint64_t)pattern.bytes + pattern.length > header->pool_size)) {
+            return false;
+        }
+        if (text && !textValid(pattern.bytes)) return false;
+    }
+    return true;
+}
+
+bool RuleImage::referencesValid() {
+    const RuleImageHeader* h = header;
+    const uint8_t* base = (const uint8_t*)h;
+
+    // A text reference is safe when a NUL follows it inside the pool
+    text_limit = 0;
+    for (uint32_t i = h->pool_size; i > 0; i--) {
+        if (pool[i - 1] == 0) {
+            text_limit = i;
+            break;
+        }
+    }
+
+    for (uint32_t r = 0; r < h->rule_count; r++) {
+        const RuleImageRule& rule = rules[r];
+        if (!textValid(rule.name) || !textValid(rule.description) || !textValid(rule.severity) ||
+            !textValid(rule.category) || !textValid(rule.platform) ||
+            rule.string_count > RULE_IMAGE_MAX_STRINGS ||
+            (uint64_t)rule.first_string + rule.string_count > h->string_count) {
+            Serial.printf("[RuleImage] Rule %u has bad references\n", (unsigned)r);
+            return false;
+        }
+    }
+
+    for (uint32_t i = 0; i < h->string_count; i++) {
+        if (!textValid(strings[i].text) || strings[i].kind > RULE_STRING_REGEX) {
+            Serial.printf("[RuleImage] String %u has bad references\n", (unsigned)i);
+            return false;
+        }
+    }
+
+    if (!patternsValid(patterns, h->pattern_count, true, false) ||
+        !patternsValid(hex_patterns, h->hex_pattern_count, false, false) ||
+        !patternsValid(regex_patterns, h->regex_pattern_count, false, true)) {
+        Serial.println("[RuleImage] Pattern has bad references");
+        return false;
+    }
+
+    // Automaton: every transition, failure link and output in range. A failure link must
+    // lead to an earlier (shallower) state, or following links might never end
+    const uint8_t* class_map = base + h->class_map_offset;
+    for (int b = 0; b < 256; b++) {
+        if (class_map[b] >= h->num_classes) return automatonInvalid();
+    }
+
+    const uint32_t* dense = (const uint32_t*)(base + h->dense_offset);
+    for (uint64_t i = 0; i < (uint64_t)h->dense_states * h->num_classes; i++) {
+        if ((dense[i] & MultiPatternMatcher::STATE_MASK) >= h->num_states) return automatonInvalid();
+    }
+
+    const uint32_t* sparse_begin = (const uint32_t*)(base + h->sparse_begin_offset);
+    const uint32_t* sparse_next = (const uint32_t*)(base + h->sparse_next_offset);
+    const uint32_t* fail = (const uint32_t*)(base + h->fail_offset);
+    uint32_t sparse_states = h->num_states - h->dense_states;
+    for (uint32_t k = 0; k < sparse_states; k++) {
+        if (sparse_begin[k] > sparse_begin[k + 1] || fail[k] >= h->dense_states + k) return automatonInvalid();
+    }
+    if (sparse_begin[sparse_states] > h->sparse_edge_count) return automatonInvalid();
+    for (uint32_t e = 0; e < h->sparse_edge_count; e++) {
+        if ((sparse_next[e] & MultiPatternMatcher::STATE_MASK) >= h->num_states) return automatonInvalid();
+    }
+
+    const uint32_t* output_begin = (const uint32_t*)(base + h->output_begin_offset);
+    const uint16_t* output_ids = (const uint16_t*)(base + h->output_ids_offset);
+    for (uint32_t s = 0; s < h->num_states; s++) {
+        if (output_begin[s] > output_begin[s + 1]) return automatonInvalid();
+    }
+    if (output_begin[h->num_states] > h->output_count) return automatonInvalid();
+    for (uint32_t o = 0; o < h->output_count; o++) {
+        if (output_ids[o] >= h->pattern_count) return automatonInvalid();
+    }
+
+    // Hex tables: the pattern reported for every accepting bit
+    const uint64_t* word_bits = (const uint64_t*)(base + h->hex_bits_offset);
+    const uint16_t* accept_ids = (const uint16_t*)(base + h->hex_accept_offset);
+    for (uint32_t w = 0; w < h->hex_word_count; w++) {
+        uint64_t accepts = word_bits[w * HexPatternMatcher::WORD_BITS_COUNT + HexPatternMatcher::WORD_ACCEPTS];
+        for (; accepts; accepts &= accepts - 1) {
+            if (accept_ids[w * 64 + __builtin_ctzll(accepts)] >= h->hex_pattern_count) {
+                Serial.println("[RuleImage] Hex table has bad references");
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+bool RuleImage::automatonInvalid() {
+    Serial.println("[RuleImage] Automaton has bad references");
+    return false;
+}
+
+void RuleImage::detach() {
+    header = nullptr;
+    rules = nullptr;
+    strings = nullptr;
+    patterns = nullptr;
+    hex_patterns = nullptr;
+    regex_patterns = nullptr;
+    pool = nullptr;
+    text_limit = 0;
+}
+
+MultiPatternMatcher::Tables RuleImage::getAutomatonTables() const {
+    MultiPatternMatcher::Tables t;
+    memset(&t, 0, sizeof(t));
+    if (!header) return t;
+
+    const uint8_t* base = (const uint8_t*)header;
+    t.class_map = base + header->class_map_offset;
+    t.dense = (const uint32_t*)(base + header->dense_offset);
+    t.sparse_begin = (const uint32_t*)(base + header->sparse_begin_offset);
+    t.sparse_class = base + header->sparse_class_offset;
+    t.sparse_next = (const uint32_t*)(base + header->sparse_next_offset);
+    t.fail = (const uint32_t*)(base + header->fail_offset);
+    t.output_begin = (const uint32_t*)(base + header->output_begin_offset);
+    t.output_ids = (const uint16_t*)(base + header->output_ids_offset);
+    t.num_states = header->num_states;
+    t.dense_states = header->dense_states;
+    t.pattern_count = header->pattern_count;
+    t.num_classes = header->num_classes;
+    return t;
+}
+
+HexPatternMatcher::Tables RuleImage::getHexTables() const {
+    HexPatternMatcher::Tables t;
+    memset(&t, 0, sizeof(t));
+    if (!header) return t;
+
+    const uint8_t* base = (const uint8_t*)header;
+    t.byte_masks = (const uint64_t*)(base + header->hex_masks_offset);
+    t.word_bits = (const uint64_t*)(base + header->hex_bits_offset);
+    t.accept_ids = (const uint16_t*)(base + header->hex_accept_offset);
+    t.first_bytes = base + header->hex_first_offset;
+    t.word_count = header->hex_word_count;
+    t.pattern_count = header->hex_pattern_count;
+    return t;
+}
+
+uint8_t* RuleImage::loadFile(FRFDStorage* storage, const String& path, size_t* size) {
+    if (!storage) {
+        Serial.printf("[RuleImage] No storage to load %s from\n", path.c_str());
+        return nullptr;
+    }
+
+    File file = storage->openFile(path);
+    if (!file) {
+        Serial.printf("[RuleImage] Cannot open %s\n", path.c_str());
+        return nullptr;
+    }
+
+    size_t file_size = file.size();
+    uint8_t* buffer = (uint8_t*)heap_caps_aligned_alloc(8, file_size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!buffer) {
+        buffer = (uint8_t*)heap_caps_aligned_alloc(8, file_size, MALLOC_CAP_8BIT);
+    }
+    if (!buffer) {
+        Serial.printf("[RuleImage] Not enough memory for %s (%u bytes)\n", path.c_str(), (unsigned)file_size);
+        file.close();
+        return nullptr;
+    }
+
+    size_t read = file.read(buffer, file_size);
+    file.close();
+    if (read != file_size) {
+        Serial.printf("[RuleImage] Short read on %s\n", path.c_str());
+        heap_caps_free(buffer);
+        return nullptr;
+    }
+
+    *size = file_size;
+    return buffer;
+}
@@ -0,0 +1,1262 @@
+#include "sigma_rules.h"
+#include <algorithm>
+
+const uint8_t SigmaRuleSet::ATOM_INDEXED;
+const uint8_t SigmaRuleSet::ATOM_VERIFY;
+const uint8_t SigmaRuleSet::ATOM_CASED;
+
+// Wildcards in MATCH_GLOB values; escaped \* and \? stay literal
+static const char WILDCARD_ANY = '\x01';
+static const char WILDCARD_ONE = '\x02';
+
+static const uint32_t NO_ATOM = 0xFFFFFFFFUL;
+static const uint16_t NO_PATTERN = 0xFFFF;
+
+// Three-valued results of programWithoutHits
+static const uint8_t TRI_FALSE = 0;
+static const uint8_t TRI_TRUE = 1;
+static const uint8_t TRI_UNKNOWN = 2;
+
+static inline char foldChar(char c) {
+    return (c >= 'A' && c <= 'Z') ? c + 32 : c;
+}
+
+static String foldString(const String& text) {
+    String folded = text;
+    folded.toLowerCase();
+    return folded;
+}
+
+static bool equalsAt(const char* text, const char* value, size_t length, bool cased) {
+    if (cased) return memcmp(text, value, length) == 0;
+    for (size_t i = 0; i < length; i++) {
+        if (foldChar(text[i]) != value[i]) return false;
+    }
+    return true;
+}
+
+// ===========================
+// YAML subset and rule compiler
+// ===========================
+
+struct SigmaCompiler {
+    struct Line {
+        uint16_t indent;
+        uint16_t number;
+        String text;
+    };
+
+    struct Node {
+        enum Kind : uint8_t { SCALAR, MAP, LIST };
+
+        uint8_t kind;
+        String key;                 // Entries of a map
+        String value;               // Scalars
+        std::vector<Node> children;
+
+        Node() : kind(SCALAR) {}
+
+        const Node* find(const char* name) const {
+            for (const auto& child : children) {
+                if (child.key == name) return &child;
+            }
+            return nullptr;
+        }
+    };
+
+    SigmaRuleSet& set;
+    std::vector<Line> lines;
+    size_t pos;
+
+    // Detection being compiled
+    std::vector<String> selection_names;
+    std::vector<std::vector<uint32_t>> selection_code;
+    std::vector<uint32_t>* out;
+    std::vector<String> tokens;
+    size_t token;
+    int depth;
+
+    explicit SigmaCompiler(SigmaRuleSet& target)
+        : set(target), pos(0), out(nullptr), token(0), depth(0) {}
+
+    bool fail(const String& message) {
+        if (set.error.length() == 0) set.error = message;
+        return false;
+    }
+
+    String where() const {
+        return "line " + String(pos < lines.size() ? lines[pos].number : lines.empty() ? 0 : lines.back().number);
+    }
+
+    void emit(uint8_t op, uint32_t operand = 0) {
+        out->push_back((uint32_t)op << 24 | operand);
+    }
+
+    // ---------------------------
+    // Lines and nodes
+    // ---------------------------
+
+    bool addLine(const String& raw, uint16_t number) {
+        size_t indent = 0;
+        while (indent < raw.length() && raw[indent] == ' ') indent++;
+        if (indent < raw.length() && raw[indent] == '\t') {
+            return fail("line " + String(number) + ": tab in indentation");
+        }
+
+        String text = raw.substring(indent);
+        text.trim();
+        if (text.length() == 0 || text[0] == '#') return true;
+
+        Line line;
+        line.indent = indent;
+        line.number = number;
+        line.text = text;
+        lines.push_back(line);
+        return true;
+    }
+
+    static bool isItem(const String& text) {
+        return text == "-" || text.startsWith("- ");
+    }
+
+    // Offset of the ':' ending a mapping key, or -1
+    static int keyColon(const String& text) {
+        char quote = 0;
+        for (size_t i = 0; i < text.length(); i++) {
+            char c = text[i];
+            if (quote) {
+                if (c == quote) quote = 0;
+                continue;
+            }
+            if (i == 0 && (c == '\'' || c == '"')) {
+                quote = c;
+                continue;
+            }
+            if (c == ':' && (i + 1 == text.length() || text[i + 1] == ' ')) return i;
+            if (c == '#' && i > 0 && text[i - 1] == ' ') return -1;
+        }
+        return -1;
+    }
+
+    bool parseScalar(const String& raw, Node& node) {
+        String text = raw;
+        text.trim();
+        node.kind = Node::SCALAR;
+        node.value = "";
+
+        if (text.length() > 0 && text[0] == '\'') {
+            size_t i = 1;
+            for (; i < text.length(); i++) {
+                if (text[i] == '\'') {
+                    if (i + 1 < text.length() && text[i + 1] == '\'') {
+                        node.value += '\'';
+                        i++;
+                        continue;
+                    }
+                    return true;
+                }
+                node.value += text[i];
+            }
+            return fail(where() + ": unterminated quote");
+        }
+
+        if (text.length() > 0 && text[0] == '"') {
+            for (size_t i = 1; i < text.length(); i++) {
+                char c = text[i];
+                if (c == '"') return true;
+                if (c == '\\' && i + 1 < text.length()) {
+                    char e = text[++i];
+                    switch (e) {
+                        case 'n': node.value += '\n'; break;
+                        case 't': node.value += '\t'; break;
+                        case '"': node.value += '"'; break;
+                        case '\\': node.value += '\\'; break;
+                        default: node.value += '\\'; node.value += e; break;
+                    }
+                    continue;
+                }
+                node.value += c;
+            }
+            return fail(where() + ": unterminated quote");
+        }
+
+        if (text.length() > 0 && text[0] == '[') {
+            // Flow list: [a, 'b', "c"]
+            node.kind = Node::LIST;
+            int close = -1;
+            char quote = 0;
+            size_t item_start = 1;
+            for (size_t i = 1; i < text.length() && close < 0; i++) {
+                char c = text[i];
+                if (quote) {
+                    if (c == quote) quote = 0;
+                } else if (c == '\'' || c == '"') {
+                    quote = c;
+                } else if (c == ',' || c == ']') {
+                    String item = text.substring(item_start, i);
+                    item.trim();
+                    if (item.length() > 0 || c == ',') {
+                        Node child;
+                        if (!parseScalar(item, child)) return false;
+                        node.children.push_back(child);
+                    }
+                    item_start = i + 1;
+                    if (c == ']') close = i;
+                }
+            }
+            if (close < 0) return fail(where() + ": unterminated flow list");
+            return true;
+        }
+
+        int comment = text.indexOf(" #");
+        if (comment >= 0) {
+            text = text.substring(0, comment);
+            text.trim();
+        }
+        if (text != "null" && text != "~") node.value = text;
+        return true;
+    }
+
+    bool parseNode(uint16_t indent, Node& node) {
+        if (isItem(lines[pos].text)) {
+            node.kind = Node::LIST;
+            while (pos < lines.size() && lines[pos].indent == indent && isItem(lines[pos].text)) {
+                Line& line = lines[pos];
+                size_t skip = 1;
+                while (skip < line.text.length() && line.text[skip] == ' ') skip++;
+                String rest = line.text.substring(skip);
+
+                node.children.push_back(Node());
+                Node& item = node.children.back();
+                if (rest.length() == 0) {
+                    pos++;
+                    if (pos < lines.size() && lines[pos].indent > indent &&
+                        !parseNode(lines[pos].indent, item)) {
+                        return false;
+                    }
+                } else if (keyColon(rest) >= 0) {
+                    // "- key: value" starts a map indented to the key
+                    line.indent = indent + skip;
+                    line.text = rest;
+                    if (!parseNode(line.indent, item)) return false;
+                } else {
+                    if (!parseScalar(rest, item)) return false;
+                    pos++;
+                }
+            }
+        } else {
+            node.kind = Node::MAP;
+            while (pos < lines.size() && lines[pos].indent == indent && !isItem(lines[pos].text)) {
+                String text = lines[pos].text;
+                int colon = keyColon(text);
+                if (colon < 0) return fail(where() + ": expected 'key: value'");
+
+                node.children.push_back(Node());
+                Node& child = node.children.back();
+                Node key;
+                if (!parseScalar(text.substring(0, colon), key)) return false;
+                child.key = key.value;
+
+                String rest = text.substring(colon + 1);
+                rest.trim();
+                pos++;
+
+                if (rest.length() == 0) {
+                    // Nested block; a list may sit at the key's own indentation
+                    if (pos < lines.size() &&
+                        (lines[pos].indent > indent || (lines[pos].indent == indent && isItem(lines[pos].text))) &&
+                        !parseNode(lines[pos].indent, child)) {
+                        return false;
+                    }
+                } else if (rest[0] == '|' || rest[0] == '>') {
+                    // Block scalar: every more-indented line
+                    String separator = rest[0] == '|' ? "\n" : " ";
+                    while (pos < lines.size() && lines[pos].indent > indent) {
+                        if (child.value.length() > 0) child.value += separator;
+                        child.value += lines[pos].text;
+                        pos++;
+                    }
+                } else if (!parseScalar(rest, child)) {
+                    return false;
+                }
+            }
+        }
+
+        if (pos < lines.size() && lines[pos].indent > indent) {
+            return fail(where() + ": unexpected indentation");
+        }
+        return true;
+    }
+
+    // ---------------------------
+    // Atoms
+    // ---------------------------
+
+    static int parseField(const String& name) {
+        String lower = foldString(name);
+        if (lower == "actor" || lower == "user" || lower == "image" || lower == "parentimage") {
+            return SIGMA_FIELD_ACTOR;
+        }
+        if (lower == "target" || lower == "targetfilename" || lower == "targetobject" ||
+            lower == "destinationhostname") {
+            return SIGMA_FIELD_TARGET;
+        }
+        if (lower == "description") return SIGMA_FIELD_DESCRIPTION;
+        if (lower == "details" || lower == "commandline") return SIGMA_FIELD_DETAILS;
+        if (lower == "source" || lower == "source_artifact") return SIGMA_FIELD_SOURCE;
+        if (lower == "type" || lower == "eventtype") return SIGMA_FIELD_TYPE;
+        return -1;
+    }
+
+    // A Sigma string value under a contains/startswith/endswith/equals modifier
+    uint32_t valueAtom(uint8_t field, uint8_t match, const String& raw, bool cased) {
+        String body;
+        for (size_t i = 0; i < raw.length(); i++) {
+            char c = raw[i];
+            if (c == '\\' && i + 1 < raw.length() &&
+                (raw[i + 1] == '*' || raw[i + 1] == '?' || raw[i + 1] == '\\')) {
+                body += raw[++i];
+            } else if (c == '*') {
+                body += WILDCARD_ANY;
+            } else if (c == '?') {
+                body += WILDCARD_ONE;
+            } else {
+                body += c;
+            }
+        }
+        if (!cased) body.toLowerCase();
+
+        bool open_start = match == SigmaRuleSet::MATCH_CONTAINS || match == SigmaRuleSet::MATCH_ENDS;
+        bool open_end = match == SigmaRuleSet::MATCH_CONTAINS || match == SigmaRuleSet::MATCH_STARTS;
+
+        // Leading and trailing * only loosen the anchoring
+        size_t first = 0;
+        size_t last = body.length();
+        while (first < last && body[first] == WILDCARD_ANY) {
+            open_start = true;
+            first++;
+        }
+        while (last > first && body[last - 1] == WILDCARD_ANY) {
+            open_end = true;
+            last--;
+        }
+        String core = body.substring(first, last);
+
+        bool wildcards = core.indexOf(WILDCARD_ANY) >= 0 || core.indexOf(WILDCARD_ONE) >= 0;
+        if (!wildcards && (core.length() > 0 || !(open_start || open_end))) {
+            uint8_t literal = open_start ? (open_end ? SigmaRuleSet::MATCH_CONTAINS : SigmaRuleSet::MATCH_ENDS)
+                                         : (open_end ? SigmaRuleSet::MATCH_STARTS : SigmaRuleSet::MATCH_EQUALS);
+            return set.addAtom(field, literal, core, cased ? SigmaRuleSet::ATOM_CASED : 0);
+        }
+
+        String glob = open_start ? String(WILDCARD_ANY) : String("");
+        glob += core;
+        if (open_end) glob += WILDCARD_ANY;
+        return set.addAtom(field, SigmaRuleSet::MATCH_GLOB, glob, cased ? SigmaRuleSet::ATOM_CASED : 0);
+    }
+
+    uint32_t regexAtom(uint8_t field, const String& pattern, bool icase, bool dot_all) {
+        String expression = dot_all ? "(?s)" + pattern : pattern;
+        String key = String(icase ? "i:" : "c:") + expression;
+
+        auto cached = set.regex_cache.find(key);
+        if (cached == set.regex_cache.end()) {
+            RegexMatcher& regex = set.regex_cache[key];
+            if (!regex.compile(expression, icase, SIGMA_REGEX_CACHE_SIZE)) {
+                fail("bad regex '" + pattern + "': " + regex.getError());
+                set.regex_cache.erase(key);
+                return NO_ATOM;
+            }
+            cached = set.regex_cache.find(key);
+        }
+
+        uint32_t atom = set.addAtom(field, SigmaRuleSet::MATCH_REGEX, key, 0);
+        if (atom != NO_ATOM) set.atoms[atom].regex = &cached->second;
+        return atom;
+    }
+
+    // ---------------------------
+    // Detection
+    // ---------------------------
+
+    bool compileKeyword(const String& value) {
+        static const uint8_t fields[] = {
+            SIGMA_FIELD_ACTOR, SIGMA_FIELD_TARGET, SIGMA_FIELD_DESCRIPTION, SIGMA_FIELD_DETAILS
+        };
+        for (size_t i = 0; i < sizeof(fields); i++) {
+            uint32_t atom = valueAtom(fields[i], SigmaRuleSet::MATCH_CONTAINS, value, false);
+            if (atom == NO_ATOM) return false;
+            emit(SigmaRuleSet::OP_ATOM, atom);
+            if (i > 0) emit(SigmaRuleSet::OP_OR);
+        }
+        return true;
+    }
+
+    bool compileField(const Node& entry) {
+        // field|modifier|modifier
+        String key = entry.key;
+        int bar = key.indexOf('|');
+        String name = bar < 0 ? key : key.substring(0, bar);
+        int field = parseField(name);
+        if (field < 0) return fail("unknown field '" + name + "'");
+
+        uint8_t match = SigmaRuleSet::MATCH_EQUALS;
+        bool all = false, regex = false, icase = false, dot_all = false, cased = false, exists = false;
+        while (bar >= 0) {
+            int next = key.indexOf('|', bar + 1);
+            String modifier = key.substring(bar + 1, next < 0 ? key.length() : next);
+            bar = next;
+
+            if (modifier == "contains") match = SigmaRuleSet::MATCH_CONTAINS;
+            else if (modifier == "startswith") match = SigmaRuleSet::MATCH_STARTS;
+            else if (modifier == "endswith") match = SigmaRuleSet::MATCH_ENDS;
+            else if (modifier == "all") all = true;
+            else if (modifier == "re") regex = true;
+            else if (regex && modifier == "i") icase = true;
+            else if (regex && modifier == "s") dot_all = true;
+            else if (regex && modifier == "m") continue;    // ^ and $ always match at lines
+            else if (modifier == "cased") cased = true;
+            else if (modifier == "exists") exists = true;
+            else return fail("unsupported modifier '" + modifier + "'");
+        }
+
+        std::vector<const Node*> values;
+        if (entry.kind == Node::SCALAR) {
+            values.push_back(&entry);
+        } else if (entry.kind == Node::LIST) {
+            for (const auto& item : entry.children) {
+                if (item.kind != Node::SCALAR) return fail("'" + key + "' values must be scalars");
+                values.push_back(&item);
+            }
+        }
+        if (values.empty()) return fail("'" + key + "' has no values");
+
+        for (size_t i = 0; i < values.size(); i++) {
+            const String& value = values[i]->value;
+            uint32_t atom;
+            if (exists) {
+                atom = set.addAtom(field, SigmaRuleSet::MATCH_EXISTS, "", 0);
+            } else if (regex) {
+                atom = regexAtom(field, value, icase, dot_all);
+            } else {
+                atom = valueAtom(field, match, value, cased);
+            }
+            if (atom == NO_ATOM) return false;
+
+            emit(SigmaRuleSet::OP_ATOM, atom);
+            if (exists && value.equalsIgnoreCase("false")) emit(SigmaRuleSet::OP_NOT);
+            if (i > 0) emit(all ? SigmaRuleSet::OP_AND : SigmaRuleSet::OP_OR);
+        }
+        return true;
+    }
+
+    bool compileSelection(const Node& selection) {
+        if (selection.kind == Node::SCALAR) return compileKeyword(selection.value);
+        if (selection.children.empty()) return fail("empty selection");
+
+        for (size_t i = 0; i < selection.children.size(); i++) {
+            const Node& child = selection.children[i];
+            bool compiled;
+            if (selection.kind == Node::MAP) {
+                compiled = compileField(child);
+            } else if (child.kind == Node::MAP) {
+                compiled = compileSelection(child);
+            } else if (child.kind == Node::SCALAR) {
+                compiled = compileKeyword(child.value);
+            } else {
+                compiled = fail("nested lists are not supported");
+            }
+            if (!compiled) return false;
+            if (i > 0) emit(selection.kind == Node::MAP ? SigmaRuleSet::OP_AND : SigmaRuleSet::OP_OR);
+        }
+        return true;
+    }
+
+    // ---------------------------
+    // Condition
+    // ---------------------------
+
+    bool tokenize(const String& condition) {
+        tokens.clear();
+        token = 0;
+        size_t i = 0;
+        while (i < condition.length()) {
+            char c = condition[i];
+            if (c == ' ' || c == '\t') {
+                i++;
+            } else if (c == '(' || c == ')') {
+                tokens.push_back(String(c));
+                i++;
+            } else if (c == '|') {
+                return fail("aggregations are not supported");
+            } else {
+                size_t start = i;
+                while (i < condition.length() && condition[i] != ' ' && condition[i] != '\t' &&
+                       condition[i] != '(' && condition[i] != ')' && condition[i] != '|') {
+                    i++;
+                }
+                tokens.push_back(condition.substring(start, i));
+            }
+        }
+        if (tokens.empty()) return fail("empty condition");
+        return true;
+    }
+
+    bool peek(const char* word) const {
+        return token < tokens.size() && tokens[token] == word;
+    }
+
+    bool emitSelection(size_t selection) {
+        const std::vector<uint32_t>& snippet = selection_code[selection];
+        out->insert(out->end(), snippet.begin(), snippet.end());
+        return true;
+    }
+
+    bool parseQuantifier(bool all) {
+        token++;    // "of"
+        if (token >= tokens.size()) return fail("'of' without selections");
+        String target = tokens[token++];
+
+        // "them" is every selection not starting with '_'
+        String glob = target;
+        bool them = target == "them";
+        glob.replace("*", String(WILDCARD_ANY));
+
+        size_t emitted = 0;
+        for (size_t s = 0; s < selection_names.size(); s++) {
+            const String& name = selection_names[s];
+            bool selected = them ? !name.startsWith("_")
+                                 : SigmaRuleSet::globMatch(name.c_str(), name.length(), glob.c_str(), true);
+            if (!selected) continue;
+            emitSelection(s);
+            if (emitted++ > 0) emit(all ? SigmaRuleSet::OP_AND : SigmaRuleSet::OP_OR);
+        }
+        if (emitted == 0) return fail("no selection matches '" + target + "'");
+        return true;
+    }
+
+    bool parseFactor() {
+        if (token >= tokens.size()) return fail("condition ends early");
+        if (++depth > SIGMA_MAX_CONDITION_DEPTH) return fail("condition nested too deeply");
+
+        bool parsed;
+        const String& word = tokens[token];
+        if (word == "not") {
+            token++;
+            parsed = parseFactor();
+            if (parsed) emit(SigmaRuleSet::OP_NOT);
+        } else if (word == "(") {
+            token++;
+            parsed = parseExpression();
+            if (parsed && !peek(")")) parsed = fail("missing ')'");
+            token++;
+        } else if (token + 1 < tokens.size() && tokens[token + 1] == "of") {
+            if (word == "1" || word == "any") {
+                token++;
+                parsed = parseQuantifier(false);
+            } else if (word == "all") {
+                token++;
+                parsed = parseQuantifier(true);
+            } else {
+                parsed = fail("only '1 of' and 'all of' are supported");
+            }
+        } else {
+            auto found = std::find(selection_names.begin(), selection_names.end(), word);
+            if (found == selection_names.end()) {
+                parsed = fail("unknown selection '" + word + "'");
+            } else {
+                token++;
+                parsed = emitSelection(found - selection_names.begin());
+            }
+        }
+
+        depth--;
+        return parsed;
+    }
+
+    bool parseTerm() {
+        if (!parseFactor()) return false;
+        while (peek("and")) {
+            token++;
+            if (!parseFactor()) return false;
+            emit(SigmaRuleSet::OP_AND);
+        }
+        return true;
+    }
+
+    bool parseExpression() {
+        if (!parseTerm()) return false;
+        while (peek("or")) {
+            token++;
+            if (!parseTerm()) return false;
+            emit(SigmaRuleSet::OP_OR);
+        }
+        return true;
+    }
+
+    bool compileCondition(const String& condition) {
+        if (!tokenize(condition)) return false;
+        if (!parseExpression()) return false;
+        if (token < tokens.size()) return fail("unexpected '" + tokens[token] + "' in condition");
+        return true;
+    }
+
+    // ---------------------------
+    // Rules
+    // ---------------------------
+
+    int compileDocument() {
+        if (lines.empty()) return -1;
+        if (lines[0].indent != 0) {
+            fail("line " + String(lines[0].number) + ": rule must start at column 0");
+            return -1;
+        }
+
+        pos = 0;
+        Node root;
+        if (!parseNode(0, root)) return -1;
+        if (pos < lines.size()) {
+            fail(where() + ": unexpected line");
+            return -1;
+        }
+        if (root.kind != Node::MAP) {
+            fail("rule is not a map");
+            return -1;
+        }
+
+        SigmaRule rule;
+        for (const auto& child : root.children) {
+            if (child.key == "title") rule.title = child.value;
+            else if (child.key == "id") rule.id = child.value;
+            else if (child.key == "description") rule.description = child.value;
+            else if (child.key == "level") rule.level = child.value;
+            else if (child.key == "status") rule.status = child.value;
+            else if (child.key == "tags") {
+                for (const auto& tag : child.children) rule.tags.push_back(tag.value);
+            }
+        }
+        if (rule.title.length() == 0) {
+            fail("rule has no title");
+            return -1;
+        }
+        if (set.rules.size() >= SIGMA_MAX_RULES) {
+            fail("too many rules");
+            return -1;
+        }
+
+        const Node* detection = root.find("detection");
+        if (!detection || detection->kind != Node::MAP) {
+            fail(rule.title + ": no detection");
+            return -1;
+        }
+
+        size_t atoms_before = set.atoms.size();
+        if (!compileDetection(*detection)) {
+            set.error = rule.title + ": " + set.error;
+            discardAtoms(atoms_before);
+            return -1;
+        }
+
+        set.rules.push_back(rule);
+        set.compiled = false;
+        return set.rules.size() - 1;
+    }
+
+    bool compileDetection(const Node& detection) {
+        selection_names.clear();
+        selection_code.clear();
+
+        const Node* condition = nullptr;
+        for (const auto& child : detection.children) {
+            if (child.key == "condition") {
+                condition = &child;
+                continue;
+            }
+            if (child.key == "timeframe") return fail("timeframe is not supported");
+
+            selection_names.push_back(child.key);
+            selection_code.push_back(std::vector<uint32_t>());
+            out = &selection_code.back();
+            if (!compileSelection(child)) {
+                set.error = child.key + ": " + set.error;
+                return false;
+            }
+        }
+        if (!condition) return fail("no condition");
+
+        // Several conditions are alternatives
+        std::vector<uint32_t> program;
+        out = &program;
+        if (condition->kind == Node::LIST) {
+            if (condition->children.empty()) return fail("empty condition");
+            for (size_t i = 0; i < condition->children.size(); i++) {
+                if (!compileCondition(condition->children[i].value)) return false;
+                if (i > 0) emit(SigmaRuleSet::OP_OR);
+            }
+        } else if (!compileCondition(condition->value)) {
+            return false;
+        }
+
+        // Stack depth the program needs
+        size_t stack_depth = 0;
+        size_t max_depth = 0;
+        for (uint32_t insn : program) {
+            if (insn >> 24 == SigmaRuleSet::OP_ATOM) {
+                max_depth = std::max(max_depth, ++stack_depth);
+            } else if (insn >> 24 != SigmaRuleSet::OP_NOT) {
+                stack_depth--;
+            }
+        }
+        set.max_stack = std::max(set.max_stack, max_depth);
+
+        SigmaRuleSet::Program compiled;
+        compiled.begin = set.code.size();
+        set.code.insert(set.code.end(), program.begin(), program.end());
+        compiled.end = set.code.size();
+        set.programs.push_back(compiled);
+        return true;
+    }
+
+    // Atoms added by a rule that failed to compile and that nothing else uses
+    void discardAtoms(size_t keep) {
+        if (set.atoms.size() == keep) return;
+        for (auto it = set.atom_ids.begin(); it != set.atom_ids.end();) {
+            if (it->second >= keep) it = set.atom_ids.erase(it);
+            else ++it;
+        }
+        set.atoms.resize(keep);
+    }
+};
+
+// ===========================
+// Rule set
+// ===========================
+
+SigmaRuleSet::SigmaRuleSet()
+    : compiled(false),
+      max_stack(0),
+      stamp(0),
+      events_scanned(0),
+      programs_run(0) {
+}
+
+void SigmaRuleSet::clear() {
+    error = "";
+    compiled = false;
+    rules.clear();
+    programs.clear();
+    code.clear();
+    max_stack = 0;
+    atoms.clear();
+    atom_ids.clear();
+    regex_cache.clear();
+    for (int f = 0; f < SIGMA_FIELD_COUNT; f++) {
+        field_automata[f].clear();
+        field_literals[f].clear();
+        pattern_atom_begin[f].clear();
+        pattern_atoms[f].clear();
+    }
+    for (int t = 0; t <= EVENT_UNKNOWN; t++) {
+        type_atoms[t].clear();
+    }
+    atom_rule_begin.clear();
+    atom_rules.clear();
+    unindexed_rules.clear();
+    events_scanned = 0;
+    programs_run = 0;
+}
+
+int SigmaRuleSet::addRule(const String& yaml) {
+    error = "";
+    SigmaCompiler compiler(*this);
+
+    uint16_t number = 0;
+    int start = 0;
+    while (start <= (int)yaml.length()) {
+        int end = yaml.indexOf('\n', start);
+        if (end < 0) end = yaml.length();
+        String line = yaml.substring(start, end);
+        line.replace("\r", "");
+        if (!compiler.addLine(line, ++number)) return -1;
+        start = end + 1;
+    }
+
+    return compiler.compileDocument();
+}
+
+bool SigmaRuleSet::loadFile(FRFDStorage* storage, const String& path) {
+    if (!storage) return false;
+
+    File file = storage->openFile(path);
+    if (!file) {
+        Serial.printf("[Sigma] Cannot open %s\n", path.c_str());
+        return false;
+    }
+
+    size_t loaded = 0;
+    size_t failed = 0;
+    uint16_t number = 0;
+    bool more = true;
+    while (more) {
+        // One YAML document per rule
+        SigmaCompiler compiler(*this);
+        error = "";
+        bool line_error = false;
+        more = false;
+        while (file.available()) {
+            String line = file.readStringUntil('\n');
+            line.replace("\r", "");
+            number++;
+            if (line.startsWith("---")) {
+                more = true;
+                break;
+            }
+            if (!line_error && !compiler.addLine(line, number)) line_error = true;
+        }
+        if (compiler.lines.empty() && !line_error) continue;
+
+        if (!line_error && compiler.compileDocument() >= 0) {
+            loaded++;
+        } else {
+            failed++;
+            Serial.printf("[Sigma] %s: %s\n", path.c_str(), error.c_str());
+        }
+    }
+    file.close();
+
+    Serial.printf("[Sigma] Loaded %u rules from %s (%u rejected)\n",
+                  (unsigned)loaded, path.c_str(), (unsigned)failed);
+    return loaded > 0;
+}
+
+uint32_t SigmaRuleSet::addAtom(uint8_t field, uint8_t match, const String& value, uint8_t flags) {
+    String key = String((char)('A' + field)) + String((char)('a' + match)) + String((char)('0' + flags)) + value;
+    auto found = atom_ids.find(key);
+    if (found != atom_ids.end()) return found->second;
+
+    if (atoms.size() >= SIGMA_MAX_ATOMS) {
+        if (error.length() == 0) error = "too many distinct field tests";
+        return NO_ATOM;
+    }
+
+    Atom atom;
+    atom.field = field;
+    atom.match = match;
+    atom.flags = flags;
+    atom.pattern = NO_PATTERN;
+    atom.length = 0;
+    atom.value = value;
+    atom.regex = nullptr;
+
+    // Type atoms are resolved per event type; text atoms need a literal to be indexed
+    if (field == SIGMA_FIELD_TYPE) {
+        atom.flags |= ATOM_INDEXED;
+    } else if (match <= MATCH_EQUALS && value.length() > 0) {
+        atom.flags |= ATOM_INDEXED;
+        if (flags & ATOM_CASED) atom.flags |= ATOM_VERIFY;
+    } else if (match == MATCH_GLOB && atomLiteral(atom).length() > 0) {
+        atom.flags |= ATOM_INDEXED | ATOM_VERIFY;
+    }
+
+    atoms.push_back(atom);
+    atom_ids[key] = atoms.size() - 1;
+    return atoms.size() - 1;
+}
+
+String SigmaRuleSet::atomLiteral(const Atom& atom) {
+    if (atom.match <= MATCH_EQUALS) {
+        return (atom.flags & ATOM_CASED) ? foldString(atom.value) : atom.value;
+    }
+    if (atom.match != MATCH_GLOB) return "";
+
+    // Longest run without wildcards
+    size_t best_start = 0, best_length = 0, start = 0;
+    for (size_t i = 0; i <= atom.value.length(); i++) {
+        if (i == atom.value.length() || atom.value[i] == WILDCARD_ANY || atom.value[i] == WILDCARD_ONE) {
+            if (i - start > best_length) {
+                best_start = start;
+                best_length = i - start;
+            }
+            start = i + 1;
+        }
+    }
+    String literal = atom.value.substring(best_start, best_start + best_length);
+    return (atom.flags & ATOM_CASED) ? foldString(literal) : literal;
+}
+
+bool SigmaRuleSet::compile() {
+    for (int f = 0; f < SIGMA_FIELD_COUNT; f++) {
+        field_automata[f].clear();
+        field_literals[f].clear();
+    }
+    for (int t = 0; t <= EVENT_UNKNOWN; t++) {
+        type_atoms[t].clear();
+    }
+
+    // One automaton per field over the distinct literals of its atoms
+    size_t literal_count = 0;
+    for (size_t a = 0; a < atoms.size(); a++) {
+        Atom& atom = atoms[a];
+        if (!(atom.flags & ATOM_INDEXED)) continue;
+
+        if (atom.field == SIGMA_FIELD_TYPE) {
+            for (int t = 0; t <= EVENT_UNKNOWN; t++) {
+                String name = TimelineGenerator::getEventTypeName((TimelineEventType)t);
+                if (matchText(atom, name.c_str(), name.length())) {
+                    type_atoms[t].push_back(a);
+                }
+            }
+            continue;
+        }
+
+        String literal = atomLiteral(atom);
+        std::map<String, uint16_t>& literals = field_literals[atom.field];
+        auto found = literals.find(literal);
+        if (found == literals.end()) {
+            int id = field_automata[atom.field].addPattern(literal);
+            if (id < 0) {
+                // Not indexable: evaluated on demand like a regex
+                atom.flags &= ~(ATOM_INDEXED | ATOM_VERIFY);
+                continue;
+            }
+            found = literals.insert(std::make_pair(literal, (uint16_t)id)).first;
+            literal_count++;
+        }
+        atom.pattern = found->second;
+        atom.length = literal.length();
+    }
+
+    for (int f = 0; f < SIGMA_FIELD_TYPE; f++) {
+        if (!field_literals[f].empty()) field_automata[f].compile();
+
+        // Atoms per literal
+        std::vector<uint32_t>& begin = pattern_atom_begin[f];
+        std::vector<uint32_t>& list = pattern_atoms[f];
+        begin.assign(field_literals[f].size() + 1, 0);
+        for (const auto& atom : atoms) {
+            if (atom.field == f && (atom.flags & ATOM_INDEXED)) begin[atom.pattern + 1]++;
+        }
+        for (size_t p = 1; p < begin.size(); p++) begin[p] += begin[p - 1];
+        list.assign(begin.back(), 0);
+        std::vector<uint32_t> fill(begin.begin(), begin.end() - 1);
+        for (size_t a = 0; a < atoms.size(); a++) {
+            if (atoms[a].field == f && (atoms[a].flags & ATOM_INDEXED)) list[fill[atoms[a].pattern]++] = a;
+        }
+    }
+
+    // Trigger atoms per rule: the indexed atoms outside any `not` when the rule is false
+    // without them, else every indexed atom, else none and the rule runs on every event
+    unindexed_rules.clear();
+    std::vector<uint8_t> positive(atoms.size(), 0);
+    std::vector<uint8_t> trigger_mode(rules.size(), 0);
+    for (size_t r = 0; r < rules.size(); r++) {
+        markPositiveAtoms(programs[r], positive);
+        if (programWithoutHits(programs[r], &positive) == TRI_FALSE) trigger_mode[r] = 1;
+        else if (programWithoutHits(programs[r], nullptr) == TRI_FALSE) trigger_mode[r] = 2;
+        else unindexed_rules.push_back(r);
+        std::fill(positive.begin(), positive.end(), 0);
+    }
+
+    // Rules per trigger atom, counted then filled
+    atom_rule_begin.assign(atoms.size() + 1, 0);
+    std::vector<uint32_t> fill;
+    for (int pass = 0; pass < 2; pass++) {
+        std::vector<uint32_t> seen(atoms.size(), 0xFFFFFFFFUL);
+        for (size_t r = 0; r < rules.size(); r++) {
+            if (trigger_mode[r] == 0) continue;
+            if (trigger_mode[r] == 1) markPositiveAtoms(programs[r], positive);
+
+            for (uint32_t pc = programs[r].begin; pc < programs[r].end; pc++) {
+                uint32_t a = code[pc] & 0xFFFFFF;
+                if (code[pc] >> 24 != OP_ATOM || !(atoms[a].flags & ATOM_INDEXED) || seen[a] == r) continue;
+                if (trigger_mode[r] == 1 && !positive[a]) continue;
+                seen[a] = r;
+                if (pass == 0) atom_rule_begin[a + 1]++;
+                else atom_rules[fill[a]++] = r;
+            }
+            if (trigger_mode[r] == 1) std::fill(positive.begin(), positive.end(), 0);
+        }
+
+        if (pass == 0) {
+            for (size_t a = 1; a < atom_rule_begin.size(); a++) atom_rule_begin[a] += atom_rule_begin[a - 1];
+            atom_rules.assign(atom_rule_begin.back(), 0);
+            fill.assign(atom_rule_begin.begin(), atom_rule_begin.end() - 1);
+        }
+    }
+
+    stamp = 0;
+    atom_hit.assign(atoms.size(), 0);
+    atom_checked.assign(atoms.size(), 0);
+    atom_result.assign(atoms.size(), 0);
+    rule_mark.assign(rules.size(), 0);
+    candidates.clear();
+    candidates.reserve(rules.size());
+    stack.assign(max_stack + 1, 0);
+    compiled = true;
+
+    Serial.printf("[Sigma] Compiled %u rules: %u field tests, %u literals, %u unindexed rules, %u bytes\n",
+                  (unsigned)rules.size(), (unsigned)atoms.size(), (unsigned)literal_count,
+                  (unsigned)unindexed_rules.size(), (unsigned)getMemoryUsage());
+    return true;
+}
+
+// ===========================
+// Matching
+// ===========================
+
+void SigmaRuleSet::nextStamp() {
+    if (++stamp == 0) {
+        std::fill(atom_hit.begin(), atom_hit.end(), 0);
+        std::fill(atom_checked.begin(), atom_checked.end(), 0);
+        std::fill(rule_mark.begin(), rule_mark.end(), 0);
+        stamp = 1;
+    }
+}
+
+void SigmaRuleSet::hitAtom(uint32_t atom) {
+    if (atom_hit[atom] == stamp) return;
+    atom_hit[atom] = stamp;
+    for (uint32_t i = atom_rule_begin[atom]; i < atom_rule_begin[atom + 1]; i++) {
+        uint16_t rule = atom_rules[i];
+        if (rule_mark[rule] != stamp) {
+            rule_mark[rule] = stamp;
+            candidates.push_back(rule);
+        }
+    }
+}
+
+bool SigmaRuleSet::match(const TimelineEvent& event, std::vector<uint16_t>& matched) {
+    const String* fields[SIGMA_FIELD_TYPE];
+    fields[SIGMA_FIELD_ACTOR] = &event.actor;
+    fields[SIGMA_FIELD_TARGET] = &event.target;
+    fields[SIGMA_FIELD_DESCRIPTION] = &event.description;
+    fields[SIGMA_FIELD_DETAILS] = &event.details;
+    fields[SIGMA_FIELD_SOURCE] = &event.source_artifact;
+
+    EventFields view;
+    for (int f = 0; f < SIGMA_FIELD_TYPE; f++) {
+        view.text[f] = fields[f]->c_str();
+        view.length[f] = fields[f]->length();
+    }
+    view.type = event.type <= EVENT_UNKNOWN ? event.type : EVENT_UNKNOWN;
+    return matchFields(view, matched);
+}
+
+bool SigmaRuleSet::match(const TimelineStore& store, uint32_t index, std::vector<uint16_t>& matched) {
+    static const TimelineField columns[SIGMA_FIELD_TYPE] = {
+        TIMELINE_FIELD_ACTOR, TIMELINE_FIELD_TARGET, TIMELINE_FIELD_DESCRIPTION,
+        TIMELINE_FIELD_DETAILS, TIMELINE_FIELD_SOURCE
+    };
+
+    EventFields view;
+    for (int f = 0; f < SIGMA_FIELD_TYPE; f++) {
+        view.text[f] = store.getText(columns[f], index);
+        view.length[f] = store.getTextLength(columns[f], index);
+    }
+    view.type = store.getType(index);
+    return matchFields(view, matched);
+}
+
+bool SigmaRuleSet::matchFields(const EventFields& event, std::vector<uint16_t>& matched) {
+    matched.clear();
+    if (!compiled) compile();
+    if (rules.empty()) return false;
+
+    events_scanned++;
+    nextStamp();
+    candidates.clear();
+
+    for (uint32_t atom : type_atoms[event.type]) {
+        hitAtom(atom);
+    }
+
+    // One automaton pass per field finds every indexed literal
+    for (uint8_t f = 0; f < SIGMA_FIELD_TYPE; f++) {
+        const MultiPatternMatcher& automaton = field_automata[f];
+        if (!automaton.isCompiled()) continue;
+
+        size_t length = event.length[f];
+        const std::vector<uint32_t>& begin = pattern_atom_begin[f];
+        const std::vector<uint32_t>& list = pattern_atoms[f];
+        automaton.scan((const uint8_t*)event.text[f], length, MultiPatternMatcher::START_STATE,
+                       [&](uint16_t pattern, size_t end) {
+            for (uint32_t i = begin[pattern]; i < begin[pattern + 1]; i++) {
+                uint32_t a = list[i];
+                if (atom_hit[a] == stamp) continue;
+
+                const Atom& atom = atoms[a];
+                bool hit = true;
+                if (atom.match == MATCH_STARTS) hit = end == atom.length;
+                else if (atom.match == MATCH_ENDS) hit = end == length;
+                else if (atom.match == MATCH_EQUALS) hit = end == length && length == atom.length;
+                if (hit) hitAtom(a);
+            }
+        });
+    }
+
+    for (uint16_t rule : unindexed_rules) {
+        if (runProgram(programs[rule], event)) matched.push_back(rule);
+    }
+    for (uint16_t rule : candidates) {
+        if (runProgram(programs[rule], event)) matched.push_back(rule);
+    }
+    if (!unindexed_rules.empty() || matched.size() > 1) {
+        std::sort(matched.begin(), matched.end());
+    }
+    return !matched.empty();
+}
+
+bool SigmaRuleSet::atomValue(uint32_t a, const EventFields& event) {
+    const Atom& atom = atoms[a];
+    if (atom.flags & ATOM_INDEXED) {
+        if (atom_hit[a] != stamp) return false;
+        if (!(atom.flags & ATOM_VERIFY)) return true;
+    }
+
+    if (atom_checked[a] != stamp) {
+        atom_checked[a] = stamp;
+        // The type has no text here: its atoms are all resolved through type_atoms
+        atom_result[a] = atom.field < SIGMA_FIELD_TYPE && matchText(atom, event.text[atom.field], event.length[atom.field]);
+    }
+    return atom_result[a];
+}
+
+bool SigmaRuleSet::runProgram(const Program& program, const EventFields& event) {
+    programs_run++;
+    uint8_t* top = stack.data();
+    for (uint32_t pc = program.begin; pc < program.end; pc++) {
+        uint32_t insn = code[pc];
+        switch (insn >> 24) {
+            case OP_ATOM: *top++ = atomValue(insn & 0xFFFFFF, event); break;
+            case OP_NOT: top[-1] ^= 1; break;
+            case OP_AND: top--; top[-1] &= top[0]; break;
+            case OP_OR: top--; top[-1] |= top[0]; break;
+        }
+    }
+    return stack[0];
+}
+
+uint8_t SigmaRuleSet::programWithoutHits(const Program& program, const std::vector<uint8_t>* triggers) const {
+    // Kleene logic: indexed atoms (only the triggers, if given) are false, the rest unknown
+    std::vector<uint8_t> values;
+    for (uint32_t pc = program.begin; pc < program.end; pc++) {
+        uint32_t insn = code[pc];
+        uint8_t op = insn >> 24;
+        if (op == OP_ATOM) {
+            uint32_t a = insn & 0xFFFFFF;
+            bool absent = (atoms[a].flags & ATOM_INDEXED) && (!triggers || (*triggers)[a]);
+            values.push_back(absent ? TRI_FALSE : TRI_UNKNOWN);
+            continue;
+        }
+        if (op == OP_NOT) {
+            uint8_t& v = values.back();
+            if (v != TRI_UNKNOWN) v = v == TRI_TRUE ? TRI_FALSE : TRI_TRUE;
+            continue;
+        }
+
+        uint8_t right = values.back();
+        values.pop_back();
+        uint8_t& left = values.back();
+        uint8_t dominant = op == OP_AND ? TRI_FALSE : TRI_TRUE;
+        if (left == dominant || right == dominant) left = dominant;
+        else if (left == TRI_UNKNOWN || right == TRI_UNKNOWN) left = TRI_UNKNOWN;
+    }
+    return values.empty() ? TRI_UNKNOWN : values[0];
+}
+
+void SigmaRuleSet::markPositiveAtoms(const Program& program, std::vector<uint8_t>& positive) const {
+    // Operand extents on a stack; a NOT flips the polarity of every atom in its operand
+    size_t length = program.end - program.begin;
+    std::vector<uint8_t> negated(length, 0);
+    std::vector<uint32_t> starts;
+    for (uint32_t i = 0; i < length; i++) {
+        uint8_t op = code[program.begin + i] >> 24;
+        if (op == OP_ATOM) {
+            starts.push_back(i);
+        } else if (op == OP_NOT) {
+            for (uint32_t j = starts.back(); j < i; j++) negated[j] ^= 1;
+        } else {
+            starts.pop_back();
+        }
+    }
+
+    for (uint32_t i = 0; i < length; i++) {
+        uint32_t insn = code[program.begin + i];
+        if (insn >> 24 == OP_ATOM && !negated[i]) positive[insn & 0xFFFFFF] = 1;
+    }
+}
+
+bool SigmaRuleSet::matchText(const Atom& atom, const char* data, size_t length) {
+    const char* value = atom.value.c_str();
+    size_t n = atom.value.length();
+    bool cased = atom.flags & ATOM_CASED;
+
+    switch (atom.match) {
+        case MATCH_CONTAINS:
+            for (size_t i = 0; i + n <= length; i++) {
+                if (equalsAt(data + i, value, n, cased)) return true;
+            }
+            return false;
+        case MATCH_STARTS: return n <= length && equalsAt(data, value, n, cased);
+        case MATCH_ENDS: return n <= length && equalsAt(data + length - n, value, n, cased);
+        case MATCH_EQUALS: return n == length && equalsAt(data, value, n, cased);
+        case MATCH_GLOB: return globMatch(data, length, value, cased);
+        case MATCH_REGEX: return atom.regex && atom.regex->search((const uint8_t*)data, length);
+        case MATCH_EXISTS: return length > 0;
+        default: return false;
+    }
+}
+
+bool SigmaRuleSet::globMatch(const char* text, size_t length, const char* glob, bool cased) {
+    // Greedy with backtracking to the last '*' only, so at most length * pattern steps
+    const char* star = nullptr;
+    size_t star_text = 0;
+    size_t t = 0;
+    while (t < length) {
+        char c = cased ? text[t] : foldChar(text[t]);
+        if (*glob == WILDCARD_ANY) {
+            star = ++glob;
+            star_text = t;
+        } else if (*glob && (*glob == WILDCARD_ONE || *glob == c)) {
+            glob++;
+            t++;
+        } else if (star) {
+            glob = star;
+            t = ++star_text;
+        } else {
+            return false;
+        }
+    }
+    while (*glob == WILDCARD_ANY) glob++;
+    return *glob == 0;
+}
+
+size_t SigmaRuleSet::getMemoryUsage() const {
+    size_t total = sizeof(*this);
+    total += rules.capacity() * sizeof(SigmaRule);
+    total += programs.capacity() * sizeof(Program);
+    total += code.capacity() * sizeof(uint32_t);
+    total += atoms.capacity() * sizeof(Atom);
+    for (const auto& atom : atoms) total += atom.value.length();
+    for (const auto& entry : regex_cache) total += entry.second.getMemoryUsage();
+    for (int f = 0; f < SIGMA_FIELD_COUNT; f++) {
+        total += field_automata[f].getMemoryUsage();
+        total += (pattern_atom_begin[f].capacity() + pattern_atoms[f].capacity()) * sizeof(uint32_t);
+    }
+    for (int t = 0; t <= EVENT_UNKNOWN; t++) total += type_atoms[t].capacity() * sizeof(uint32_t);
+    total += atom_rule_begin.capacity() * sizeof(uint32_t) + atom_rules.capacity() * sizeof(uint16_t);
+    total += (atom_hit.capacity() + atom_checked.capacity() + rule_mark.capacity()) * sizeof(uint32_t);
+    return total;
+}
+
+const char* SigmaRuleSet::getFieldName(SigmaField field) {
+    switch (field) {
+        case SIGMA_FIELD_ACTOR: return "actor";
+        case SIGMA_FIELD_TARGET: return "target";
+        case SIGMA_FIELD_DESCRIPTION: return "description";
+        case SIGMA_FIELD_DETAILS: return "details";
+        case SIGMA_FIELD_SOURCE: return "source";
+        case SIGMA_FIELD_TYPE: return "type";
+        default: return "unknown";
+    }
+}
@@ -40,7 +40,7 @@ bool FRFDStorage::initSDCard() {
     Serial.println("[Storage] Initializing SD Card...");
 
     // Initialize SD card with SPI pins
-    if (!SD.begin(SD_CS)) {
+    if (!SD.begin(SD_CS, SPI, SD_SPI_FREQUENCY, "/sd", SD_MAX_OPEN_FILES)) {
         Serial.println("[Storage] SD Card mount failed");
         sdCardAvailable = false;
         return false;
@@ -342,6 +342,18 @@ bool FRFDStorage::deleteFile(const String& path) {
     return false;
 }
 
+File FRFDStorage::openFile(const String& path, const char* mode) {
+    bool useSD = sdCardAvailable && path.startsWith("/evidence");
+
+    if (useSD) {
+        return SD.open(path.c_str(), mode);
+    } else if (spiffsAvailable) {
+        return SPIFFS.open(path.c_str(), mode);
+    }
+
+    return File();
+}
+
 size_t FRFDStorage::getFileSize(const String& path) {
     bool useSD = sdCardAvailable && path.startsWith("/evidence");
 
@@ -1,10 +1,20 @@
 #include "threat_detector.h"
+#include "rule_image.h"
+#include "esp_heap_caps.h"
+#include <algorithm>
 
 ThreatDetector::ThreatDetector()
     : storage(nullptr),
       ioc_extractor(nullptr),
       timeline_generator(nullptr),
-      scan_count(0) {
+      scan_count(0),
+      performance_monitor(nullptr),
+      index_dirty(true),
+      rolled_up_count(0),
+      evicted_alerts(0),
+      suppressed_alerts(0),
+      content_pending(0) {
+    memset(alerts_by_severity, 0, sizeof(alerts_by_severity));
 }
 
 ThreatDetector::~ThreatDetector() {
@@ -25,18 +35,125 @@ void ThreatDetector::begin(FRFDStorage* storage_ptr, IOCExtractor* ioc_ptr, Time
 
 bool ThreatDetector::loadRule(const ThreatRule& rule) {
     // Check if rule already exists
-    for (size_t i = 0; i < rules.size(); i++) {
-        if (rules[i].rule_id == rule.rule_id) {
-            Serial.println("[ThreatDetector] Rule already exists: " + rule.rule_id);
-            return false;
-        }
+    if (rule_ids.count(rule.rule_id)) {
+        Serial.println("[ThreatDetector] Rule already exists: " + rule.rule_id);
+        return false;
     }
 
+    rule_ids[rule.rule_id] = rules.size();
     rules.push_back(rule);
+    alerts_kept.push_back(0);
+    index_dirty = true;
     Serial.println("[ThreatDetector] Loaded rule: " + rule.name);
     return true;
 }
 
+bool ThreatDetector::loadRulesFromFile(const String& filename) {
+    // Rule image produced by scripts/compile_rules.py --binary
+    size_t size = 0;
+    uint8_t* buffer = RuleImage::loadFile(storage, filename, &size);
+    if (!buffer) {
+        Serial.println("[ThreatDetector] Cannot load rule file: " + filename);
+        return false;
+    }
+
+    RuleImage image;
+    if (!image.attach(buffer, size)) {
+        Serial.println("[ThreatDetector] Invalid rule image: " + filename);
+        heap_caps_free(buffer);
+        return false;
+    }
+
+    uint32_t loaded = 0;
+    for (uint32_t r = 0; r < image.getRuleCount(); r++) {
+        const RuleImageRule& entry = image.getRule(r);
+
+        ThreatRule rule;
+        rule.rule_id = "YARA_" + String(image.getText(entry.name));
+        rule.name = image.getText(entry.name);
+        rule.description = image.getText(entry.description);
+        rule.type = RULE_CONTENT_PATTERN;
+        rule.severity = parseSeverityName(image.getText(entry.severity));
+        rule.tactics.push_back(parseCategoryTactic(image.getText(entry.category)));
+        rule.enabled = entry.threshold > 0;
+        rule.match_count = 0;
+
+        // Content matching is text based; hex and regex strings stay with IOCMatcher. Any
+        // N text strings still satisfy "N of them", but a rule that needs more strings
+        // than it has text ones cannot be decided here and is left to IOCMatcher
+        for (uint16_t i = 0; i < entry.string_count; i++) {
+            const RuleImageString& str = image.getString(entry.first_string + i);
+            if (str.kind == RULE_STRING_TEXT) {
+                rule.patterns.push_back(image.getText(str.text));
+            }
+        }
+        if (rule.patterns.empty() || entry.threshold > rule.patterns.size()) {
+            Serial.println("[ThreatDetector] Rule " + rule.name + " needs hex or regex strings, skipped");
+            continue;
+        }
+
+        rule.metadata["min_matches"] = String(entry.threshold);
+        rule.metadata["category"] = image.getText(entry.category);
+        rule.metadata["platform"] = image.getText(entry.platform);
+        rule.metadata["source"] = filename;
+
+        if (loadRule(rule)) {
+            loaded++;
+        }
+    }
+
+    heap_caps_free(buffer);
+    Serial.println("[ThreatDetector] Loaded " + String(loaded) + " rules from " + filename);
+    return loaded > 0;
+}
+
+bool ThreatDetector::loadSigmaRules(const String& filename) {
+    size_t first = sigma_rules.getRuleCount();
+    if (!sigma_rules.loadFile(storage, filename)) {
+        Serial.println("[ThreatDetector] No Sigma rules loaded from " + filename);
+        return false;
+    }
+
+    uint32_t loaded = 0;
+    for (size_t s = first; s < sigma_rules.getRuleCount(); s++) {
+        const SigmaRule& sigma = sigma_rules.getRule(s);
+
+        ThreatRule rule;
+        rule.rule_id = "SIGMA_" + (sigma.id.length() > 0 ? sigma.id : sigma.title);
+        rule.name = sigma.title;
+        rule.description = sigma.description;
+        rule.type = RULE_SIGMA;
+        rule.severity = parseSeverityName(sigma.level);
+        rule.enabled = true;
+        rule.match_count = 0;
+
+        // attack.<tactic> and attack.t<technique> tags
+        for (const auto& tag : sigma.tags) {
+            if (!tag.startsWith("attack.")) continue;
+            String name = tag.substring(7);
+            if (name.length() > 1 && name[0] == 't' && isdigit(name[1])) {
+                name.toUpperCase();
+                rule.techniques.push_back(name);
+                continue;
+            }
+            name.replace("-", "_");
+            MITRETactic tactic = parseCategoryTactic(name);
+            if (tactic != TACTIC_UNKNOWN) rule.tactics.push_back(tactic);
+        }
+
+        rule.metadata["sigma_id"] = sigma.id;
+        rule.metadata["status"] = sigma.status;
+        rule.metadata["source"] = filename;
+
+        bool added = loadRule(rule);
+        sigma_rule_index.push_back(added ? rules.size() - 1 : NO_RULE);
+        if (added) loaded++;
+    }
+
+    Serial.println("[ThreatDetector] Loaded " + String(loaded) + " Sigma rules from " + filename);
+    return loaded > 0;
+}
+
 bool ThreatDetector::loadDefaultRules() {
     Serial.println("[ThreatDetector] Loading default threat detection rules...");
 
@@ -48,33 +165,46 @@ bool ThreatDetector::loadDefaultRules() {
 
 void ThreatDetector::clearRules() {
     rules.clear();
+    rule_ids.clear();
+    alerts_kept.clear();
+    profiles.clear();
+    regex_refs.clear();
+    regex_cache.clear();
+    sigma_rules.clear();
+    sigma_rule_index.clear();
+    index_dirty = true;
 }
 
 void ThreatDetector::enableRule(const String& rule_id) {
-    for (size_t i = 0; i < rules.size(); i++) {
-        if (rules[i].rule_id == rule_id) {
-            rules[i].enabled = true;
-            return;
-        }
-    }
+    ThreatRule* rule = getRule(rule_id);
+    if (rule) rule->enabled = true;
 }
 
 void ThreatDetector::disableRule(const String& rule_id) {
-    for (size_t i = 0; i < rules.size(); i++) {
-        if (rules[i].rule_id == rule_id) {
-            rules[i].enabled = false;
-            return;
-        }
-    }
+    ThreatRule* rule = getRule(rule_id);
+    if (rule) rule->enabled = false;
+}
+
+const ThreatRule* ThreatDetector::findRule(const String& rule_id) const {
+    auto found = rule_ids.find(rule_id);
+    return found != rule_ids.end() ? &rules[found->second] : nullptr;
 }
 
 ThreatRule* ThreatDetector::getRule(const String& rule_id) {
-    for (size_t i = 0; i < rules.size(); i++) {
-        if (rules[i].rule_id == rule_id) {
-            return &rules[i];
-        }
-    }
-    return nullptr;
+    // The caller may edit the rule, so the index is rebuilt before the next scan
+    auto found = rule_ids.find(rule_id);
+    if (found == rule_ids.end()) return nullptr;
+
+    index_dirty = true;
+    return &rules[found->second];
+}
+
+const std::vector<uint16_t>& ThreatDetector::getRulesByType(ThreatRuleType type) {
+    static const std::vector<uint16_t> none;
+    if (type >= RULE_TYPE_COUNT) return none;
+
+    if (index_dirty) buildRuleIndex();
+    return rules_by_type[type];
 }
 
 // ===========================
@@ -85,32 +215,37 @@ bool ThreatDetector::scanAllArtifacts() {
     Serial.println("[ThreatDetector] Starting comprehensive scan of all artifacts...");
     scan_count++;
 
-    uint32_t alerts_before = alerts.size();
+    uint32_t alerts_before = alerts.size() + suppressed_alerts;
+    if (index_dirty) buildRuleIndex();
 
-    // Scan behavioral patterns using correlation data
-    for (const auto& rule : rules) {
-        if (!rule.enabled) continue;
+    // Behavioral, process and composite rules share one pass over the timeline
+    evaluateEventRules();
+
+    // Unique IOCs are borrowed from the extractor for network, IOC and composite rules
+    static const std::vector<IOC> no_iocs;
+    bool network_rules = !rules_by_type[RULE_NETWORK_PATTERN].empty() || !rules_by_type[RULE_IOC_MATCH].empty();
+    bool composite_rules = !rules_by_type[RULE_BEHAVIORAL].empty() || !rules_by_type[RULE_COMPOSITE].empty();
+    const std::vector<IOC>& iocs = ioc_extractor && (network_rules || composite_rules)
+                                       ? ioc_extractor->getUniqueIOCs() : no_iocs;
 
-        if (rule.type == RULE_BEHAVIORAL || rule.type == RULE_COMPOSITE) {
-            if (matchBehavioralPattern(rule) || matchCompositeRule(rule)) {
-                ThreatAlert alert = createAlert(rule, "behavioral_analysis",
-                                               "Pattern matched across multiple artifacts", 80);
-                addAlert(alert);
+    // Scan behavioral patterns using correlation data
+    bool behavior_data = timeline_generator && ioc_extractor;
+    for (ThreatRuleType type : {RULE_BEHAVIORAL, RULE_COMPOSITE}) {
+        for (uint16_t r : rules_by_type[type]) {
+            bool behavior = behavior_data && eventPatternsSeen(behavior_events, r) >= 2;
+            if (behavior || compositeMatched(r, iocs)) {
+                raiseAlert(r, "behavioral_analysis", "Pattern matched across multiple artifacts", 80);
             }
         }
     }
 
     // Scan network IOCs
-    if (ioc_extractor) {
-        auto iocs = ioc_extractor->getIOCs();
-        for (const auto& rule : rules) {
-            if (!rule.enabled) continue;
-
-            if (rule.type == RULE_NETWORK_PATTERN || rule.type == RULE_IOC_MATCH) {
+    if (ioc_extractor && network_rules) {
+        for (ThreatRuleType type : {RULE_NETWORK_PATTERN, RULE_IOC_MATCH}) {
+            for (uint16_t r : rules_by_type[type]) {
+                const ThreatRule& rule = rules[r];
                 if (matchNetworkPattern(rule, iocs)) {
-                    ThreatAlert alert = createAlert(rule, "ioc_analysis",
-                                                   "Malicious network indicator detected", 85);
-                    addAlert(alert);
+                    raiseAlert(r, "ioc_analysis", "Malicious network indicator detected", 85);
                 }
             }
         }
@@ -118,21 +253,20 @@ bool ThreatDetector::scanAllArtifacts() {
 
     // Scan timeline events
     if (timeline_generator) {
-        auto events = timeline_generator->getEvents();
-        for (const auto& rule : rules) {
-            if (!rule.enabled) continue;
-
-            if (rule.type == RULE_PROCESS_PATTERN) {
-                if (matchProcessPattern(rule, events)) {
-                    ThreatAlert alert = createAlert(rule, "process_analysis",
-                                                   "Suspicious process activity detected", 75);
-                    addAlert(alert);
-                }
+        for (uint16_t r : rules_by_type[RULE_PROCESS_PATTERN]) {
+            if (eventPatternsSeen(process_events, r) > 0) {
+                raiseAlert(r, "process_analysis", "Suspicious process activity detected", 75);
             }
         }
     }
 
-    uint32_t new_alerts = alerts.size() - alerts_before;
+    // Sigma rules
+    if (timeline_generator && !rules_by_type[RULE_SIGMA].empty()) {
+        evaluateSigmaRules();
+    }
+
+    compactAlerts();
+    uint32_t new_alerts = alerts.size() + suppressed_alerts - alerts_before;
     Serial.println("[ThreatDetector] Scan complete. Generated " + String(new_alerts) + " new alerts");
 
     return true;
@@ -141,25 +275,55 @@ bool ThreatDetector::scanAllArtifacts() {
 bool ThreatDetector::scanFile(const String& file_path) {
     if (!storage) return false;
 
-    // Read file content
     File file = storage->openFile(file_path, FILE_READ);
     if (!file) return false;
 
-    String content = "";
-    while (file.available()) {
-        content += (char)file.read();
-        if (content.length() > 50000) break; // Limit content size
+    bool is_registry = file_path.indexOf("registry") >= 0 || file_path.indexOf("reg_") >= 0;
+    if (index_dirty) buildRuleIndex();
+    beginContentScan(is_registry);
+
+    scan_buffer.resize(THREAT_SCAN_BLOCK_SIZE);
+    uint8_t* block = scan_buffer.data();
+    uint32_t state = MultiPatternMatcher::START_STATE;
+    uint64_t bytes = 0;
+    unsigned long start = micros();
+    size_t n;
+
+    // One automaton pass for all rules; the automaton carries matches across blocks, and the
+    // file is read only while some rule is undecided
+    while (content_pending > 0 && (n = file.read(block, THREAT_SCAN_BLOCK_SIZE)) > 0) {
+        // Drop NULs, so UTF-16LE exports match as plain text
+        size_t len = 0;
+        for (size_t i = 0; i < n; i++) {
+            if (block[i] != 0) block[len++] = block[i];
+        }
+        state = scanContentBlock(block, len, state);
+        bytes += n;
     }
     file.close();
+    finishContentScan(bytes, micros() - start);
 
-    return scanContent(content, file_path);
+    return raiseArtifactAlerts(file_path, is_registry);
 }
 
 bool ThreatDetector::scanContent(const String& content, const String& source) {
-    uint32_t matches = 0;
+    bool is_registry = source.indexOf("registry") >= 0 || source.indexOf("reg_") >= 0;
+    if (index_dirty) buildRuleIndex();
+    beginContentScan(is_registry);
 
-    for (const auto& rule : rules) {
-        if (!rule.enabled) continue;
+    // The automaton folds case itself, so the content is neither copied nor lowercased
+    unsigned long start = micros();
+    scanContentBlock((const uint8_t*)content.c_str(), content.length(), MultiPatternMatcher::START_STATE);
+    finishContentScan(content.length(), micros() - start);
+
+    return raiseArtifactAlerts(source, is_registry);
+}
+
+bool ThreatDetector::raiseArtifactAlerts(const String& source, bool is_registry) {
+    // Alerts are raised in rule order
+    uint32_t matches = 0;
+    for (uint16_t r : artifact_rules) {
+        const ThreatRule& rule = rules[r];
 
         bool matched = false;
         uint8_t confidence = 50;
@@ -173,17 +337,15 @@ bool ThreatDetector::scanContent(const String& content, const String& source) {
                 break;
 
             case RULE_CONTENT_PATTERN:
-                matched = matchContentPattern(rule, content);
+                matched = contentMatched(r);
                 confidence = 80;
                 matched_content = "Content signature match";
                 break;
 
             case RULE_REGISTRY_PATTERN:
-                if (source.indexOf("registry") >= 0 || source.indexOf("reg_") >= 0) {
-                    matched = matchRegistryPattern(rule, content);
-                    confidence = 75;
-                    matched_content = "Registry pattern match";
-                }
+                matched = is_registry && contentMatched(r);
+                confidence = 75;
+                matched_content = "Registry pattern match";
                 break;
 
             default:
@@ -191,50 +353,517 @@ bool ThreatDetector::scanContent(const String& content, const String& source) {
         }
 
         if (matched) {
-            ThreatAlert alert = createAlert(rule, source, matched_content, confidence);
-            addAlert(alert);
+            raiseAlert(r, source, matched_content, confidence);
             matches++;
         }
     }
 
+    compactAlerts();
     return matches > 0;
 }
 
+// ===========================
+// Rule Index
+// ===========================
+
+void ThreatDetector::buildRuleIndex() {
+    for (auto& bucket : rules_by_type) {
+        bucket.clear();
+    }
+    artifact_rules.clear();
+    content_automaton.clear();
+    pattern_refs.clear();
+    regex_refs.clear();
+    pattern_base.assign(rules.size() + 1, 0);
+    network_ranges.clear();
+    for (EventMatcher* matcher : {&behavior_events, &process_events}) {
+        matcher->automaton.clear();
+        matcher->refs.clear();
+        matcher->regexes.clear();
+        matcher->slots = 0;
+    }
+
+    while (profiles.size() < rules.size()) {
+        RuleProfile profile;
+        profile.bytes_scanned = 0;
+        profile.candidate_hits = 0;
+        profiles.push_back(profile);
+    }
+
+    uint32_t slots = 0;
+    for (size_t r = 0; r < rules.size(); r++) {
+        const ThreatRule& rule = rules[r];
+        RuleProfile& profile = profiles[r];
+
+        // Patterns are folded here once, not on every match call. Regexes match case-insensitively
+        // as written (folding would turn \W into \w), and are compiled here rather than per match
+        profile.patterns_lower.clear();
+        for (const auto& pattern : rule.patterns) {
+            if (isRegexPattern(pattern)) {
+                if (rule.enabled) getRegex(pattern);
+                profile.patterns_lower.push_back(pattern);
+                continue;
+            }
+            String pattern_lower = pattern;
+            pattern_lower.toLowerCase();
+            profile.patterns_lower.push_back(pattern_lower);
+        }
+        if (profile.pattern_hits.size() != rule.patterns.size()) {
+            profile.pattern_hits.assign(rule.patterns.size(), 0);
+        }
+
+        // CIDR patterns become a range tree here rather than on every network match. Composite
+        // rules match network conditions too, so every rule gets its split
+        profile.network_ranges = -1;
+        if (splitNetworkPatterns(rule, network_scratch, profile.network_substrings)) {
+            profile.network_ranges = network_ranges.size();
+            network_ranges.push_back(network_scratch);
+        }
+
+        pattern_base[r] = slots;
+        slots += rule.patterns.size();
+        if (!rule.enabled || rule.type >= RULE_TYPE_COUNT) continue;
+
+        rules_by_type[rule.type].push_back(r);
+        if (rule.type != RULE_FILE_PATTERN && rule.type != RULE_CONTENT_PATTERN &&
+            rule.type != RULE_REGISTRY_PATTERN) {
+            continue;
+        }
+        artifact_rules.push_back(r);
+        if (rule.type == RULE_FILE_PATTERN) continue;
+
+        for (size_t p = 0; p < rule.patterns.size(); p++) {
+            PatternRef ref;
+            ref.rule = r;
+            ref.pattern = p;
+
+            if (isRegexPattern(rule.patterns[p])) {
+                addRegexRef(regex_refs, ref);
+                continue;
+            }
+
+            // Keep pattern ids aligned with pattern_refs
+            if (content_automaton.addPattern(rule.patterns[p]) < 0) continue;
+            pattern_refs.push_back(ref);
+        }
+    }
+    pattern_base[rules.size()] = slots;
+
+    // Behavioral matching runs for composite rules too, and process matching for both
+    for (ThreatRuleType type : {RULE_BEHAVIORAL, RULE_COMPOSITE}) {
+        for (uint16_t r : rules_by_type[type]) {
+            addEventPatterns(behavior_events, r);
+        }
+    }
+    for (ThreatRuleType type : {RULE_PROCESS_PATTERN, RULE_BEHAVIORAL, RULE_COMPOSITE}) {
+        for (uint16_t r : rules_by_type[type]) {
+            addEventPatterns(process_events, r);
+        }
+    }
+
+    content_automaton.compile();
+    behavior_events.automaton.compile();
+    process_events.automaton.compile();
+    index_dirty = false;
+
+    Serial.printf("[ThreatDetector] Rule index: %u content patterns, %u states, %u bytes, %u regexes\n",
+                  (unsigned)pattern_refs.size(), (unsigned)content_automaton.getStateCount(),
+                  (unsigned)content_automaton.getMemoryUsage(), (unsigned)regex_refs.size());
+}
+
+void ThreatDetector::beginContentScan(bool is_registry) {
+    content_required.assign(rules.size(), 0);
+    content_hits.assign(rules.size(), 0);
+    content_candidates.assign(rules.size(), 0);
+    pattern_seen.assign(pattern_base[rules.size()], false);
+    content_pending = 0;
+
+    for (uint16_t r : rules_by_type[RULE_CONTENT_PATTERN]) {
+        content_required[r] = requiredContentMatches(rules[r]);
+    }
+    if (is_registry) {
+        for (uint16_t r : rules_by_type[RULE_REGISTRY_PATTERN]) {
+            content_required[r] = 1;
+        }
+    }
+
+    for (size_t r = 0; r < rules.size(); r++) {
+        if (content_required[r] > 0 && !rules[r].patterns.empty()) content_pending++;
+    }
+
+    regex_cursors.resize(regex_refs.size());
+    for (size_t i = 0; i < regex_refs.size(); i++) {
+        regex_refs[i].regex->begin(regex_cursors[i]);
+    }
+}
+
+uint32_t ThreatDetector::scanContentBlock(const uint8_t* data, size_t len, uint32_t state) {
+    // Regexes carry their own cursors across blocks, like the automaton state
+    for (size_t i = 0; i < regex_refs.size(); i++) {
+        if (regexPending(i) && regex_refs[i].regex->feed(regex_cursors[i], data, len)) {
+            markRegexMatch(i);
+        }
+    }
+
+    return content_automaton.scan(data, len, state, [this](uint16_t pattern_id, size_t) {
+        const PatternRef& ref = pattern_refs[pattern_id];
+        uint16_t required = content_required[ref.rule];
+        if (required == 0) return;
+
+        content_candidates[ref.rule]++;
+        uint32_t slot = pattern_base[ref.rule] + ref.pattern;
+        if (pattern_seen[slot]) return;
+
+        pattern_seen[slot] = true;
+        if (++content_hits[ref.rule] == required) content_pending--;
+    });
+}
+
+bool ThreatDetector::addRegexRef(std::vector<RegexRef>& refs, const PatternRef& ref) {
+    RegexMatcher* regex = getRegex(rules[ref.rule].patterns[ref.pattern]);
+    if (!regex) return false;
+
+    // Rules sharing a regex share its cursor
+    size_t i = 0;
+    while (i < refs.size() && refs[i].regex != regex) i++;
+    if (i == refs.size()) {
+        RegexRef regex_ref;
+        regex_ref.regex = regex;
+        refs.push_back(regex_ref);
+    }
+    refs[i].owners.push_back(ref);
+    return true;
+}
+
+bool ThreatDetector::regexPending(size_t regex_index) const {
+    if (regex_cursors[regex_index].matched) return false;
+
+    for (const PatternRef& ref : regex_refs[regex_index].owners) {
+        uint16_t required = content_required[ref.rule];
+        if (required > 0 && content_hits[ref.rule] < required) return true;
+    }
+    return false;
+}
+
+void ThreatDetector::markRegexMatch(size_t regex_index) {
+    for (const PatternRef& ref : regex_refs[regex_index].owners) {
+        uint16_t required = content_required[ref.rule];
+        if (required == 0) continue;
+
+        content_candidates[ref.rule]++;
+        uint32_t slot = pattern_base[ref.rule] + ref.pattern;
+        if (pattern_seen[slot]) continue;
+
+        pattern_seen[slot] = true;
+        if (++content_hits[ref.rule] == required) content_pending--;
+    }
+}
+
+bool ThreatDetector::contentMatched(size_t rule_index) const {
+    return content_required[rule_index] > 0 && content_hits[rule_index] >= content_required[rule_index];
+}
+
+void ThreatDetector::finishContentScan(uint64_t bytes, uint32_t time_us) {
+    // Settle regexes that can only match at the end of the artifact ($, \b)
+    for (size_t i = 0; i < regex_refs.size(); i++) {
+        if (regexPending(i) && regex_refs[i].regex->finish(regex_cursors[i])) {
+            markRegexMatch(i);
+        }
+    }
+
+    // All rules share one automaton pass, so its time is attributed to rules by their
+    // share of candidate hits; the pass as a whole is recorded as "(scan)"
+    uint64_t total_candidates = 0;
+    bool any_matched = false;
+    for (size_t r = 0; r < rules.size(); r++) {
+        total_candidates += content_candidates[r];
+    }
+
+    for (size_t r = 0; r < rules.size(); r++) {
+        if (content_required[r] == 0) continue;
+
+        RuleProfile& profile = profiles[r];
+        profile.bytes_scanned += bytes;
+        profile.candidate_hits += content_candidates[r];
+        for (size_t p = 0; p < profile.pattern_hits.size(); p++) {
+            if (pattern_seen[pattern_base[r] + p]) profile.pattern_hits[p]++;
+        }
+
+        bool matched = contentMatched(r);
+        any_matched |= matched;
+        if (performance_monitor) {
+            uint32_t time_share = total_candidates > 0
+                ? (uint32_t)((uint64_t)time_us * content_candidates[r] / total_candidates) : 0;
+            performance_monitor->recordRuleScan("threat", rules[r].rule_id, bytes, time_share,
+                                                content_candidates[r], matched);
+        }
+    }
+
+    if (performance_monitor) {
+        performance_monitor->recordRuleScan("threat", "(scan)", bytes, time_us,
+                                            (uint32_t)total_candidates, any_matched);
+    }
+}
+
+const String& ThreatDetector::foldText(const String& text) {
+    // Reused buffer: folding allocates only when a longer text comes along
+    fold_buffer = text;
+    fold_buffer.toLowerCase();
+    return fold_buffer;
+}
+
+const std::vector<String>& ThreatDetector::foldedPatterns(const ThreatRule& rule) {
+    // Rules held by the detector were folded when the index was built
+    if (!rules.empty() && &rule >= &rules.front() && &rule <= &rules.back()) {
+        if (index_dirty) buildRuleIndex();
+        return profiles[&rule - &rules.front()].patterns_lower;
+    }
+
+    fold_patterns.clear();
+    for (const auto& pattern : rule.patterns) {
+        if (isRegexPattern(pattern)) {
+            fold_patterns.push_back(pattern);
+            continue;
+        }
+        String pattern_lower = pattern;
+        pattern_lower.toLowerCase();
+        fold_patterns.push_back(pattern_lower);
+    }
+    return fold_patterns;
+}
+
+// ===========================
+// Timeline Rules
+// ===========================
+
+void ThreatDetector::addEventPatterns(EventMatcher& matcher, uint16_t rule_index) {
+    const ThreatRule& rule = rules[rule_index];
+    for (size_t p = 0; p < rule.patterns.size(); p++) {
+        PatternRef ref;
+        ref.rule = rule_index;
+        ref.pattern = p;
+
+        if (isRegexPattern(rule.patterns[p])) {
+            if (addRegexRef(matcher.regexes, ref)) matcher.slots++;
+            continue;
+        }
+
+        // Keep pattern ids aligned with refs
+        if (matcher.automaton.addPattern(rule.patterns[p]) < 0) continue;
+        matcher.refs.push_back(ref);
+        matcher.slots++;
+    }
+}
+
+void ThreatDetector::evaluateEventRules() {
+    behavior_events.seen.assign(pattern_base[rules.size()], false);
+    process_events.seen.assign(pattern_base[rules.size()], false);
+    if (!timeline_generator) return;
+
+    const TimelineStore& events = timeline_generator->getStore();
+
+    // Behavioral patterns look at every event, until each pattern has been seen once
+    if (ioc_extractor && behavior_events.slots > 0) {
+        static const TimelineField fields[] = {TIMELINE_FIELD_DESCRIPTION, TIMELINE_FIELD_TARGET};
+        size_t unseen = behavior_events.slots;
+        for (uint32_t i = 0; i < events.size(); i++) {
+            unseen -= scanEvent(behavior_events, events, i, fields, 2);
+            if (unseen == 0) break;
+        }
+    }
+
+    // Process patterns only look at process events
+    if (process_events.slots > 0) {
+        static const TimelineField fields[] = {TIMELINE_FIELD_TARGET, TIMELINE_FIELD_DESCRIPTION, TIMELINE_FIELD_DETAILS};
+        size_t unseen = process_events.slots;
+        for (TimelineEventType type : {EVENT_PROCESS_STARTED, EVENT_PROCESS_TERMINATED}) {
+            TimelineSpan indexes = timeline_generator->getEventsByType(type);
+            for (size_t i = 0; i < indexes.size() && unseen > 0; i++) {
+                unseen -= scanEvent(process_events, events, indexes[i], fields, 3);
+            }
+        }
+    }
+}
+
+size_t ThreatDetector::scanEvent(EventMatcher& matcher, const TimelineStore& events, uint32_t index,
+                                 const TimelineField* fields, size_t field_count) {
+    // Fields are joined by a space, as the single-rule matchers join them
+    static const uint8_t separator = ' ';
+    size_t newly_seen = 0;
+
+    auto mark = [&](const PatternRef& ref) {
+        uint32_t slot = pattern_base[ref.rule] + ref.pattern;
+        if (!matcher.seen[slot]) {
+            matcher.seen[slot] = true;
+            newly_seen++;
+        }
+    };
+
+    if (!matcher.refs.empty()) {
+        auto on_match = [&](uint16_t pattern_id, size_t) { mark(matcher.refs[pattern_id]); };
+        uint32_t state = MultiPatternMatcher::START_STATE;
+        for (size_t f = 0; f < field_count; f++) {
+            if (f > 0) state = matcher.automaton.scan(&separator, 1, state, on_match);
+            state = matcher.automaton.scan((const uint8_t*)events.getText(fields[f], index),
+                                           events.getTextLength(fields[f], index), state, on_match);
+        }
+    }
+
+    for (const auto& regex_ref : matcher.regexes) {
+        bool wanted = false;
+        for (const PatternRef& ref : regex_ref.owners) {
+            wanted |= !matcher.seen[pattern_base[ref.rule] + ref.pattern];
+        }
+        if (!wanted) continue;
+
+        RegexMatcher::Cursor cursor;
+        regex_ref.regex->begin(cursor);
+        bool matched = false;
+        for (size_t f = 0; f < field_count && !matched; f++) {
+            if (f > 0) matched = regex_ref.regex->feed(cursor, &separator, 1);
+            if (!matched) {
+                matched = regex_ref.regex->feed(cursor, (const uint8_t*)events.getText(fields[f], index),
+                                                events.getTextLength(fields[f], index));
+            }
+        }
+        if (matched || regex_ref.regex->finish(cursor)) {
+            for (const PatternRef& ref : regex_ref.owners) mark(ref);
+        }
+    }
+    return newly_seen;
+}
+
+uint16_t ThreatDetector::eventPatternsSeen(const EventMatcher& matcher, size_t rule_index) const {
+    uint16_t seen = 0;
+    for (uint32_t slot = pattern_base[rule_index]; slot < pattern_base[rule_index + 1]; slot++) {
+        if (slot < matcher.seen.size() && matcher.seen[slot]) seen++;
+    }
+    return seen;
+}
+
+bool ThreatDetector::compositeMatched(size_t rule_index, const std::vector<IOC>& iocs) {
+    // As matchCompositeRule, on the results of evaluateEventRules
+    const ThreatRule& rule = rules[rule_index];
+    uint16_t condition_matches = 0;
+
+    for (const auto& condition : rule.conditions) {
+        if (condition.indexOf("process") >= 0 && timeline_generator &&
+            eventPatternsSeen(process_events, rule_index) > 0) {
+            condition_matches++;
+        }
+        if (condition.indexOf("network") >= 0 && ioc_extractor && matchNetworkPattern(rule, iocs)) {
+            condition_matches++;
+        }
+    }
+    return condition_matches >= 2;
+}
+
+void ThreatDetector::evaluateSigmaRules() {
+    // One alert per rule and source artifact, described by the first event that matched
+    if (!sigma_rules.isCompiled()) sigma_rules.compile();
+
+    const TimelineStore& events = timeline_generator->getStore();
+    std::vector<uint16_t> matched;
+    for (uint32_t i = 0; i < events.size(); i++) {
+        if (!sigma_rules.match(events, i, matched)) continue;
+
+        TimelineField source_field = events.getTextLength(TIMELINE_FIELD_SOURCE, i) > 0 ? TIMELINE_FIELD_SOURCE : TIMELINE_FIELD_TARGET;
+        String source = events.getString(source_field, i);
+        String description = events.getString(TIMELINE_FIELD_DESCRIPTION, i);
+        for (uint16_t s : matched) {
+            uint16_t r = sigma_rule_index[s];
+            if (r == NO_RULE || !rules[r].enabled) continue;
+            raiseAlert(r, source, description, 80);
+        }
+    }
+}
+
 // ===========================
 // Rule Matching Methods
 // ===========================
 
 bool ThreatDetector::matchFilePattern(const ThreatRule& rule, const String& file_path) {
-    for (const auto& pattern : rule.patterns) {
-        if (containsPattern(file_path.toLowerCase(), pattern.toLowerCase())) {
+    const std::vector<String>& patterns = foldedPatterns(rule);
+    const String& path_lower = foldText(file_path);
+
+    for (const auto& pattern : patterns) {
+        if (patternMatches(path_lower, pattern)) {
             return true;
         }
     }
     return false;
 }
 
+uint16_t ThreatDetector::requiredContentMatches(const ThreatRule& rule) const {
+    // Require multiple pattern matches for content-based rules, unless the rule says otherwise
+    auto min_matches = rule.metadata.find("min_matches");
+    if (min_matches != rule.metadata.end()) {
+        return min_matches->second.toInt();
+    }
+    return rule.patterns.size() > 2 ? 2 : 1;
+}
+
 bool ThreatDetector::matchContentPattern(const ThreatRule& rule, const String& content) {
-    String content_lower = content.toLowerCase();
+    uint16_t required = requiredContentMatches(rule);
+    if (required == 0) return false;
+
+    const std::vector<String>& patterns = foldedPatterns(rule);
+    const String& content_lower = foldText(content);
 
     uint16_t pattern_matches = 0;
-    for (const auto& pattern : rule.patterns) {
-        if (containsPattern(content_lower, pattern.toLowerCase())) {
-            pattern_matches++;
+    size_t remaining = patterns.size();
+    for (const auto& pattern : patterns) {
+        remaining--;
+        if (patternMatches(content_lower, pattern) && ++pattern_matches >= required) {
+            return true;
+        }
+        if (pattern_matches + remaining < required) {
+            return false;
         }
     }
 
-    // Require multiple pattern matches for content-based rules
-    return pattern_matches >= (rule.patterns.size() > 2 ? 2 : 1);
+    return false;
+}
+
+bool ThreatDetector::splitNetworkPatterns(const ThreatRule& rule, CidrTree& ranges,
+                                          std::vector<uint16_t>& substrings) {
+    // CIDR patterns match IP addresses by range, everything else as a substring
+    ranges.clear();
+    substrings.clear();
+    for (size_t p = 0; p < rule.patterns.size(); p++) {
+        const String& pattern = rule.patterns[p];
+        if (pattern.indexOf('/') > 0 && ranges.add(pattern, CIDR_DENY)) continue;
+        substrings.push_back(p);
+    }
+    return ranges.getRangeCount() > 0;
 }
 
 bool ThreatDetector::matchNetworkPattern(const ThreatRule& rule, const std::vector<IOC>& iocs) {
+    // Folding rebuilds the index first if rules changed, so the profile is current
+    const std::vector<String>& patterns = foldedPatterns(rule);
+
+    const CidrTree* ranges = nullptr;
+    const std::vector<uint16_t>* substrings = &network_scratch_substrings;
+    if (!rules.empty() && &rule >= &rules.front() && &rule <= &rules.back()) {
+        const RuleProfile& profile = profiles[&rule - &rules.front()];
+        if (profile.network_ranges >= 0) ranges = &network_ranges[profile.network_ranges];
+        substrings = &profile.network_substrings;
+    } else if (splitNetworkPatterns(rule, network_scratch, network_scratch_substrings)) {
+        ranges = &network_scratch;
+    }
+
     for (const auto& ioc : iocs) {
         if (ioc.type != IOC_IP_ADDRESS && ioc.type != IOC_DOMAIN && ioc.type != IOC_URL) {
             continue;
         }
 
-        for (const auto& pattern : rule.patterns) {
-            if (containsPattern(ioc.value.toLowerCase(), pattern.toLowerCase())) {
+        if (ioc.type == IOC_IP_ADDRESS && ranges && ranges->lookup(ioc.value) != CIDR_NONE) {
+            return true;
+        }
+
+        const String& value = foldText(ioc.value);
+        for (uint16_t p : *substrings) {
+            if (patternMatches(value, patterns[p])) {
                 return true;
             }
         }
@@ -242,17 +871,18 @@ bool ThreatDetector::matchNetworkPattern(const ThreatRule& rule, const std::vect
     return false;
 }
 
-bool ThreatDetector::matchProcessPattern(const ThreatRule& rule, const std::vector<TimelineEvent>& events) {
-    for (const auto& event : events) {
-        if (event.type != EVENT_PROCESS_STARTED && event.type != EVENT_PROCESS_TERMINATED) {
+bool ThreatDetector::matchProcessPattern(const ThreatRule& rule, const TimelineStore& events) {
+    for (uint32_t i = 0; i < events.size(); i++) {
+        TimelineEventType type = events.getType(i);
+        if (type != EVENT_PROCESS_STARTED && type != EVENT_PROCESS_TERMINATED) {
             continue;
         }
 
-        String combined = event.target + " " + event.description + " " + event.details;
-        combined.toLowerCase();
-
-        for (const auto& pattern : rule.patterns) {
-            if (containsPattern(combined, pattern.toLowerCase())) {
+        const String& combined = foldText(events.getString(TIMELINE_FIELD_TARGET, i) + " " +
+                                          events.getText(TIMELINE_FIELD_DESCRIPTION, i) + " " +
+                                          events.getText(TIMELINE_FIELD_DETAILS, i));
+        for (const auto& pattern : foldedPatterns(rule)) {
+            if (patternMatches(combined, pattern)) {
                 return true;
             }
         }
@@ -261,10 +891,11 @@ bool ThreatDetector::matchProcessPattern(const ThreatRule& rule, const std::vect
 }
 
 bool ThreatDetector::matchRegistryPattern(const ThreatRule& rule, const String& content) {
-    String content_lower = content.toLowerCase();
+    const std::vector<String>& patterns = foldedPatterns(rule);
+    const String& content_lower = foldText(content);
 
-    for (const auto& pattern : rule.patterns) {
-        if (containsPattern(content_lower, pattern.toLowerCase())) {
+    for (const auto& pattern : patterns) {
+        if (patternMatches(content_lower, pattern)) {
             return true;
         }
     }
@@ -277,16 +908,20 @@ bool ThreatDetector::matchBehavioralPattern(const ThreatRule& rule) {
 
     uint16_t behavior_indicators = 0;
 
-    // Check for suspicious temporal patterns
-    auto events = timeline_generator->getEvents();
-    for (const auto& pattern : rule.patterns) {
-        for (const auto& event : events) {
-            String event_str = event.description + " " + event.target;
-            if (containsPattern(event_str.toLowerCase(), pattern.toLowerCase())) {
+    // Check for suspicious temporal patterns; each event is folded once for all patterns
+    const std::vector<String>& patterns = foldedPatterns(rule);
+    std::vector<bool> found(patterns.size(), false);
+    const TimelineStore& events = timeline_generator->getStore();
+    for (uint32_t i = 0; i < events.size(); i++) {
+        const String& event_str = foldText(events.getString(TIMELINE_FIELD_DESCRIPTION, i) + " " +
+                                           events.getText(TIMELINE_FIELD_TARGET, i));
+        for (size_t p = 0; p < patterns.size(); p++) {
+            if (!found[p] && patternMatches(event_str, patterns[p])) {
+                found[p] = true;
                 behavior_indicators++;
-                break;
             }
         }
+        if (behavior_indicators == patterns.size()) break;
     }
 
     // Require multiple behavioral indicators
@@ -301,8 +936,7 @@ bool ThreatDetector::matchCompositeRule(const ThreatRule& rule) {
         // Parse condition (simplified)
         if (condition.indexOf("process") >= 0) {
             if (timeline_generator) {
-                auto events = timeline_generator->getEvents();
-                if (matchProcessPattern(rule, events)) {
+                if (matchProcessPattern(rule, timeline_generator->getStore())) {
                     condition_matches++;
                 }
             }
@@ -310,8 +944,7 @@ bool ThreatDetector::matchCompositeRule(const ThreatRule& rule) {
 
         if (condition.indexOf("network") >= 0) {
             if (ioc_extractor) {
-                auto iocs = ioc_extractor->getIOCs();
-                if (matchNetworkPattern(rule, iocs)) {
+                if (matchNetworkPattern(rule, ioc_extractor->getUniqueIOCs())) {
                     condition_matches++;
                 }
             }
@@ -327,30 +960,241 @@ bool ThreatDetector::matchCompositeRule(const ThreatRule& rule) {
 // ===========================
 
 void ThreatDetector::addAlert(const ThreatAlert& alert) {
-    // Check for duplicates
-    for (const auto& existing : alerts) {
-        if (existing.rule_id == alert.rule_id &&
-            existing.artifact_source == alert.artifact_source) {
-            return; // Duplicate alert
+    uint64_t hash = hashAlertKey(alert.rule_id, alert.artifact_source);
+    if (findAlert(hash, alert.rule_id, alert.artifact_source) >= 0 || wasRolledUp(hash)) {
+        return; // Duplicate alert
+    }
+
+    auto rule = rule_ids.find(alert.rule_id);
+    uint16_t rule_index = rule != rule_ids.end() ? rule->second : NO_RULE;
+    if (rule_index != NO_RULE) rules[rule_index].match_count++;
+
+    if (!admitAlert(alert.severity, rule_index)) {
+        rollUpAlert(hash, alert.rule_id, alert.rule_name, alert.severity,
+                    alert.artifact_source, alert.timestamp);
+        return;
+    }
+    storeAlert(alert, hash, rule_index);
+    compactAlerts();
+}
+
+void ThreatDetector::raiseAlert(uint16_t rule_index, const String& source,
+                                const String& matched_content, uint8_t confidence) {
+    // Same checks as addAlert, but the alert is only built once it is known to be stored.
+    // Scans compact the store once, when they finish
+    ThreatRule& rule = rules[rule_index];
+    uint64_t hash = hashAlertKey(rule.rule_id, source);
+    if (findAlert(hash, rule.rule_id, source) >= 0 || wasRolledUp(hash)) {
+        return;
+    }
+
+    rule.match_count++;
+    if (!admitAlert(rule.severity, rule_index)) {
+        rollUpAlert(hash, rule.rule_id, rule.name, rule.severity, source, millis());
+        return;
+    }
+    storeAlert(createAlert(rule, source, matched_content, confidence), hash, rule_index);
+}
+
+bool ThreatDetector::admitAlert(ThreatSeverity severity, uint16_t rule_index) {
+    size_t stored = alerts.size() - evicted_alerts;
+    if (severity >= THREAT_HIGH) {
+        // Always kept; a full store makes room by rolling up a lower-severity alert if it has one
+        if (stored >= THREAT_MAX_ALERTS) evictAlert(THREAT_HIGH);
+        return true;
+    }
+
+    if (rule_index != NO_RULE && alerts_kept[rule_index] >= THREAT_ALERTS_PER_RULE) {
+        return false;
+    }
+    return stored < THREAT_MAX_ALERTS || evictAlert(severity);
+}
+
+bool ThreatDetector::evictAlert(ThreatSeverity below) {
+    // Oldest alert of the lowest severity present, if that is below `below`
+    int lowest = THREAT_INFO;
+    while (lowest < below && eviction_queues[lowest].empty()) lowest++;
+    if (lowest >= below) return false;
+
+    uint32_t victim = eviction_queues[lowest].front();
+    eviction_queues[lowest].pop_front();
+
+    const ThreatAlert& alert = alerts[victim];
+    auto rule = rule_ids.find(alert.rule_id);
+    if (rule != rule_ids.end() && alerts_kept[rule->second] > 0) alerts_kept[rule->second]--;
+    alerts_by_severity[lowest]--;
+    rollUpAlert(alert_hashes[victim], alert.rule_id, alert.rule_name, alert.severity,
+                alert.artifact_source, alert.timestamp);
+
+    // Dropped in one pass once a quarter of the store is evicted, or when the call returns
+    alert_evicted[victim] = true;
+    evicted_alerts++;
+    if (evicted_alerts * 4 >= alerts.size()) compactAlerts();
+    return true;
+}
+
+void ThreatDetector::compactAlerts() {
+    if (evicted_alerts == 0) return;
+
+    size_t kept = 0;
+    for (size_t i = 0; i < alerts.size(); i++) {
+        if (alert_evicted[i]) continue;
+        if (kept != i) {
+            alerts[kept] = std::move(alerts[i]);
+            alert_hashes[kept] = alert_hashes[i];
         }
+        kept++;
     }
+    alerts.erase(alerts.begin() + kept, alerts.end());
+    alert_hashes.resize(kept);
+    alert_evicted.assign(kept, false);
+    evicted_alerts = 0;
+    rebuildAlertIndex();
+
+    // Positions have moved; the queues keep their order
+    for (std::deque<uint32_t>& queue : eviction_queues) queue.clear();
+    for (size_t i = 0; i < kept; i++) {
+        if ((unsigned)alerts[i].severity < THREAT_HIGH) eviction_queues[alerts[i].severity].push_back(i);
+    }
+}
 
+void ThreatDetector::storeAlert(const ThreatAlert& alert, uint64_t hash, uint16_t rule_index) {
     alerts.push_back(alert);
+    alert_hashes.push_back(hash);
+    alert_evicted.push_back(false);
+    indexAlert(alerts.size() - 1);
+
+    if ((size_t)alert.severity < sizeof(alerts_by_severity) / sizeof(alerts_by_severity[0])) {
+        alerts_by_severity[alert.severity]++;
+    }
+    if ((unsigned)alert.severity < THREAT_HIGH) {
+        eviction_queues[alert.severity].push_back(alerts.size() - 1);
+        if (rule_index != NO_RULE) alerts_kept[rule_index]++;
+    }
 
     Serial.println("[ThreatDetector] ALERT: " + alert.rule_name +
                    " (" + getThreatSeverityName(alert.severity) + ")");
+}
+
+void ThreatDetector::rollUpAlert(uint64_t hash, const String& rule_id, const String& rule_name,
+                                 ThreatSeverity severity, const String& source, unsigned long timestamp) {
+    AlertRollup& rollup = rollups[rule_id];
+    if (rollup.count == 0) {
+        rollup.rule_id = rule_id;
+        rollup.rule_name = rule_name;
+        rollup.severity = severity;
+        rollup.first_timestamp = timestamp;
+        Serial.println("[ThreatDetector] Rolling up further " + rule_name + " alerts");
+    }
+    rollup.count++;
+    rollup.last_timestamp = timestamp;
+    rollup.last_source = source;
+    suppressed_alerts++;
+
+    // Remembered, so the same finding is not counted again
+    if ((rolled_up_count + 1) * 4 > rolled_up_keys.size() * 3) {
+        std::vector<uint64_t> table(rolled_up_keys.empty() ? 64 : rolled_up_keys.size() * 2, 0);
+        for (uint64_t key : rolled_up_keys) {
+            if (key != 0) insertRolledUpKey(table, key);
+        }
+        rolled_up_keys.swap(table);
+    }
+    insertRolledUpKey(rolled_up_keys, hash);
+    rolled_up_count++;
+}
 
-    // Update rule match count
-    for (size_t i = 0; i < rules.size(); i++) {
-        if (rules[i].rule_id == alert.rule_id) {
-            rules[i].match_count++;
-            break;
+int32_t ThreatDetector::findAlert(uint64_t hash, const String& rule_id, const String& source) const {
+    // Evicted alerts are still found until they are dropped
+    if (alert_index.empty()) return -1;
+    size_t mask = alert_index.size() - 1;
+    for (size_t slot = hash & mask; alert_index[slot] != 0; slot = (slot + 1) & mask) {
+        uint32_t position = alert_index[slot] - 1;
+        if (alert_hashes[position] == hash &&
+            alerts[position].rule_id == rule_id &&
+            alerts[position].artifact_source == source) {
+            return position;
         }
     }
+    return -1;
+}
+
+bool ThreatDetector::wasRolledUp(uint64_t hash) const {
+    if (rolled_up_keys.empty()) return false;
+    uint64_t key = hash != 0 ? hash : 1;
+    size_t mask = rolled_up_keys.size() - 1;
+    for (size_t slot = key & mask; rolled_up_keys[slot] != 0; slot = (slot + 1) & mask) {
+        if (rolled_up_keys[slot] == key) return true;
+    }
+    return false;
+}
+
+void ThreatDetector::insertRolledUpKey(std::vector<uint64_t>& table, uint64_t hash) {
+    uint64_t key = hash != 0 ? hash : 1;
+    size_t mask = table.size() - 1;
+    size_t slot = key & mask;
+    while (table[slot] != 0) slot = (slot + 1) & mask;
+    table[slot] = key;
+}
+
+void ThreatDetector::indexAlert(size_t position) {
+    if (alert_index.empty() || alerts.size() * 4 > alert_index.size() * 3) {
+        rebuildAlertIndex();
+        return;
+    }
+    size_t mask = alert_index.size() - 1;
+    size_t slot = alert_hashes[position] & mask;
+    while (alert_index[slot] != 0) slot = (slot + 1) & mask;
+    alert_index[slot] = position + 1;
+}
+
+void ThreatDetector::rebuildAlertIndex() {
+    size_t size = 64;
+    while (alerts.size() * 4 > size * 3) size *= 2;
+    alert_index.assign(size, 0);
+
+    size_t mask = size - 1;
+    for (size_t i = 0; i < alerts.size(); i++) {
+        size_t slot = alert_hashes[i] & mask;
+        while (alert_index[slot] != 0) slot = (slot + 1) & mask;
+        alert_index[slot] = i + 1;
+    }
+}
+
+uint64_t ThreatDetector::hashAlertKey(const String& rule_id, const String& source) {
+    // 64-bit FNV-1a over "rule id \0 source"; rolled-up keys are kept by this hash alone
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < rule_id.length(); i++) {
+        hash = (hash ^ (uint8_t)rule_id[i]) * 1099511628211ULL;
+    }
+    hash *= 1099511628211ULL;
+    for (size_t i = 0; i < source.length(); i++) {
+        hash = (hash ^ (uint8_t)source[i]) * 1099511628211ULL;
+    }
+    return hash;
 }
 
 void ThreatDetector::clearAlerts() {
     alerts.clear();
+    alert_hashes.clear();
+    alert_evicted.clear();
+    alert_index.clear();
+    rolled_up_keys.clear();
+    rolled_up_count = 0;
+    for (std::deque<uint32_t>& queue : eviction_queues) queue.clear();
+    evicted_alerts = 0;
+    rollups.clear();
+    std::fill(alerts_kept.begin(), alerts_kept.end(), 0);
+    memset(alerts_by_severity, 0, sizeof(alerts_by_severity));
+    suppressed_alerts = 0;
+}
+
+std::vector<AlertRollup> ThreatDetector::getAlertRollups() const {
+    std::vector<AlertRollup> result;
+    result.reserve(rollups.size());
+    for (const auto& entry : rollups) {
+        result.push_back(entry.second);
+    }
+    return result;
 }
 
 std::vector<ThreatAlert> ThreatDetector::getAlertsBySeverity(ThreatSeverity severity) const {
@@ -395,12 +1239,13 @@ DetectionStatistics ThreatDetector::getStatistics() const {
     stats.total_rules_loaded = rules.size();
     stats.rules_enabled = 0;
     stats.total_scans_performed = scan_count;
-    stats.total_alerts_generated = alerts.size();
+    stats.total_alerts_generated = alerts.size() + suppressed_alerts;
     stats.critical_alerts = 0;
     stats.high_alerts = 0;
     stats.medium_alerts = 0;
     stats.low_alerts = 0;
     stats.false_positives = 0;
+    stats.suppressed_alerts = suppressed_alerts;
 
     for (const auto& rule : rules) {
         if (rule.enabled) stats.rules_enabled++;
@@ -429,6 +1274,17 @@ DetectionStatistics ThreatDetector::getStatistics() const {
         }
     }
 
+    // Rolled-up alerts count towards their severity and rule
+    for (const auto& entry : rollups) {
+        const AlertRollup& rollup = entry.second;
+        switch (rollup.severity) {
+            case THREAT_MEDIUM: stats.medium_alerts += rollup.count; break;
+            case THREAT_LOW: stats.low_alerts += rollup.count; break;
+            default: break;
+        }
+        stats.alerts_by_rule[rollup.rule_id] += rollup.count;
+    }
+
     return stats;
 }
 
@@ -469,7 +1325,29 @@ String ThreatDetector::exportAlertsToJSON() {
     }
 
     json += "  ],\n";
-    json += "  \"total_alerts\": " + String(alerts.size()) + "\n";
+    json += "  \"rollups\": [\n";
+
+    size_t rollup_number = 0;
+    for (const auto& entry : rollups) {
+        const AlertRollup& rollup = entry.second;
+
+        json += "    {\n";
+        json += "      \"rule_id\": \"" + rollup.rule_id + "\",\n";
+        json += "      \"rule_name\": \"" + rollup.rule_name + "\",\n";
+        json += "      \"severity\": \"" + getThreatSeverityName(rollup.severity) + "\",\n";
+        json += "      \"count\": " + String(rollup.count) + ",\n";
+        json += "      \"last_source\": \"" + rollup.last_source + "\",\n";
+        json += "      \"first_timestamp\": " + String(rollup.first_timestamp) + ",\n";
+        json += "      \"last_timestamp\": " + String(rollup.last_timestamp) + "\n";
+        json += "    }";
+
+        if (++rollup_number < rollups.size()) json += ",";
+        json += "\n";
+    }
+
+    json += "  ],\n";
+    json += "  \"total_alerts\": " + String(alerts.size()) + ",\n";
+    json += "  \"suppressed_alerts\": " + String(suppressed_alerts) + "\n";
     json += "}\n";
 
     return json;
@@ -831,6 +1709,77 @@ bool ThreatDetector::containsPattern(const String& content, const String& patter
     return content.indexOf(pattern) >= 0;
 }
 
+bool ThreatDetector::patternMatches(const String& content_lower, const String& pattern) {
+    return isRegexPattern(pattern) ? matchesRegex(content_lower, pattern) : containsPattern(content_lower, pattern);
+}
+
+bool ThreatDetector::isRegexPattern(const String& pattern) {
+    // YARA style /body/flags; "/sc minute" and other slash-led literals have no closing slash
+    if (pattern.length() < 3 || pattern[0] != '/') return false;
+
+    int close = pattern.lastIndexOf('/');
+    if (close < 2) return false;
+    for (size_t i = close + 1; i < pattern.length(); i++) {
+        if (pattern[i] != 'i' && pattern[i] != 's') return false;
+    }
+    return true;
+}
+
+RegexMatcher* ThreatDetector::getRegex(const String& pattern) {
+    auto it = regex_cache.find(pattern);
+    if (it != regex_cache.end()) {
+        return it->second.isCompiled() ? &it->second : nullptr;
+    }
+
+    // Each expression owns a fixed DFA cache, so the number of expressions bounds the memory
+    if (regex_cache.size() >= THREAT_MAX_REGEX_PATTERNS) {
+        Serial.println("[ThreatDetector] Regex limit reached, skipping: " + pattern);
+        return nullptr;
+    }
+
+    // Matching is case-insensitive throughout the detector; the s flag lets . match newlines
+    String body = pattern;
+    if (isRegexPattern(pattern)) {
+        int close = pattern.lastIndexOf('/');
+        body = pattern.substring(1, close);
+        if (pattern.indexOf('s', close) > 0) body = "(?s)" + body;
+    }
+
+    RegexMatcher& regex = regex_cache[pattern];
+    if (!regex.compile(body, true, THREAT_REGEX_CACHE_SIZE)) {
+        Serial.println("[ThreatDetector] Bad regex " + pattern + ": " + regex.getError());
+        return nullptr;
+    }
+    return &regex;
+}
+
+bool ThreatDetector::matchesRegex(const String& content, const String& regex) {
+    RegexMatcher* matcher = getRegex(regex);
+    return matcher && matcher->search(content);
+}
+
+std::vector<String> ThreatDetector::extractMatches(const String& content, const String& pattern) {
+    std::vector<String> matches;
+    RegexMatcher* matcher = getRegex(pattern);
+    if (!matcher) return matches;
+
+    // Leftmost-longest, non-overlapping; empty matches are skipped
+    const uint8_t* data = (const uint8_t*)content.c_str();
+    size_t len = content.length();
+    size_t from = 0;
+    size_t start, end;
+    while (from <= len && matches.size() < THREAT_MAX_EXTRACTED_MATCHES &&
+           matcher->find(data, len, from, start, end)) {
+        if (end > start) {
+            matches.push_back(content.substring(start, end));
+            from = end;
+        } else {
+            from = end + 1;
+        }
+    }
+    return matches;
+}
+
 ThreatAlert ThreatDetector::createAlert(const ThreatRule& rule, const String& source,
                                         const String& matched_content, uint8_t confidence) {
     ThreatAlert alert;
@@ -883,3 +1832,28 @@ String ThreatDetector::getMITRETacticName(MITRETactic tactic) const {
         default: return "Unknown";
     }
 }
+
+ThreatSeverity ThreatDetector::parseSeverityName(const String& name) const {
+    if (name.equalsIgnoreCase("critical")) return THREAT_CRITICAL;
+    if (name.equalsIgnoreCase("high")) return THREAT_HIGH;
+    if (name.equalsIgnoreCase("low")) return THREAT_LOW;
+    if (name.equalsIgnoreCase("info") || name.equalsIgnoreCase("informational")) return THREAT_INFO;
+    return THREAT_MEDIUM;
+}
+
+MITRETactic ThreatDetector::parseCategoryTactic(const String& category) const {
+    // YARA meta "category" values, snake_case tactic names
+    if (category == "initial_access") return TACTIC_INITIAL_ACCESS;
+    if (category == "execution") return TACTIC_EXECUTION;
+    if (category == "persistence") return TACTIC_PERSISTENCE;
+    if (category == "privilege_escalation") return TACTIC_PRIVILEGE_ESCALATION;
+    if (category == "defense_evasion") return TACTIC_DEFENSE_EVASION;
+    if (category == "credential_access") return TACTIC_CREDENTIAL_ACCESS;
+    if (category == "discovery") return TACTIC_DISCOVERY;
+    if (category == "lateral_movement") return TACTIC_LATERAL_MOVEMENT;
+    if (category == "collection") return TACTIC_COLLECTION;
+    if (category == "command_and_control") return TACTIC_COMMAND_AND_CONTROL;
+    if (category == "exfiltration") return TACTIC_EXFILTRATION;
+    if (category == "impact") return TACTIC_IMPACT;
+    return TACTIC_UNKNOWN;
+}
@@ -0,0 +1,220 @@
+#include "threat_intel_watchlist.h"
+#include "esp_rom_crc.h"
+#include "esp_heap_caps.h"
+
+static const uint32_t MAX_BLOCK_SIZE = 65536;
+
+// Bloom filter and index go to PSRAM when there is some
+static void* allocTable(size_t size) {
+    void* table = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!table) {
+        table = heap_caps_malloc(size, MALLOC_CAP_8BIT);
+    }
+    return table;
+}
+
+static inline uint8_t lowerByte(uint8_t c) {
+    return (c >= 'A' && c <= 'Z') ? c + 32 : c;
+}
+
+ThreatIntelWatchlist::ThreatIntelWatchlist()
+    : bloom(nullptr), index(nullptr), block(nullptr), cached_block(-1) {
+    memset(&header, 0, sizeof(header));
+    resetStats();
+}
+
+ThreatIntelWatchlist::~ThreatIntelWatchlist() {
+    unload();
+}
+
+void ThreatIntelWatchlist::resetStats() {
+    memset(&stats, 0, sizeof(stats));
+}
+
+void ThreatIntelWatchlist::unload() {
+    if (file) file.close();
+    if (bloom) heap_caps_free(bloom);        // Index lives in the same allocation
+    if (block) heap_caps_free(block);
+    bloom = nullptr;
+    index = nullptr;
+    block = nullptr;
+    cached_block = -1;
+    memset(&header, 0, sizeof(header));
+}
+
+bool ThreatIntelWatchlist::load(FRFDStorage* storage, const String& path) {
+    unload();
+    if (!storage) return false;
+
+    file = storage->openFile(path);
+    if (!file) {
+        Serial.printf("[Watchlist] Cannot open %s\n", path.c_str());
+        return false;
+    }
+
+    size_t file_size = file.size();
+    if (file.read((uint8_t*)&header, sizeof(header)) != sizeof(header) ||
+        header.magic != WATCHLIST_MAGIC || header.version != WATCHLIST_VERSION ||
+        header.header_size < sizeof(header)) {
+        Serial.printf("[Watchlist] %s is not a watchlist\n", path.c_str());
+        unload();
+        return false;
+    }
+
+    size_t bloom_bytes = header.bloom_bits / 8;
+    size_t index_bytes = (size_t)header.block_count * sizeof(uint64_t);
+    if (header.bloom_bits < 64 || header.bloom_bits % 64 != 0 ||
+        header.bloom_hashes == 0 || header.bloom_hashes > 32 ||
+        header.block_size < sizeof(WatchlistBlockHeader) + WATCHLIST_RECORD_HEADER ||
+        header.block_size > MAX_BLOCK_SIZE ||
+        header.index_offset != header.bloom_offset + bloom_bytes ||
+        header.blocks_offset < header.index_offset + index_bytes ||
+        header.blocks_offset + (size_t)header.block_count * header.block_size > file_size) {
+        Serial.printf("[Watchlist] Bad layout in %s\n", path.c_str());
+        unload();
+        return false;
+    }
+
+    bloom = (uint8_t*)allocTable(bloom_bytes + index_bytes);
+    block = (uint8_t*)allocTable(header.block_size);
+    if (!bloom || !block) {
+        Serial.printf("[Watchlist] Not enough memory for %s\n", path.c_str());
+        unload();
+        return false;
+    }
+
+    // Bloom filter and index are contiguous, read and checked in one go
+    if (!file.seek(header.bloom_offset) ||
+        file.read(bloom, bloom_bytes + index_bytes) != bloom_bytes + index_bytes ||
+        esp_rom_crc32_le(0, bloom, bloom_bytes + index_bytes) != header.checksum) {
+        Serial.printf("[Watchlist] Checksum mismatch in %s\n", path.c_str());
+        unload();
+        return false;
+    }
+    index = (uint64_t*)(bloom + bloom_bytes);
+
+    Serial.printf("[Watchlist] Loaded %u entries in %u blocks, %u bytes in RAM\n",
+                  (unsigned)header.entry_count, (unsigned)header.block_count, (unsigned)getMemoryUsage());
+    return true;
+}
+
+size_t ThreatIntelWatchlist::getMemoryUsage() const {
+    if (!isLoaded()) return sizeof(*this);
+    return sizeof(*this) + header.bloom_bits / 8 + (size_t)header.block_count * sizeof(uint64_t) +
+           header.block_size;
+}
+
+uint64_t ThreatIntelWatchlist::makeKey(uint8_t type, const char* value, size_t length) {
+    // 64-bit FNV-1a over the type byte and the lowercased value
+    uint64_t key = (14695981039346656037ULL ^ type) * 1099511628211ULL;
+    for (size_t i = 0; i < length; i++) {
+        key = (key ^ lowerByte(value[i])) * 1099511628211ULL;
+    }
+    return key;
+}
+
+bool ThreatIntelWatchlist::mayContain(uint64_t key) const {
+    // Double hashing: probe i is h1 + i * h2
+    uint32_t h1 = (uint32_t)key;
+    uint32_t h2 = (uint32_t)(key >> 32) | 1;
+
+    for (uint32_t i = 0; i < header.bloom_hashes; i++) {
+        uint32_t bit = (h1 + i * h2) % header.bloom_bits;
+        if (!(bloom[bit >> 3] & (1 << (bit & 7)))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int32_t ThreatIntelWatchlist::findBlock(uint64_t key) const {
+    // Last block whose first key is <= key
+    int32_t lo = 0;
+    int32_t hi = (int32_t)header.block_count - 1;
+    int32_t found = -1;
+    while (lo <= hi) {
+        int32_t mid = lo + (hi - lo) / 2;
+        if (index[mid] <= key) {
+            found = mid;
+            lo = mid + 1;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    return found;
+}
+
+bool ThreatIntelWatchlist::readBlock(int32_t number) {
+    if (number == cached_block) return true;
+
+    cached_block = -1;
+    stats.block_reads++;
+    if (!file.seek(header.blocks_offset + (uint32_t)number * header.block_size) ||
+        file.read(block, header.block_size) != header.block_size) {
+        Serial.printf("[Watchlist] Read error in block %d\n", (int)number);
+        return false;
+    }
+
+    WatchlistBlockHeader block_header;
+    memcpy(&block_header, block, sizeof(block_header));
+    if (block_header.used > header.block_size - sizeof(block_header) ||
+        esp_rom_crc32_le(0, block + sizeof(block_header), block_header.used) != block_header.checksum) {
+        Serial.printf("[Watchlist] Corrupt block %d\n", (int)number);
+        return false;
+    }
+
+    cached_block = number;
+    return true;
+}
+
+bool ThreatIntelWatchlist::lookup(uint8_t type, const char* value, size_t length, WatchlistHit* hit) {
+    if (!isLoaded() || length == 0 || length > 255) return false;
+
+    stats.lookups++;
+    uint64_t key = makeKey(type, value, length);
+    if (!mayContain(key)) {
+        stats.bloom_rejects++;
+        return false;
+    }
+
+    int32_t number = findBlock(key);
+    if (number < 0 || !readBlock(number)) return false;
+
+    WatchlistBlockHeader block_header;
+    memcpy(&block_header, block, sizeof(block_header));
+    const uint8_t* p = block + sizeof(block_header);
+    const uint8_t* end = p + block_header.used;
+
+    for (uint16_t r = 0; r < block_header.record_count && p + WATCHLIST_RECORD_HEADER <= end; r++) {
+        uint64_t record_key;
+        memcpy(&record_key, p, sizeof(record_key));
+        uint8_t record_type = p[8];
+        uint8_t severity = p[9];
+        uint8_t value_len = p[10];
+        uint8_t label_len = p[11];
+        const uint8_t* record_value = p + WATCHLIST_RECORD_HEADER;
+        p = record_value + value_len + label_len;
+        if (p > end || record_key > key) break;
+        if (record_key != key || record_type != type || value_len != length) continue;
+
+        // Keys are hashes: confirm the value itself
+        bool same = true;
+        for (size_t i = 0; i < length && same; i++) {
+            same = record_value[i] == lowerByte(value[i]);
+        }
+        if (!same) continue;
+
+        stats.hits++;
+        if (hit) {
+            hit->type = record_type;
+            hit->severity = severity;
+            hit->value = "";
+            hit->value.concat((const char*)record_value, value_len);
+            hit->label = "";
+            hit->label.concat((const char*)record_value + value_len, label_len);
+        }
+        return true;
+    }
+
+    return false;
+}
@@ -0,0 +1,513 @@
+#include "timeline_file.h"
+#include "esp_rom_crc.h"
+#include <algorithm>
+#include <stddef.h>
+#include <time.h>
+
+static const uint32_t MIN_BLOCK_SIZE = 512;
+static const uint32_t MAX_BLOCK_SIZE = 65536;
+static const uint32_t MAX_BLOCK_PAYLOAD = 16 * 1024 * 1024;    // Sanity bound for a block spanning several
+
+// Fields of a record after the timestamp, type, significance and reserved bytes
+static const TimelineField RECORD_FIELDS[] = {
+    TIMELINE_FIELD_DATETIME,
+    TIMELINE_FIELD_DESCRIPTION,
+    TIMELINE_FIELD_SOURCE,
+    TIMELINE_FIELD_ACTOR,
+    TIMELINE_FIELD_TARGET,
+    TIMELINE_FIELD_DETAILS
+};
+static const uint32_t RECORD_STRINGS_AT = 12;
+
+// Bytes a block takes on the card: its header, payload and, for an index, the trailer, block-aligned
+static uint32_t blockSpan(uint32_t used, bool with_trailer, uint32_t block_size) {
+    uint32_t bytes = sizeof(TimelineBlockHeader) + used + (with_trailer ? sizeof(TimelineFileTrailer) : 0);
+    return (bytes + block_size - 1) / block_size * block_size;
+}
+
+static uint32_t trailerChecksum(const TimelineFileTrailer& trailer) {
+    return esp_rom_crc32_le(0, (const uint8_t*)&trailer, offsetof(TimelineFileTrailer, checksum));
+}
+
+static uint32_t hashString(const char* text, uint32_t length) {
+    // FNV-1a
+    uint32_t hash = 2166136261UL;
+    for (uint32_t i = 0; i < length; i++) {
+        hash = (hash ^ (uint8_t)text[i]) * 16777619UL;
+    }
+    return hash;
+}
+
+// ===========================
+// Writer
+// ===========================
+
+TimelineFileWriter::TimelineFileWriter()
+    : block_size(TIMELINE_FILE_BLOCK_SIZE), end_offset(0), event_count(0), update_count(0), index_stale(false),
+      failed(false) {
+    events.reset();
+    updates.reset();
+}
+
+TimelineFileWriter::~TimelineFileWriter() {
+    close();
+}
+
+void TimelineFileWriter::BlockBuffer::reset() {
+    numbers.clear();
+    records.clear();
+    strings.assign(sizeof(uint32_t), 0);    // The empty string
+    string_slots.assign(256, 0);            // 0 is free: the empty string is never looked up
+    string_count = 0;
+    first_time = INT64_MAX;
+    last_time = INT64_MIN;
+}
+
+bool TimelineFileWriter::open(FRFDStorage& storage, const String& file_path) {
+    close();
+    path = file_path;
+    blocks.clear();
+    update_blocks.clear();
+    event_count = 0;
+    update_count = 0;
+    index_stale = true;
+    failed = false;
+    block_size = TIMELINE_FILE_BLOCK_SIZE;
+    events.reset();
+    updates.reset();
+
+    // An existing file is carried on from its index; anything else is left alone
+    uint32_t file_size = storage.fileExists(path) ? storage.getFileSize(path) : 0;
+    if (file_size > 0) {
+        TimelineFileReader reader;
+        if (!reader.open(storage.openFile(path, FILE_READ))) {
+            Serial.printf("[Timeline] %s is not a timeline file\n", path.c_str());
+            return false;
+        }
+        block_size = reader.getBlockSize();
+        blocks = reader.getBlocks();
+        update_blocks = reader.getUpdateBlocks();
+        event_count = reader.getEventCount();
+        for (const auto& entry : update_blocks) {
+            update_count += entry.event_count;
+        }
+        index_stale = reader.wasRecovered();
+        if (reader.wasRecovered()) {
+            Serial.printf("[Timeline] %s had no index, recovered %u events\n", path.c_str(), (unsigned)event_count);
+        }
+    }
+
+    file = storage.openFile(path, file_size > 0 ? FILE_APPEND : FILE_WRITE);
+    if (!file) {
+        Serial.printf("[Timeline] Cannot open %s for writing\n", path.c_str());
+        return false;
+    }
+
+    if (file_size == 0) {
+        TimelineFileHeader header;
+        header.magic = TIMELINE_FILE_MAGIC;
+        header.version = TIMELINE_FILE_VERSION;
+        header.header_size = sizeof(header);
+        header.block_size = block_size;
+        header.created = time(nullptr);
+        failed |= file.write((const uint8_t*)&header, sizeof(header)) != sizeof(header);
+        writePadding(block_size - sizeof(header));
+        end_offset = block_size;
+    } else {
+        // A torn last write leaves the file unaligned; new blocks start on the next boundary
+        end_offset = (file_size + block_size - 1) / block_size * block_size;
+        writePadding(end_offset - file_size);
+    }
+    return !failed;
+}
+
+void TimelineFileWriter::writePadding(uint32_t bytes) {
+    static const uint8_t zeros[64] = {0};
+    while (bytes > 0) {
+        uint32_t take = std::min(bytes, (uint32_t)sizeof(zeros));
+        failed |= file.write(zeros, take) != take;
+        bytes -= take;
+    }
+}
+
+uint32_t TimelineFileWriter::BlockBuffer::addString(const char* text, uint32_t length) {
+    if (length == 0) return 0;
+
+    size_t mask = string_slots.size() - 1;
+    size_t slot = hashString(text, length) & mask;
+    for (; string_slots[slot] != 0; slot = (slot + 1) & mask) {
+        uint32_t offset = string_slots[slot];
+        uint32_t stored;
+        memcpy(&stored, &strings[offset], sizeof(stored));
+        if (stored == length && memcmp(&strings[offset + sizeof(stored)], text, length) == 0) {
+            return offset;
+        }
+    }
+
+    uint32_t offset = strings.size();
+    strings.resize(offset + sizeof(length) + length);
+    memcpy(&strings[offset], &length, sizeof(length));
+    memcpy(&strings[offset + sizeof(length)], text, length);
+    string_slots[slot] = offset;
+    string_count++;
+
+    // Keep the load factor under 3/4
+    if (string_count * 4 > string_slots.size() * 3) {
+        std::vector<uint32_t> grown(string_slots.size() * 2, 0);
+        mask = grown.size() - 1;
+        for (uint32_t stored : string_slots) {
+            if (stored == 0) continue;
+            uint32_t stored_length;
+            memcpy(&stored_length, &strings[stored], sizeof(stored_length));
+            size_t to = hashString((const char*)&strings[stored + sizeof(stored_length)], stored_length) & mask;
+            while (grown[to] != 0) to = (to + 1) & mask;
+            grown[to] = stored;
+        }
+        string_slots.swap(grown);
+    }
+    return offset;
+}
+
+bool TimelineFileWriter::append(const TimelineStore& store, uint32_t index) {
+    if (!addRecord(events, TIMELINE_BLOCK_EVENTS, store, index)) return false;
+    event_count++;
+    return true;
+}
+
+bool TimelineFileWriter::update(const TimelineStore& store, uint32_t index, uint32_t event) {
+    if (event >= event_count || !addRecord(updates, TIMELINE_BLOCK_UPDATES, store, index)) return false;
+    updates.numbers.insert(updates.numbers.end(), (const uint8_t*)&event, (const uint8_t*)&event + sizeof(event));
+    update_count++;
+    return true;
+}
+
+bool TimelineFileWriter::addRecord(BlockBuffer& buffer, TimelineBlockKind kind, const TimelineStore& store, uint32_t index) {
+    if (!file || failed) return false;
+
+    // Start a new block unless the event fits, its strings counted as new; a lone event may overflow one
+    uint32_t needed = TIMELINE_FILE_RECORD_SIZE + (kind == TIMELINE_BLOCK_UPDATES ? sizeof(uint32_t) : 0);
+    for (TimelineField field : RECORD_FIELDS) {
+        needed += sizeof(uint32_t) + store.getTextLength(field, index);
+    }
+    size_t used = buffer.numbers.size() + buffer.records.size() + buffer.strings.size();
+    if (!buffer.records.empty() && sizeof(TimelineBlockHeader) + used + needed > block_size) {
+        if (!flushBlock(buffer, kind)) return false;
+    }
+
+    uint8_t record[TIMELINE_FILE_RECORD_SIZE] = {0};
+    int64_t timestamp = store.getTimestamp(index);
+    memcpy(record, &timestamp, sizeof(timestamp));
+    record[8] = store.getType(index);
+    record[9] = store.getSignificance(index);
+    for (size_t f = 0; f < 6; f++) {
+        uint32_t offset = buffer.addString(store.getText(RECORD_FIELDS[f], index),
+                                           store.getTextLength(RECORD_FIELDS[f], index));
+        memcpy(record + RECORD_STRINGS_AT + f * sizeof(uint32_t), &offset, sizeof(offset));
+    }
+    buffer.records.insert(buffer.records.end(), record, record + sizeof(record));
+
+    buffer.first_time = std::min(buffer.first_time, timestamp);
+    buffer.last_time = std::max(buffer.last_time, timestamp);
+    return true;
+}
+
+bool TimelineFileWriter::writeBlock(TimelineBlockKind kind, uint32_t record_count, int64_t first, int64_t last,
+                                    const uint8_t* head, uint32_t head_bytes, const uint8_t* tail, uint32_t tail_bytes) {
+    TimelineBlockHeader header;
+    memset(&header, 0, sizeof(header));
+    header.kind = kind;
+    header.record_count = record_count;
+    header.used = head_bytes + tail_bytes;
+    header.checksum = esp_rom_crc32_le(esp_rom_crc32_le(0, head, head_bytes), tail, tail_bytes);
+    header.first_time = first;
+    header.last_time = last;
+
+    bool index = kind == TIMELINE_BLOCK_INDEX;
+    uint32_t span = blockSpan(header.used, index, block_size);
+    failed |= file.write((const uint8_t*)&header, sizeof(header)) != sizeof(header);
+    failed |= head_bytes > 0 && file.write(head, head_bytes) != head_bytes;
+    failed |= tail_bytes > 0 && file.write(tail, tail_bytes) != tail_bytes;
+    writePadding(span - sizeof(header) - header.used - (index ? sizeof(TimelineFileTrailer) : 0));
+
+    if (index) {
+        TimelineFileTrailer trailer;
+        trailer.magic = TIMELINE_FILE_TRAILER_MAGIC;
+        trailer.index_offset = end_offset;
+        trailer.event_count = event_count;
+        trailer.checksum = trailerChecksum(trailer);
+        failed |= file.write((const uint8_t*)&trailer, sizeof(trailer)) != sizeof(trailer);
+    }
+
+    end_offset += span;
+    return !failed;
+}
+
+bool TimelineFileWriter::flushBlock(BlockBuffer& buffer, TimelineBlockKind kind) {
+    if (buffer.records.empty()) return !failed;
+
+    TimelineIndexEntry entry;
+    entry.offset = end_offset;
+    entry.event_count = buffer.records.size() / TIMELINE_FILE_RECORD_SIZE;
+    entry.first_time = buffer.first_time;
+    entry.last_time = buffer.last_time;
+
+    // An update block's event numbers go before its records
+    std::vector<uint8_t>& head = kind == TIMELINE_BLOCK_UPDATES ? buffer.numbers : buffer.records;
+    if (kind == TIMELINE_BLOCK_UPDATES) {
+        head.insert(head.end(), buffer.records.begin(), buffer.records.end());
+    }
+    if (!writeBlock(kind, entry.event_count, entry.first_time, entry.last_time,
+                    head.data(), head.size(), buffer.strings.data(), buffer.strings.size())) {
+        Serial.printf("[Timeline] Write to %s failed\n", path.c_str());
+        return false;
+    }
+    (kind == TIMELINE_BLOCK_UPDATES ? update_blocks : blocks).push_back(entry);
+    index_stale = true;
+    buffer.reset();
+    return true;
+}
+
+bool TimelineFileWriter::save() {
+    if (!file || failed || !flushBlock(events, TIMELINE_BLOCK_EVENTS) || !flushBlock(updates, TIMELINE_BLOCK_UPDATES)) {
+        return false;
+    }
+    if (!index_stale) return true;      // The last index still lists every block
+
+    TimelineIndexHeader index_header;
+    index_header.event_count = event_count;
+    index_header.update_blocks = update_blocks.size();
+
+    int64_t first = INT64_MAX;
+    int64_t last = INT64_MIN;
+    for (const auto& entry : blocks) {
+        first = std::min(first, entry.first_time);
+        last = std::max(last, entry.last_time);
+    }
+    std::vector<TimelineIndexEntry> entries(blocks);
+    entries.insert(entries.end(), update_blocks.begin(), update_blocks.end());
+    if (!writeBlock(TIMELINE_BLOCK_INDEX, entries.size(), first, last,
+                    (const uint8_t*)&index_header, sizeof(index_header),
+                    (const uint8_t*)entries.data(), entries.size() * sizeof(TimelineIndexEntry))) {
+        Serial.printf("[Timeline] Write to %s failed\n", path.c_str());
+        return false;
+    }
+    index_stale = false;
+    file.flush();
+    return true;
+}
+
+void TimelineFileWriter::close() {
+    if (file) {
+        save();
+        file.close();
+    }
+    file = File();
+}
+
+// ===========================
+// Reader
+// ===========================
+
+TimelineFileReader::TimelineFileReader()
+    : event_count(0), end_offset(0), recovered(false), loaded_offset(0), block_records(0), records_at(0), blocks_read(0),
+      bad_blocks(0) {
+    memset(&header, 0, sizeof(header));
+}
+
+TimelineFileReader::~TimelineFileReader() {
+    close();
+}
+
+void TimelineFileReader::close() {
+    if (file) file.close();
+    file = File();
+    blocks.clear();
+    update_blocks.clear();
+    std::vector<uint8_t>().swap(block);
+    memset(&header, 0, sizeof(header));
+    event_count = 0;
+    end_offset = 0;
+    recovered = false;
+    loaded_offset = 0;
+    block_records = 0;
+    records_at = 0;
+}
+
+bool TimelineFileReader::readAt(uint32_t offset, void* data, size_t length) {
+    return file.seek(offset) && file.read((uint8_t*)data, length) == length;
+}
+
+bool TimelineFileReader::open(File opened) {
+    close();
+    file = opened;
+    if (!file) return false;
+
+    if (!readAt(0, &header, sizeof(header)) ||
+        header.magic != TIMELINE_FILE_MAGIC || header.version < 1 || header.version > TIMELINE_FILE_VERSION ||
+        header.header_size < sizeof(header) || header.block_size < MIN_BLOCK_SIZE ||
+        header.block_size > MAX_BLOCK_SIZE) {
+        close();
+        return false;
+    }
+
+    // A cleanly saved file ends with a trailer naming its index
+    uint32_t file_size = file.size();
+    TimelineFileTrailer trailer;
+    if (file_size >= 2 * header.block_size && file_size % header.block_size == 0 &&
+        readAt(file_size - sizeof(trailer), &trailer, sizeof(trailer)) &&
+        trailer.magic == TIMELINE_FILE_TRAILER_MAGIC && trailer.checksum == trailerChecksum(trailer) &&
+        readIndex(trailer.index_offset)) {
+        end_offset = file_size;
+        return true;
+    }
+
+    recovered = true;
+    return scanBlocks();
+}
+
+bool TimelineFileReader::readIndex(uint32_t offset) {
+    // Sizes from the file are checked in 64 bits, so a huge record count cannot wrap around
+    TimelineBlockHeader block_header;
+    if (!readAt(offset, &block_header, sizeof(block_header)) ||
+        block_header.kind != TIMELINE_BLOCK_INDEX ||
+        block_header.used > MAX_BLOCK_PAYLOAD ||
+        block_header.record_count > block_header.used / sizeof(TimelineIndexEntry) ||
+        block_header.used != sizeof(TimelineIndexHeader) +
+                             (uint64_t)block_header.record_count * sizeof(TimelineIndexEntry)) {
+        return false;
+    }
+
+    std::vector<uint8_t> payload(block_header.used);
+    if (file.read(payload.data(), payload.size()) != payload.size() ||
+        esp_rom_crc32_le(0, payload.data(), payload.size()) != block_header.checksum) {
+        return false;
+    }
+
+    TimelineIndexHeader index_header;
+    memcpy(&index_header, payload.data(), sizeof(index_header));
+    if (index_header.update_blocks > block_header.record_count) return false;
+
+    // Event blocks, then update blocks
+    const TimelineIndexEntry* entries = (const TimelineIndexEntry*)(payload.data() + sizeof(index_header));
+    uint32_t event_blocks = block_header.record_count - index_header.update_blocks;
+    blocks.assign(entries, entries + event_blocks);
+    update_blocks.assign(entries + event_blocks, entries + block_header.record_count);
+    event_count = index_header.event_count;
+    return true;
+}
+
+bool TimelineFileReader::scanBlocks() {
+    // Walk block by block, keeping every event block whose checksum holds
+    uint32_t file_size = file.size();
+    uint32_t offset = header.block_size;
+    std::vector<uint8_t> payload;
+    blocks.clear();
+    update_blocks.clear();
+    event_count = 0;
+    end_offset = offset;
+
+    while (offset + sizeof(TimelineBlockHeader) <= file_size) {
+        TimelineBlockHeader block_header;
+        bool known = readAt(offset, &block_header, sizeof(block_header)) &&
+                     block_header.kind >= TIMELINE_BLOCK_EVENTS && block_header.kind <= TIMELINE_BLOCK_UPDATES &&
+                     block_header.used <= MAX_BLOCK_PAYLOAD &&
+                     offset + sizeof(block_header) + block_header.used <= file_size;
+        if (known) {
+            payload.resize(block_header.used);
+            known = file.read(payload.data(), payload.size()) == payload.size() &&
+                    esp_rom_crc32_le(0, payload.data(), payload.size()) == block_header.checksum;
+        }
+        if (!known) {
+            offset += header.block_size;
+            continue;
+        }
+
+        TimelineIndexEntry entry = {offset, block_header.record_count, block_header.first_time, block_header.last_time};
+        if (block_header.kind == TIMELINE_BLOCK_EVENTS) {
+            blocks.push_back(entry);
+            event_count += block_header.record_count;
+        } else if (block_header.kind == TIMELINE_BLOCK_UPDATES) {
+            update_blocks.push_back(entry);
+        }
+        offset += blockSpan(block_header.used, block_header.kind == TIMELINE_BLOCK_INDEX, header.block_size);
+        end_offset = offset;
+    }
+    return true;
+}
+
+bool TimelineFileReader::loadBlock(const TimelineIndexEntry& entry, TimelineBlockKind kind) {
+    if (loaded_offset == entry.offset) return true;
+    loaded_offset = 0;
+
+    // Update records are preceded by their event numbers. Checked in 64 bits, as in readIndex
+    uint32_t record_size = TIMELINE_FILE_RECORD_SIZE + (kind == TIMELINE_BLOCK_UPDATES ? sizeof(uint32_t) : 0);
+    TimelineBlockHeader block_header;
+    bool valid = readAt(entry.offset, &block_header, sizeof(block_header)) &&
+                 block_header.kind == kind &&
+                 block_header.record_count == entry.event_count &&
+                 block_header.used <= MAX_BLOCK_PAYLOAD &&
+                 entry.event_count <= block_header.used / record_size &&
+                 block_header.used >= (uint64_t)entry.event_count * record_size + sizeof(uint32_t);
+    if (valid) {
+        block.resize(block_header.used);
+        valid = file.read(block.data(), block.size()) == block.size() &&
+                esp_rom_crc32_le(0, block.data(), block.size()) == block_header.checksum;
+    }
+    blocks_read++;
+
+    if (!valid) {
+        Serial.printf("[Timeline] Bad %s block at offset %u\n", kind == TIMELINE_BLOCK_UPDATES ? "update" : "event",
+                      (unsigned)entry.offset);
+        bad_blocks++;
+        return false;
+    }
+    loaded_offset = entry.offset;
+    block_records = entry.event_count;
+    records_at = kind == TIMELINE_BLOCK_UPDATES ? entry.event_count * sizeof(uint32_t) : 0;
+    return true;
+}
+
+void TimelineFileReader::loadUpdates(int64_t start, int64_t end) {
+    updates.clear();
+    TimelineEvent event;
+    for (const auto& entry : update_blocks) {
+        if (entry.last_time < start || entry.first_time > end) continue;
+        if (!loadBlock(entry, TIMELINE_BLOCK_UPDATES)) continue;
+        for (uint32_t r = 0; r < block_records; r++) {
+            if (!decodeEvent(r, start, end, event)) continue;
+            uint32_t number;
+            memcpy(&number, &block[r * sizeof(uint32_t)], sizeof(number));
+            updates[number] = event;     // Later blocks, and later records, win
+        }
+    }
+}
+
+bool TimelineFileReader::readString(uint32_t offset, String& value) const {
+    size_t table = records_at + (size_t)block_records * TIMELINE_FILE_RECORD_SIZE;
+    uint32_t length;
+    if (offset > block.size() - table - sizeof(length)) return false;
+    memcpy(&length, &block[table + offset], sizeof(length));
+    if (length > block.size() - table - offset - sizeof(length)) return false;
+
+    value = "";
+    value.concat((const char*)&block[table + offset + sizeof(length)], length);
+    return true;
+}
+
+bool TimelineFileReader::decodeEvent(uint32_t record, int64_t start, int64_t end, TimelineEvent& event) const {
+    const uint8_t* data = &block[records_at + (size_t)record * TIMELINE_FILE_RECORD_SIZE];
+    memcpy(&event.timestamp, data, sizeof(event.timestamp));
+    if (event.timestamp < start || event.timestamp > end) return false;
+
+    event.type = (TimelineEventType)std::min<uint8_t>(data[8], EVENT_UNKNOWN);
+    event.significance = data[9];
+
+    String* fields[] = {&event.datetime, &event.description, &event.source_artifact,
+                        &event.actor, &event.target, &event.details};
+    for (size_t f = 0; f < 6; f++) {
+        uint32_t offset;
+        memcpy(&offset, data + RECORD_STRINGS_AT + f * sizeof(offset), sizeof(offset));
+        if (!readString(offset, *fields[f])) return false;
+    }
+    return true;
+}
@@ -1,476 +1,815 @@
 #include "timeline_generator.h"
-
-TimelineGenerator::TimelineGenerator() {
+#include "esp_heap_caps.h"
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <sys/time.h>
+#ifdef ESP_PLATFORM
+#include "esp_pthread.h"
+#endif
+
+TimelineGenerator::TimelineGenerator() : index(store) {
     storage = nullptr;
+    sort_memory_budget = TIMELINE_SORT_MEMORY_BUDGET;
+    spilled_events = 0;
+    next_run_id = 0;
+    spill_failed = false;
+    deduplicate = true;
+    duplicates_merged = 0;
+    parse_workers = 0;
+    file_persisted = 0;
+    resetStatistics();
 }
 
 TimelineGenerator::~TimelineGenerator() {
+    closeTimelineFile();
+    endExternalSort();
 }
 
 void TimelineGenerator::begin(FRFDStorage* storage_ptr) {
     storage = storage_ptr;
+
+    // Syslog years are inferred relative to now once the clock has been set
+    int64_t now = currentTimestamp();
+    if (now > 946684800LL * TIMESTAMP_MICROS_PER_SECOND) {
+        timestamp_parser.setReferenceTime(now);
+    }
 }
 
-bool TimelineGenerator::buildTimelineFromFile(const String& file_path) {
-    if (!storage || !storage->fileExists(file_path)) {
-        return false;
+// ===========================
+// Artifact Format Registry
+// ===========================
+
+typedef uint32_t (*TimelineArtifactParser)(CSVReader& reader, const String& source, TimelineEventSink& sink);
+
+struct TimelineArtifactEntry {
+    TimelineArtifactFormat format;
+    const char* name;
+    TimelineArtifactParser parse;
+    const char* columns[5];     // Header columns, all required; case-insensitive
+    const char* markers[5];     // Any one of them in the head of the file; case-insensitive
+    const char* file_names[4];  // Any one of them in the lowercased file name
+};
+
+// Ties go to the earlier entry
+static const TimelineArtifactEntry ARTIFACT_FORMATS[] = {
+    {ARTIFACT_MFT, "mft", TimelineGenerator::parseMFTTimeline,
+     {"filename", "created", "modified", "accessed"}, {}, {"mft"}},
+    {ARTIFACT_USN_JOURNAL, "usn_journal", TimelineGenerator::parseUSNJournal,
+     {"timestamp", "filename", "reason"}, {"usn_reason"}, {"usn", "journal", "$j"}},
+    {ARTIFACT_PREFETCH, "prefetch", TimelineGenerator::parsePrefetchTimeline,
+     {"filename", "lastexecuted"}, {}, {"prefetch"}},
+    {ARTIFACT_EVENT_LOG, "event_log", TimelineGenerator::parseEventLogTimeline,
+     {"timecreated", "id", "message"}, {}, {"evtx", "eventlog", "event"}},
+    {ARTIFACT_REGISTRY, "registry", TimelineGenerator::parseRegistryTimeline,
+     {}, {"windows registry editor", "[hkey_", "hklm\\", "hkcu\\"}, {"registry", ".reg"}},
+    {ARTIFACT_BROWSER_HISTORY, "browser_history", TimelineGenerator::parseBrowserHistory,
+     {"url", "title"}, {}, {"browser", "history"}},
+    {ARTIFACT_NETWORK, "network", TimelineGenerator::parseNetworkConnections,
+     {"remoteaddress"}, {}, {"network", "connection", "netstat"}},
+    {ARTIFACT_AUTH_LOG, "auth_log", TimelineGenerator::parseAuthLogs,
+     {}, {"sshd[", "pam_unix(", "accepted password", "failed password", "authentication failure"},
+     {"auth", "login", "secure"}},
+    {ARTIFACT_PROCESS_LIST, "process_list", TimelineGenerator::parseProcessList,
+     {"processname", "pid"}, {}, {"process"}},
+    {ARTIFACT_SHIMCACHE, "shimcache", TimelineGenerator::parseShimCache,
+     {"cacheentryposition"}, {}, {"shimcache", "appcompat"}},
+    {ARTIFACT_AMCACHE, "amcache", TimelineGenerator::parseAmCache,
+     {"programid"}, {}, {"amcache"}},
+    {ARTIFACT_JUMPLIST, "jumplist", TimelineGenerator::parseJumpLists,
+     {"appid"}, {}, {"jumplist", "destinations-ms"}},
+};
+
+static const size_t ARTIFACT_FORMAT_COUNT = sizeof(ARTIFACT_FORMATS) / sizeof(ARTIFACT_FORMATS[0]);
+
+static bool headContains(const char* head, size_t length, const char* text) {
+    size_t text_length = strlen(text);
+    for (size_t i = 0; i + text_length <= length; i++) {
+        if (strncasecmp(head + i, text, text_length) == 0) return true;
     }
+    return false;
+}
 
-    String content = storage->readFile(file_path);
-    if (content.isEmpty()) {
-        return false;
+static bool headerHasColumn(const char* line, size_t length, const char* column) {
+    size_t column_length = strlen(column);
+    size_t start = 0;
+    while (start < length) {
+        size_t end = start;
+        while (end < length && line[end] != ',' && line[end] != '\t' && line[end] != ';') end++;
+
+        // Trim blanks and quotes around the name
+        size_t first = start, last = end;
+        while (first < last && (line[first] == ' ' || line[first] == '"')) first++;
+        while (last > first && (line[last - 1] == ' ' || line[last - 1] == '"' || line[last - 1] == '\r')) last--;
+        if (last - first == column_length && strncasecmp(line + first, column, column_length) == 0) return true;
+
+        start = end + 1;
     }
+    return false;
+}
 
-    // Detect file type and parse accordingly
-    String filename = file_path.substring(file_path.lastIndexOf('/') + 1);
-    filename.toLowerCase();
-
-    std::vector<TimelineEvent> parsed_events;
-
-    // Parse based on filename patterns
-    if (filename.indexOf("mft") >= 0) {
-        parsed_events = parseMFTTimeline(content, file_path);
-    } else if (filename.indexOf("usn") >= 0 || filename.indexOf("journal") >= 0) {
-        parsed_events = parseUSNJournal(content, file_path);
-    } else if (filename.indexOf("prefetch") >= 0) {
-        parsed_events = parsePrefetchTimeline(content, file_path);
-    } else if (filename.indexOf("event") >= 0 || filename.indexOf("log") >= 0) {
-        parsed_events = parseEventLogTimeline(content, file_path);
-    } else if (filename.indexOf("registry") >= 0 || filename.indexOf("reg") >= 0) {
-        parsed_events = parseRegistryTimeline(content, file_path);
-    } else if (filename.indexOf("browser") >= 0 || filename.indexOf("history") >= 0) {
-        parsed_events = parseBrowserHistory(content, file_path);
-    } else if (filename.indexOf("network") >= 0 || filename.indexOf("connection") >= 0) {
-        parsed_events = parseNetworkConnections(content, file_path);
-    } else if (filename.indexOf("auth") >= 0 || filename.indexOf("login") >= 0) {
-        parsed_events = parseAuthLogs(content, file_path);
-    } else if (filename.indexOf("process") >= 0) {
-        parsed_events = parseProcessList(content, file_path);
-    } else if (filename.indexOf("shimcache") >= 0) {
-        parsed_events = parseShimCache(content, file_path);
-    } else if (filename.indexOf("amcache") >= 0) {
-        parsed_events = parseAmCache(content, file_path);
-    } else if (filename.indexOf("jumplist") >= 0) {
-        parsed_events = parseJumpLists(content, file_path);
-    } else {
-        // Generic CSV parsing
-        if (isCSVFile(filename)) {
-            parsed_events = parseEventLogTimeline(content, file_path);
+TimelineArtifactFormat TimelineGenerator::detectArtifactFormat(const char* head, size_t length, const String& file_name) {
+    // Skip a UTF-8 byte order mark; the header row is the first line
+    if (length >= 3 && memcmp(head, "\xEF\xBB\xBF", 3) == 0) {
+        head += 3;
+        length -= 3;
+    }
+    const char* line_end = (const char*)memchr(head, '\n', length);
+    size_t line_length = line_end ? line_end - head : length;
+
+    String name = file_name;
+    name.toLowerCase();
+
+    TimelineArtifactFormat best = ARTIFACT_UNKNOWN;
+    int best_score = 0;
+    for (size_t f = 0; f < ARTIFACT_FORMAT_COUNT; f++) {
+        const TimelineArtifactEntry& entry = ARTIFACT_FORMATS[f];
+        int score = 0;
+
+        // All header columns: 4, and 1 more per column so the more specific signature wins
+        int columns = 0;
+        while (columns < 5 && entry.columns[columns] && headerHasColumn(head, line_length, entry.columns[columns])) columns++;
+        if (columns > 0 && (columns == 5 || !entry.columns[columns])) score += 4 + columns;
+
+        for (int m = 0; m < 5 && entry.markers[m]; m++) {
+            if (headContains(head, length, entry.markers[m])) {
+                score += 3;
+                break;
+            }
+        }
+
+        for (int n = 0; n < 4 && entry.file_names[n]; n++) {
+            if (name.indexOf(entry.file_names[n]) >= 0) {
+                score += 1;
+                break;
+            }
+        }
+
+        if (score > best_score) {
+            best = entry.format;
+            best_score = score;
         }
     }
 
-    // Add all parsed events
-    for (const auto& event : parsed_events) {
-        addEvent(event);
+    // Generic CSV parsing
+    if (best == ARTIFACT_UNKNOWN && isCSVFile(name)) {
+        best = ARTIFACT_EVENT_LOG;
     }
+    return best;
+}
 
-    return parsed_events.size() > 0;
+const char* TimelineGenerator::getArtifactFormatName(TimelineArtifactFormat format) {
+    for (size_t f = 0; f < ARTIFACT_FORMAT_COUNT; f++) {
+        if (ARTIFACT_FORMATS[f].format == format) return ARTIFACT_FORMATS[f].name;
+    }
+    return "unknown";
 }
 
-bool TimelineGenerator::buildTimelineFromDirectory(const String& dir_path) {
-    if (!storage) return false;
+uint32_t TimelineGenerator::parseArtifact(TimelineArtifactFormat format, CSVReader& reader, const String& source,
+                                          TimelineEventSink& sink) {
+    for (size_t f = 0; f < ARTIFACT_FORMAT_COUNT; f++) {
+        if (ARTIFACT_FORMATS[f].format == format) return ARTIFACT_FORMATS[f].parse(reader, source, sink);
+    }
+    return 0;
+}
 
-    std::vector<String> files = storage->getFileList(dir_path);
-    int files_processed = 0;
+// ===========================
+// Parallel Parsing
+// ===========================
+//
+// Worker threads take the files in list order and parse each into batches of
+// up to TIMELINE_PARSE_BATCH_EVENTS. The calling thread adds the batches to
+// the timeline in file order and each batch in row order, exactly as a
+// sequential build adds them. The result does not depend on which worker
+// finishes first or on the batch size, and dedup, the index, spills and the
+// timeline file all stay on one thread. Each worker recycles
+// TIMELINE_PARSE_QUEUE_DEPTH batches, which bounds how far parsing runs
+// ahead of the merge.
+//
+// Interning into the timeline's string pool is most of the cost of an event
+// and stays on the calling thread, so a batch is raw text and costs the
+// workers no hashing: what runs in parallel is reading and parsing.
+
+struct TimelineParseBatch {
+    struct Record {
+        int64_t timestamp;
+        uint32_t text_end[TIMELINE_FIELD_COUNT];    // Each field ends where the next starts
+        uint8_t type;
+        uint8_t significance;
+    };
+
+    std::vector<Record> records;
+    std::vector<char> text;         // Fields of every record, back to back
+    uint32_t file;                  // Position in the file list
+    bool last;                      // The file's final batch
+
+    // An event's strings in TimelineField order
+    static void fieldsOf(const TimelineEvent& event, const String* fields[TIMELINE_FIELD_COUNT]) {
+        fields[TIMELINE_FIELD_DATETIME] = &event.datetime;
+        fields[TIMELINE_FIELD_DESCRIPTION] = &event.description;
+        fields[TIMELINE_FIELD_SOURCE] = &event.source_artifact;
+        fields[TIMELINE_FIELD_ACTOR] = &event.actor;
+        fields[TIMELINE_FIELD_TARGET] = &event.target;
+        fields[TIMELINE_FIELD_DETAILS] = &event.details;
+    }
 
-    for (const auto& file : files) {
-        String full_path = dir_path + "/" + file;
-        if (buildTimelineFromFile(full_path)) {
-            files_processed++;
+    static void fieldsOf(TimelineEvent& event, String* fields[TIMELINE_FIELD_COUNT]) {
+        fields[TIMELINE_FIELD_DATETIME] = &event.datetime;
+        fields[TIMELINE_FIELD_DESCRIPTION] = &event.description;
+        fields[TIMELINE_FIELD_SOURCE] = &event.source_artifact;
+        fields[TIMELINE_FIELD_ACTOR] = &event.actor;
+        fields[TIMELINE_FIELD_TARGET] = &event.target;
+        fields[TIMELINE_FIELD_DETAILS] = &event.details;
+    }
+
+    void add(const TimelineEvent& event) {
+        Record record;
+        record.timestamp = event.timestamp;
+        record.type = event.type;
+        record.significance = event.significance;
+        const String* fields[TIMELINE_FIELD_COUNT];
+        fieldsOf(event, fields);
+        for (int f = 0; f < TIMELINE_FIELD_COUNT; f++) {
+            text.insert(text.end(), fields[f]->c_str(), fields[f]->c_str() + fields[f]->length());
+            record.text_end[f] = text.size();
         }
+        records.push_back(record);
     }
 
-    return files_processed > 0;
+    void get(uint32_t index, TimelineEvent& event) const {     // Reuses event's buffers
+        const Record& record = records[index];
+        event.timestamp = record.timestamp;
+        event.type = (TimelineEventType)record.type;
+        event.significance = record.significance;
+        String* fields[TIMELINE_FIELD_COUNT];
+        fieldsOf(event, fields);
+        uint32_t start = index > 0 ? records[index - 1].text_end[TIMELINE_FIELD_COUNT - 1] : 0;
+        for (int f = 0; f < TIMELINE_FIELD_COUNT; f++) {
+            *fields[f] = "";
+            fields[f]->concat(text.data() + start, record.text_end[f] - start);
+            start = record.text_end[f];
+        }
+    }
+
+    void clear() {      // Keeps the capacity for the next batch
+        records.clear();
+        text.clear();
+    }
+};
+
+class TimelineParsePipeline {
+public:
+    TimelineParsePipeline(FRFDStorage& storage, const std::vector<String>& paths,
+                          const TimestampParser& timestamps, uint32_t worker_count);
+
+    uint32_t run(TimelineGenerator& generator);     // Files that added events
+
+private:
+    static const uint32_t NO_WORKER = 0xFFFFFFFF;
+
+    struct Worker {
+        std::thread thread;
+        std::deque<TimelineParseBatch*> ready;      // Handed over, in file order
+        std::vector<TimelineParseBatch*> spare;
+        std::vector<std::unique_ptr<TimelineParseBatch>> batches;
+    };
+
+    // Fills batches on a worker thread
+    class BatchSink : public TimelineEventSink {
+    public:
+        BatchSink(TimelineParsePipeline& pipeline, uint32_t worker, TimestampParser& timestamps)
+            : TimelineEventSink(timestamps), pipeline(pipeline), worker(worker), batch(nullptr), file(0) {}
+        void begin(uint32_t file_number);
+        void add(const TimelineEvent& event) override;
+        void finish();
+
+    private:
+        TimelineParsePipeline& pipeline;
+        uint32_t worker;
+        TimelineParseBatch* batch;
+        uint32_t file;
+    };
+
+    FRFDStorage& storage;
+    const std::vector<String>& paths;
+    const TimestampParser& timestamps;
+    std::vector<Worker> workers;
+    std::vector<uint32_t> file_worker;      // Worker that took each file, or NO_WORKER
+    uint32_t next_file;
+
+    std::mutex mutex;
+    std::condition_variable changed;
+
+    void work(uint32_t worker);
+    TimelineParseBatch* takeSpare(uint32_t worker);
+    void handOver(uint32_t worker, TimelineParseBatch* batch, bool last);
+};
+
+const uint32_t TimelineParsePipeline::NO_WORKER;
+
+TimelineParsePipeline::TimelineParsePipeline(FRFDStorage& storage, const std::vector<String>& paths,
+                                             const TimestampParser& timestamps, uint32_t worker_count)
+    : storage(storage), paths(paths), timestamps(timestamps), workers(worker_count),
+      file_worker(paths.size(), NO_WORKER), next_file(0) {
+    for (auto& worker : workers) {
+        for (int b = 0; b < TIMELINE_PARSE_QUEUE_DEPTH; b++) {
+            worker.batches.emplace_back(new TimelineParseBatch());
+            worker.spare.push_back(worker.batches.back().get());
+        }
+    }
 }
 
-bool TimelineGenerator::buildTimelineFromAllArtifacts() {
-    if (!storage) return false;
+void TimelineParsePipeline::BatchSink::begin(uint32_t file_number) {
+    file = file_number;
+    batch = pipeline.takeSpare(worker);
+    batch->file = file;
+}
 
-    String case_dir = storage->getCaseDirectory();
-    if (case_dir.isEmpty()) return false;
+void TimelineParsePipeline::BatchSink::add(const TimelineEvent& event) {
+    batch->add(event);
+    if (batch->records.size() >= TIMELINE_PARSE_BATCH_EVENTS) {
+        pipeline.handOver(worker, batch, false);
+        begin(file);
+    }
+}
 
-    return buildTimelineFromDirectory(case_dir);
+void TimelineParsePipeline::BatchSink::finish() {
+    pipeline.handOver(worker, batch, true);
+    batch = nullptr;
+}
+
+TimelineParseBatch* TimelineParsePipeline::takeSpare(uint32_t worker) {
+    std::unique_lock<std::mutex> lock(mutex);
+    changed.wait(lock, [&] { return !workers[worker].spare.empty(); });
+    TimelineParseBatch* batch = workers[worker].spare.back();
+    workers[worker].spare.pop_back();
+    return batch;
 }
 
-std::vector<TimelineEvent> TimelineGenerator::parseMFTTimeline(const String& content, const String& source) {
-    std::vector<TimelineEvent> timeline_events;
+void TimelineParsePipeline::handOver(uint32_t worker, TimelineParseBatch* batch, bool last) {
+    batch->last = last;
 
-    // Parse MFT CSV format
-    // Expected columns: Filename, Created, Modified, Accessed, Changed
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        workers[worker].ready.push_back(batch);
+    }
+    changed.notify_all();
+}
 
-    std::vector<String> lines;
-    int start = 0;
-    int end = content.indexOf('\n');
+void TimelineParsePipeline::work(uint32_t worker) {
+    TimestampParser own_timestamps = timestamps;    // Own day cache
+    BatchSink sink(*this, worker, own_timestamps);
+
+    while (true) {
+        uint32_t file;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (next_file >= paths.size()) break;
+            file = next_file++;
+            file_worker[file] = worker;
+        }
 
-    while (end >= 0) {
-        String line = content.substring(start, end);
-        lines.push_back(line);
-        start = end + 1;
-        end = content.indexOf('\n', start);
-    }
-
-    // Skip header if present
-    int start_line = lines.size() > 0 && lines[0].indexOf("Filename") >= 0 ? 1 : 0;
-
-    for (size_t i = start_line; i < lines.size(); i++) {
-        std::vector<String> fields = parseCSVLine(lines[i]);
-
-        if (fields.size() >= 5) {
-            String filename = fields[0];
-            String created = fields[1];
-            String modified = fields[2];
-            String accessed = fields[3];
-
-            // Create event for file creation
-            if (!created.isEmpty() && created != "N/A") {
-                TimelineEvent event;
-                event.timestamp = parseTimestamp(created);
-                event.datetime = created;
-                event.type = EVENT_FILE_CREATED;
-                event.description = "File created";
-                event.source_artifact = source;
-                event.target = filename;
-                event.significance = 5;
-                timeline_events.push_back(event);
+        sink.begin(file);
+        TimelineGenerator::parseArtifactFile(storage, paths[file], sink);
+        sink.finish();
+    }
+}
+
+uint32_t TimelineParsePipeline::run(TimelineGenerator& generator) {
+#ifdef ESP_PLATFORM
+    // std::thread runs on a pthread task: give it room for the parsers, one worker per core
+    esp_pthread_cfg_t previous = esp_pthread_get_default_config();
+    esp_pthread_get_cfg(&previous);
+#endif
+    for (uint32_t w = 0; w < workers.size(); w++) {
+#ifdef ESP_PLATFORM
+        esp_pthread_cfg_t config = esp_pthread_get_default_config();
+        config.stack_size = TIMELINE_PARSE_STACK_SIZE;
+        config.pin_to_core = w % portNUM_PROCESSORS;
+        config.thread_name = "timeline_parse";
+        esp_pthread_set_cfg(&config);
+#endif
+        workers[w].thread = std::thread(&TimelineParsePipeline::work, this, w);
+    }
+#ifdef ESP_PLATFORM
+    esp_pthread_set_cfg(&previous);
+#endif
+
+    TimelineEvent event;
+    uint32_t files_processed = 0;
+    for (uint32_t file = 0; file < paths.size(); file++) {
+        uint32_t added = 0;
+        bool last = false;
+        while (!last) {
+            // Workers take files in order, so the current file's batches head its worker's queue
+            uint32_t worker;
+            TimelineParseBatch* batch;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                changed.wait(lock, [&] {
+                    return file_worker[file] != NO_WORKER && !workers[file_worker[file]].ready.empty();
+                });
+                worker = file_worker[file];
+                batch = workers[worker].ready.front();
+                workers[worker].ready.pop_front();
             }
 
-            // Create event for file modification
-            if (!modified.isEmpty() && modified != "N/A" && modified != created) {
-                TimelineEvent event;
-                event.timestamp = parseTimestamp(modified);
-                event.datetime = modified;
-                event.type = EVENT_FILE_MODIFIED;
-                event.description = "File modified";
-                event.source_artifact = source;
-                event.target = filename;
-                event.significance = 6;
-                timeline_events.push_back(event);
+            for (uint32_t record = 0; record < batch->records.size(); record++) {
+                batch->get(record, event);
+                generator.addEvent(event);
             }
+            added += batch->records.size();
+            last = batch->last;
 
-            // Create event for file access
-            if (!accessed.isEmpty() && accessed != "N/A") {
-                TimelineEvent event;
-                event.timestamp = parseTimestamp(accessed);
-                event.datetime = accessed;
-                event.type = EVENT_FILE_ACCESSED;
-                event.description = "File accessed";
-                event.source_artifact = source;
-                event.target = filename;
-                event.significance = 4;
-                timeline_events.push_back(event);
+            batch->clear();
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                workers[worker].spare.push_back(batch);
             }
+            changed.notify_all();
         }
+        if (added > 0) files_processed++;
     }
 
-    return timeline_events;
+    for (auto& worker : workers) {
+        worker.thread.join();
+    }
+    return files_processed;
 }
 
-std::vector<TimelineEvent> TimelineGenerator::parseUSNJournal(const String& content, const String& source) {
-    std::vector<TimelineEvent> timeline_events;
-
-    // Parse USN Journal entries
-    // Format: Timestamp, Filename, Reason
-
-    std::vector<String> lines;
-    int start = 0;
-    int end = content.indexOf('\n');
+// ===========================
+// Timeline Building
+// ===========================
 
-    while (end >= 0) {
-        String line = content.substring(start, end);
-        if (line.length() > 0) lines.push_back(line);
-        start = end + 1;
-        end = content.indexOf('\n', start);
+bool TimelineGenerator::buildTimelineFromFile(const String& file_path) {
+    if (!storage || !storage->fileExists(file_path)) {
+        return false;
     }
 
-    for (const auto& line : lines) {
-        std::vector<String> fields = parseCSVLine(line);
+    DirectSink sink(*this);
+    return parseArtifactFile(*storage, file_path, sink) > 0;
+}
 
-        if (fields.size() >= 3) {
-            TimelineEvent event;
-            event.timestamp = parseTimestamp(fields[0]);
-            event.datetime = fields[0];
-            event.target = fields[1];
-            event.source_artifact = source;
-            event.significance = 5;
+bool TimelineGenerator::buildTimelineFromDirectory(const String& dir_path) {
+    if (!storage) return false;
 
-            String reason = fields[2];
-            if (reason.indexOf("CREATE") >= 0) {
-                event.type = EVENT_FILE_CREATED;
-                event.description = "File created (USN)";
-            } else if (reason.indexOf("MODIFY") >= 0) {
-                event.type = EVENT_FILE_MODIFIED;
-                event.description = "File modified (USN)";
-            } else if (reason.indexOf("DELETE") >= 0) {
-                event.type = EVENT_FILE_DELETED;
-                event.description = "File deleted (USN)";
-                event.significance = 7;
-            } else {
-                event.type = EVENT_UNKNOWN;
-                event.description = "File change (USN): " + reason;
-            }
+    std::vector<String> files = storage->getFileList(dir_path);
+    for (auto& file : files) {
+        file = dir_path + "/" + file;
+    }
 
-            timeline_events.push_back(event);
+    uint32_t workers = parseWorkerCount(files.size());
+    if (workers > 1) {
+        TimelineParsePipeline pipeline(*storage, files, timestamp_parser, workers);
+        return pipeline.run(*this) > 0;
+    }
+
+    int files_processed = 0;
+    for (const auto& file : files) {
+        if (buildTimelineFromFile(file)) {
+            files_processed++;
         }
     }
 
-    return timeline_events;
+    return files_processed > 0;
 }
 
-std::vector<TimelineEvent> TimelineGenerator::parsePrefetchTimeline(const String& content, const String& source) {
-    std::vector<TimelineEvent> timeline_events;
+bool TimelineGenerator::buildTimelineFromAllArtifacts() {
+    if (!storage) return false;
 
-    // Parse Prefetch CSV
-    // Columns: Filename, LastExecuted, RunCount
+    String case_dir = storage->getCaseDirectory();
+    if (case_dir.isEmpty()) return false;
 
-    std::vector<String> lines;
-    int start = 0;
-    int end = content.indexOf('\n');
+    return buildTimelineFromDirectory(case_dir);
+}
 
-    while (end >= 0) {
-        String line = content.substring(start, end);
-        if (line.length() > 0) lines.push_back(line);
-        start = end + 1;
-        end = content.indexOf('\n', start);
+uint32_t TimelineGenerator::parseWorkerCount(size_t files) const {
+    uint32_t workers = parse_workers;
+    if (workers == 0) {
+#ifdef portNUM_PROCESSORS
+        workers = portNUM_PROCESSORS;
+#else
+        workers = std::thread::hardware_concurrency();
+#endif
     }
+    if (workers > TIMELINE_PARSE_MAX_WORKERS) workers = TIMELINE_PARSE_MAX_WORKERS;
+    if (workers > files) workers = files;
+    return workers;
+}
 
-    int start_line = lines.size() > 0 && lines[0].indexOf("Filename") >= 0 ? 1 : 0;
-
-    for (size_t i = start_line; i < lines.size(); i++) {
-        std::vector<String> fields = parseCSVLine(lines[i]);
+uint32_t TimelineGenerator::parseArtifactFile(FRFDStorage& storage, const String& file_path, TimelineEventSink& sink) {
+    File file = storage.openFile(file_path, FILE_READ);
+    if (!file) return 0;
+
+    // Recognise the format from the head of the file, then parse it from the start
+    char head[TIMELINE_SNIFF_BYTES];
+    size_t head_length = file.read((uint8_t*)head, sizeof(head));
+    TimelineArtifactFormat format = detectArtifactFormat(head, head_length,
+                                                         file_path.substring(file_path.lastIndexOf('/') + 1));
+    if (format == ARTIFACT_UNKNOWN || !file.seek(0)) {
+        file.close();
+        return 0;
+    }
 
-        if (fields.size() >= 2) {
-            TimelineEvent event;
-            event.timestamp = parseTimestamp(fields[1]);
-            event.datetime = fields[1];
-            event.type = EVENT_PROCESS_STARTED;
-            event.description = "Process executed (Prefetch)";
-            event.source_artifact = source;
-            event.target = fields[0];
-            event.significance = 7; // Process execution is significant
-            timeline_events.push_back(event);
-        }
+    // Rows are streamed from the file; it is never read in whole
+    CSVReader reader;
+    if (!reader.open(file)) {
+        return 0;
     }
+    uint32_t parsed_events = parseArtifact(format, reader, file_path, sink);
 
-    return timeline_events;
+    if (reader.hasError()) {
+        Serial.printf("[Timeline] %s (%s): stopped at row %u\n", file_path.c_str(), getArtifactFormatName(format),
+                      (unsigned)reader.getRowNumber());
+    }
+    return parsed_events;
 }
 
-std::vector<TimelineEvent> TimelineGenerator::parseEventLogTimeline(const String& content, const String& source) {
-    std::vector<TimelineEvent> timeline_events;
+// ===========================
+// Artifact Parsers
+// ===========================
+//
+// Each parser fills one TimelineEvent per row and reuses it, so once its
+// Strings have grown to fit, rows cost no allocation before the store.
 
-    // Parse Windows Event Log CSV
-    // Typical columns: TimeCreated, Id, Message, Level
+uint32_t TimelineGenerator::parseMFTTimeline(CSVReader& reader, const String& source, TimelineEventSink& sink) {
+    uint32_t added = 0;
+    TimelineEvent event;
+    event.source_artifact = source;
 
-    std::vector<String> lines;
-    int start = 0;
-    int end = content.indexOf('\n');
+    // Parse MFT CSV format
+    // Expected columns: Filename, Created, Modified, Accessed, Changed
+    while (reader.nextRow()) {
+        // Skip header if present
+        if (reader.getRowNumber() == 1 && reader.rowContains("Filename")) continue;
+        if (reader.getFieldCount() < 5) continue;
+
+        const CSVField& filename = reader.getField(0);
+        const CSVField& created = reader.getField(1);
+        const CSVField& modified = reader.getField(2);
+        const CSVField& accessed = reader.getField(3);
+        filename.copyTo(event.target);
+
+        // Create event for file creation
+        if (!created.isEmpty() && !created.equals("N/A")) {
+            event.timestamp = sink.parseTimestamp(created);
+            created.copyTo(event.datetime);
+            event.type = EVENT_FILE_CREATED;
+            event.description = "File created";
+            event.significance = 5;
+            sink.add(event);
+            added++;
+        }
 
-    while (end >= 0) {
-        String line = content.substring(start, end);
-        if (line.length() > 0) lines.push_back(line);
-        start = end + 1;
-        end = content.indexOf('\n', start);
-    }
-
-    int start_line = lines.size() > 0 && lines[0].indexOf("Time") >= 0 ? 1 : 0;
-
-    for (size_t i = start_line; i < lines.size(); i++) {
-        std::vector<String> fields = parseCSVLine(lines[i]);
-
-        if (fields.size() >= 3) {
-            TimelineEvent event;
-            event.timestamp = parseTimestamp(fields[0]);
-            event.datetime = fields[0];
-            event.source_artifact = source;
-            event.details = fields.size() > 2 ? fields[2] : "";
-
-            // Detect event type from message
-            String message = event.details.toLowerCase();
-
-            if (message.indexOf("logon") >= 0 || message.indexOf("login") >= 0) {
-                if (message.indexOf("success") >= 0 || message.indexOf("4624") >= 0) {
-                    event.type = EVENT_LOGIN_SUCCESS;
-                    event.description = "Successful login";
-                    event.significance = 6;
-                } else {
-                    event.type = EVENT_LOGIN_FAILURE;
-                    event.description = "Failed login attempt";
-                    event.significance = 8;
-                }
-            } else if (message.indexOf("service") >= 0) {
-                if (message.indexOf("start") >= 0) {
-                    event.type = EVENT_SERVICE_STARTED;
-                    event.description = "Service started";
-                    event.significance = 5;
-                } else if (message.indexOf("stop") >= 0) {
-                    event.type = EVENT_SERVICE_STOPPED;
-                    event.description = "Service stopped";
-                    event.significance = 5;
-                }
-            } else if (message.indexOf("boot") >= 0 || message.indexOf("startup") >= 0) {
-                event.type = EVENT_SYSTEM_BOOT;
-                event.description = "System boot";
-                event.significance = 7;
-            } else if (message.indexOf("shutdown") >= 0) {
-                event.type = EVENT_SYSTEM_SHUTDOWN;
-                event.description = "System shutdown";
-                event.significance = 7;
-            } else {
-                event.type = EVENT_UNKNOWN;
-                event.description = "Event log entry";
-                event.significance = 4;
-            }
+        // Create event for file modification
+        if (!modified.isEmpty() && !modified.equals("N/A") && !modified.equals(created)) {
+            event.timestamp = sink.parseTimestamp(modified);
+            modified.copyTo(event.datetime);
+            event.type = EVENT_FILE_MODIFIED;
+            event.description = "File modified";
+            event.significance = 6;
+            sink.add(event);
+            added++;
+        }
 
-            timeline_events.push_back(event);
+        // Create event for file access
+        if (!accessed.isEmpty() && !accessed.equals("N/A")) {
+            event.timestamp = sink.parseTimestamp(accessed);
+            accessed.copyTo(event.datetime);
+            event.type = EVENT_FILE_ACCESSED;
+            event.description = "File accessed";
+            event.significance = 4;
+            sink.add(event);
+            added++;
         }
     }
 
-    return timeline_events;
+    return added;
 }
 
-std::vector<TimelineEvent> TimelineGenerator::parseRegistryTimeline(const String& content, const String& source) {
-    std::vector<TimelineEvent> timeline_events;
+uint32_t TimelineGenerator::parseUSNJournal(CSVReader& reader, const String& source, TimelineEventSink& sink) {
+    uint32_t added = 0;
+    TimelineEvent event;
+    event.source_artifact = source;
 
-    // Parse registry export or CSV
-    // Look for LastWriteTime or modified timestamps
+    // Parse USN Journal entries
+    // Format: Timestamp, Filename, Reason
+    while (reader.nextRow()) {
+        if (reader.getFieldCount() < 3) continue;
+
+        const CSVField& reason = reader.getField(2);
+        event.timestamp = sink.parseTimestamp(reader.getField(0));
+        reader.getField(0).copyTo(event.datetime);
+        reader.getField(1).copyTo(event.target);
+        event.significance = 5;
+
+        if (reason.contains("CREATE")) {
+            event.type = EVENT_FILE_CREATED;
+            event.description = "File created (USN)";
+        } else if (reason.contains("MODIFY")) {
+            event.type = EVENT_FILE_MODIFIED;
+            event.description = "File modified (USN)";
+        } else if (reason.contains("DELETE")) {
+            event.type = EVENT_FILE_DELETED;
+            event.description = "File deleted (USN)";
+            event.significance = 7;
+        } else {
+            event.type = EVENT_UNKNOWN;
+            event.description = "File change (USN): ";
+            event.description.concat(reason.data, reason.length);
+        }
 
-    std::vector<String> lines;
-    int start = 0;
-    int end = content.indexOf('\n');
+        sink.add(event);
+        added++;
+    }
 
-    while (end >= 0) {
-        String line = content.substring(start, end);
-        if (line.length() > 0) lines.push_back(line);
-        start = end + 1;
-        end = content.indexOf('\n', start);
+    return added;
+}
+
+uint32_t TimelineGenerator::parsePrefetchTimeline(CSVReader& reader, const String& source, TimelineEventSink& sink) {
+    uint32_t added = 0;
+    TimelineEvent event;
+    event.type = EVENT_PROCESS_STARTED;
+    event.description = "Process executed (Prefetch)";
+    event.source_artifact = source;
+    event.significance = 7; // Process execution is significant
+
+    // Parse Prefetch CSV
+    // Columns: Filename, LastExecuted, RunCount
+    while (reader.nextRow()) {
+        if (reader.getRowNumber() == 1 && reader.rowContains("Filename")) continue;
+        if (reader.getFieldCount() < 2) continue;
+
+        event.timestamp = sink.parseTimestamp(reader.getField(1));
+        reader.getField(1).copyTo(event.datetime);
+        reader.getField(0).copyTo(event.target);
+        sink.add(event);
+        added++;
     }
 
-    for (const auto& line : lines) {
-        // Look for registry key patterns
-        if (line.indexOf("HKLM\\") >= 0 || line.indexOf("HKCU\\") >= 0 || line.indexOf("HKEY_") >= 0) {
-            TimelineEvent event;
-            event.type = EVENT_REGISTRY_MODIFIED;
-            event.description = "Registry key modified";
-            event.source_artifact = source;
-
-            // Extract key name
-            int key_start = line.indexOf("HK");
-            if (key_start >= 0) {
-                int key_end = line.indexOf('\"', key_start);
-                if (key_end < 0) key_end = line.indexOf('\n', key_start);
-                if (key_end < 0) key_end = line.length();
-
-                event.target = line.substring(key_start, key_end);
-            }
+    return added;
+}
 
-            event.timestamp = millis(); // Use current time if no timestamp available
-            event.datetime = formatTimestamp(event.timestamp);
-            event.significance = 5;
+uint32_t TimelineGenerator::parseEventLogTimeline(CSVReader& reader, const String& source, TimelineEventSink& sink) {
+    uint32_t added = 0;
+    TimelineEvent event;
+    event.source_artifact = source;
+    String message;
 
-            timeline_events.push_back(event);
+    // Parse Windows Event Log CSV
+    // Typical columns: TimeCreated, Id, Message, Level
+    while (reader.nextRow()) {
+        if (reader.getRowNumber() == 1 && reader.rowContains("Time")) continue;
+        if (reader.getFieldCount() < 3) continue;
+
+        event.timestamp = sink.parseTimestamp(reader.getField(0));
+        reader.getField(0).copyTo(event.datetime);
+        reader.getField(2).copyTo(event.details);
+
+        // Detect event type from message
+        message = event.details;
+        message.toLowerCase();
+
+        if (message.indexOf("logon") >= 0 || message.indexOf("login") >= 0) {
+            if (message.indexOf("success") >= 0 || message.indexOf("4624") >= 0) {
+                event.type = EVENT_LOGIN_SUCCESS;
+                event.description = "Successful login";
+                event.significance = 6;
+            } else {
+                event.type = EVENT_LOGIN_FAILURE;
+                event.description = "Failed login attempt";
+                event.significance = 8;
+            }
+        } else if (message.indexOf("service") >= 0 && message.indexOf("start") >= 0) {
+            event.type = EVENT_SERVICE_STARTED;
+            event.description = "Service started";
+            event.significance = 5;
+        } else if (message.indexOf("service") >= 0 && message.indexOf("stop") >= 0) {
+            event.type = EVENT_SERVICE_STOPPED;
+            event.description = "Service stopped";
+            event.significance = 5;
+        } else if (message.indexOf("service") >= 0) {
+            // Neither start nor stop: no type of its own
+            event.type = EVENT_UNKNOWN;
+            event.description = "";
+            event.significance = 0;
+        } else if (message.indexOf("boot") >= 0 || message.indexOf("startup") >= 0) {
+            event.type = EVENT_SYSTEM_BOOT;
+            event.description = "System boot";
+            event.significance = 7;
+        } else if (message.indexOf("shutdown") >= 0) {
+            event.type = EVENT_SYSTEM_SHUTDOWN;
+            event.description = "System shutdown";
+            event.significance = 7;
+        } else {
+            event.type = EVENT_UNKNOWN;
+            event.description = "Event log entry";
+            event.significance = 4;
         }
+
+        sink.add(event);
+        added++;
     }
 
-    return timeline_events;
+    return added;
 }
 
-std::vector<TimelineEvent> TimelineGenerator::parseBrowserHistory(const String& content, const String& source) {
-    std::vector<TimelineEvent> timeline_events;
+uint32_t TimelineGenerator::parseRegistryTimeline(CSVReader& reader, const String& source, TimelineEventSink& sink) {
+    uint32_t added = 0;
+    TimelineEvent event;
+    event.type = EVENT_REGISTRY_MODIFIED;
+    event.description = "Registry key modified";
+    event.source_artifact = source;
+    event.significance = 5;
 
-    // Parse browser history CSV
-    // Columns: URL, Title, VisitTime
+    // Parse registry export or CSV
+    // Look for LastWriteTime or modified timestamps
+    while (reader.nextLine()) {
+        const CSVField& line = reader.getField(0);
 
-    std::vector<String> lines;
-    int start = 0;
-    int end = content.indexOf('\n');
+        // Look for registry key patterns
+        if (!line.contains("HKLM\\") && !line.contains("HKCU\\") && !line.contains("HKEY_")) continue;
 
-    while (end >= 0) {
-        String line = content.substring(start, end);
-        if (line.length() > 0) lines.push_back(line);
-        start = end + 1;
-        end = content.indexOf('\n', start);
+        // Extract key name
+        const char* key_start = strstr(line.data, "HK");
+        const char* key_end = key_start ? strchr(key_start, '\"') : nullptr;
+        if (!key_end) key_end = line.data + line.length;
+        event.target = "";
+        if (key_start) event.target.concat(key_start, key_end - key_start);
+
+        event.timestamp = currentTimestamp(); // Use current time if no timestamp available
+        event.datetime = formatTimestamp(event.timestamp);
+        sink.add(event);
+        added++;
     }
 
-    int start_line = lines.size() > 0 && (lines[0].indexOf("URL") >= 0 || lines[0].indexOf("url") >= 0) ? 1 : 0;
+    return added;
+}
 
-    for (size_t i = start_line; i < lines.size(); i++) {
-        std::vector<String> fields = parseCSVLine(lines[i]);
+uint32_t TimelineGenerator::parseBrowserHistory(CSVReader& reader, const String& source, TimelineEventSink& sink) {
+    uint32_t added = 0;
+    TimelineEvent event;
+    event.type = EVENT_BROWSER_NAVIGATION;
+    event.description = "Browser navigation";
+    event.source_artifact = source;
+    event.significance = 5;
 
-        if (fields.size() >= 3) {
-            TimelineEvent event;
-            event.timestamp = parseTimestamp(fields[2]);
-            event.datetime = fields[2];
-            event.type = EVENT_BROWSER_NAVIGATION;
-            event.description = "Browser navigation";
-            event.source_artifact = source;
-            event.target = fields[0]; // URL
-            event.details = fields[1]; // Title
-            event.significance = 5;
-            timeline_events.push_back(event);
-        }
+    // Parse browser history CSV
+    // Columns: URL, Title, VisitTime
+    while (reader.nextRow()) {
+        if (reader.getRowNumber() == 1 && (reader.rowContains("URL") || reader.rowContains("url"))) continue;
+        if (reader.getFieldCount() < 3) continue;
+
+        event.timestamp = sink.parseTimestamp(reader.getField(2));
+        reader.getField(2).copyTo(event.datetime);
+        reader.getField(0).copyTo(event.target);   // URL
+        reader.getField(1).copyTo(event.details);  // Title
+        sink.add(event);
+        added++;
     }
 
-    return timeline_events;
+    return added;
 }
 
-std::vector<TimelineEvent> TimelineGenerator::parseNetworkConnections(const String& content, const String& source) {
-    std::vector<TimelineEvent> timeline_events;
+uint32_t TimelineGenerator::parseNetworkConnections(CSVReader& reader, const String& source, TimelineEventSink& sink) {
+    uint32_t added = 0;
+    TimelineEvent event;
+    event.type = EVENT_NETWORK_CONNECTION;
+    event.description = "Network connection";
+    event.source_artifact = source;
+    event.significance = 6;
 
     // Parse network connection CSV
     // Look for RemoteAddress, State
+    while (reader.nextLine()) {
+        const CSVField& line = reader.getField(0);
 
-    std::vector<String> lines;
-    int start = 0;
-    int end = content.indexOf('\n');
-
-    while (end >= 0) {
-        String line = content.substring(start, end);
-        if (line.length() > 0) lines.push_back(line);
-        start = end + 1;
-        end = content.indexOf('\n', start);
-    }
-
-    for (const auto& line : lines) {
         // Look for IP addresses in line
-        if (line.indexOf('.') >= 0 || line.indexOf(':') >= 0) {
-            TimelineEvent event;
-            event.type = EVENT_NETWORK_CONNECTION;
-            event.description = "Network connection";
-            event.source_artifact = source;
-            event.timestamp = millis();
-            event.datetime = formatTimestamp(event.timestamp);
-            event.details = line;
-            event.significance = 6;
-            timeline_events.push_back(event);
-        }
+        if (!memchr(line.data, '.', line.length) && !memchr(line.data, ':', line.length)) continue;
+
+        event.timestamp = currentTimestamp();
+        event.datetime = formatTimestamp(event.timestamp);
+        line.copyTo(event.details);
+        sink.add(event);
+        added++;
     }
 
-    return timeline_events;
+    return added;
 }
 
-std::vector<TimelineEvent> TimelineGenerator::parseAuthLogs(const String& content, const String& source) {
-    std::vector<TimelineEvent> timeline_events;
+uint32_t TimelineGenerator::parseAuthLogs(CSVReader& reader, const String& source, TimelineEventSink& sink) {
+    uint32_t added = 0;
+    TimelineEvent event;
+    event.source_artifact = source;
+    String lower_line;
 
     // Parse Linux auth logs
     // Format: timestamp username action
-
-    std::vector<String> lines;
-    int start = 0;
-    int end = content.indexOf('\n');
-
-    while (end >= 0) {
-        String line = content.substring(start, end);
-        if (line.length() > 0) lines.push_back(line);
-        start = end + 1;
-        end = content.indexOf('\n', start);
-    }
-
-    for (const auto& line : lines) {
-        TimelineEvent event;
-        event.source_artifact = source;
-        event.timestamp = millis();
-        event.datetime = formatTimestamp(event.timestamp);
-
-        String lower_line = line;
+    while (reader.nextLine()) {
+        reader.getField(0).copyTo(lower_line);
         lower_line.toLowerCase();
 
         if (lower_line.indexOf("success") >= 0 || lower_line.indexOf("accepted") >= 0) {
@@ -485,301 +824,371 @@ std::vector<TimelineEvent> TimelineGenerator::parseAuthLogs(const String& conten
             continue; // Skip non-auth entries
         }
 
-        event.details = line;
-        timeline_events.push_back(event);
+        event.timestamp = currentTimestamp();
+        event.datetime = formatTimestamp(event.timestamp);
+        reader.getField(0).copyTo(event.details);
+        sink.add(event);
+        added++;
     }
 
-    return timeline_events;
+    return added;
 }
 
-std::vector<TimelineEvent> TimelineGenerator::parseProcessList(const String& content, const String& source) {
-    std::vector<TimelineEvent> timeline_events;
+uint32_t TimelineGenerator::parseProcessList(CSVReader& reader, const String& source, TimelineEventSink& sink) {
+    uint32_t added = 0;
+    TimelineEvent event;
+    event.type = EVENT_PROCESS_STARTED;
+    event.description = "Process started";
+    event.source_artifact = source;
+    event.significance = 6;
 
     // Parse process list CSV
     // Columns: ProcessName, PID, StartTime
+    while (reader.nextRow()) {
+        if (reader.getRowNumber() == 1 && reader.rowContains("Process")) continue;
+        if (reader.getFieldCount() < 3) continue;
+
+        event.timestamp = sink.parseTimestamp(reader.getField(2));
+        reader.getField(2).copyTo(event.datetime);
+        reader.getField(0).copyTo(event.target);
+        event.details = "PID: ";
+        event.details.concat(reader.getField(1).data, reader.getField(1).length);
+        sink.add(event);
+        added++;
+    }
+
+    return added;
+}
 
-    std::vector<String> lines;
-    int start = 0;
-    int end = content.indexOf('\n');
+uint32_t TimelineGenerator::parseShimCache(CSVReader& reader, const String& source, TimelineEventSink& sink) {
+    uint32_t added = 0;
+    TimelineEvent event;
+    event.type = EVENT_PROCESS_STARTED;
+    event.description = "Program executed (ShimCache)";
+    event.source_artifact = source;
+    event.significance = 7;
 
-    while (end >= 0) {
-        String line = content.substring(start, end);
-        if (line.length() > 0) lines.push_back(line);
-        start = end + 1;
-        end = content.indexOf('\n', start);
+    // ShimCache shows executed programs
+    while (reader.nextLine()) {
+        const CSVField& line = reader.getField(0);
+        if (!line.contains(".exe")) continue;
+
+        line.copyTo(event.target);
+        event.timestamp = currentTimestamp();
+        event.datetime = formatTimestamp(event.timestamp);
+        sink.add(event);
+        added++;
     }
 
-    int start_line = lines.size() > 0 && lines[0].indexOf("Process") >= 0 ? 1 : 0;
+    return added;
+}
 
-    for (size_t i = start_line; i < lines.size(); i++) {
-        std::vector<String> fields = parseCSVLine(lines[i]);
+uint32_t TimelineGenerator::parseAmCache(CSVReader& reader, const String& source, TimelineEventSink& sink) {
+    uint32_t added = 0;
+    TimelineEvent event;
+    event.type = EVENT_PROCESS_STARTED;
+    event.description = "Application executed (AmCache)";
+    event.source_artifact = source;
+    event.significance = 7;
 
-        if (fields.size() >= 3) {
-            TimelineEvent event;
-            event.timestamp = parseTimestamp(fields[2]);
-            event.datetime = fields[2];
-            event.type = EVENT_PROCESS_STARTED;
-            event.description = "Process started";
-            event.source_artifact = source;
-            event.target = fields[0];
-            event.details = "PID: " + fields[1];
-            event.significance = 6;
-            timeline_events.push_back(event);
-        }
+    // AmCache - program execution
+    while (reader.nextLine()) {
+        const CSVField& line = reader.getField(0);
+        if (!line.contains(".exe") && !line.contains("Path")) continue;
+
+        line.copyTo(event.details);
+        event.timestamp = currentTimestamp();
+        event.datetime = formatTimestamp(event.timestamp);
+        sink.add(event);
+        added++;
     }
 
-    return timeline_events;
+    return added;
 }
 
-std::vector<TimelineEvent> TimelineGenerator::parseShimCache(const String& content, const String& source) {
-    std::vector<TimelineEvent> timeline_events;
+uint32_t TimelineGenerator::parseJumpLists(CSVReader& reader, const String& source, TimelineEventSink& sink) {
+    uint32_t added = 0;
+    TimelineEvent event;
+    event.type = EVENT_FILE_ACCESSED;
+    event.description = "File accessed (Jump List)";
+    event.source_artifact = source;
+    event.significance = 5;
 
-    // ShimCache shows executed programs
-    std::vector<String> lines;
-    int start = 0;
-    int end = content.indexOf('\n');
-
-    while (end >= 0) {
-        String line = content.substring(start, end);
-        if (line.length() > 0 && line.indexOf(".exe") >= 0) {
-            TimelineEvent event;
-            event.type = EVENT_PROCESS_STARTED;
-            event.description = "Program executed (ShimCache)";
-            event.source_artifact = source;
-            event.target = line;
-            event.timestamp = millis();
-            event.datetime = formatTimestamp(event.timestamp);
-            event.significance = 7;
-            timeline_events.push_back(event);
-        }
-        start = end + 1;
-        end = content.indexOf('\n', start);
+    // Jump lists - recently used files
+    while (reader.nextLine()) {
+        reader.getField(0).copyTo(event.target);
+        event.timestamp = currentTimestamp();
+        event.datetime = formatTimestamp(event.timestamp);
+        sink.add(event);
+        added++;
     }
 
-    return timeline_events;
+    return added;
 }
 
-std::vector<TimelineEvent> TimelineGenerator::parseAmCache(const String& content, const String& source) {
-    std::vector<TimelineEvent> timeline_events;
-
-    // AmCache - program execution
-    std::vector<String> lines;
-    int start = 0;
-    int end = content.indexOf('\n');
-
-    while (end >= 0) {
-        String line = content.substring(start, end);
-        if (line.length() > 0 && (line.indexOf(".exe") >= 0 || line.indexOf("Path") >= 0)) {
-            TimelineEvent event;
-            event.type = EVENT_PROCESS_STARTED;
-            event.description = "Application executed (AmCache)";
-            event.source_artifact = source;
-            event.details = line;
-            event.timestamp = millis();
-            event.datetime = formatTimestamp(event.timestamp);
-            event.significance = 7;
-            timeline_events.push_back(event);
+void TimelineGenerator::addEvent(const TimelineEvent& event) {
+    // Overlapping sources (MFT and USN, a re-uploaded artifact) report the same event again
+    uint64_t identity = TimelineIndex::identityOf(event);
+    if (deduplicate) {
+        uint32_t existing = index.findIdentical(event, identity);
+        if (existing != TimelineIndex::NO_EVENT) {
+            mergeDuplicate(existing, event);
+            duplicates_merged++;
+            return;
         }
-        start = end + 1;
-        end = content.indexOf('\n', start);
     }
 
-    return timeline_events;
+    uint32_t position = store.add(event);
+    index.add(position, identity);
+    countEvent(position);
+
+    if (!sort_run_dir.isEmpty() && !spill_failed) {
+        if (store.getMemoryUsage() + index.getMemoryUsage() >= sort_memory_budget && !spillRun()) {
+            // Keep the rest in memory rather than lose events
+            spill_failed = true;
+        }
+    }
 }
 
-std::vector<TimelineEvent> TimelineGenerator::parseJumpLists(const String& content, const String& source) {
-    std::vector<TimelineEvent> timeline_events;
+// Whether a "; "-separated source list already names `source`
+static bool sourceListed(const char* list, const char* source, size_t length) {
+    for (const char* item = list; *item; ) {
+        const char* end = strstr(item, "; ");
+        size_t item_length = end ? end - item : strlen(item);
+        if (item_length == length && memcmp(item, source, length) == 0) return true;
+        if (!end) break;
+        item = end + 2;
+    }
+    return false;
+}
 
-    // Jump lists - recently used files
-    std::vector<String> lines;
-    int start = 0;
-    int end = content.indexOf('\n');
-
-    while (end >= 0) {
-        String line = content.substring(start, end);
-        if (line.length() > 0) {
-            TimelineEvent event;
-            event.type = EVENT_FILE_ACCESSED;
-            event.description = "File accessed (Jump List)";
-            event.source_artifact = source;
-            event.target = line;
-            event.timestamp = millis();
-            event.datetime = formatTimestamp(event.timestamp);
-            event.significance = 5;
-            timeline_events.push_back(event);
+// Adds the sources of a "; "-separated list that `sources` does not name yet; false when there were none
+static bool mergeSources(String& sources, const String& added) {
+    bool changed = false;
+    for (const char* item = added.c_str(); *item; ) {
+        const char* end = strstr(item, "; ");
+        size_t length = end ? end - item : strlen(item);
+        if (length > 0 && !sourceListed(sources.c_str(), item, length)) {
+            if (!sources.isEmpty()) sources += "; ";
+            sources.concat(item, length);
+            changed = true;
         }
-        start = end + 1;
-        end = content.indexOf('\n', start);
+        if (!end) break;
+        item = end + 2;
     }
+    return changed;
+}
 
-    return timeline_events;
+// Same event by the identity TimelineIndex::findIdentical() confirms
+static bool sameEvent(const TimelineEvent& a, const TimelineEvent& b) {
+    return a.timestamp == b.timestamp && a.type == b.type && a.target == b.target && a.actor == b.actor;
 }
 
-void TimelineGenerator::addEvent(const TimelineEvent& event) {
-    events.push_back(event);
+void TimelineGenerator::mergeDuplicate(uint32_t position, const TimelineEvent& event) {
+    // Keep the highest significance and every source that reported the event
+    bool changed = false;
+    if (event.significance > store.getSignificance(position)) {
+        store.setSignificance(position, event.significance);
+        changed = true;
+    }
+    const String& source = event.source_artifact;
+    if (!source.isEmpty() && !sourceListed(store.getText(TIMELINE_FIELD_SOURCE, position), source.c_str(), source.length())) {
+        String sources = store.getString(TIMELINE_FIELD_SOURCE, position);
+        if (mergeSources(sources, source)) {
+            store.setText(TIMELINE_FIELD_SOURCE, position, sources.c_str(), sources.length());
+            changed = true;
+        }
+        countSource(source.c_str(), source.length());
+    }
+    if (changed) markFileStale(position);
+}
+
+// mergeDuplicate() on a decoded event
+static void mergeEvent(TimelineEvent& kept, const TimelineEvent& duplicate) {
+    if (duplicate.significance > kept.significance) kept.significance = duplicate.significance;
+    mergeSources(kept.source_artifact, duplicate.source_artifact);
 }
 
 void TimelineGenerator::clearTimeline() {
-    events.clear();
+    store.clear();
+    index.clear();
+    file_persisted = 0;
+    file_numbers.clear();
+    file_updates.clear();
+    duplicates_merged = 0;
+    deleteRuns();
+    resetStatistics();
 }
 
-std::vector<TimelineEvent> TimelineGenerator::getEventsByType(TimelineEventType type) const {
-    std::vector<TimelineEvent> filtered;
-    for (const auto& event : events) {
-        if (event.type == type) {
-            filtered.push_back(event);
-        }
+TimelineSpan TimelineGenerator::getEventsByActor(const String& actor) const {
+    return index.byActor(store.findText(actor));
+}
+
+TimelineSpan TimelineGenerator::getEventsByTarget(const String& target) const {
+    return index.byTarget(store.findText(target));
+}
+
+void TimelineGenerator::sortByTimestamp() {
+    std::vector<SortKey> keys(store.size());
+    for (uint32_t i = 0; i < store.size(); i++) {
+        keys[i].key = store.getTimestamp(i);
+        keys[i].index = i;
     }
-    return filtered;
+    sortEvents(keys);
 }
 
-std::vector<TimelineEvent> TimelineGenerator::getEventsByTimeRange(unsigned long start, unsigned long end) const {
-    std::vector<TimelineEvent> filtered;
-    for (const auto& event : events) {
-        if (event.timestamp >= start && event.timestamp <= end) {
-            filtered.push_back(event);
-        }
+void TimelineGenerator::sortBySignificance() {
+    // Most significant first
+    std::vector<SortKey> keys(store.size());
+    for (uint32_t i = 0; i < store.size(); i++) {
+        keys[i].key = 255 - store.getSignificance(i);
+        keys[i].index = i;
     }
-    return filtered;
+    sortEvents(keys);
 }
 
-std::vector<TimelineEvent> TimelineGenerator::getEventsByActor(const String& actor) const {
-    std::vector<TimelineEvent> filtered;
-    for (const auto& event : events) {
-        if (event.actor == actor) {
-            filtered.push_back(event);
-        }
+void TimelineGenerator::sortByType() {
+    std::vector<SortKey> keys(store.size());
+    for (uint32_t i = 0; i < store.size(); i++) {
+        keys[i].key = store.getType(i);
+        keys[i].index = i;
     }
-    return filtered;
+    sortEvents(keys);
 }
 
-std::vector<TimelineEvent> TimelineGenerator::getEventsByTarget(const String& target) const {
-    std::vector<TimelineEvent> filtered;
-    for (const auto& event : events) {
-        if (event.target == target) {
-            filtered.push_back(event);
-        }
+// Runs shorter than this are extended by insertion sort before merging
+static const size_t SORT_MIN_RUN = 32;
+
+template <typename Key>
+static void mergeRuns(const Key* left, const Key* left_end, const Key* right, const Key* right_end, Key* out) {
+    // Equal keys are taken from the left run first, which keeps the sort stable
+    while (left < left_end && right < right_end) {
+        *out++ = right->key < left->key ? *right++ : *left++;
     }
-    return filtered;
+    while (left < left_end) *out++ = *left++;
+    while (right < right_end) *out++ = *right++;
 }
 
-void TimelineGenerator::sortByTimestamp() {
-    // Simple bubble sort for small datasets
-    for (size_t i = 0; i < events.size(); i++) {
-        for (size_t j = i + 1; j < events.size(); j++) {
-            if (events[j].timestamp < events[i].timestamp) {
-                TimelineEvent temp = events[i];
-                events[i] = events[j];
-                events[j] = temp;
+void TimelineGenerator::sortEvents(std::vector<SortKey>& keys) {
+    // Natural merge sort on the keys: parsers emit their events mostly in order, so the
+    // input is a handful of ascending runs (one per source) and sorts in a few passes
+    size_t n = keys.size();
+    std::vector<uint32_t> runs;     // Run starts, then n
+    size_t start = 0;
+    while (start < n) {
+        size_t end = start + 1;
+        if (end < n && keys[end].key < keys[start].key) {
+            // Strictly descending: reverse in place, which cannot reorder equal keys
+            while (end < n && keys[end].key < keys[end - 1].key) end++;
+            std::reverse(keys.begin() + start, keys.begin() + end);
+        } else {
+            while (end < n && !(keys[end].key < keys[end - 1].key)) end++;
+        }
+
+        // Binary insertion sort short runs up to SORT_MIN_RUN
+        size_t limit = std::min(n, start + SORT_MIN_RUN);
+        for (; end < limit; end++) {
+            SortKey item = keys[end];
+            auto slot = std::upper_bound(keys.begin() + start, keys.begin() + end, item,
+                                         [](const SortKey& a, const SortKey& b) { return a.key < b.key; });
+            std::move_backward(slot, keys.begin() + end, keys.begin() + end + 1);
+            *slot = item;
+        }
+
+        runs.push_back(start);
+        start = end;
+    }
+    runs.push_back(n);
+
+    // Merge neighbouring runs pairwise until one is left
+    std::vector<SortKey> buffer(runs.size() > 2 ? n : 0);
+    SortKey* from = keys.data();
+    SortKey* to = buffer.data();
+    while (runs.size() > 2) {
+        std::vector<uint32_t> merged;
+        size_t r = 0;
+        for (; r + 2 < runs.size(); r += 2) {
+            SortKey* left = from + runs[r];
+            SortKey* middle = from + runs[r + 1];
+            SortKey* right_end = from + runs[r + 2];
+            if (!(middle->key < (middle - 1)->key)) {
+                // Already in order across the boundary
+                std::copy(left, right_end, to + runs[r]);
+            } else {
+                mergeRuns(left, middle, middle, right_end, to + runs[r]);
             }
+            merged.push_back(runs[r]);
         }
+        if (r + 1 < runs.size()) {
+            std::copy(from + runs[r], from + n, to + runs[r]);
+            merged.push_back(runs[r]);
+        }
+        merged.push_back(n);
+        runs.swap(merged);
+        std::swap(from, to);
     }
-}
+    if (from != keys.data()) keys.swap(buffer);
 
-void TimelineGenerator::sortBySignificance() {
-    for (size_t i = 0; i < events.size(); i++) {
-        for (size_t j = i + 1; j < events.size(); j++) {
-            if (events[j].significance > events[i].significance) {
-                TimelineEvent temp = events[i];
-                events[i] = events[j];
-                events[j] = temp;
-            }
+    // Gather every column through the sorted positions, once the file has every event at its old position
+    persistPending();
+    std::vector<uint32_t> order(n);
+    for (size_t i = 0; i < n; i++) {
+        order[i] = keys[i].index;
+    }
+    std::vector<SortKey>().swap(keys);
+    std::vector<SortKey>().swap(buffer);
+    store.permute(order);
+    if (!file_numbers.empty()) {
+        std::vector<uint32_t> numbers(n);
+        for (size_t i = 0; i < n; i++) {
+            numbers[i] = file_numbers[order[i]];
         }
+        file_numbers.swap(numbers);
     }
+
+    index.rebuild();
 }
 
 String TimelineGenerator::exportToJSON() {
-    String json = "{";
-    json += "\"timeline\":{";
-    json += "\"event_count\":" + String(events.size()) + ",";
-    json += "\"generated_at\":" + String(millis()) + ",";
-    json += "\"events\":[";
-
-    for (size_t i = 0; i < events.size(); i++) {
-        if (i > 0) json += ",";
-
-        json += "{";
-        json += "\"timestamp\":" + String(events[i].timestamp) + ",";
-        json += "\"datetime\":\"" + events[i].datetime + "\",";
-        json += "\"type\":\"" + getEventTypeName(events[i].type) + "\",";
-        json += "\"description\":\"" + events[i].description + "\",";
-        json += "\"source\":\"" + events[i].source_artifact + "\",";
-        json += "\"target\":\"" + events[i].target + "\",";
-        json += "\"significance\":" + String(events[i].significance);
-        json += "}";
-    }
-
-    json += "]}}";
+    String json = exportHeader(EXPORT_JSON);
+    TimelineEvent event;
+    for (uint32_t i = 0; i < store.size(); i++) {
+        store.getEvent(i, event);
+        appendExportEvent(json, event, EXPORT_JSON, i == 0);
+    }
+    json += exportFooter(EXPORT_JSON, store.size());
     return json;
 }
 
 String TimelineGenerator::exportToCSV() {
-    String csv = "Timestamp,DateTime,Type,Description,Source,Actor,Target,Significance\n";
-
-    for (const auto& event : events) {
-        csv += String(event.timestamp) + ",";
-        csv += "\"" + event.datetime + "\",";
-        csv += getEventTypeName(event.type) + ",";
-        csv += "\"" + event.description + "\",";
-        csv += "\"" + event.source_artifact + "\",";
-        csv += "\"" + event.actor + "\",";
-        csv += "\"" + event.target + "\",";
-        csv += String(event.significance) + "\n";
+    String csv = exportHeader(EXPORT_CSV);
+    TimelineEvent event;
+    for (uint32_t i = 0; i < store.size(); i++) {
+        store.getEvent(i, event);
+        appendExportEvent(csv, event, EXPORT_CSV, false);
     }
-
     return csv;
 }
 
 String TimelineGenerator::exportToHTML() {
-    String html = "<!DOCTYPE html><html><head><title>Forensic Timeline</title>";
-    html += "<style>body{font-family:Arial;margin:20px;}";
-    html += "table{border-collapse:collapse;width:100%;}";
-    html += "th,td{border:1px solid #ddd;padding:8px;text-align:left;}";
-    html += "th{background:#4CAF50;color:white;}";
-    html += "tr:hover{background:#f5f5f5;}";
-    html += ".high{color:red;font-weight:bold;}";
-    html += ".medium{color:orange;}";
-    html += ".low{color:green;}";
-    html += "</style></head><body>";
-    html += "<h1>Forensic Timeline Report</h1>";
-    html += "<p>Total Events: " + String(events.size()) + "</p>";
-    html += "<table><tr><th>Time</th><th>Type</th><th>Description</th><th>Target</th><th>Significance</th></tr>";
-
-    for (const auto& event : events) {
-        html += "<tr>";
-        html += "<td>" + event.datetime + "</td>";
-        html += "<td>" + getEventTypeName(event.type) + "</td>";
-        html += "<td>" + event.description + "</td>";
-        html += "<td>" + event.target + "</td>";
-
-        String sig_class = event.significance >= 8 ? "high" : (event.significance >= 6 ? "medium" : "low");
-        html += "<td class=\"" + sig_class + "\">" + String(event.significance) + "</td>";
-        html += "</tr>";
-    }
-
-    html += "</table></body></html>";
+    String html = exportHeader(EXPORT_HTML);
+    TimelineEvent event;
+    for (uint32_t i = 0; i < store.size(); i++) {
+        store.getEvent(i, event);
+        appendExportEvent(html, event, EXPORT_HTML, false);
+    }
+    html += exportFooter(EXPORT_HTML, store.size());
     return html;
 }
 
 String TimelineGenerator::exportToBodyFile() {
     // Sleuth Kit body file format
     String body = "";
-
-    for (const auto& event : events) {
-        body += "0|";  // MD5
-        body += event.target + "|";  // Name
-        body += "0|";  // Inode
-        body += "0|";  // Mode
-        body += "0|";  // UID
-        body += "0|";  // GID
-        body += "0|";  // Size
-        body += String(event.timestamp) + "|";  // Atime
-        body += String(event.timestamp) + "|";  // Mtime
-        body += String(event.timestamp) + "|";  // Ctime
-        body += String(event.timestamp);  // Crtime
-        body += "\n";
+    TimelineEvent event;
+    for (uint32_t i = 0; i < store.size(); i++) {
+        store.getEvent(i, event);
+        appendExportEvent(body, event, EXPORT_BODYFILE, false);
     }
-
     return body;
 }
 
@@ -802,34 +1211,776 @@ bool TimelineGenerator::saveToFile(const String& filename, const String& format)
     return storage->writeFile(filename, content);
 }
 
-TimelineStatistics TimelineGenerator::getStatistics() const {
-    TimelineStatistics stats;
-    stats.total_events = events.size();
-    stats.unique_actors = 0;
-    stats.unique_targets = 0;
-    stats.earliest_timestamp = events.size() > 0 ? events[0].timestamp : 0;
-    stats.latest_timestamp = events.size() > 0 ? events[0].timestamp : 0;
+TimelineGenerator::ExportFormat TimelineGenerator::exportFormatFromName(const String& format) {
+    if (format == "json") return EXPORT_JSON;
+    if (format == "csv") return EXPORT_CSV;
+    if (format == "html") return EXPORT_HTML;
+    if (format == "bodyfile") return EXPORT_BODYFILE;
+    return EXPORT_INVALID;
+}
+
+String TimelineGenerator::exportHeader(ExportFormat format) {
+    String header = "";
+    switch (format) {
+        case EXPORT_JSON:
+            header += "{";
+            header += "\"timeline\":{";
+            header += "\"generated_at\":" + String(millis()) + ",";
+            header += "\"events\":[";
+            break;
+        case EXPORT_CSV:
+            header = "Timestamp,DateTime,Type,Description,Source,Actor,Target,Significance\n";
+            break;
+        case EXPORT_HTML:
+            header = "<!DOCTYPE html><html><head><title>Forensic Timeline</title>";
+            header += "<style>body{font-family:Arial;margin:20px;}";
+            header += "table{border-collapse:collapse;width:100%;}";
+            header += "th,td{border:1px solid #ddd;padding:8px;text-align:left;}";
+            header += "th{background:#4CAF50;color:white;}";
+            header += "tr:hover{background:#f5f5f5;}";
+            header += ".high{color:red;font-weight:bold;}";
+            header += ".medium{color:orange;}";
+            header += ".low{color:green;}";
+            header += "</style></head><body>";
+            header += "<h1>Forensic Timeline Report</h1>";
+            header += "<table><tr><th>Time</th><th>Type</th><th>Description</th><th>Target</th><th>Significance</th></tr>";
+            break;
+        default:
+            break;
+    }
+    return header;
+}
+
+void TimelineGenerator::appendExportEvent(String& out, const TimelineEvent& event, ExportFormat format, bool first) {
+    switch (format) {
+        case EXPORT_JSON:
+            if (!first) out += ",";
+            out += "{";
+            out += "\"timestamp\":" + String((long long)event.timestamp) + ",";
+            out += "\"datetime\":\"" + event.datetime + "\",";
+            out += "\"type\":\"" + getEventTypeName(event.type) + "\",";
+            out += "\"description\":\"" + event.description + "\",";
+            out += "\"source\":\"" + event.source_artifact + "\",";
+            out += "\"target\":\"" + event.target + "\",";
+            out += "\"significance\":" + String(event.significance);
+            out += "}";
+            break;
+        case EXPORT_CSV:
+            out += String((long long)event.timestamp) + ",";
+            out += "\"" + event.datetime + "\",";
+            out += getEventTypeName(event.type) + ",";
+            out += "\"" + event.description + "\",";
+            out += "\"" + event.source_artifact + "\",";
+            out += "\"" + event.actor + "\",";
+            out += "\"" + event.target + "\",";
+            out += String(event.significance) + "\n";
+            break;
+        case EXPORT_HTML: {
+            out += "<tr>";
+            out += "<td>" + event.datetime + "</td>";
+            out += "<td>" + getEventTypeName(event.type) + "</td>";
+            out += "<td>" + event.description + "</td>";
+            out += "<td>" + event.target + "</td>";
+
+            String sig_class = event.significance >= 8 ? "high" : (event.significance >= 6 ? "medium" : "low");
+            out += "<td class=\"" + sig_class + "\">" + String(event.significance) + "</td>";
+            out += "</tr>";
+            break;
+        }
+        case EXPORT_BODYFILE: {
+            // Body file times are whole Unix seconds
+            int64_t seconds = event.timestamp / TIMESTAMP_MICROS_PER_SECOND;
+            if (event.timestamp < 0 && event.timestamp % TIMESTAMP_MICROS_PER_SECOND) seconds--;
+            String time = String((long long)seconds);
+            out += "0|";  // MD5
+            out += event.target + "|";  // Name
+            out += "0|";  // Inode
+            out += "0|";  // Mode
+            out += "0|";  // UID
+            out += "0|";  // GID
+            out += "0|";  // Size
+            out += time + "|";  // Atime
+            out += time + "|";  // Mtime
+            out += time + "|";  // Ctime
+            out += time;  // Crtime
+            out += "\n";
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+String TimelineGenerator::exportFooter(ExportFormat format, uint32_t event_count) {
+    switch (format) {
+        case EXPORT_JSON: return "],\"event_count\":" + String(event_count) + "}}";
+        case EXPORT_HTML: return "</table><p>Total Events: " + String(event_count) + "</p></body></html>";
+        default: return "";
+    }
+}
+
+// ===========================
+// External Sort
+// ===========================
+//
+// Run file record, little-endian: timestamp (i64), type (u8), significance (u8),
+// then datetime, description, source_artifact, actor, target and details, each
+// as a u32 length followed by the bytes. Runs are only ever read back by this
+// class, from start to end, so there is no header or index.
+
+// Run buffers go to PSRAM when there is some
+static uint8_t* allocSortBuffer() {
+    uint8_t* buffer = (uint8_t*)heap_caps_malloc(TIMELINE_SORT_IO_BUFFER, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!buffer) {
+        buffer = (uint8_t*)heap_caps_malloc(TIMELINE_SORT_IO_BUFFER, MALLOC_CAP_8BIT);
+    }
+    return buffer;
+}
+
+/**
+ * @brief Buffered sequential writer of run records
+ */
+struct SortRunWriter {
+    File file;
+    uint8_t* buffer = nullptr;
+    size_t filled = 0;
+    bool ok = false;
+
+    ~SortRunWriter() {
+        if (buffer) heap_caps_free(buffer);
+    }
+
+    bool begin(File opened) {
+        file = opened;
+        buffer = allocSortBuffer();
+        ok = file && buffer;
+        return ok;
+    }
+
+    void write(const void* data, size_t length) {
+        const uint8_t* bytes = (const uint8_t*)data;
+        while (length > 0) {
+            size_t take = std::min(length, (size_t)TIMELINE_SORT_IO_BUFFER - filled);
+            memcpy(buffer + filled, bytes, take);
+            filled += take;
+            bytes += take;
+            length -= take;
+            if (filled == TIMELINE_SORT_IO_BUFFER) flush();
+        }
+    }
+
+    void flush() {
+        if (filled > 0 && file.write(buffer, filled) != filled) ok = false;
+        filled = 0;
+    }
+
+    void writeString(const String& value) {
+        uint32_t length = value.length();
+        write(&length, sizeof(length));
+        write(value.c_str(), length);
+    }
+
+    void writeEvent(const TimelineEvent& event) {
+        uint8_t head[10];
+        memcpy(head, &event.timestamp, 8);
+        head[8] = event.type;
+        head[9] = event.significance;
+        write(head, sizeof(head));
+        writeString(event.datetime);
+        writeString(event.description);
+        writeString(event.source_artifact);
+        writeString(event.actor);
+        writeString(event.target);
+        writeString(event.details);
+    }
+
+    bool close() {
+        if (file) {
+            if (buffer) flush();
+            file.close();
+        }
+        return ok;
+    }
+};
+
+/**
+ * @brief One input of a merge: a run file read sequentially, or the sorted in-memory store
+ */
+struct SortRunReader {
+    File file;
+    uint8_t* buffer = nullptr;
+    size_t pos = 0;
+    size_t filled = 0;
+    const TimelineStore* memory = nullptr;
+    size_t memory_pos = 0;
+    TimelineEvent decoded;
+    const TimelineEvent* current = nullptr;
+    bool failed = false;
+
+    ~SortRunReader() {
+        if (file) file.close();
+        if (buffer) heap_caps_free(buffer);
+    }
+
+    bool openFile(File opened) {
+        file = opened;
+        buffer = allocSortBuffer();
+        return file && buffer;
+    }
+
+    void openMemory(const TimelineStore& store) {
+        memory = &store;
+    }
+
+    bool read(void* data, size_t length) {
+        uint8_t* bytes = (uint8_t*)data;
+        while (length > 0) {
+            if (pos == filled) {
+                filled = file.read(buffer, TIMELINE_SORT_IO_BUFFER);
+                pos = 0;
+                if (filled == 0) return false;
+            }
+            size_t take = std::min(length, filled - pos);
+            memcpy(bytes, buffer + pos, take);
+            pos += take;
+            bytes += take;
+            length -= take;
+        }
+        return true;
+    }
+
+    bool readString(String& value) {
+        uint32_t length;
+        if (!read(&length, sizeof(length))) return false;
+        value = "";
+        value.reserve(length);
+        while (length > 0) {
+            if (pos == filled) {
+                filled = file.read(buffer, TIMELINE_SORT_IO_BUFFER);
+                pos = 0;
+                if (filled == 0) return false;
+            }
+            size_t take = std::min((size_t)length, filled - pos);
+            value.concat((const char*)buffer + pos, take);
+            pos += take;
+            length -= take;
+        }
+        return true;
+    }
+
+    // Advance to the next event; false at the end of the input or on a short read
+    bool next() {
+        if (memory) {
+            if (memory_pos >= memory->size()) {
+                current = nullptr;
+                return false;
+            }
+            memory->getEvent(memory_pos++, decoded);
+            current = &decoded;
+            return true;
+        }
+
+        current = nullptr;
+        uint8_t head[10];
+        if (!read(head, 1)) return false;   // Clean end of run
+        if (!read(head + 1, sizeof(head) - 1)) {
+            failed = true;
+            return false;
+        }
+        memcpy(&decoded.timestamp, head, 8);
+        decoded.type = (TimelineEventType)std::min<uint8_t>(head[8], EVENT_UNKNOWN);
+        decoded.significance = head[9];
+        if (!readString(decoded.datetime) || !readString(decoded.description) ||
+            !readString(decoded.source_artifact) || !readString(decoded.actor) ||
+            !readString(decoded.target) || !readString(decoded.details)) {
+            failed = true;
+            return false;
+        }
+        current = &decoded;
+        return true;
+    }
+};
+
+/**
+ * @brief k-way merge of sorted inputs by timestamp
+ *
+ * A binary min-heap holds the head of each input. Equal timestamps come out
+ * of the earlier input first, and inputs are given in insertion order, so
+ * the merge keeps the sort stable.
+ */
+template <typename Emit>
+static bool mergeSortedRuns(std::vector<SortRunReader>& readers, Emit emit) {
+    struct Head {
+        int64_t timestamp;
+        uint32_t reader;
+    };
+    auto later = [](const Head& a, const Head& b) {
+        return a.timestamp != b.timestamp ? a.timestamp > b.timestamp : a.reader > b.reader;
+    };
+
+    std::vector<Head> heap;
+    heap.reserve(readers.size());
+    for (uint32_t r = 0; r < readers.size(); r++) {
+        if (readers[r].next()) {
+            heap.push_back({readers[r].current->timestamp, r});
+        } else if (readers[r].failed) {
+            return false;
+        }
+    }
+    std::make_heap(heap.begin(), heap.end(), later);
+
+    while (!heap.empty()) {
+        std::pop_heap(heap.begin(), heap.end(), later);
+        SortRunReader& reader = readers[heap.back().reader];
+        emit(*reader.current);
+        if (reader.next()) {
+            heap.back().timestamp = reader.current->timestamp;
+            std::push_heap(heap.begin(), heap.end(), later);
+        } else {
+            if (reader.failed) return false;
+            heap.pop_back();
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Drops identical events from a merged stream
+ *
+ * Runs are deduplicated as they are built, but an event can recur in
+ * another run. Identical events share their timestamp, so they leave the
+ * merge among the events of one timestamp, though not always next to each
+ * other. The last TIMELINE_SORT_DEDUP_WINDOW events of the current timestamp
+ * are held back; one identical to a held event is merged into it with the
+ * rules of addEvent() and dropped. Held events go out in arrival order.
+ */
+template <typename Emit>
+struct DuplicateFolder {
+    struct Held {
+        uint64_t identity;
+        TimelineEvent event;
+    };
+    Emit& emit;
+    bool enabled;
+    std::deque<Held> held;
+    uint32_t folded = 0;
+
+    DuplicateFolder(Emit& emit, bool enabled) : emit(emit), enabled(enabled) {}
+
+    void add(const TimelineEvent& event) {
+        if (!enabled) {
+            emit(event);
+            return;
+        }
+        if (!held.empty() && held.front().event.timestamp != event.timestamp) finish();
+
+        uint64_t identity = TimelineIndex::identityOf(event);
+        for (Held& entry : held) {
+            if (entry.identity == identity && sameEvent(entry.event, event)) {
+                mergeEvent(entry.event, event);
+                folded++;
+                return;
+            }
+        }
+        if (held.size() >= TIMELINE_SORT_DEDUP_WINDOW) {
+            emit(held.front().event);
+            held.pop_front();
+        }
+        held.push_back({identity, event});
+    }
+
+    void finish() {
+        for (const Held& entry : held) {
+            emit(entry.event);
+        }
+        held.clear();
+    }
+};
+
+bool TimelineGenerator::beginExternalSort(const String& run_dir) {
+    if (!storage) return false;
+    if (isExternalSortActive()) return true;
+
+    String dir = run_dir;
+    if (dir.isEmpty()) {
+        String case_dir = storage->getCaseDirectory();
+        if (case_dir.isEmpty()) return false;
+        dir = case_dir + "/" + TIMELINE_SORT_DIR;
+    }
+    if (!storage->directoryExists(dir) && !storage->createDirectory(dir)) {
+        Serial.println("[Timeline] Cannot create sort directory " + dir);
+        return false;
+    }
+
+    sort_run_dir = dir;
+    spill_failed = false;
+    if (store.getMemoryUsage() >= sort_memory_budget && !spillRun()) {
+        spill_failed = true;
+    }
+
+    Serial.printf("[Timeline] External sort in %s, %u KB budget\n", dir.c_str(), (unsigned)(sort_memory_budget / 1024));
+    return true;
+}
+
+void TimelineGenerator::endExternalSort() {
+    bool dropped = spilled_events > 0;
+    deleteRuns();
+    sort_run_dir = "";
+    spill_failed = false;
 
-    for (const auto& event : events) {
-        // Update timestamp range
-        if (event.timestamp < stats.earliest_timestamp) {
-            stats.earliest_timestamp = event.timestamp;
+    // The statistics counted the spilled events too
+    if (dropped) recountStatistics();
+}
+
+void TimelineGenerator::deleteRuns() {
+    if (storage) {
+        for (const auto& path : sort_runs) {
+            storage->deleteFile(path);
         }
-        if (event.timestamp > stats.latest_timestamp) {
-            stats.latest_timestamp = event.timestamp;
+    }
+    sort_runs.clear();
+    spilled_events = 0;
+}
+
+String TimelineGenerator::nextRunPath() {
+    return sort_run_dir + "/run_" + String(next_run_id++) + ".bin";
+}
+
+size_t TimelineGenerator::sortFanIn() const {
+    // Each input of a merge holds one read buffer, which the budget has to cover
+    size_t fan_in = sort_memory_budget / TIMELINE_SORT_IO_BUFFER;
+    return std::max((size_t)2, std::min(fan_in, (size_t)TIMELINE_SORT_MAX_FANIN));
+}
+
+bool TimelineGenerator::spillRun() {
+    if (store.empty()) return true;
+
+    sortByTimestamp();
+
+    String path = nextRunPath();
+    SortRunWriter writer;
+    if (writer.begin(storage->openFile(path, FILE_WRITE))) {
+        TimelineEvent event;
+        for (uint32_t i = 0; i < store.size(); i++) {
+            store.getEvent(i, event);
+            writer.writeEvent(event);
         }
+    }
+    if (!writer.close()) {
+        Serial.println("[Timeline] Failed to write sort run " + path);
+        storage->deleteFile(path);
+        return false;
+    }
 
-        // Count by type
-        stats.events_by_type[event.type]++;
+    sort_runs.push_back(path);
+    spilled_events += store.size();
+    store.clear();
+    index.clear();
+    file_persisted = 0;
+    file_numbers.clear();
+    file_updates.clear();
+    return true;
+}
 
-        // Count by source
-        stats.events_by_source[event.source_artifact]++;
+bool TimelineGenerator::mergeRunFiles(size_t begin, size_t end, String& merged_path) {
+    std::vector<SortRunReader> readers(end - begin);
+    for (size_t i = begin; i < end; i++) {
+        if (!readers[i - begin].openFile(storage->openFile(sort_runs[i], FILE_READ))) {
+            Serial.println("[Timeline] Cannot open sort run " + sort_runs[i]);
+            return false;
+        }
     }
 
-    return stats;
+    merged_path = nextRunPath();
+    SortRunWriter writer;
+    auto write = [&](const TimelineEvent& event) { writer.writeEvent(event); };
+    DuplicateFolder<decltype(write)> folder(write, deduplicate);
+    bool merged = writer.begin(storage->openFile(merged_path, FILE_WRITE)) &&
+                  mergeSortedRuns(readers, [&](const TimelineEvent& event) { folder.add(event); });
+    if (merged) folder.finish();
+    if (!writer.close() || !merged) {
+        Serial.println("[Timeline] Failed to merge sort runs into " + merged_path);
+        storage->deleteFile(merged_path);
+        return false;
+    }
+    return true;
 }
 
-String TimelineGenerator::getEventTypeName(TimelineEventType type) const {
+bool TimelineGenerator::saveSortedToFile(const String& filename, const String& format) {
+    if (!storage) return false;
+
+    ExportFormat export_format = exportFormatFromName(format);
+    if (export_format == EXPORT_INVALID) return false;
+
+    // The events still in memory form one more input of the final merge
+    sortByTimestamp();
+    size_t fan_in = sortFanIn();
+    size_t run_limit = store.empty() ? fan_in : fan_in - 1;
+
+    // Merge consecutive groups of runs until the rest can be open at once
+    while (sort_runs.size() > run_limit) {
+        std::vector<String> merged_runs;
+        for (size_t begin = 0; begin < sort_runs.size(); begin += fan_in) {
+            size_t end = std::min(begin + fan_in, sort_runs.size());
+            if (end - begin == 1) {
+                merged_runs.push_back(sort_runs[begin]);
+                continue;
+            }
+
+            String merged_path;
+            if (!mergeRunFiles(begin, end, merged_path)) return false;
+            for (size_t i = begin; i < end; i++) {
+                storage->deleteFile(sort_runs[i]);
+            }
+            merged_runs.push_back(merged_path);
+        }
+        sort_runs.swap(merged_runs);
+    }
+
+    std::vector<SortRunReader> readers(sort_runs.size() + (store.empty() ? 0 : 1));
+    for (size_t i = 0; i < sort_runs.size(); i++) {
+        if (!readers[i].openFile(storage->openFile(sort_runs[i], FILE_READ))) {
+            Serial.println("[Timeline] Cannot open sort run " + sort_runs[i]);
+            return false;
+        }
+    }
+    if (!store.empty()) {
+        readers.back().openMemory(store);
+    }
+
+    File out = storage->openFile(filename, FILE_WRITE);
+    if (!out) return false;
+
+    // Format into a chunk and write it out whenever it fills a buffer
+    bool written = true;
+    uint32_t exported = 0;
+    String chunk = exportHeader(export_format);
+    chunk.reserve(TIMELINE_SORT_IO_BUFFER + 1024);
+    auto append = [&](const TimelineEvent& event) {
+        appendExportEvent(chunk, event, export_format, exported == 0);
+        exported++;
+        if (chunk.length() >= TIMELINE_SORT_IO_BUFFER) {
+            written &= out.write((const uint8_t*)chunk.c_str(), chunk.length()) == chunk.length();
+            chunk = "";
+        }
+    };
+    DuplicateFolder<decltype(append)> folder(append, deduplicate);
+    bool merged = mergeSortedRuns(readers, [&](const TimelineEvent& event) { folder.add(event); });
+    folder.finish();
+    chunk += exportFooter(export_format, exported);
+    written &= out.write((const uint8_t*)chunk.c_str(), chunk.length()) == chunk.length();
+    out.close();
+
+    if (!merged || !written) {
+        Serial.println("[Timeline] Sorted export to " + filename + " failed");
+        return false;
+    }
+    Serial.printf("[Timeline] Exported %u events from %u runs to %s, %u duplicates merged\n",
+                  (unsigned)exported, (unsigned)sort_runs.size(), filename.c_str(), (unsigned)folder.folded);
+    return true;
+}
+
+// ===========================
+// Timeline File
+// ===========================
+
+// Event number in the file that has not been assigned, and the flag of a stale file copy
+static const uint32_t NOT_IN_FILE = UINT32_MAX;
+static const uint32_t FILE_UPDATE_PENDING = 0x80000000UL;
+
+bool TimelineGenerator::openTimelineFile(const String& path) {
+    if (!storage) return false;
+    closeTimelineFile();
+
+    String file_path = path;
+    if (file_path.isEmpty()) {
+        String case_dir = storage->getCaseDirectory();
+        if (case_dir.isEmpty()) return false;
+        file_path = case_dir + "/" + TIMELINE_FILE_NAME;
+    }
+
+    // Events already in memory go into the file with the next save, unless it has them
+    file_persisted = 0;
+    file_numbers.assign(store.size(), NOT_IN_FILE);
+    uint32_t matched = 0;
+    if (!store.empty() && storage->fileExists(file_path) && storage->getFileSize(file_path) > 0) {
+        matched = matchFileEvents(file_path);
+    }
+    if (!timeline_file.open(*storage, file_path)) {
+        std::vector<uint32_t>().swap(file_numbers);
+        file_updates.clear();
+        return false;
+    }
+
+    Serial.printf("[Timeline] Timeline file %s: %u events in %u blocks, %u of the %u in memory\n", file_path.c_str(),
+                  (unsigned)timeline_file.getEventCount(), (unsigned)timeline_file.getBlockCount(),
+                  (unsigned)matched, (unsigned)store.size());
+    return true;
+}
+
+uint32_t TimelineGenerator::matchFileEvents(const String& path) {
+    TimelineFileReader reader;
+    if (!reader.open(storage->openFile(path, FILE_READ))) return 0;
+
+    uint32_t matched = 0;
+    reader.query(INT64_MIN, INT64_MAX, [&](const TimelineEvent& event, uint32_t number) {
+        uint32_t position = index.findIdentical(event, TimelineIndex::identityOf(event));
+        if (position == TimelineIndex::NO_EVENT || file_numbers[position] != NOT_IN_FILE) return;
+
+        // The file copy may name sources the memory copy lacks, and the other way round
+        mergeDuplicate(position, event);
+        file_numbers[position] = number;
+        if (store.getSignificance(position) != event.significance ||
+            store.getString(TIMELINE_FIELD_SOURCE, position) != event.source_artifact) {
+            markFileStale(position);
+        }
+        matched++;
+    });
+    return matched;
+}
+
+void TimelineGenerator::markFileStale(uint32_t position) {
+    // Only an event already written needs an update record; the others are written as they are
+    if (position >= file_numbers.size() || file_numbers[position] == NOT_IN_FILE ||
+        (file_numbers[position] & FILE_UPDATE_PENDING)) {
+        return;
+    }
+    file_numbers[position] |= FILE_UPDATE_PENDING;
+    file_updates.push_back(position);
+}
+
+void TimelineGenerator::persistPending() {
+    if (!timeline_file.isOpen()) return;
+    file_numbers.resize(store.size(), NOT_IN_FILE);
+    for (; file_persisted < store.size(); file_persisted++) {
+        if (file_numbers[file_persisted] != NOT_IN_FILE) continue;     // Matched in the file when it was opened
+        uint32_t number = timeline_file.getEventCount();
+        if (!timeline_file.append(store, file_persisted)) break;
+        file_numbers[file_persisted] = number;
+    }
+
+    size_t written = 0;
+    for (; written < file_updates.size(); written++) {
+        uint32_t position = file_updates[written];
+        uint32_t number = file_numbers[position] & ~FILE_UPDATE_PENDING;
+        if (!timeline_file.update(store, position, number)) break;
+        file_numbers[position] = number;
+    }
+    file_updates.erase(file_updates.begin(), file_updates.begin() + written);
+}
+
+bool TimelineGenerator::saveTimelineFile() {
+    if (!timeline_file.isOpen()) return false;
+    persistPending();
+    return file_persisted == store.size() && file_updates.empty() && timeline_file.save();
+}
+
+void TimelineGenerator::closeTimelineFile() {
+    if (!timeline_file.isOpen()) return;
+    persistPending();
+    timeline_file.close();
+    file_persisted = 0;
+    std::vector<uint32_t>().swap(file_numbers);
+    file_updates.clear();
+}
+
+uint32_t TimelineGenerator::loadTimelineFile(const String& path, int64_t start, int64_t end) {
+    if (!storage) return 0;
+
+    TimelineFileReader reader;
+    if (!reader.open(storage->openFile(path, FILE_READ))) {
+        Serial.println("[Timeline] Cannot read timeline file " + path);
+        return 0;
+    }
+
+    // Events read back from the file being written are already in it
+    bool same_file = timeline_file.isOpen() && timeline_file.getPath() == path;
+    if (same_file) persistPending();
+
+    uint32_t loaded = reader.query(start, end, [&](const TimelineEvent& event, uint32_t number) {
+        uint32_t position = store.size();
+        addEvent(event);
+        if (same_file && store.size() > position) {
+            file_numbers.resize(store.size(), NOT_IN_FILE);
+            file_numbers[position] = number;
+            file_persisted = store.size();
+        }
+    });
+    Serial.printf("[Timeline] Loaded %u events from %u of %u blocks of %s\n", (unsigned)loaded,
+                  (unsigned)reader.getBlocksRead(), (unsigned)reader.getBlocks().size(), path.c_str());
+    return loaded;
+}
+
+void TimelineGenerator::resetStatistics() {
+    statistics.total_events = 0;
+    statistics.unique_actors = 0;
+    statistics.unique_targets = 0;
+    statistics.unique_sources = 0;
+    statistics.earliest_timestamp = 0;
+    statistics.latest_timestamp = 0;
+    for (auto& count : statistics.events_by_type) {
+        count = 0;
+    }
+    statistics.events_by_source.clear();
+    actor_sketch.clear();
+    target_sketch.clear();
+    counted_source = "";
+    counted_source_events = nullptr;
+}
+
+void TimelineGenerator::recountStatistics() {
+    resetStatistics();
+    for (uint32_t i = 0; i < store.size(); i++) {
+        countEvent(i);
+    }
+}
+
+void TimelineGenerator::countEvent(uint32_t position) {
+    int64_t timestamp = store.getTimestamp(position);
+    if (statistics.total_events == 0 || timestamp < statistics.earliest_timestamp) {
+        statistics.earliest_timestamp = timestamp;
+    }
+    if (statistics.total_events == 0 || timestamp > statistics.latest_timestamp) {
+        statistics.latest_timestamp = timestamp;
+    }
+    statistics.total_events++;
+    statistics.events_by_type[store.getType(position)]++;
+
+    // A value already counted leaves the sketch, and so the estimate, unchanged
+    if (store.getTextId(TIMELINE_FIELD_ACTOR, position) != TimelineStringPool::EMPTY) {
+        actor_sketch.add(store.getText(TIMELINE_FIELD_ACTOR, position), store.getTextLength(TIMELINE_FIELD_ACTOR, position));
+        statistics.unique_actors = actor_sketch.estimate();
+    }
+    if (store.getTextId(TIMELINE_FIELD_TARGET, position) != TimelineStringPool::EMPTY) {
+        target_sketch.add(store.getText(TIMELINE_FIELD_TARGET, position), store.getTextLength(TIMELINE_FIELD_TARGET, position));
+        statistics.unique_targets = target_sketch.estimate();
+    }
+
+    // A merged duplicate's source is a "; "-separated list, and each of them reported it
+    for (const char* item = store.getText(TIMELINE_FIELD_SOURCE, position); *item; ) {
+        const char* end = strstr(item, "; ");
+        size_t length = end ? end - item : strlen(item);
+        countSource(item, length);
+        if (!end) break;
+        item = end + 2;
+    }
+}
+
+void TimelineGenerator::countSource(const char* source, size_t length) {
+    if (length == 0) return;
+
+    // Events come in runs from one artifact: keep its counter at hand
+    if (!counted_source_events || counted_source.length() != length ||
+        memcmp(counted_source.c_str(), source, length) != 0) {
+        counted_source = "";
+        counted_source.concat(source, length);
+        counted_source_events = &statistics.events_by_source[counted_source];
+        statistics.unique_sources = statistics.events_by_source.size();
+    }
+    (*counted_source_events)++;
+}
+
+String TimelineGenerator::getEventTypeName(TimelineEventType type) {
     switch (type) {
         case EVENT_FILE_CREATED: return "file_created";
         case EVENT_FILE_MODIFIED: return "file_modified";
@@ -857,14 +2008,28 @@ String TimelineGenerator::getEventTypeName(TimelineEventType type) const {
     }
 }
 
-unsigned long TimelineGenerator::parseTimestamp(const String& timestamp_str) {
-    // Simplified timestamp parsing
-    // In production, would use proper date parsing library
-    return millis(); // Placeholder
+int64_t TimelineGenerator::parseTimestamp(const String& timestamp_str) {
+    int64_t micros;
+    return timestamp_parser.parse(timestamp_str, micros) ? micros : 0;
+}
+
+int64_t TimelineGenerator::parseTimestamp(const CSVField& field) {
+    int64_t micros;
+    return timestamp_parser.parse(field.data, field.length, micros) ? micros : 0;
 }
 
-String TimelineGenerator::formatTimestamp(unsigned long timestamp) {
-    return String(timestamp);
+String TimelineGenerator::formatTimestamp(int64_t timestamp) {
+    return TimestampParser::format(timestamp);
+}
+
+int64_t TimelineGenerator::currentTimestamp() {
+    // The clock is only meaningful once set (SNTP or the host); before that it counts from 1970
+    struct timeval now;
+    gettimeofday(&now, nullptr);
+    if (now.tv_sec > 946684800) {   // 2000-01-01
+        return (int64_t)now.tv_sec * TIMESTAMP_MICROS_PER_SECOND + now.tv_usec;
+    }
+    return (int64_t)millis() * 1000;
 }
 
 bool TimelineGenerator::isCSVFile(const String& filename) {
@@ -879,24 +2044,3 @@ bool TimelineGenerator::isJSONFile(const String& filename) {
     return filename.endsWith(".json");
 }
 
-std::vector<String> TimelineGenerator::parseCSVLine(const String& line) {
-    std::vector<String> fields;
-    String current_field = "";
-    bool in_quotes = false;
-
-    for (size_t i = 0; i < line.length(); i++) {
-        char c = line[i];
-
-        if (c == '"') {
-            in_quotes = !in_quotes;
-        } else if (c == ',' && !in_quotes) {
-            fields.push_back(current_field);
-            current_field = "";
-        } else {
-            current_field += c;
-        }
-    }
-
-    fields.push_back(current_field);
-    return fields;
-}
@@ -0,0 +1,268 @@
+#include "timeline_index.h"
+#include <algorithm>
+
+const uint32_t TimelineIndex::EntityIndex::NO_LIST;
+const uint32_t TimelineIndex::NO_EVENT;
+
+// ===========================
+// Entity Index
+// ===========================
+
+static inline uint32_t hashTextId(uint32_t text_id) {
+    // Pool ids are arena positions: multiply, then fold the high half into the bits the mask keeps
+    uint32_t hash = text_id * 2654435761UL;
+    return hash ^ (hash >> 16);
+}
+
+void TimelineIndex::EntityIndex::clear() {
+    slots.assign(256, NO_LIST);
+    text_ids.clear();
+    offsets.assign(1, 0);
+    postings.clear();
+    pending.clear();
+}
+
+size_t TimelineIndex::EntityIndex::probe(uint32_t text_id) const {
+    size_t mask = slots.size() - 1;
+    size_t slot = hashTextId(text_id) & mask;
+    while (slots[slot] != NO_LIST && text_ids[slots[slot]] != text_id) {
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+void TimelineIndex::EntityIndex::grow() {
+    std::vector<uint32_t> grown(slots.size() * 2, NO_LIST);
+    size_t mask = grown.size() - 1;
+    for (uint32_t list = 0; list < text_ids.size(); list++) {
+        size_t slot = hashTextId(text_ids[list]) & mask;
+        while (grown[slot] != NO_LIST) slot = (slot + 1) & mask;
+        grown[slot] = list;
+    }
+    slots.swap(grown);
+}
+
+void TimelineIndex::EntityIndex::add(uint32_t text_id, uint32_t index) {
+    if (text_id == TimelineStringPool::EMPTY) return;
+
+    size_t slot = probe(text_id);
+    if (slots[slot] != NO_LIST) {
+        pending.push_back({slots[slot], index});
+        return;
+    }
+
+    slots[slot] = text_ids.size();
+    pending.push_back({(uint32_t)text_ids.size(), index});
+    text_ids.push_back(text_id);
+
+    // Keep the load factor under 3/4
+    if (text_ids.size() * 4 > slots.size() * 3) {
+        grow();
+    }
+}
+
+void TimelineIndex::EntityIndex::mergePending() const {
+    if (pending.empty()) return;
+
+    // Offsets of the merged lists: old length plus pending count, summed
+    size_t merged_lists = offsets.size() - 1;
+    std::vector<uint32_t> merged(text_ids.size() + 1, 0);
+    for (size_t list = 0; list < merged_lists; list++) {
+        merged[list + 1] = offsets[list + 1] - offsets[list];
+    }
+    for (const Pending& entry : pending) {
+        merged[entry.list + 1]++;
+    }
+    for (size_t list = 0; list < text_ids.size(); list++) {
+        merged[list + 1] += merged[list];
+    }
+
+    // Lists only move right: moving the last one first never overwrites one still to move
+    postings.resize(merged.back());
+    for (size_t list = merged_lists; list-- > 0;) {
+        memmove(&postings[merged[list]], &postings[offsets[list]],
+                (offsets[list + 1] - offsets[list]) * sizeof(uint32_t));
+    }
+
+    // Pending positions are later than every merged one, so each goes after its list's old
+    // positions. The old offsets become the write cursors
+    offsets.resize(text_ids.size() + 1, 0);
+    for (size_t list = 0; list < text_ids.size(); list++) {
+        uint32_t old_length = list < merged_lists ? offsets[list + 1] - offsets[list] : 0;
+        offsets[list] = merged[list] + old_length;
+    }
+    for (const Pending& entry : pending) {
+        postings[offsets[entry.list]++] = entry.index;
+    }
+
+    offsets.swap(merged);
+    std::vector<Pending>().swap(pending);
+}
+
+TimelineSpan TimelineIndex::EntityIndex::find(uint32_t text_id) const {
+    uint32_t list = slots[probe(text_id)];
+    if (list == NO_LIST) return {nullptr, 0};
+
+    mergePending();
+    return {postings.data() + offsets[list], offsets[list + 1] - offsets[list]};
+}
+
+size_t TimelineIndex::EntityIndex::getMemoryUsage() const {
+    return slots.capacity() * sizeof(uint32_t) +
+           text_ids.capacity() * sizeof(uint32_t) +
+           offsets.capacity() * sizeof(uint32_t) +
+           postings.capacity() * sizeof(uint32_t) +
+           pending.capacity() * sizeof(Pending);
+}
+
+// ===========================
+// Timeline Index
+// ===========================
+
+TimelineIndex::TimelineIndex(const TimelineStore& store) : store(store), identity_count(0), time_sorted(0) {
+    clear();
+}
+
+void TimelineIndex::clear() {
+    for (auto& list : types) {
+        list.clear();
+    }
+    actors.clear();
+    targets.clear();
+    identities.assign(1024, {0, NO_EVENT});
+    identity_count = 0;
+    by_time.clear();
+    time_sorted = 0;
+}
+
+void TimelineIndex::add(uint32_t index) {
+    add(index, identityOf(store.getTimestamp(index), store.getType(index),
+                          store.getText(TIMELINE_FIELD_TARGET, index), store.getTextLength(TIMELINE_FIELD_TARGET, index),
+                          store.getText(TIMELINE_FIELD_ACTOR, index), store.getTextLength(TIMELINE_FIELD_ACTOR, index)));
+}
+
+void TimelineIndex::add(uint32_t index, uint64_t identity) {
+    types[store.getType(index)].push_back(index);
+    addIdentity(identity, index);
+    actors.add(store.getTextId(TIMELINE_FIELD_ACTOR, index), index);
+    targets.add(store.getTextId(TIMELINE_FIELD_TARGET, index), index);
+
+    // In order as long as nothing is pending and the timestamp does not go back
+    bool in_order = time_sorted == by_time.size() &&
+                    (by_time.empty() || store.getTimestamp(by_time.back()) <= store.getTimestamp(index));
+    by_time.push_back(index);
+    if (in_order) time_sorted++;
+}
+
+void TimelineIndex::rebuild() {
+    clear();
+    for (uint32_t i = 0; i < store.size(); i++) {
+        add(i);
+    }
+
+    // Lay the entity lists out now rather than on the first query
+    actors.mergePending();
+    targets.mergePending();
+}
+
+void TimelineIndex::mergePending() const {
+    if (time_sorted == by_time.size()) return;
+
+    // Pending positions are all later than the sorted ones, so a stable order by
+    // timestamp alone keeps ties in position order
+    const std::vector<int64_t>& timestamps = store.getTimestamps();
+    auto earlier = [&](uint32_t a, uint32_t b) { return timestamps[a] < timestamps[b]; };
+    std::stable_sort(by_time.begin() + time_sorted, by_time.end(), earlier);
+    std::inplace_merge(by_time.begin(), by_time.begin() + time_sorted, by_time.end(), earlier);
+    time_sorted = by_time.size();
+}
+
+uint64_t TimelineIndex::identityOf(int64_t timestamp, uint8_t type, const char* target, uint32_t target_length,
+                                   const char* actor, uint32_t actor_length) {
+    // 64-bit FNV-1a; the strings are length-prefixed so their boundary is part of the hash
+    uint64_t hash = 14695981039346656037ULL;
+    auto mix = [&](const void* data, size_t length) {
+        const uint8_t* bytes = (const uint8_t*)data;
+        for (size_t i = 0; i < length; i++) {
+            hash = (hash ^ bytes[i]) * 1099511628211ULL;
+        }
+    };
+    mix(&timestamp, sizeof(timestamp));
+    mix(&type, sizeof(type));
+    mix(&target_length, sizeof(target_length));
+    mix(target, target_length);
+    mix(&actor_length, sizeof(actor_length));
+    mix(actor, actor_length);
+    return hash;
+}
+
+uint64_t TimelineIndex::identityOf(const TimelineEvent& event) {
+    return identityOf(event.timestamp, event.type, event.target.c_str(), event.target.length(),
+                      event.actor.c_str(), event.actor.length());
+}
+
+void TimelineIndex::addIdentity(uint64_t identity, uint32_t index) {
+    size_t mask = identities.size() - 1;
+    size_t slot = identity & mask;
+    while (identities[slot].index != NO_EVENT) slot = (slot + 1) & mask;
+    identities[slot] = {identity, index};
+    identity_count++;
+
+    // Keep the load factor under 3/4; slots keep their hash, so growing reads no strings
+    if (identity_count * 4 > identities.size() * 3) {
+        std::vector<IdentitySlot> grown(identities.size() * 2, {0, NO_EVENT});
+        mask = grown.size() - 1;
+        for (const IdentitySlot& entry : identities) {
+            if (entry.index == NO_EVENT) continue;
+            size_t to = entry.identity & mask;
+            while (grown[to].index != NO_EVENT) to = (to + 1) & mask;
+            grown[to] = entry;
+        }
+        identities.swap(grown);
+    }
+}
+
+uint32_t TimelineIndex::findIdentical(const TimelineEvent& event, uint64_t identity) const {
+    size_t mask = identities.size() - 1;
+    for (size_t slot = identity & mask; identities[slot].index != NO_EVENT; slot = (slot + 1) & mask) {
+        if (identities[slot].identity != identity) continue;
+
+        // Confirm, so a hash collision cannot merge two different events
+        uint32_t index = identities[slot].index;
+        if (store.getTimestamp(index) == event.timestamp && store.getType(index) == event.type &&
+            store.getTextLength(TIMELINE_FIELD_TARGET, index) == event.target.length() &&
+            store.getTextLength(TIMELINE_FIELD_ACTOR, index) == event.actor.length() &&
+            memcmp(store.getText(TIMELINE_FIELD_TARGET, index), event.target.c_str(), event.target.length()) == 0 &&
+            memcmp(store.getText(TIMELINE_FIELD_ACTOR, index), event.actor.c_str(), event.actor.length()) == 0) {
+            return index;
+        }
+    }
+    return NO_EVENT;
+}
+
+TimelineSpan TimelineIndex::byType(TimelineEventType type) const {
+    if (type > EVENT_UNKNOWN) return {nullptr, 0};
+    return {types[type].data(), (uint32_t)types[type].size()};
+}
+
+TimelineSpan TimelineIndex::byTimeRange(int64_t start, int64_t end) const {
+    mergePending();
+
+    const std::vector<int64_t>& timestamps = store.getTimestamps();
+    auto first = std::lower_bound(by_time.begin(), by_time.end(), start,
+                                  [&](uint32_t index, int64_t time) { return timestamps[index] < time; });
+    auto last = std::upper_bound(first, by_time.end(), end,
+                                 [&](int64_t time, uint32_t index) { return time < timestamps[index]; });
+    if (first >= last) return {nullptr, 0};
+    return {&*first, (uint32_t)(last - first)};
+}
+
+size_t TimelineIndex::getMemoryUsage() const {
+    size_t usage = sizeof(*this) + actors.getMemoryUsage() + targets.getMemoryUsage();
+    for (const auto& list : types) {
+        usage += list.capacity() * sizeof(uint32_t);
+    }
+    usage += identities.capacity() * sizeof(IdentitySlot);
+    usage += by_time.capacity() * sizeof(uint32_t);
+    return usage;
+}
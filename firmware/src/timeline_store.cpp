@@ -0,0 +1,243 @@
+#include "timeline_store.h"
+#include "esp_heap_caps.h"
+
+const uint32_t TimelineStringPool::EMPTY;
+const uint32_t TimelineStringPool::NOT_FOUND;
+
+// ===========================
+// String Pool
+// ===========================
+
+TimelineStringPool::TimelineStringPool() : current_block(0), block_used(0), arena_bytes(0), text_bytes(0), count(0) {
+    clear();
+}
+
+TimelineStringPool::~TimelineStringPool() {
+    for (char* block : blocks) {
+        heap_caps_free(block);
+    }
+}
+
+void TimelineStringPool::clear() {
+    for (char* block : blocks) {
+        heap_caps_free(block);
+    }
+    blocks.clear();
+    index.assign(1024, NOT_FOUND);
+    current_block = 0;
+    block_used = 0;
+    arena_bytes = 0;
+    text_bytes = 0;
+
+    // Id 0 is the empty string, which needs no arena space
+    index[probe(hashText("", 0), "", 0)] = EMPTY;
+    count = 1;
+}
+
+uint32_t TimelineStringPool::hashText(const char* text, size_t length) {
+    // FNV-1a
+    uint32_t hash = 2166136261UL;
+    for (size_t i = 0; i < length; i++) {
+        hash = (hash ^ (uint8_t)text[i]) * 16777619UL;
+    }
+    return hash;
+}
+
+size_t TimelineStringPool::probe(uint32_t hash, const char* text, size_t length) const {
+    // Slot holding the string, or the empty slot where it belongs
+    size_t mask = index.size() - 1;
+    size_t slot = hash & mask;
+    for (; index[slot] != NOT_FOUND; slot = (slot + 1) & mask) {
+        uint32_t id = index[slot];
+        if (this->length(id) == length && memcmp(get(id), text, length) == 0) {
+            break;
+        }
+    }
+    return slot;
+}
+
+uint32_t TimelineStringPool::find(const char* text, size_t length) const {
+    return index[probe(hashText(text, length), text, length)];
+}
+
+char* TimelineStringPool::allocate(size_t bytes, uint32_t& id) {
+    // Blocks go to PSRAM when there is some
+    auto alloc = [](size_t size) {
+        char* block = (char*)heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (!block) {
+            block = (char*)heap_caps_malloc(size, MALLOC_CAP_8BIT);
+        }
+        return block;
+    };
+
+    // Block numbers are 16 bits
+    if (blocks.size() >= 0xFFFF) return nullptr;
+
+    if (bytes > TIMELINE_POOL_BLOCK_SIZE / 4) {
+        // A long string gets a block of its own, and the current block stays open
+        char* block = alloc(bytes);
+        if (!block) return nullptr;
+        blocks.push_back(block);
+        arena_bytes += bytes;
+        id = blocks.size() << 16;
+        return block;
+    }
+
+    // Headers stay 4-byte aligned
+    bytes = (bytes + 3) & ~(size_t)3;
+    if (current_block == 0 || block_used + bytes > TIMELINE_POOL_BLOCK_SIZE) {
+        char* block = alloc(TIMELINE_POOL_BLOCK_SIZE);
+        if (!block) return nullptr;
+        blocks.push_back(block);
+        arena_bytes += TIMELINE_POOL_BLOCK_SIZE;
+        current_block = blocks.size();
+        block_used = 0;
+    }
+    char* text = blocks[current_block - 1] + block_used;
+    id = current_block << 16 | block_used;
+    block_used += bytes;
+    return text;
+}
+
+void TimelineStringPool::growIndex() {
+    // Ids do not keep their hash, so every string is hashed again
+    std::vector<uint32_t> grown(index.size() * 2, NOT_FOUND);
+    size_t mask = grown.size() - 1;
+
+    for (uint32_t id : index) {
+        if (id == NOT_FOUND) continue;
+        size_t slot = hashText(get(id), length(id)) & mask;
+        while (grown[slot] != NOT_FOUND) slot = (slot + 1) & mask;
+        grown[slot] = id;
+    }
+    index.swap(grown);
+}
+
+uint32_t TimelineStringPool::intern(const char* text, size_t length) {
+    size_t slot = probe(hashText(text, length), text, length);
+    if (index[slot] != NOT_FOUND) {
+        return index[slot];
+    }
+
+    uint32_t id;
+    char* copy = allocate(sizeof(uint32_t) + length + 1, id);
+    if (!copy) {
+        Serial.println("[Timeline] String pool out of memory");
+        return EMPTY;
+    }
+    uint32_t stored_length = length;
+    memcpy(copy, &stored_length, sizeof(stored_length));
+    memcpy(copy + sizeof(uint32_t), text, length);
+    copy[sizeof(uint32_t) + length] = '\0';
+    text_bytes += length + 1;
+
+    index[slot] = id;
+    count++;
+
+    // Keep the load factor under 3/4
+    if (count * 4 > index.size() * 3) {
+        growIndex();
+    }
+
+    return id;
+}
+
+size_t TimelineStringPool::getMemoryUsage() const {
+    return sizeof(*this) +
+           arena_bytes +
+           index.capacity() * sizeof(uint32_t) +
+           blocks.capacity() * sizeof(char*);
+}
+
+// ===========================
+// Event Columns
+// ===========================
+
+const String& TimelineStore::fieldOf(const TimelineEvent& event, TimelineField field) {
+    switch (field) {
+        case TIMELINE_FIELD_DATETIME: return event.datetime;
+        case TIMELINE_FIELD_DESCRIPTION: return event.description;
+        case TIMELINE_FIELD_SOURCE: return event.source_artifact;
+        case TIMELINE_FIELD_ACTOR: return event.actor;
+        case TIMELINE_FIELD_TARGET: return event.target;
+        default: return event.details;
+    }
+}
+
+String& TimelineStore::fieldOf(TimelineEvent& event, TimelineField field) {
+    return const_cast<String&>(fieldOf(const_cast<const TimelineEvent&>(event), field));
+}
+
+uint32_t TimelineStore::add(const TimelineEvent& event) {
+    timestamps.push_back(event.timestamp);
+    types.push_back(event.type <= EVENT_UNKNOWN ? event.type : EVENT_UNKNOWN);
+    significance.push_back(event.significance);
+    for (int f = 0; f < TIMELINE_FIELD_COUNT; f++) {
+        const String& text = fieldOf(event, (TimelineField)f);
+        text_ids[f].push_back(pool.intern(text.c_str(), text.length()));
+    }
+    return timestamps.size() - 1;
+}
+
+void TimelineStore::clear() {
+    // Release the columns, not just empty them: a cleared timeline gives its memory back
+    std::vector<int64_t>().swap(timestamps);
+    std::vector<uint8_t>().swap(types);
+    std::vector<uint8_t>().swap(significance);
+    for (auto& column : text_ids) {
+        std::vector<uint32_t>().swap(column);
+    }
+    pool.clear();
+}
+
+void TimelineStore::getEvent(uint32_t index, TimelineEvent& event) const {
+    event.timestamp = timestamps[index];
+    event.type = (TimelineEventType)types[index];
+    event.significance = significance[index];
+    for (int f = 0; f < TIMELINE_FIELD_COUNT; f++) {
+        uint32_t id = text_ids[f][index];
+        String& text = fieldOf(event, (TimelineField)f);
+        text = "";
+        text.concat(pool.get(id), pool.length(id));
+    }
+}
+
+TimelineEvent TimelineStore::getEvent(uint32_t index) const {
+    TimelineEvent event;
+    getEvent(index, event);
+    return event;
+}
+
+template <typename T>
+static void gather(std::vector<T>& column, const std::vector<uint32_t>& order, std::vector<T>& scratch) {
+    scratch.resize(order.size());
+    for (size_t k = 0; k < order.size(); k++) {
+        scratch[k] = column[order[k]];
+    }
+    column.swap(scratch);
+}
+
+void TimelineStore::permute(const std::vector<uint32_t>& order) {
+    // One column at a time, so the scratch space is a single column
+    {
+        std::vector<int64_t> scratch;
+        gather(timestamps, order, scratch);
+    }
+    std::vector<uint8_t> bytes;
+    gather(types, order, bytes);
+    gather(significance, order, bytes);
+    std::vector<uint32_t> ids;
+    for (auto& column : text_ids) {
+        gather(column, order, ids);
+    }
+}
+
+size_t TimelineStore::getMemoryUsage() const {
+    size_t usage = sizeof(*this) - sizeof(pool) + pool.getMemoryUsage();
+    usage += timestamps.capacity() * sizeof(int64_t);
+    usage += types.capacity() + significance.capacity();
+    for (const auto& column : text_ids) {
+        usage += column.capacity() * sizeof(uint32_t);
+    }
+    return usage;
+}
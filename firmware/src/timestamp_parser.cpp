@@ -0,0 +1,407 @@
+#include "timestamp_parser.h"
+
+static const int64_t MICROS_PER_DAY = 86400LL * TIMESTAMP_MICROS_PER_SECOND;
+
+static inline bool isDigitChar(char c) {
+    return (unsigned)(c - '0') <= 9;
+}
+
+static inline unsigned twoDigits(const char* p) {
+    return (p[0] - '0') * 10 + (p[1] - '0');
+}
+
+static inline bool isBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '"';
+}
+
+TimestampParser::TimestampParser() {
+    last_format = TS_FORMAT_UNKNOWN;
+    default_offset = 0;
+    iso_day.length = 0;
+    syslog_day.length = 0;
+    us_day.length = 0;
+
+    // Until told otherwise, syslog years are inferred from the firmware build date ("Mar 15 2024")
+    const char* build_date = __DATE__;
+    int month = syslogMonth(build_date);
+    reference_month = month > 0 ? month : 1;
+    reference_year = atoi(build_date + 7);
+}
+
+void TimestampParser::setReferenceTime(int64_t micros) {
+    int64_t days = micros >= 0 ? micros / MICROS_PER_DAY : -((-micros + MICROS_PER_DAY - 1) / MICROS_PER_DAY);
+    int64_t year;
+    unsigned day;
+    civilFromDays(days, year, reference_month, day);
+    reference_year = (int)year;
+    syslog_day.length = 0;
+}
+
+// ===========================
+// Format Detection
+// ===========================
+
+bool TimestampParser::parse(const char* text, size_t length, int64_t& micros) {
+    last_format = TS_FORMAT_UNKNOWN;
+
+    // CSV fields arrive with quotes and line ends still attached now and then
+    while (length > 0 && isBlank(*text)) {
+        text++;
+        length--;
+    }
+    while (length > 0 && isBlank(text[length - 1])) {
+        length--;
+    }
+    if (length == 0) return false;
+
+    char first = text[0];
+    if (isDigitChar(first)) {
+        if (length >= 10 && text[4] == '-') {
+            return parseISO8601(text, length, micros);
+        }
+        if ((length > 1 && text[1] == '/') || (length > 2 && text[2] == '/')) {
+            return parseUSDate(text, length, micros);
+        }
+        if (length > 2 && first == '0' && (text[1] == 'x' || text[1] == 'X')) {
+            return parseFileTime(text, length, micros);
+        }
+        return parseEpoch(text, length, micros);
+    }
+    if ((first | 0x20) >= 'a' && (first | 0x20) <= 'z') {
+        return parseSyslog(text, length, micros);
+    }
+    return false;
+}
+
+// ===========================
+// Formats
+// ===========================
+
+bool TimestampParser::parseISO8601(const char* text, size_t length, int64_t& micros) {
+    if (length < 10 || text[4] != '-' || text[7] != '-') return false;
+
+    int64_t day;
+    if (!cachedDay(iso_day, text, 10, day)) {
+        static const uint8_t digit_positions[] = {0, 1, 2, 3, 5, 6, 8, 9};
+        for (uint8_t i : digit_positions) {
+            if (!isDigitChar(text[i])) return false;
+        }
+        int64_t year = twoDigits(text) * 100 + twoDigits(text + 2);
+        unsigned month = twoDigits(text + 5);
+        unsigned mday = twoDigits(text + 8);
+        if (month < 1 || month > 12 || mday < 1 || mday > daysInMonth(year, month)) return false;
+        day = daysFromCivil(year, month, mday);
+        storeDay(iso_day, text, 10, day);
+    }
+
+    const char* p = text + 10;
+    const char* end = text + length;
+    int64_t time_of_day = 0;
+    int64_t offset = default_offset;
+
+    if (p < end && (*p == 'T' || *p == 't' || *p == ' ')) {
+        p++;
+        if (!parseTimeOfDay(p, end, false, time_of_day)) return false;
+
+        if (p < end && *p == ' ') p++;
+        if (p < end && (*p == 'Z' || *p == 'z')) {
+            offset = 0;
+            p++;
+        } else if (p < end && (*p == '+' || *p == '-')) {
+            int64_t sign = *p == '-' ? -1 : 1;
+            p++;
+            if (end - p < 2 || !isDigitChar(p[0]) || !isDigitChar(p[1])) return false;
+            unsigned hours = twoDigits(p);
+            unsigned minutes = 0;
+            p += 2;
+            if (p < end && *p == ':') p++;
+            if (end - p >= 2 && isDigitChar(p[0]) && isDigitChar(p[1])) {
+                minutes = twoDigits(p);
+                p += 2;
+            }
+            if (hours > 23 || minutes > 59) return false;
+            offset = sign * (int64_t)(hours * 3600 + minutes * 60) * TIMESTAMP_MICROS_PER_SECOND;
+        } else if (end - p == 3 && (memcmp(p, "UTC", 3) == 0 || memcmp(p, "GMT", 3) == 0)) {
+            offset = 0;
+            p += 3;
+        }
+    }
+    if (p != end) return false;
+
+    micros = day * MICROS_PER_DAY + time_of_day - offset;
+    last_format = TS_FORMAT_ISO8601;
+    return true;
+}
+
+bool TimestampParser::parseFileTime(const char* text, size_t length, int64_t& micros) {
+    uint64_t ticks = 0;
+    if (length > 2 && text[0] == '0' && (text[1] == 'x' || text[1] == 'X')) {
+        if (length > 18) return false;
+        for (size_t i = 2; i < length; i++) {
+            char c = text[i];
+            unsigned nibble;
+            if (isDigitChar(c)) nibble = c - '0';
+            else if ((c | 0x20) >= 'a' && (c | 0x20) <= 'f') nibble = (c | 0x20) - 'a' + 10;
+            else return false;
+            ticks = ticks << 4 | nibble;
+        }
+    } else {
+        if (length == 0 || length > 19) return false;
+        for (size_t i = 0; i < length; i++) {
+            if (!isDigitChar(text[i])) return false;
+            ticks = ticks * 10 + (text[i] - '0');
+        }
+    }
+
+    micros = fileTimeToMicros(ticks);
+    last_format = TS_FORMAT_FILETIME;
+    return true;
+}
+
+bool TimestampParser::parseSyslog(const char* text, size_t length, int64_t& micros) {
+    // "Mar 15 10:22:33", day space-padded ("Mar  5")
+    if (length < 15 || text[3] != ' ' || text[6] != ' ') return false;
+
+    int64_t day;
+    if (!cachedDay(syslog_day, text, 6, day)) {
+        int month = syslogMonth(text);
+        if (month == 0 || !isDigitChar(text[5])) return false;
+        unsigned mday = text[4] == ' ' ? text[5] - '0' : (isDigitChar(text[4]) ? twoDigits(text + 4) : 0);
+
+        int64_t year = reference_year - ((unsigned)month > reference_month ? 1 : 0);
+        if (mday < 1 || mday > daysInMonth(year, month)) return false;
+        day = daysFromCivil(year, month, mday);
+        storeDay(syslog_day, text, 6, day);
+    }
+
+    const char* p = text + 7;
+    int64_t time_of_day;
+    if (!parseTimeOfDay(p, text + length, true, time_of_day) || p != text + length) return false;
+
+    micros = day * MICROS_PER_DAY + time_of_day - default_offset;
+    last_format = TS_FORMAT_SYSLOG;
+    return true;
+}
+
+bool TimestampParser::parseUSDate(const char* text, size_t length, int64_t& micros) {
+    // "3/15/2024 10:22:33 AM", month and day without padding; 24-hour clock when no AM/PM
+    const char* end = text + length;
+    const char* date_end = (const char*)memchr(text, ' ', length);
+    if (!date_end) date_end = end;
+
+    int64_t day;
+    if (!cachedDay(us_day, text, date_end - text, day)) {
+        unsigned parts[3] = {0, 0, 0};
+        unsigned digits[3] = {0, 0, 0};
+        int part = 0;
+        for (const char* p = text; p < date_end; p++) {
+            if (isDigitChar(*p)) {
+                parts[part] = parts[part] * 10 + (*p - '0');
+                digits[part]++;
+            } else if (*p == '/' && part < 2) {
+                part++;
+            } else {
+                return false;
+            }
+        }
+        if (part != 2 || digits[0] == 0 || digits[0] > 2 || digits[1] == 0 || digits[1] > 2 || digits[2] != 4) {
+            return false;
+        }
+        unsigned month = parts[0];
+        unsigned mday = parts[1];
+        if (month < 1 || month > 12 || mday < 1 || mday > daysInMonth(parts[2], month)) return false;
+        day = daysFromCivil(parts[2], month, mday);
+        storeDay(us_day, text, date_end - text, day);
+    }
+
+    int64_t time_of_day = 0;
+    const char* p = date_end;
+    if (p < end) {
+        p++;
+        unsigned hour = 0;
+        if (p < end && isDigitChar(*p)) hour = *p++ - '0';
+        else return false;
+        if (p < end && isDigitChar(*p)) hour = hour * 10 + (*p++ - '0');
+        if (end - p < 3 || *p != ':' || !isDigitChar(p[1]) || !isDigitChar(p[2])) return false;
+        unsigned minute = twoDigits(p + 1);
+        unsigned second = 0;
+        p += 3;
+        if (end - p >= 3 && *p == ':' && isDigitChar(p[1]) && isDigitChar(p[2])) {
+            second = twoDigits(p + 1);
+            p += 3;
+        }
+
+        if (end - p == 3 && p[0] == ' ' && (p[2] | 0x20) == 'm') {
+            char meridiem = p[1] | 0x20;
+            if (hour < 1 || hour > 12 || (meridiem != 'a' && meridiem != 'p')) return false;
+            hour = hour % 12 + (meridiem == 'p' ? 12 : 0);
+            p += 3;
+        }
+        if (p != end || hour > 23 || minute > 59 || second > 60) return false;
+        time_of_day = (int64_t)((hour * 60 + minute) * 60 + second) * TIMESTAMP_MICROS_PER_SECOND;
+    }
+
+    micros = day * MICROS_PER_DAY + time_of_day - default_offset;
+    last_format = TS_FORMAT_US_DATE;
+    return true;
+}
+
+bool TimestampParser::parseEpoch(const char* text, size_t length, int64_t& micros) {
+    uint64_t value = 0;
+    size_t i = 0;
+    while (i < length && isDigitChar(text[i])) {
+        if (i == 19) return false;
+        value = value * 10 + (text[i] - '0');
+        i++;
+    }
+    if (i == 0) return false;
+
+    if (value < 100000000000ULL) {
+        // Seconds, with an optional fraction
+        uint32_t fraction = 0;
+        if (i < length && (text[i] == '.' || text[i] == ',')) {
+            i++;
+            uint32_t scale = 100000;
+            size_t fraction_start = i;
+            while (i < length && isDigitChar(text[i])) {
+                fraction += (text[i] - '0') * scale;
+                scale /= 10;
+                i++;
+            }
+            if (i == fraction_start) return false;
+        }
+        if (i != length) return false;
+        micros = (int64_t)value * TIMESTAMP_MICROS_PER_SECOND + fraction;
+    } else {
+        if (i != length) return false;
+        if (value < 100000000000000ULL) {
+            micros = (int64_t)value * 1000;                 // Milliseconds
+        } else if (value < 100000000000000000ULL) {
+            micros = (int64_t)value;                        // Microseconds
+        } else if (value < 1000000000000000000ULL) {
+            return parseFileTime(text, length, micros);
+        } else {
+            micros = (int64_t)(value / 1000);               // Nanoseconds
+        }
+    }
+
+    last_format = TS_FORMAT_EPOCH;
+    return true;
+}
+
+// ===========================
+// Helpers
+// ===========================
+
+bool TimestampParser::parseTimeOfDay(const char*& p, const char* end, bool seconds_required, int64_t& micros) {
+    // HH:MM[:SS[.ffffff]]
+    if (end - p < 5 || !isDigitChar(p[0]) || !isDigitChar(p[1]) || p[2] != ':' ||
+        !isDigitChar(p[3]) || !isDigitChar(p[4])) {
+        return false;
+    }
+    unsigned hour = twoDigits(p);
+    unsigned minute = twoDigits(p + 3);
+    unsigned second = 0;
+    uint32_t fraction = 0;
+    p += 5;
+
+    if (end - p >= 3 && *p == ':' && isDigitChar(p[1]) && isDigitChar(p[2])) {
+        second = twoDigits(p + 1);
+        p += 3;
+        if (p < end && (*p == '.' || *p == ',')) {
+            p++;
+            const char* fraction_start = p;
+            uint32_t scale = 100000;
+            while (p < end && isDigitChar(*p)) {
+                fraction += (*p - '0') * scale;     // Digits past microseconds add 0
+                scale /= 10;
+                p++;
+            }
+            if (p == fraction_start) return false;
+        }
+    } else if (seconds_required) {
+        return false;
+    }
+
+    if (hour > 23 || minute > 59 || second > 60) return false;
+    micros = (int64_t)((hour * 60 + minute) * 60 + second) * TIMESTAMP_MICROS_PER_SECOND + fraction;
+    return true;
+}
+
+bool TimestampParser::cachedDay(DayCache& cache, const char* prefix, size_t length, int64_t& day) const {
+    if (cache.length != length || memcmp(cache.prefix, prefix, length) != 0) return false;
+    day = cache.day;
+    return true;
+}
+
+void TimestampParser::storeDay(DayCache& cache, const char* prefix, size_t length, int64_t day) {
+    if (length > sizeof(cache.prefix)) return;
+    memcpy(cache.prefix, prefix, length);
+    cache.length = length;
+    cache.day = day;
+}
+
+unsigned TimestampParser::daysInMonth(int64_t year, unsigned month) {
+    static const uint8_t days[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    if (month == 2) {
+        bool leap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+        return leap ? 29 : 28;
+    }
+    return days[month - 1];
+}
+
+int TimestampParser::syslogMonth(const char* name) {
+    static const char months[] = "janfebmaraprmayjunjulaugsepoctnovdec";
+    char lower[3] = {(char)(name[0] | 0x20), (char)(name[1] | 0x20), (char)(name[2] | 0x20)};
+    for (int m = 0; m < 12; m++) {
+        if (memcmp(months + m * 3, lower, 3) == 0) return m + 1;
+    }
+    return 0;
+}
+
+int64_t TimestampParser::daysFromCivil(int64_t year, unsigned month, unsigned day) {
+    // Days since 1970-01-01 (H. Hinnant's algorithm, eras of 400 years)
+    year -= month <= 2;
+    int64_t era = (year >= 0 ? year : year - 399) / 400;
+    unsigned year_of_era = (unsigned)(year - era * 400);
+    unsigned day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    unsigned day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+    return era * 146097 + (int64_t)day_of_era - 719468;
+}
+
+void TimestampParser::civilFromDays(int64_t days, int64_t& year, unsigned& month, unsigned& day) {
+    days += 719468;
+    int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+    unsigned day_of_era = (unsigned)(days - era * 146097);
+    unsigned year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+    unsigned day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+    unsigned mp = (5 * day_of_year + 2) / 153;
+    day = day_of_year - (153 * mp + 2) / 5 + 1;
+    month = mp < 10 ? mp + 3 : mp - 9;
+    year = (int64_t)year_of_era + era * 400 + (month <= 2);
+}
+
+String TimestampParser::format(int64_t micros) {
+    int64_t days = micros / MICROS_PER_DAY;
+    int64_t rest = micros % MICROS_PER_DAY;
+    if (rest < 0) {
+        rest += MICROS_PER_DAY;
+        days--;
+    }
+
+    int64_t year;
+    unsigned month, day;
+    civilFromDays(days, year, month, day);
+    unsigned seconds = (unsigned)(rest / TIMESTAMP_MICROS_PER_SECOND);
+    unsigned fraction = (unsigned)(rest % TIMESTAMP_MICROS_PER_SECOND);
+
+    char buffer[40];
+    int n = snprintf(buffer, sizeof(buffer), "%04lld-%02u-%02uT%02u:%02u:%02u",
+                     (long long)year, month, day, seconds / 3600, seconds / 60 % 60, seconds % 60);
+    if (fraction) {
+        snprintf(buffer + n, sizeof(buffer) - n, ".%06uZ", fraction);
+    } else {
+        snprintf(buffer + n, sizeof(buffer) - n, "Z");
+    }
+    return String(buffer);
+}
@@ -4,6 +4,7 @@ WiFiManager::WiFiManager(FRFDStorage* storagePtr) {
     storage = storagePtr;
     server = nullptr;
     evidence_container = nullptr;
+    performance_monitor = nullptr;
     apActive = false;
     apSSID = "";
     apPassword = "";
@@ -416,6 +417,10 @@ void WiFiManager::setEvidenceContainer(EvidenceContainer* container) {
     evidence_container = container;
 }
 
+void WiFiManager::setPerformanceMonitor(PerformanceMonitor* monitor) {
+    performance_monitor = monitor;
+}
+
 String WiFiManager::getAPIP() {
     return WiFi.softAPIP().toString();
 }
@@ -825,6 +830,11 @@ String WiFiManager::generateStatusJSON() {
     }
     json += "},";
 
+    // Costliest scan rules, for tuning rule packs on real cases
+    if (performance_monitor) {
+        json += "\"rule_stats\":" + performance_monitor->exportRuleStatsJSON(10) + ",";
+    }
+
     json += "\"firmware\":\"" + String(FIRMWARE_VERSION) + "\"";
     json += "}";
 
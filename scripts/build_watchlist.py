@@ -0,0 +1,307 @@
+#!/usr/bin/env python3
+"""
+FRFD Watchlist Builder
+Builds the block-indexed threat-intel watchlist read by the firmware
+(see firmware/include/threat_intel_watchlist.h) from CSV or STIX 2.1 feeds
+
+Inputs:
+  CSV:      type,value[,severity[,label]] per line, optional header row.
+            type is an IOC type name (ip_address, domain, url, md5, sha1, sha256,
+            email, ...) or a common alias (ip, ipv4, hostname, hash, ...).
+            severity is 0-100 (default 50).
+  STIX 2.1: a bundle (or a bare list) of indicator objects; equality
+            comparisons in their patterns become entries, named after the
+            indicator and rated by its confidence.
+
+Usage:
+  build_watchlist.py feed.csv stix_bundle.json -o /sdcard/intel/watchlist.frwl
+"""
+
+import csv
+import json
+import math
+import re
+import struct
+import sys
+import time
+import zlib
+from typing import Dict, Iterable, List, Optional, Tuple
+import argparse
+
+WATCHLIST_MAGIC = 0x4C575246       # "FRWL"
+WATCHLIST_VERSION = 1
+
+HEADER_FORMAT = '<IHHIIIIIIIIII'
+BLOCK_HEADER_FORMAT = '<HHI'
+RECORD_FORMAT = '<QBBBB'
+
+DEFAULT_BLOCK_SIZE = 4096
+DEFAULT_BLOOM_BITS_PER_ENTRY = 10
+DEFAULT_SEVERITY = 50
+
+# IOCType numbering (firmware/include/ioc_extractor.h)
+IOC_TYPES = {
+    'ip_address': 0,
+    'domain': 1,
+    'url': 2,
+    'md5': 3,
+    'sha1': 4,
+    'sha256': 5,
+    'email': 6,
+    'registry_key': 7,
+    'file_path': 8,
+    'mutex': 9,
+    'user_agent': 10,
+    'cve': 11,
+}
+
+TYPE_ALIASES = {
+    'ip': 'ip_address', 'ipv4': 'ip_address', 'ipv4-addr': 'ip_address', 'ip-dst': 'ip_address',
+    'ip-src': 'ip_address', 'hostname': 'domain', 'domain-name': 'domain', 'fqdn': 'domain',
+    'uri': 'url', 'sha-1': 'sha1', 'sha-256': 'sha256', 'email-addr': 'email',
+    'email-src': 'email', 'filepath': 'file_path', 'path': 'file_path',
+}
+
+HASH_TYPES_BY_LENGTH = {32: 'md5', 40: 'sha1', 64: 'sha256'}
+
+# STIX object path -> IOC type name
+STIX_PATHS = {
+    'ipv4-addr:value': 'ip_address',
+    'domain-name:value': 'domain',
+    'url:value': 'url',
+    'email-addr:value': 'email',
+    "file:hashes.'md5'": 'md5',
+    "file:hashes.md5": 'md5',
+    "file:hashes.'sha-1'": 'sha1',
+    "file:hashes.'sha1'": 'sha1',
+    "file:hashes.sha1": 'sha1',
+    "file:hashes.'sha-256'": 'sha256',
+    "file:hashes.'sha256'": 'sha256',
+    "file:hashes.sha256": 'sha256',
+    'mutex:name': 'mutex',
+    'windows-registry-key:key': 'registry_key',
+}
+
+STIX_COMPARISON = re.compile(r"([\w-]+:[\w.'-]+)\s*=\s*'((?:[^'\\]|\\.)*)'")
+
+
+class WatchlistError(Exception):
+    pass
+
+
+def warn(message: str):
+    print(f"[Watchlist] Warning: {message}", file=sys.stderr)
+
+
+# ===========================
+# Feed parsing
+# ===========================
+
+def resolve_type(name: str, value: str) -> Optional[str]:
+    name = name.strip().lower()
+    name = TYPE_ALIASES.get(name, name)
+    if name in ('hash', 'filehash', 'file_hash'):
+        return HASH_TYPES_BY_LENGTH.get(len(value))
+    return name if name in IOC_TYPES else None
+
+
+def read_csv(path: str) -> Iterable[Tuple[str, str, int, str]]:
+    with open(path, 'r', encoding='utf-8', errors='replace', newline='') as f:
+        for line_number, row in enumerate(csv.reader(f), 1):
+            if not row or row[0].startswith('#'):
+                continue
+            if line_number == 1 and row[0].strip().lower() == 'type':
+                continue
+            if len(row) < 2:
+                warn(f"{path}:{line_number}: expected type,value")
+                continue
+
+            value = row[1].strip()
+            type_name = resolve_type(row[0], value)
+            if not type_name:
+                warn(f"{path}:{line_number}: unknown type '{row[0]}'")
+                continue
+
+            severity = DEFAULT_SEVERITY
+            if len(row) > 2 and row[2].strip():
+                try:
+                    severity = int(row[2])
+                except ValueError:
+                    warn(f"{path}:{line_number}: bad severity '{row[2]}'")
+            label = row[3].strip() if len(row) > 3 else ''
+            yield type_name, value, severity, label
+
+
+def read_stix(path: str) -> Iterable[Tuple[str, str, int, str]]:
+    with open(path, 'r', encoding='utf-8') as f:
+        document = json.load(f)
+
+    objects = document.get('objects', []) if isinstance(document, dict) else document
+    for obj in objects:
+        if not isinstance(obj, dict) or obj.get('type') != 'indicator':
+            continue
+        if obj.get('pattern_type', 'stix') != 'stix':
+            continue
+
+        severity = int(obj.get('confidence', DEFAULT_SEVERITY))
+        label = obj.get('name') or obj.get('description') or ''
+        for object_path, value in STIX_COMPARISON.findall(obj.get('pattern', '')):
+            type_name = STIX_PATHS.get(object_path.lower())
+            if not type_name:
+                warn(f"{path}: {obj.get('id', '?')}: unsupported object path {object_path}")
+                continue
+            yield type_name, value.replace("\\'", "'").replace('\\\\', '\\'), severity, label
+
+
+def read_feed(path: str) -> Iterable[Tuple[str, str, int, str]]:
+    if path.lower().endswith('.json'):
+        return read_stix(path)
+    return read_csv(path)
+
+
+# ===========================
+# Image construction
+# ===========================
+
+def make_key(type_code: int, value: bytes) -> int:
+    """64-bit FNV-1a over the type byte and the lowercased value (ThreatIntelWatchlist::makeKey)"""
+    key = ((14695981039346656037 ^ type_code) * 1099511628211) & 0xFFFFFFFFFFFFFFFF
+    for b in value:
+        key = ((key ^ b) * 1099511628211) & 0xFFFFFFFFFFFFFFFF
+    return key
+
+
+def ascii_lower(value: bytes) -> bytes:
+    return bytes(b + 32 if 65 <= b <= 90 else b for b in value)
+
+
+def collect_entries(feeds: List[str]) -> Dict[Tuple[int, bytes], Tuple[int, bytes]]:
+    entries = {}
+    for path in feeds:
+        count = 0
+        for type_name, value, severity, label in read_feed(path):
+            data = ascii_lower(value.encode('utf-8'))
+            if not data or len(data) > 255:
+                warn(f"{path}: value of {len(data)} bytes skipped")
+                continue
+
+            severity = max(0, min(100, severity))
+            label_data = label.encode('utf-8')[:255]
+            identity = (IOC_TYPES[type_name], data)
+
+            # The same indicator from several feeds keeps its highest severity
+            previous = entries.get(identity)
+            if previous is None or severity > previous[0]:
+                entries[identity] = (severity, label_data or (previous[1] if previous else b''))
+            count += 1
+        print(f"[Watchlist] {path}: {count} indicators")
+    return entries
+
+
+def build_bloom(keys: List[int], bits_per_entry: int) -> Tuple[bytearray, int, int]:
+    bits = max(64, (len(keys) * bits_per_entry + 63) // 64 * 64)
+    hashes = max(1, min(32, round(bits / max(1, len(keys)) * math.log(2))))
+
+    bloom = bytearray(bits // 8)
+    for key in keys:
+        h1 = key & 0xFFFFFFFF
+        h2 = (key >> 32) | 1
+        for i in range(hashes):
+            bit = ((h1 + i * h2) & 0xFFFFFFFF) % bits
+            bloom[bit >> 3] |= 1 << (bit & 7)
+    return bloom, bits, hashes
+
+
+def build_blocks(records: List[Tuple[int, int, int, bytes, bytes]], block_size: int) -> Tuple[List[bytes], List[int]]:
+    header_size = struct.calcsize(BLOCK_HEADER_FORMAT)
+    blocks = []
+    first_keys = []
+    current = bytearray()
+    count = 0
+    last_key = None
+
+    def flush():
+        block = struct.pack(BLOCK_HEADER_FORMAT, count, len(current), zlib.crc32(current) & 0xFFFFFFFF) + current
+        blocks.append(block + bytes(block_size - len(block)))
+
+    for key, type_code, severity, value, label in records:
+        record = struct.pack(RECORD_FORMAT, key, type_code, severity, len(value), len(label)) + value + label
+        if header_size + len(record) > block_size:
+            raise WatchlistError(f"block size {block_size} too small for a {len(record)}-byte record")
+
+        if header_size + len(current) + len(record) > block_size:
+            if key == last_key:
+                raise WatchlistError("key collision across a block boundary, try another block size")
+            flush()
+            current = bytearray()
+            count = 0
+        if not current:
+            first_keys.append(key)
+
+        current += record
+        count += 1
+        last_key = key
+
+    if current:
+        flush()
+    return blocks, first_keys
+
+
+def build_watchlist(entries: Dict[Tuple[int, bytes], Tuple[int, bytes]], block_size: int = DEFAULT_BLOCK_SIZE,
+                    bits_per_entry: int = DEFAULT_BLOOM_BITS_PER_ENTRY) -> bytes:
+    records = sorted((make_key(type_code, value), type_code, severity, value, label)
+                     for (type_code, value), (severity, label) in entries.items())
+
+    bloom, bloom_bits, bloom_hashes = build_bloom([r[0] for r in records], bits_per_entry)
+    blocks, first_keys = build_blocks(records, block_size)
+    index = struct.pack(f'<{len(first_keys)}Q', *first_keys)
+
+    header_size = struct.calcsize(HEADER_FORMAT)
+    bloom_offset = header_size
+    index_offset = bloom_offset + len(bloom)
+    blocks_offset = (index_offset + len(index) + block_size - 1) // block_size * block_size
+
+    header = struct.pack(HEADER_FORMAT,
+                         WATCHLIST_MAGIC, WATCHLIST_VERSION, header_size,
+                         block_size, len(blocks), len(records),
+                         bloom_bits, bloom_hashes,
+                         bloom_offset, index_offset, blocks_offset,
+                         zlib.crc32(bytes(bloom) + index) & 0xFFFFFFFF, int(time.time()))
+
+    padding = bytes(blocks_offset - index_offset - len(index))
+    image = header + bytes(bloom) + index + padding + b''.join(blocks)
+
+    false_positive_rate = (1 - math.exp(-bloom_hashes * len(records) / bloom_bits)) ** bloom_hashes
+    print(f"[Watchlist] {len(records)} entries in {len(blocks)} blocks of {block_size} bytes, "
+          f"Bloom filter {bloom_bits // 8} bytes / {bloom_hashes} hashes "
+          f"(~{false_positive_rate:.2%} false positives), "
+          f"{len(bloom) + len(index) + block_size} bytes of RAM, {len(image)} bytes on card")
+    return image
+
+
+def main():
+    parser = argparse.ArgumentParser(description='FRFD Watchlist Builder')
+    parser.add_argument('feeds', nargs='+', help='CSV or STIX 2.1 JSON feeds')
+    parser.add_argument('-o', '--output', required=True, help='Output watchlist file')
+    parser.add_argument('--block-size', type=int, default=DEFAULT_BLOCK_SIZE,
+                        help='Bytes per SD block (default: %(default)s)')
+    parser.add_argument('--bloom-bits', type=int, default=DEFAULT_BLOOM_BITS_PER_ENTRY,
+                        help='Bloom filter bits per entry (default: %(default)s)')
+    args = parser.parse_args()
+
+    if args.block_size < 512 or args.block_size > 65536 or args.block_size % 512:
+        print("[Watchlist] Error: block size must be a multiple of 512 up to 65536", file=sys.stderr)
+        sys.exit(1)
+
+    try:
+        image = build_watchlist(collect_entries(args.feeds), args.block_size, args.bloom_bits)
+        with open(args.output, 'wb') as f:
+            f.write(image)
+    except (WatchlistError, OSError, ValueError) as e:
+        print(f"[Watchlist] Error: {e}", file=sys.stderr)
+        sys.exit(1)
+    print(f"[Watchlist] Wrote {args.output}")
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,734 @@
+#!/usr/bin/env python3
+"""
+FRFD Rule Compiler
+Compiles YARA-subset rule files into the binary rule image executed by the
+firmware (see firmware/include/rule_image.h)
+
+Supported subset:
+  meta:       description, severity, category, platform (others are ignored)
+  strings:    "text" with nocase / ascii / wide,
+              { hex } with ?? wildcards, nibble masks (4? / ?D) and bounded [n-m] jumps,
+              /regex/ with i and s flags (the RegexMatcher syntax; nocase applies too)
+  condition:  any of them, all of them, N of them
+
+Usage:
+  compile_rules.py rules/default.yar -o firmware/include/default_rule_image.h
+  compile_rules.py rules/*.yar -o /sdcard/rules/pack.frri --binary
+  compile_rules.py test/native/TestSupport/rules/mixed_strings.yar \
+      -o test/native/TestSupport/src/mixed_rule_image.h --symbol MIXED_RULE_IMAGE
+
+Also runs as a PlatformIO pre-build script (extra_scripts = pre:scripts/compile_rules.py)
+to regenerate the embedded default rule image when rules/default.yar changes.
+"""
+
+import os
+import re
+import struct
+import sys
+import zlib
+from typing import Dict, List, Optional, Tuple
+import argparse
+
+RULE_IMAGE_MAGIC = 0x49525246      # "FRRI"
+RULE_IMAGE_VERSION = 3
+
+RULE_STRING_TEXT = 0
+RULE_STRING_HEX = 1
+RULE_STRING_REGEX = 2
+
+RULE_STRING_NOCASE = 0x01
+RULE_STRING_ASCII = 0x02
+RULE_STRING_WIDE = 0x04
+RULE_STRING_DOTALL = 0x08
+
+RULE_PATTERN_EXACT_CASE = 0x01
+
+MAX_PATTERNS_PER_RULE = 64
+MAX_HEX_POSITIONS = 64
+HEX_WORD_BITS = 5       # starts, accepts, optional, bit before each optional run, last bit of each run
+DEFAULT_DENSE_BUDGET = 64 * 1024
+
+OUTPUT_FLAG = 0x80000000
+
+HEADER_FORMAT = '<IHHIIIIIIIIIIIIHHIIIIIIIIIIIIIIIIIII'
+RULE_FORMAT = '<IIIIIIHBB'
+STRING_FORMAT = '<IHBB'
+PATTERN_FORMAT = '<IHHBBH'
+
+
+class RuleString:
+    def __init__(self, ident: str, text: str, data: bytes, kind: int, flags: int,
+                 positions: Optional[List[Tuple[int, int, bool]]] = None):
+        self.ident = ident
+        self.text = text
+        self.data = data            # Exact bytes (empty for hex strings with wildcards or jumps, body of a regex)
+        self.kind = kind
+        self.flags = flags
+        self.positions = positions  # (value, mask, optional) per position for the shift-and matcher
+
+
+class Rule:
+    def __init__(self, name: str):
+        self.name = name
+        self.meta: Dict[str, str] = {}
+        self.strings: List[RuleString] = []
+        self.condition = ''
+
+    def threshold(self) -> int:
+        cond = ' '.join(self.condition.split())
+        total = len(self.strings)
+        if cond in ('any', 'any of them'):
+            return 1
+        if cond in ('all', 'all of them'):
+            return total
+        m = re.match(r'^(\d+) of them$', cond)
+        if m:
+            return min(int(m.group(1)), MAX_PATTERNS_PER_RULE)
+        return 0
+
+
+class RuleCompileError(Exception):
+    pass
+
+
+def warn(message: str):
+    print(f"[Rules] Warning: {message}", file=sys.stderr)
+
+
+# ===========================
+# Parsing
+# ===========================
+
+def strip_comments(source: str) -> str:
+    """Remove // and /* */ comments, leaving string literals and regexes untouched"""
+    out = []
+    i = 0
+    in_string = False
+    while i < len(source):
+        c = source[i]
+        if in_string:
+            out.append(c)
+            if c == '\\' and i + 1 < len(source):
+                out.append(source[i + 1])
+                i += 2
+                continue
+            if c == '"':
+                in_string = False
+            i += 1
+        elif c == '"':
+            in_string = True
+            out.append(c)
+            i += 1
+        elif source.startswith('/*', i):
+            end = source.find('*/', i + 2)
+            i = len(source) if end < 0 else end + 2
+        elif source.startswith('//', i) and (i == 0 or source[i - 1] in ' \t\n'):
+            end = source.find('\n', i)
+            i = len(source) if end < 0 else end
+        else:
+            out.append(c)
+            i += 1
+    return ''.join(out)
+
+
+def unescape(text: str) -> bytes:
+    out = bytearray()
+    i = 0
+    while i < len(text):
+        c = text[i]
+        if c == '\\' and i + 1 < len(text):
+            n = text[i + 1]
+            if n == 'n':
+                out.append(0x0A)
+            elif n == 'r':
+                out.append(0x0D)
+            elif n == 't':
+                out.append(0x09)
+            elif n == 'x' and i + 3 < len(text):
+                out.append(int(text[i + 2:i + 4], 16))
+                i += 2
+            else:
+                out += n.encode('utf-8')
+            i += 2
+            continue
+        out += c.encode('utf-8')
+        i += 1
+    return bytes(out)
+
+
+def parse_hex(body: str, where: str) -> Optional[List[Tuple[int, int, bool]]]:
+    """Parse a hex string into (value, mask, optional) positions, as HexPatternMatcher::parse()"""
+    positions: List[Tuple[int, int, bool]] = []
+    jump_last = False
+    for token in re.findall(r'\[[^\]]*\]|\S\S?', body):
+        if token.startswith('['):
+            m = re.fullmatch(r'\[\s*(\d*)\s*(?:-\s*(\d+)\s*)?\]', token)
+            if not m or not positions or (m.group(1) == '' and m.group(2) is None):
+                warn(f"{where}: unsupported jump {token} (unbounded or at the start), string skipped")
+                return None
+            low = int(m.group(1) or 0)
+            high = int(m.group(2)) if m.group(2) is not None else low
+            if high < low:
+                warn(f"{where}: invalid jump {token}, string skipped")
+                return None
+            positions += [(0, 0, False)] * low + [(0, 0, True)] * (high - low)
+            jump_last = True
+            continue
+
+        if not re.fullmatch(r'[0-9A-Fa-f?]{2}', token):
+            warn(f"{where}: unsupported hex token '{token}' (alternations and ~ are not supported), string skipped")
+            return None
+        value = mask = 0
+        if token[0] != '?':
+            value |= int(token[0], 16) << 4
+            mask |= 0xF0
+        if token[1] != '?':
+            value |= int(token[1], 16)
+            mask |= 0x0F
+        positions.append((value, mask, False))
+        jump_last = False
+
+    if not positions or jump_last:
+        warn(f"{where}: hex string is empty or ends with a jump, string skipped")
+        return None
+    if len(positions) > MAX_HEX_POSITIONS:
+        warn(f"{where}: hex string spans more than {MAX_HEX_POSITIONS} positions, string skipped")
+        return None
+    return positions
+
+
+STRING_RE = re.compile(
+    r'\$(\w*)\s*=\s*(?:"((?:[^"\\]|\\.)*)"|\{([^}]*)\}|/((?:[^/\\\n]|\\.)*)/([is]*))([ \t\w]*)')
+UNSUPPORTED_REGEX_RE = re.compile(r'\\[1-9]|\(\?[=!<]')
+RULE_RE = re.compile(r'\brule\s+(\w+)\s*(?::[\s\w]*)?\{')
+
+
+def parse_rules(source: str, filename: str) -> List[Rule]:
+    source = strip_comments(source)
+    rules = []
+
+    pos = 0
+    while True:
+        m = RULE_RE.search(source, pos)
+        if not m:
+            break
+
+        # Find the closing brace, skipping over string literals
+        depth = 1
+        i = m.end()
+        in_string = False
+        while i < len(source) and depth > 0:
+            c = source[i]
+            if in_string:
+                if c == '\\':
+                    i += 1
+                elif c == '"':
+                    in_string = False
+            elif c == '"':
+                in_string = True
+            elif c == '{':
+                depth += 1
+            elif c == '}':
+                depth -= 1
+            i += 1
+        if depth != 0:
+            raise RuleCompileError(f"{filename}: unterminated rule {m.group(1)}")
+
+        rules.append(parse_rule_body(m.group(1), source[m.end():i - 1], filename))
+        pos = i
+
+    return rules
+
+
+def split_sections(body: str) -> Dict[str, str]:
+    # Look for section keywords with string literals blanked out, so "meta:" inside a string is ignored
+    masked = re.sub(r'"(?:[^"\\]|\\.)*"', lambda m: ' ' * len(m.group(0)), body)
+    sections = {}
+    matches = list(re.finditer(r'\b(meta|strings|condition)\s*:', masked))
+    for idx, m in enumerate(matches):
+        end = matches[idx + 1].start() if idx + 1 < len(matches) else len(body)
+        sections[m.group(1)] = body[m.end():end]
+    return sections
+
+
+def parse_rule_body(name: str, body: str, filename: str) -> Rule:
+    rule = Rule(name)
+    sections = split_sections(body)
+
+    for m in re.finditer(r'(\w+)\s*=\s*(?:"((?:[^"\\]|\\.)*)"|(\w+))', sections.get('meta', '')):
+        value = m.group(2) if m.group(2) is not None else m.group(3)
+        rule.meta[m.group(1)] = unescape(value).decode('utf-8', 'replace')
+
+    for m in STRING_RE.finditer(sections.get('strings', '')):
+        ident = '$' + m.group(1)
+        where = f"{filename}: {name}.{ident}"
+        modifiers = m.group(6).split()
+
+        if m.group(4) is not None:
+            body = m.group(4)
+            if not body:
+                warn(f"{where}: empty regular expression skipped")
+                continue
+            if len(body) > 0xFFFF:
+                warn(f"{where}: regular expression longer than 65535 bytes, string skipped")
+                continue
+            if UNSUPPORTED_REGEX_RE.search(body):
+                warn(f"{where}: backreferences and lookaround are not supported, string skipped")
+                continue
+            flags = 0
+            if 'i' in m.group(5) or 'nocase' in modifiers:
+                flags |= RULE_STRING_NOCASE
+            if 's' in m.group(5):
+                flags |= RULE_STRING_DOTALL
+            for modifier in modifiers:
+                if modifier not in ('nocase', 'ascii', 'fullword', 'private'):
+                    warn(f"{where}: modifier '{modifier}' ignored")
+            rule.strings.append(RuleString(ident, f"/{body}/{m.group(5)}", body.encode('utf-8'),
+                                           RULE_STRING_REGEX, flags))
+            continue
+
+        if m.group(3) is not None:
+            positions = parse_hex(m.group(3), where)
+            if positions is None:
+                continue
+            text = '{ ' + ' '.join(m.group(3).split()) + ' }'
+            if all(mask == 0xFF for (_, mask, _) in positions):
+                # Plain bytes run through the Aho-Corasick automaton
+                rule.strings.append(RuleString(ident, text, bytes(v for (v, _, _) in positions),
+                                               RULE_STRING_HEX, 0))
+            else:
+                rule.strings.append(RuleString(ident, text, b'', RULE_STRING_HEX, 0, positions))
+            continue
+
+        data = unescape(m.group(2))
+        if not data:
+            warn(f"{where}: empty string skipped")
+            continue
+        flags = 0
+        if 'nocase' in modifiers:
+            flags |= RULE_STRING_NOCASE
+        if 'wide' in modifiers:
+            flags |= RULE_STRING_WIDE
+        if 'ascii' in modifiers or 'wide' not in modifiers:
+            flags |= RULE_STRING_ASCII
+        for modifier in modifiers:
+            if modifier not in ('nocase', 'wide', 'ascii', 'fullword', 'private'):
+                warn(f"{where}: modifier '{modifier}' ignored")
+        rule.strings.append(RuleString(ident, data.decode('utf-8', 'replace'), data,
+                                       RULE_STRING_TEXT, flags))
+
+    rule.condition = sections.get('condition', '').strip()
+
+    if len(rule.strings) > MAX_PATTERNS_PER_RULE:
+        raise RuleCompileError(f"{filename}: rule {name} has {len(rule.strings)} strings "
+                               f"(max {MAX_PATTERNS_PER_RULE})")
+    if rule.threshold() == 0:
+        warn(f"{filename}: rule {name}: condition '{rule.condition}' is not supported, rule disabled")
+
+    return rule
+
+
+# ===========================
+# Automaton
+# ===========================
+# Mirrors MultiPatternMatcher::compile() so the firmware can attach the
+# tables without rebuilding anything
+
+def fold(b: int) -> int:
+    return b + 32 if 0x41 <= b <= 0x5A else b
+
+
+def build_automaton(patterns: List[bytes], dense_budget: int) -> dict:
+    folded = [bytes(fold(b) for b in p) for p in patterns]
+
+    class_map = [0] * 256
+    num_classes = 1
+    used = set(b for p in folded for b in p)
+    for b in range(256):
+        if b not in used:
+            continue
+        class_map[b] = num_classes
+        if 0x61 <= b <= 0x7A:
+            class_map[b - 32] = num_classes
+        num_classes += 1
+
+    # Trie, children kept in insertion order
+    children: List[List[Tuple[int, int]]] = [[]]
+    outputs: List[List[int]] = [[]]
+    for pid, p in enumerate(folded):
+        state = 0
+        for b in p:
+            c = class_map[b]
+            nxt = next((n for (cls, n) in children[state] if cls == c), None)
+            if nxt is None:
+                nxt = len(children)
+                children.append([])
+                outputs.append([])
+                children[state].append((c, nxt))
+            state = nxt
+        outputs[state].append(pid)
+
+    num_states = len(children)
+    order = [0]
+    head = 0
+    while head < len(order):
+        order.extend(n for (_, n) in children[order[head]])
+        head += 1
+    rank = [0] * num_states
+    for i, s in enumerate(order):
+        rank[s] = i
+
+    dense_states = max(1, min(num_states, dense_budget // (num_classes * 4)))
+
+    fail_all = [0] * num_states
+    merged: List[List[int]] = [[] for _ in range(num_states)]
+    dense = [0] * (dense_states * num_classes)
+
+    for s in range(num_states):
+        old = order[s]
+        merged[s] = list(outputs[old])
+        if s != 0:
+            merged[s] += merged[fail_all[s]]
+        if 0 < s < dense_states:
+            f = fail_all[s]
+            dense[s * num_classes:(s + 1) * num_classes] = dense[f * num_classes:(f + 1) * num_classes]
+
+        for (cls, n) in children[old]:
+            child = rank[n]
+            if s < dense_states:
+                dense[s * num_classes + cls] = child
+            target = 0
+            if s != 0:
+                f = fail_all[s]
+                while True:
+                    if f < dense_states:
+                        target = dense[f * num_classes + cls]
+                        break
+                    hit = next((fn for (fc, fn) in children[order[f]] if fc == cls), None)
+                    if hit is not None:
+                        target = rank[hit]
+                        break
+                    f = fail_all[f]
+            fail_all[child] = target
+
+    output_begin = []
+    output_ids = []
+    for s in range(num_states):
+        output_begin.append(len(output_ids))
+        output_ids.extend(merged[s])
+    output_begin.append(len(output_ids))
+
+    dense = [n | OUTPUT_FLAG if merged[n] else n for n in dense]
+
+    sparse_begin, sparse_class, sparse_next, fail = [], [], [], []
+    for s in range(dense_states, num_states):
+        sparse_begin.append(len(sparse_next))
+        fail.append(fail_all[s])
+        for (cls, n) in children[order[s]]:
+            child = rank[n]
+            sparse_class.append(cls)
+            sparse_next.append(child | OUTPUT_FLAG if merged[child] else child)
+    sparse_begin.append(len(sparse_next))
+
+    return {
+        'class_map': class_map,
+        'num_classes': num_classes,
+        'num_states': num_states,
+        'dense_states': dense_states,
+        'dense': dense,
+        'sparse_begin': sparse_begin,
+        'sparse_class': sparse_class,
+        'sparse_next': sparse_next,
+        'fail': fail,
+        'output_begin': output_begin,
+        'output_ids': output_ids,
+    }
+
+
+def build_hex_tables(patterns: List[List[Tuple[int, int, bool]]]) -> dict:
+    """Shift-and tables, packed exactly as HexPatternMatcher::compile() packs them"""
+    masks: List[int] = []
+    bits: List[int] = []
+    accept_ids: List[int] = []
+    first = bytearray(32)
+
+    used = MAX_HEX_POSITIONS
+    for pid, positions in enumerate(patterns):
+        if used + len(positions) > MAX_HEX_POSITIONS:
+            masks += [0] * 256
+            bits += [0] * HEX_WORD_BITS
+            accept_ids += [0] * 64
+            used = 0
+        w = len(bits) // HEX_WORD_BITS - 1
+        mb = w * 256
+        wb = w * HEX_WORD_BITS
+
+        for j, (value, mask, optional) in enumerate(positions):
+            bit = 1 << (used + j)
+            for c in range(256):
+                if c & mask == value:
+                    masks[mb + c] |= bit
+            if optional:
+                bits[wb + 2] |= bit
+                if not positions[j - 1][2]:
+                    bits[wb + 3] |= bit >> 1
+                if not positions[j + 1][2]:
+                    bits[wb + 4] |= bit
+
+        bits[wb + 0] |= 1 << used
+        bits[wb + 1] |= 1 << (used + len(positions) - 1)
+        accept_ids[w * 64 + used + len(positions) - 1] = pid
+
+        value, mask, _ = positions[0]
+        for c in range(256):
+            if c & mask == value:
+                first[c >> 3] |= 1 << (c & 7)
+
+        used += len(positions)
+
+    return {'masks': masks, 'bits': bits, 'accept_ids': accept_ids, 'first': bytes(first),
+            'word_count': len(bits) // HEX_WORD_BITS}
+
+
+# ===========================
+# Image Writer
+# ===========================
+
+class StringPool:
+    def __init__(self):
+        self.data = bytearray(b'\0')   # Offset 0 is the empty string
+        self.index: Dict[bytes, int] = {b'': 0}
+
+    def add(self, value: bytes, terminate: bool = True) -> int:
+        key = value + (b'\0' if terminate else b'')
+        if key in self.index:
+            return self.index[key]
+        offset = len(self.data)
+        self.data += key
+        self.index[key] = offset
+        return offset
+
+    def add_text(self, value: str) -> int:
+        return self.add(value.encode('utf-8'))
+
+
+def align4(data: bytearray):
+    while len(data) % 4:
+        data.append(0)
+
+
+def has_letters(data: bytes) -> bool:
+    return any(0x41 <= b <= 0x5A or 0x61 <= b <= 0x7A for b in data)
+
+
+def expand_patterns(string: RuleString) -> List[Tuple[bytes, int]]:
+    # The automaton is case-folded; case-sensitive strings that contain letters
+    # are re-checked against the exact bytes on the device. Regexes run beside it
+    if string.kind == RULE_STRING_REGEX:
+        return []
+    if string.kind == RULE_STRING_HEX:
+        if string.positions is not None:
+            return []
+        return [(string.data, RULE_PATTERN_EXACT_CASE if has_letters(string.data) else 0)]
+
+    exact = 0
+    if not string.flags & RULE_STRING_NOCASE and has_letters(string.data):
+        exact = RULE_PATTERN_EXACT_CASE
+
+    out = []
+    if string.flags & RULE_STRING_ASCII:
+        out.append((string.data, exact))
+    if string.flags & RULE_STRING_WIDE:
+        out.append((bytes(b for c in string.data for b in (c, 0)), exact))
+    return out
+
+
+def build_image(rules: List[Rule], dense_budget: int = DEFAULT_DENSE_BUDGET) -> bytes:
+    if len(rules) > 0xFFFF:
+        raise RuleCompileError(f"too many rules ({len(rules)}, max 65535)")
+
+    pool = StringPool()
+    rule_rows = bytearray()
+    string_rows = bytearray()
+    pattern_rows = bytearray()
+    patterns: List[bytes] = []
+    hex_rows = bytearray()
+    hex_patterns: List[List[Tuple[int, int, bool]]] = []
+    regex_rows = bytearray()
+    regex_count = 0
+    string_index = 0
+
+    for r, rule in enumerate(rules):
+        rule_rows += struct.pack(RULE_FORMAT,
+                                 pool.add_text(rule.name),
+                                 pool.add_text(rule.meta.get('description', '')),
+                                 pool.add_text(rule.meta.get('severity', 'medium').lower()),
+                                 pool.add_text(rule.meta.get('category', '')),
+                                 pool.add_text(rule.meta.get('platform', '')),
+                                 string_index,
+                                 len(rule.strings),
+                                 rule.threshold(),
+                                 0)
+
+        for slot, string in enumerate(rule.strings):
+            string_rows += struct.pack(STRING_FORMAT, pool.add_text(string.text),
+                                       min(len(string.data), 0xFFFF), string.kind, string.flags)
+            string_index += 1
+
+            if string.positions is not None:
+                min_length = sum(1 for (_, _, optional) in string.positions if not optional)
+                hex_rows += struct.pack(PATTERN_FORMAT, 0, min_length, r, slot, 0, 0)
+                hex_patterns.append(string.positions)
+
+            if string.kind == RULE_STRING_REGEX:
+                # Compiled by RegexMatcher when the image is attached; the body is NUL-terminated
+                regex_rows += struct.pack(PATTERN_FORMAT, pool.add(string.data), len(string.data), r, slot, 0, 0)
+                regex_count += 1
+
+            for data, flags in expand_patterns(string):
+                pattern_rows += struct.pack(PATTERN_FORMAT, pool.add(data, terminate=False),
+                                            len(data), r, slot, flags, 0)
+                patterns.append(data)
+
+    if len(patterns) > 0xFFFF:
+        raise RuleCompileError(f"too many patterns ({len(patterns)}, max 65535)")
+    if len(hex_patterns) > 0xFFFF:
+        raise RuleCompileError(f"too many hex patterns ({len(hex_patterns)}, max 65535)")
+
+    dfa = build_automaton(patterns, dense_budget)
+    hexes = build_hex_tables(hex_patterns)
+
+    header_size = struct.calcsize(HEADER_FORMAT)
+    body = bytearray()
+    offsets = {}
+
+    def section(name: str, payload: bytes, alignment: int = 4):
+        while (header_size + len(body)) % alignment:
+            body.append(0)
+        offsets[name] = header_size + len(body)
+        body.extend(payload)
+
+    section('rules', rule_rows)
+    section('strings', string_rows)
+    section('patterns', pattern_rows)
+    section('class_map', bytes(dfa['class_map']))
+    section('dense', struct.pack(f"<{len(dfa['dense'])}I", *dfa['dense']))
+    section('sparse_begin', struct.pack(f"<{len(dfa['sparse_begin'])}I", *dfa['sparse_begin']))
+    section('sparse_class', bytes(dfa['sparse_class']))
+    section('sparse_next', struct.pack(f"<{len(dfa['sparse_next'])}I", *dfa['sparse_next']))
+    section('fail', struct.pack(f"<{len(dfa['fail'])}I", *dfa['fail']))
+    section('output_begin', struct.pack(f"<{len(dfa['output_begin'])}I", *dfa['output_begin']))
+    section('output_ids', struct.pack(f"<{len(dfa['output_ids'])}H", *dfa['output_ids']))
+    section('hex_patterns', hex_rows)
+    section('hex_masks', struct.pack(f"<{len(hexes['masks'])}Q", *hexes['masks']), 8)
+    section('hex_bits', struct.pack(f"<{len(hexes['bits'])}Q", *hexes['bits']), 8)
+    section('hex_accept', struct.pack(f"<{len(hexes['accept_ids'])}H", *hexes['accept_ids']))
+    section('hex_first', hexes['first'])
+    section('regex_patterns', regex_rows)
+    section('pool', pool.data)
+    align4(body)
+
+    header = struct.pack(HEADER_FORMAT,
+                         RULE_IMAGE_MAGIC, RULE_IMAGE_VERSION, header_size,
+                         header_size + len(body), zlib.crc32(body) & 0xFFFFFFFF,
+                         len(rules), string_index, len(patterns),
+                         offsets['rules'], offsets['strings'], offsets['patterns'],
+                         offsets['pool'], len(pool.data),
+                         dfa['num_states'], dfa['dense_states'], dfa['num_classes'], 0,
+                         offsets['class_map'], offsets['dense'], offsets['sparse_begin'],
+                         offsets['sparse_class'], offsets['sparse_next'], offsets['fail'],
+                         offsets['output_begin'], offsets['output_ids'],
+                         len(dfa['sparse_next']), len(dfa['output_ids']),
+                         len(hex_patterns), hexes['word_count'],
+                         offsets['hex_patterns'], offsets['hex_masks'], offsets['hex_bits'],
+                         offsets['hex_accept'], offsets['hex_first'],
+                         regex_count, offsets['regex_patterns'])
+
+    print(f"[Rules] {len(rules)} rules, {len(patterns)} patterns, {dfa['num_states']} states "
+          f"({dfa['dense_states']} dense), {dfa['num_classes']} classes, "
+          f"{len(hex_patterns)} hex patterns in {hexes['word_count']} words, {regex_count} regexes, "
+          f"{header_size + len(body)} bytes")
+    return header + bytes(body)
+
+
+DEFAULT_SYMBOL = 'FRFD_DEFAULT_RULE_IMAGE'
+
+
+def write_header(image: bytes, path: str, sources: List[str], symbol: str = DEFAULT_SYMBOL):
+    guard = 'DEFAULT_RULE_IMAGE_H' if symbol == DEFAULT_SYMBOL else symbol + '_H'
+    lines = [
+        '// Generated by scripts/compile_rules.py from ' + ', '.join(sources) + ' - do not edit',
+        f'#ifndef {guard}',
+        f'#define {guard}',
+        '',
+        '#include <Arduino.h>',
+        '',
+        '// Stored in flash and executed in place by RuleImage / MultiPatternMatcher',
+        f'alignas(8) static const uint8_t {symbol}[{len(image)}] = {{',
+    ]
+    for i in range(0, len(image), 16):
+        lines.append('    ' + ', '.join(f'0x{b:02x}' for b in image[i:i + 16]) + ',')
+    lines += [
+        '};',
+        '',
+        f'#endif // {guard}',
+        '',
+    ]
+    with open(path, 'w') as f:
+        f.write('\n'.join(lines))
+
+
+def compile_files(inputs: List[str], output: str, binary: bool, dense_budget: int = DEFAULT_DENSE_BUDGET,
+                  symbol: str = DEFAULT_SYMBOL):
+    rules = []
+    names = set()
+    for path in inputs:
+        with open(path, 'r', encoding='utf-8', errors='replace') as f:
+            for rule in parse_rules(f.read(), path):
+                if rule.name in names:
+                    warn(f"{path}: duplicate rule {rule.name} skipped")
+                    continue
+                names.add(rule.name)
+                rules.append(rule)
+
+    image = build_image(rules, dense_budget)
+    if binary:
+        with open(output, 'wb') as f:
+            f.write(image)
+    else:
+        write_header(image, output, [os.path.basename(p) for p in inputs], symbol)
+    print(f"[Rules] Wrote {output}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description='FRFD Rule Compiler')
+    parser.add_argument('inputs', nargs='+', help='YARA rule files')
+    parser.add_argument('-o', '--output', required=True, help='Output file')
+    parser.add_argument('--binary', action='store_true',
+                        help='Write a raw image (for loadRulesFromFile) instead of a C header')
+    parser.add_argument('--dense-budget', type=int, default=DEFAULT_DENSE_BUDGET,
+                        help='Bytes of dense DFA rows (default: %(default)s)')
+    parser.add_argument('--symbol', default=DEFAULT_SYMBOL,
+                        help='Array name in a C header (default: %(default)s)')
+    args = parser.parse_args()
+
+    try:
+        compile_files(args.inputs, args.output, args.binary, args.dense_budget, args.symbol)
+    except (RuleCompileError, OSError) as e:
+        print(f"[Rules] Error: {e}", file=sys.stderr)
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
+
+elif __name__ == 'SCons.Script':
+    # PlatformIO pre-build hook: regenerate the embedded image when the rules change
+    Import('env')  # noqa: F821
+    project_dir = env.subst('$PROJECT_DIR')  # noqa: F821
+    rules_file = os.path.join(project_dir, 'rules', 'default.yar')
+    header_file = os.path.join(project_dir, 'firmware', 'include', 'default_rule_image.h')
+
+    if os.path.exists(rules_file) and (not os.path.exists(header_file) or
+                                       os.path.getmtime(rules_file) > os.path.getmtime(header_file)):
+        compile_files([rules_file], header_file, binary=False)
@@ -0,0 +1,313 @@
+#!/usr/bin/env python3
+"""
+FRFD Timeline Reader
+Reads the persistent timeline file written by the firmware
+(see firmware/include/timeline_file.h) and prints or exports its events
+
+Only the event blocks whose time range overlaps --start/--end are read. An
+event the firmware updated after writing it (a duplicate merged into it) is
+printed in its latest version. A file without a valid trailer (interrupted
+while saving) is recovered by walking its blocks, as the firmware does.
+
+Times are ISO 8601 (2024-03-01T12:00:00Z, a date alone means midnight UTC)
+or Unix seconds.
+
+Usage:
+  read_timeline.py timeline.frtl --info
+  read_timeline.py timeline.frtl --start 2024-03-01 --end 2024-03-02 -f csv -o window.csv
+"""
+
+import argparse
+import csv
+import json
+import struct
+import sys
+import zlib
+from datetime import datetime, timezone
+from typing import Iterator, List, NamedTuple, Optional
+
+TIMELINE_FILE_MAGIC = 0x4C545246           # "FRTL"
+TIMELINE_FILE_TRAILER_MAGIC = 0x49545246   # "FRTI"
+TIMELINE_FILE_VERSION = 2                  # 1 had no update blocks, and is still read
+
+FILE_HEADER_FORMAT = '<IHHII'
+BLOCK_HEADER_FORMAT = '<B3xIIIqq'
+INDEX_HEADER_FORMAT = '<II'
+INDEX_ENTRY_FORMAT = '<IIqq'
+TRAILER_FORMAT = '<IIII'
+RECORD_FORMAT = '<qBBH6I'
+
+BLOCK_EVENTS = 1
+BLOCK_INDEX = 2
+BLOCK_UPDATES = 3
+
+INT64_MIN = -(1 << 63)
+INT64_MAX = (1 << 63) - 1
+MICROS_PER_SECOND = 1000000
+
+# TimelineEventType numbering and names (TimelineGenerator::getEventTypeName)
+EVENT_TYPES = [
+    'file_created', 'file_modified', 'file_accessed', 'file_deleted',
+    'registry_created', 'registry_modified', 'registry_deleted',
+    'process_started', 'process_terminated', 'network_connection',
+    'login_success', 'login_failure', 'service_started', 'service_stopped',
+    'scheduled_task', 'browser_navigation', 'email_sent', 'email_received',
+    'usb_connected', 'usb_disconnected', 'system_boot', 'system_shutdown',
+    'unknown',
+]
+
+FIELDS = ['datetime', 'description', 'source_artifact', 'actor', 'target', 'details']
+
+
+class TimelineFileError(Exception):
+    pass
+
+
+class BlockEntry(NamedTuple):
+    offset: int
+    event_count: int
+    first_time: int
+    last_time: int
+
+
+def warn(message: str):
+    print(f"[Timeline] Warning: {message}", file=sys.stderr)
+
+
+def block_span(used: int, with_trailer: bool, block_size: int) -> int:
+    size = struct.calcsize(BLOCK_HEADER_FORMAT) + used + (struct.calcsize(TRAILER_FORMAT) if with_trailer else 0)
+    return (size + block_size - 1) // block_size * block_size
+
+
+# ===========================
+# File reading
+# ===========================
+
+class TimelineFile:
+    def __init__(self, path: str, scan: bool = False):
+        with open(path, 'rb') as f:
+            self.data = f.read()
+
+        if len(self.data) < struct.calcsize(FILE_HEADER_FORMAT):
+            raise TimelineFileError(f"{path} is too short")
+        magic, version, header_size, self.block_size, self.created = \
+            struct.unpack_from(FILE_HEADER_FORMAT, self.data, 0)
+        if magic != TIMELINE_FILE_MAGIC or not 1 <= version <= TIMELINE_FILE_VERSION or \
+                header_size < struct.calcsize(FILE_HEADER_FORMAT) or not 512 <= self.block_size <= 65536:
+            raise TimelineFileError(f"{path} is not a timeline file")
+
+        self.blocks: List[BlockEntry] = []
+        self.update_blocks: List[BlockEntry] = []
+        self.event_count = 0
+        self.recovered = scan or not self.read_trailer()
+        if self.recovered:
+            self.scan_blocks()
+
+    def block_header(self, offset: int):
+        header_size = struct.calcsize(BLOCK_HEADER_FORMAT)
+        if offset + header_size > len(self.data):
+            return None
+        kind, count, used, checksum, first_time, last_time = \
+            struct.unpack_from(BLOCK_HEADER_FORMAT, self.data, offset)
+        payload = self.data[offset + header_size:offset + header_size + used]
+        if len(payload) != used or zlib.crc32(payload) & 0xFFFFFFFF != checksum:
+            return None
+        return kind, count, payload, first_time, last_time
+
+    def read_trailer(self) -> bool:
+        trailer_size = struct.calcsize(TRAILER_FORMAT)
+        if len(self.data) < 2 * self.block_size or len(self.data) % self.block_size:
+            return False
+        trailer = self.data[-trailer_size:]
+        magic, index_offset, event_count, checksum = struct.unpack(TRAILER_FORMAT, trailer)
+        if magic != TIMELINE_FILE_TRAILER_MAGIC or zlib.crc32(trailer[:12]) & 0xFFFFFFFF != checksum:
+            return False
+
+        block = self.block_header(index_offset)
+        if not block or block[0] != BLOCK_INDEX:
+            return False
+        _, count, payload, _, _ = block
+        entry_size = struct.calcsize(INDEX_ENTRY_FORMAT)
+        header_size = struct.calcsize(INDEX_HEADER_FORMAT)
+        if len(payload) != header_size + count * entry_size:
+            return False
+
+        # Event blocks, then update blocks (always 0 of them in version 1)
+        self.event_count, update_count = struct.unpack_from(INDEX_HEADER_FORMAT, payload, 0)
+        if update_count > count:
+            return False
+        entries = [BlockEntry(*struct.unpack_from(INDEX_ENTRY_FORMAT, payload, header_size + i * entry_size))
+                   for i in range(count)]
+        self.blocks = entries[:count - update_count]
+        self.update_blocks = entries[count - update_count:]
+        return True
+
+    def scan_blocks(self):
+        offset = self.block_size
+        while offset + struct.calcsize(BLOCK_HEADER_FORMAT) <= len(self.data):
+            block = self.block_header(offset)
+            if not block or block[0] not in (BLOCK_EVENTS, BLOCK_INDEX, BLOCK_UPDATES):
+                offset += self.block_size
+                continue
+            kind, count, payload, first_time, last_time = block
+            if kind == BLOCK_EVENTS:
+                self.blocks.append(BlockEntry(offset, count, first_time, last_time))
+                self.event_count += count
+            elif kind == BLOCK_UPDATES:
+                self.update_blocks.append(BlockEntry(offset, count, first_time, last_time))
+            offset += block_span(len(payload), kind == BLOCK_INDEX, self.block_size)
+
+    def records(self, entry: BlockEntry, kind: int, start: int, end: int) -> Iterator[tuple]:
+        """(record number, event, block payload) for each event of a block with start <= timestamp <= end"""
+        block = self.block_header(entry.offset)
+        if not block or block[0] != kind or block[1] != entry.event_count:
+            warn(f"bad {'update' if kind == BLOCK_UPDATES else 'event'} block at offset {entry.offset}")
+            return
+
+        payload = block[2]
+        record_size = struct.calcsize(RECORD_FORMAT)
+        records_at = entry.event_count * 4 if kind == BLOCK_UPDATES else 0
+        table = records_at + entry.event_count * record_size
+        for r in range(entry.event_count):
+            timestamp, type_code, significance, _, *offsets = \
+                struct.unpack_from(RECORD_FORMAT, payload, records_at + r * record_size)
+            if timestamp < start or timestamp > end:
+                continue
+            event = {
+                'timestamp': timestamp,
+                'type': EVENT_TYPES[min(type_code, len(EVENT_TYPES) - 1)],
+                'significance': significance,
+            }
+            for name, offset in zip(FIELDS, offsets):
+                length, = struct.unpack_from('<I', payload, table + offset)
+                at = table + offset + 4
+                event[name] = payload[at:at + length].decode('utf-8', errors='replace')
+            yield r, event, payload
+
+    def events(self, start: int = INT64_MIN, end: int = INT64_MAX) -> Iterator[dict]:
+        # Latest update of each event in the window, by event number
+        updates = {}
+        for entry in self.update_blocks:
+            if entry.last_time < start or entry.first_time > end:
+                continue
+            for r, event, payload in self.records(entry, BLOCK_UPDATES, start, end):
+                number, = struct.unpack_from('<I', payload, r * 4)
+                updates[number] = event
+
+        number = 0
+        for entry in self.blocks:
+            first = number
+            number += entry.event_count
+            if entry.last_time < start or entry.first_time > end:
+                continue
+            for r, event, _ in self.records(entry, BLOCK_EVENTS, start, end):
+                yield updates.get(first + r, event)
+
+
+# ===========================
+# Output
+# ===========================
+
+def parse_time(text: Optional[str], default: int) -> int:
+    if not text:
+        return default
+    try:
+        return int(float(text) * MICROS_PER_SECOND)
+    except ValueError:
+        pass
+    moment = datetime.fromisoformat(text.replace('Z', '+00:00'))
+    if moment.tzinfo is None:
+        moment = moment.replace(tzinfo=timezone.utc)
+    delta = moment - datetime(1970, 1, 1, tzinfo=timezone.utc)
+    return (delta.days * 86400 + delta.seconds) * MICROS_PER_SECOND + delta.microseconds
+
+
+def format_time(micros: int) -> str:
+    seconds, fraction = divmod(micros, MICROS_PER_SECOND)
+    moment = datetime.fromtimestamp(seconds, tz=timezone.utc)
+    return moment.strftime('%Y-%m-%dT%H:%M:%S') + (f'.{fraction:06d}' if fraction else '') + 'Z'
+
+
+def print_info(timeline: TimelineFile, path: str, verify: bool):
+    print(f"File:        {path}")
+    print(f"Created:     {format_time(timeline.created * MICROS_PER_SECOND)}")
+    print(f"Block size:  {timeline.block_size}")
+    print(f"Events:      {timeline.event_count} in {len(timeline.blocks)} blocks")
+    if timeline.update_blocks:
+        updates = sum(entry.event_count for entry in timeline.update_blocks)
+        print(f"Updates:     {updates} in {len(timeline.update_blocks)} blocks")
+    if timeline.blocks:
+        first = min(entry.first_time for entry in timeline.blocks)
+        last = max(entry.last_time for entry in timeline.blocks)
+        print(f"Time range:  {format_time(first)} to {format_time(last)}")
+    if timeline.recovered:
+        print("Index:       missing or damaged, blocks were walked")
+    if verify:
+        entries = timeline.blocks + timeline.update_blocks
+        bad = [entry.offset for entry in entries if not timeline.block_header(entry.offset)]
+        print(f"Checksums:   {len(entries) - len(bad)} good, {len(bad)} bad")
+        for offset in bad:
+            print(f"  bad block at offset {offset}")
+
+
+def write_events(events: Iterator[dict], output_format: str, out):
+    count = 0
+    if output_format == 'csv':
+        writer = csv.writer(out)
+        # Same columns as the firmware's CSV export
+        writer.writerow(['Timestamp', 'DateTime', 'Type', 'Description', 'Source', 'Actor', 'Target',
+                         'Significance'])
+        for event in events:
+            writer.writerow([event['timestamp'], event['datetime'] or format_time(event['timestamp']),
+                             event['type'], event['description'], event['source_artifact'], event['actor'],
+                             event['target'], event['significance']])
+            count += 1
+    elif output_format == 'jsonl':
+        for event in events:
+            out.write(json.dumps(event) + '\n')
+            count += 1
+    else:
+        # Sleuth Kit body file, whole Unix seconds
+        for event in events:
+            seconds = event['timestamp'] // MICROS_PER_SECOND
+            out.write(f"0|{event['target']}|0|0|0|0|0|{seconds}|{seconds}|{seconds}|{seconds}\n")
+            count += 1
+    return count
+
+
+def main():
+    parser = argparse.ArgumentParser(description='FRFD Timeline Reader')
+    parser.add_argument('timeline', help='Timeline file (.frtl)')
+    parser.add_argument('--start', help='Earliest event time, ISO 8601 or Unix seconds')
+    parser.add_argument('--end', help='Latest event time, ISO 8601 or Unix seconds')
+    parser.add_argument('-f', '--format', choices=['csv', 'jsonl', 'bodyfile'], default='csv',
+                        help='Output format (default: %(default)s)')
+    parser.add_argument('-o', '--output', help='Output file (default: stdout)')
+    parser.add_argument('--info', action='store_true', help='Print a summary instead of the events')
+    parser.add_argument('--verify', action='store_true', help='With --info, check every block checksum')
+    parser.add_argument('--scan', action='store_true', help='Ignore the index and walk the blocks')
+    args = parser.parse_args()
+
+    try:
+        timeline = TimelineFile(args.timeline, args.scan)
+        if timeline.recovered and not args.scan:
+            warn(f"{args.timeline} has no valid index, recovered {timeline.event_count} events")
+
+        if args.info:
+            print_info(timeline, args.timeline, args.verify)
+            return
+
+        events = timeline.events(parse_time(args.start, INT64_MIN), parse_time(args.end, INT64_MAX))
+        if args.output:
+            with open(args.output, 'w', encoding='utf-8', newline='') as out:
+                count = write_events(events, args.format, out)
+            print(f"[Timeline] Wrote {count} events to {args.output}", file=sys.stderr)
+        else:
+            write_events(events, args.format, sys.stdout)
+    except (TimelineFileError, OSError, ValueError, struct.error) as e:
+        print(f"[Timeline] Error: {e}", file=sys.stderr)
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,67 @@
+#include "Arduino.h"
+#include "esp_rom_crc.h"
+#include <stdarg.h>
+#include <chrono>
+#include <thread>
+
+HardwareSerial Serial;
+EspClass ESP;
+
+static const auto boot_time = std::chrono::steady_clock::now();
+
+unsigned long millis() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - boot_time).count();
+}
+
+unsigned long micros() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - boot_time).count();
+}
+
+void delay(unsigned long ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void yield() {
+    std::this_thread::yield();
+}
+
+size_t HardwareSerial::write(const char* data, size_t length) {
+    if (quiet) return length;
+    return fwrite(data, 1, length, stdout);
+}
+
+size_t HardwareSerial::printf(const char* format, ...) {
+    char buffer[512];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    if (length < 0) return 0;
+
+    if ((size_t)length < sizeof(buffer)) return write(buffer, length);
+
+    std::string text(length + 1, '\0');
+    va_start(args, format);
+    vsnprintf(&text[0], text.size(), format, args);
+    va_end(args);
+    return write(text.data(), length);
+}
+
+uint32_t esp_rom_crc32_le(uint32_t crc, const uint8_t* buf, uint32_t len) {
+    static uint32_t table[256];
+    static bool table_ready = false;
+    if (!table_ready) {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; k++) c = (c & 1) ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+            table[i] = c;
+        }
+        table_ready = true;
+    }
+
+    crc = ~crc;
+    for (uint32_t i = 0; i < len; i++) {
+        crc = table[(crc ^ buf[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
@@ -0,0 +1,84 @@
+#ifndef ARDUINO_SHIM_ARDUINO_H
+#define ARDUINO_SHIM_ARDUINO_H
+
+/**
+ * Host stand-in for the parts of the Arduino-ESP32 core that the analysis
+ * modules use. Only built by the native test environment.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include <algorithm>
+#include "WString.h"
+
+using std::min;
+using std::max;
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+#define HEX 16
+#define DEC 10
+
+typedef uint8_t byte;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void yield();
+
+class HardwareSerial {
+public:
+    void begin(unsigned long baud) { (void)baud; }
+    int available() { return 0; }
+    int read() { return -1; }
+    String readStringUntil(char terminator) { (void)terminator; return String(); }
+
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+    size_t print(const String& text) { return write(text.c_str(), text.length()); }
+    size_t print(const char* text) { return write(text, strlen(text)); }
+    size_t print(char c) { return write(&c, 1); }
+    size_t print(int value) { return print(String(value)); }
+    size_t print(unsigned int value) { return print(String(value)); }
+    size_t print(long value) { return print(String(value)); }
+    size_t print(unsigned long value) { return print(String(value)); }
+    size_t print(long long value) { return print(String(value)); }
+    size_t print(unsigned long long value) { return print(String(value)); }
+    size_t print(double value) { return print(String(value)); }
+
+    template <typename T>
+    size_t println(const T& value) { return print(value) + println(); }
+    size_t println() { return print("\n"); }
+
+    size_t write(const char* data, size_t length);
+    void flush() { fflush(stdout); }
+
+    // Host only: drop log output, e.g. while benchmarking
+    void setQuiet(bool enabled) { quiet = enabled; }
+
+private:
+    bool quiet = false;
+};
+
+extern HardwareSerial Serial;
+
+class EspClass {
+public:
+    uint32_t getHeapSize() { return 512 * 1024; }
+    uint32_t getFreeHeap() { return 256 * 1024; }
+    uint32_t getMinFreeHeap() { return 192 * 1024; }
+    uint32_t getMaxAllocHeap() { return 128 * 1024; }
+    uint32_t getPsramSize() { return 8 * 1024 * 1024; }
+    uint32_t getFreePsram() { return 6 * 1024 * 1024; }
+    uint32_t getCpuFreqMHz() { return 240; }
+    const char* getChipModel() { return "host"; }
+    void restart() { exit(0); }
+};
+
+extern EspClass ESP;
+
+#endif // ARDUINO_SHIM_ARDUINO_H
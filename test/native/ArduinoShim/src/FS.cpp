@@ -0,0 +1,262 @@
+#include "FS.h"
+#include "SD.h"
+#include "SPIFFS.h"
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <vector>
+
+SPIClass SPI;
+SDFS SD;
+SPIFFSFS SPIFFS;
+
+namespace fs {
+
+class FileImpl {
+public:
+    FILE* handle = nullptr;
+    bool directory = false;
+    std::string path;               // As the firmware named it
+    std::string host_path;
+    std::string base_name;
+    std::vector<std::string> entries;
+    size_t next_entry = 0;
+
+    ~FileImpl() {
+        if (handle) fclose(handle);
+    }
+};
+
+// ===========================
+// File
+// ===========================
+
+File::operator bool() const {
+    return impl && (impl->handle || impl->directory);
+}
+
+size_t File::write(const uint8_t* buf, size_t size) {
+    if (!impl || !impl->handle) return 0;
+    return fwrite(buf, 1, size, impl->handle);
+}
+
+int File::available() {
+    if (!impl || !impl->handle) return 0;
+    long remaining = (long)size() - (long)position();
+    return remaining > 0 ? (int)std::min<long>(remaining, 0x7FFFFFFF) : 0;
+}
+
+int File::read() {
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+}
+
+int File::peek() {
+    if (!impl || !impl->handle) return -1;
+    int c = fgetc(impl->handle);
+    if (c != EOF) ungetc(c, impl->handle);
+    return c == EOF ? -1 : c;
+}
+
+size_t File::read(uint8_t* buf, size_t size) {
+    if (!impl || !impl->handle) return 0;
+    return fread(buf, 1, size, impl->handle);
+}
+
+String File::readStringUntil(char terminator) {
+    String text;
+    int c;
+    while ((c = read()) >= 0 && c != terminator) {
+        text += (char)c;
+    }
+    return text;
+}
+
+bool File::seek(uint32_t pos, SeekMode mode) {
+    if (!impl || !impl->handle) return false;
+    int whence = mode == SeekCur ? SEEK_CUR : mode == SeekEnd ? SEEK_END : SEEK_SET;
+    long offset = mode == SeekEnd ? -(long)pos : (long)pos;
+    return fseek(impl->handle, offset, whence) == 0;
+}
+
+size_t File::position() const {
+    if (!impl || !impl->handle) return 0;
+    long at = ftell(impl->handle);
+    return at < 0 ? 0 : at;
+}
+
+size_t File::size() const {
+    if (!impl) return 0;
+    if (impl->handle) fflush(impl->handle);
+    struct stat st;
+    return stat(impl->host_path.c_str(), &st) == 0 ? st.st_size : 0;
+}
+
+void File::flush() {
+    if (impl && impl->handle) fflush(impl->handle);
+}
+
+void File::close() {
+    if (impl && impl->handle) {
+        fclose(impl->handle);
+        impl->handle = nullptr;
+    }
+    impl.reset();
+}
+
+const char* File::path() const {
+    return impl ? impl->path.c_str() : "";
+}
+
+const char* File::name() const {
+    return impl ? impl->base_name.c_str() : "";
+}
+
+bool File::isDirectory() const {
+    return impl && impl->directory;
+}
+
+File File::openNextFile(const char* mode) {
+    if (!impl || !impl->directory || impl->next_entry >= impl->entries.size()) return File();
+
+    std::string child = impl->path;
+    if (child.empty() || child.back() != '/') child += '/';
+    child += impl->entries[impl->next_entry++];
+
+    auto opened = std::make_shared<FileImpl>();
+    opened->path = child;
+    opened->base_name = child.substr(child.rfind('/') + 1);
+    opened->host_path = impl->host_path + "/" + opened->base_name;
+
+    struct stat st;
+    if (stat(opened->host_path.c_str(), &st) != 0) return File();
+    if (S_ISDIR(st.st_mode)) {
+        opened->directory = true;
+    } else {
+        opened->handle = fopen(opened->host_path.c_str(), strcmp(mode, FILE_READ) == 0 ? "rb" : "r+b");
+        if (!opened->handle) return File();
+    }
+    return File(opened);
+}
+
+void File::rewindDirectory() {
+    if (impl) impl->next_entry = 0;
+}
+
+// ===========================
+// File System
+// ===========================
+
+const std::string& FS::getRoot() {
+    if (!root.empty()) return root;
+
+    static std::string base;
+    if (base.empty()) {
+        const char* configured = getenv("FRFD_HOST_FS");
+        if (configured && *configured) {
+            base = configured;
+        } else {
+            char temp[] = "/tmp/frfd_host_XXXXXX";
+            base = mkdtemp(temp) ? temp : "/tmp/frfd_host";
+        }
+        ::mkdir(base.c_str(), 0755);
+    }
+    root = base + "/" + name;
+    ::mkdir(root.c_str(), 0755);
+    return root;
+}
+
+std::string FS::hostPath(const char* path) {
+    std::string full = getRoot();
+    if (path[0] != '/') full += '/';
+    full += path;
+    while (full.size() > 1 && full.back() == '/') full.pop_back();
+    return full;
+}
+
+File FS::open(const char* path, const char* mode, bool create) {
+    (void)create;
+    auto opened = std::make_shared<FileImpl>();
+    opened->path = path;
+    opened->host_path = hostPath(path);
+    opened->base_name = opened->path.substr(opened->path.rfind('/') + 1);
+
+    struct stat st;
+    bool exists = stat(opened->host_path.c_str(), &st) == 0;
+    if (exists && S_ISDIR(st.st_mode)) {
+        DIR* dir = opendir(opened->host_path.c_str());
+        if (!dir) return File();
+        while (dirent* entry = readdir(dir)) {
+            if (strcmp(entry->d_name, ".") != 0 && strcmp(entry->d_name, "..") != 0) {
+                opened->entries.push_back(entry->d_name);
+            }
+        }
+        closedir(dir);
+        std::sort(opened->entries.begin(), opened->entries.end());
+        opened->directory = true;
+        return File(opened);
+    }
+
+    const char* host_mode = "rb";
+    if (strcmp(mode, FILE_WRITE) == 0) {
+        host_mode = "w+b";
+    } else if (strcmp(mode, FILE_APPEND) == 0) {
+        host_mode = "a+b";
+    } else if (strcmp(mode, "r+") == 0) {
+        host_mode = "r+b";
+    } else if (!exists) {
+        return File();
+    }
+
+    opened->handle = fopen(opened->host_path.c_str(), host_mode);
+    if (!opened->handle) return File();
+    return File(opened);
+}
+
+bool FS::exists(const char* path) {
+    struct stat st;
+    return stat(hostPath(path).c_str(), &st) == 0;
+}
+
+bool FS::remove(const char* path) {
+    return unlink(hostPath(path).c_str()) == 0;
+}
+
+bool FS::rename(const char* from, const char* to) {
+    return ::rename(hostPath(from).c_str(), hostPath(to).c_str()) == 0;
+}
+
+bool FS::mkdir(const char* path) {
+    return ::mkdir(hostPath(path).c_str(), 0755) == 0;
+}
+
+bool FS::rmdir(const char* path) {
+    return ::rmdir(hostPath(path).c_str()) == 0;
+}
+
+static void removeTree(const std::string& path) {
+    struct stat st;
+    if (lstat(path.c_str(), &st) != 0) return;
+    if (S_ISDIR(st.st_mode)) {
+        if (DIR* dir = opendir(path.c_str())) {
+            while (dirent* entry = readdir(dir)) {
+                if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) continue;
+                removeTree(path + "/" + entry->d_name);
+            }
+            closedir(dir);
+        }
+        ::rmdir(path.c_str());
+    } else {
+        unlink(path.c_str());
+    }
+}
+
+void FS::wipe() {
+    removeTree(getRoot());
+    ::mkdir(root.c_str(), 0755);
+}
+
+} // namespace fs
@@ -0,0 +1,106 @@
+#ifndef ARDUINO_SHIM_FS_H
+#define ARDUINO_SHIM_FS_H
+
+#include <Arduino.h>
+#include <memory>
+#include <string>
+
+#define FILE_READ   "r"
+#define FILE_WRITE  "w"
+#define FILE_APPEND "a"
+
+namespace fs {
+
+enum SeekMode { SeekSet = 0, SeekCur = 1, SeekEnd = 2 };
+
+class FileImpl;
+
+/**
+ * @brief Host version of fs::File over a host file or directory
+ *
+ * Copies share the open handle, as on the device.
+ */
+class File {
+public:
+    File() {}
+    explicit File(std::shared_ptr<FileImpl> impl) : impl(impl) {}
+
+    explicit operator bool() const;
+
+    size_t write(uint8_t c) { return write(&c, 1); }
+    size_t write(const uint8_t* buf, size_t size);
+    size_t print(const String& text) { return write((const uint8_t*)text.c_str(), text.length()); }
+    size_t print(const char* text) { return write((const uint8_t*)text, strlen(text)); }
+    size_t println(const String& text) { return print(text) + print("\n"); }
+    size_t println(const char* text) { return print(text) + print("\n"); }
+
+    int available();
+    int read();
+    int peek();
+    size_t read(uint8_t* buf, size_t size);
+    size_t readBytes(char* buf, size_t size) { return read((uint8_t*)buf, size); }
+    String readStringUntil(char terminator);
+
+    bool seek(uint32_t pos, SeekMode mode);
+    bool seek(uint32_t pos) { return seek(pos, SeekSet); }
+    size_t position() const;
+    size_t size() const;
+    void flush();
+    void close();
+
+    const char* path() const;
+    const char* name() const;
+    bool isDirectory() const;
+    File openNextFile(const char* mode = FILE_READ);
+    void rewindDirectory();
+
+private:
+    std::shared_ptr<FileImpl> impl;
+};
+
+/**
+ * @brief Host version of fs::FS, rooted in a host directory
+ *
+ * Each file system lives in its own directory under FRFD_HOST_FS, or under a
+ * fresh directory in /tmp.
+ */
+class FS {
+public:
+    explicit FS(const char* name) : name(name) {}
+
+    File open(const char* path, const char* mode = FILE_READ, bool create = false);
+    File open(const String& path, const char* mode = FILE_READ, bool create = false) {
+        return open(path.c_str(), mode, create);
+    }
+    bool exists(const char* path);
+    bool exists(const String& path) { return exists(path.c_str()); }
+    bool remove(const char* path);
+    bool remove(const String& path) { return remove(path.c_str()); }
+    bool rename(const char* from, const char* to);
+    bool rename(const String& from, const String& to) { return rename(from.c_str(), to.c_str()); }
+    bool mkdir(const char* path);
+    bool mkdir(const String& path) { return mkdir(path.c_str()); }
+    bool rmdir(const char* path);
+    bool rmdir(const String& path) { return rmdir(path.c_str()); }
+
+    // Host only
+    std::string hostPath(const char* path);
+    void wipe();                    // Delete everything, e.g. between tests
+
+protected:
+    const char* name;
+    std::string root;
+
+    const std::string& getRoot();
+};
+
+} // namespace fs
+
+using fs::FS;
+using fs::File;
+using fs::SeekMode;
+using fs::SeekSet;
+using fs::SeekCur;
+using fs::SeekEnd;
+
+#endif // ARDUINO_SHIM_FS_H
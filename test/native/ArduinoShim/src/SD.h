@@ -0,0 +1,35 @@
+#ifndef ARDUINO_SHIM_SD_H
+#define ARDUINO_SHIM_SD_H
+
+#include "FS.h"
+
+typedef enum { CARD_NONE, CARD_MMC, CARD_SD, CARD_SDHC, CARD_UNKNOWN } sdcard_type_t;
+
+class SPIClass {};
+extern SPIClass SPI;
+
+class SDFS : public fs::FS {
+public:
+    SDFS() : fs::FS("sd") {}
+
+    bool begin(uint8_t ss = 0, SPIClass& spi = SPI, uint32_t frequency = 4000000, const char* mountpoint = "/sd",
+               uint8_t max_files = 5, bool format_if_empty = false) {
+        (void)ss; (void)spi; (void)frequency; (void)mountpoint; (void)max_files; (void)format_if_empty;
+        return available;
+    }
+    void end() {}
+    sdcard_type_t cardType() { return available ? CARD_SDHC : CARD_NONE; }
+    uint64_t cardSize() { return 32ULL * 1024 * 1024 * 1024; }
+    uint64_t totalBytes() { return cardSize(); }
+    uint64_t usedBytes() { return 0; }
+
+    // Host only: simulate a missing card
+    void setAvailable(bool present) { available = present; }
+
+private:
+    bool available = true;
+};
+
+extern SDFS SD;
+
+#endif // ARDUINO_SHIM_SD_H
@@ -0,0 +1,22 @@
+#ifndef ARDUINO_SHIM_SPIFFS_H
+#define ARDUINO_SHIM_SPIFFS_H
+
+#include "FS.h"
+
+class SPIFFSFS : public fs::FS {
+public:
+    SPIFFSFS() : fs::FS("spiffs") {}
+
+    bool begin(bool format_on_fail = false, const char* base_path = "/spiffs", uint8_t max_files = 10,
+               const char* partition_label = nullptr) {
+        (void)format_on_fail; (void)base_path; (void)max_files; (void)partition_label;
+        return true;
+    }
+    void end() {}
+    size_t totalBytes() { return 1536 * 1024; }
+    size_t usedBytes() { return 0; }
+};
+
+extern SPIFFSFS SPIFFS;
+
+#endif // ARDUINO_SHIM_SPIFFS_H
@@ -0,0 +1,187 @@
+#include "WString.h"
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static std::string formatInteger(unsigned long long value, bool negative, unsigned char base) {
+    if (base < 2 || base > 36) base = 10;
+    char digits[72];
+    size_t n = 0;
+    do {
+        unsigned digit = value % base;
+        digits[n++] = digit < 10 ? '0' + digit : 'a' + digit - 10;
+        value /= base;
+    } while (value > 0);
+    if (negative) digits[n++] = '-';
+
+    std::string text;
+    while (n > 0) text += digits[--n];
+    return text;
+}
+
+static std::string formatSigned(long long value, unsigned char base) {
+    // Like the core, only base 10 shows a sign; other bases print the two's complement
+    if (base == 10 && value < 0) return formatInteger(0ULL - (unsigned long long)value, true, base);
+    return formatInteger((unsigned long long)value, false, base);
+}
+
+static std::string formatFloat(double value, unsigned int decimals) {
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), "%.*f", (int)decimals, value);
+    return buffer;
+}
+
+String::String(unsigned char value, unsigned char base) : text(formatInteger(value, false, base)) {}
+String::String(int value, unsigned char base) : text(formatSigned(base == 10 ? value : (unsigned int)value, base)) {}
+String::String(unsigned int value, unsigned char base) : text(formatInteger(value, false, base)) {}
+String::String(long value, unsigned char base) : text(formatSigned(base == 10 ? value : (unsigned long)value, base)) {}
+String::String(unsigned long value, unsigned char base) : text(formatInteger(value, false, base)) {}
+String::String(long long value, unsigned char base) : text(formatSigned(value, base)) {}
+String::String(unsigned long long value, unsigned char base) : text(formatInteger(value, false, base)) {}
+String::String(float value, unsigned int decimals) : text(formatFloat(value, decimals)) {}
+String::String(double value, unsigned int decimals) : text(formatFloat(value, decimals)) {}
+
+bool String::equalsIgnoreCase(const String& other) const {
+    if (text.size() != other.text.size()) return false;
+    for (size_t i = 0; i < text.size(); i++) {
+        if (tolower((unsigned char)text[i]) != tolower((unsigned char)other.text[i])) return false;
+    }
+    return true;
+}
+
+bool String::startsWith(const String& prefix, unsigned int offset) const {
+    if (offset > text.size() || prefix.text.size() > text.size() - offset) return false;
+    return text.compare(offset, prefix.text.size(), prefix.text) == 0;
+}
+
+bool String::endsWith(const String& suffix) const {
+    if (suffix.text.size() > text.size()) return false;
+    return text.compare(text.size() - suffix.text.size(), suffix.text.size(), suffix.text) == 0;
+}
+
+char& String::operator[](unsigned int index) {
+    static char dummy;
+    if (index >= text.size()) {
+        dummy = 0;
+        return dummy;
+    }
+    return text[index];
+}
+
+void String::getBytes(unsigned char* buf, unsigned int size, unsigned int index) const {
+    if (!buf || size == 0) return;
+    if (index >= text.size()) {
+        buf[0] = 0;
+        return;
+    }
+    size_t n = std::min<size_t>(size - 1, text.size() - index);
+    memcpy(buf, text.data() + index, n);
+    buf[n] = 0;
+}
+
+int String::indexOf(char c, unsigned int from) const {
+    size_t found = text.find(c, from);
+    return found == std::string::npos ? -1 : (int)found;
+}
+
+int String::indexOf(const String& other, unsigned int from) const {
+    if (from >= text.size()) return -1;
+    size_t found = text.find(other.text, from);
+    return found == std::string::npos ? -1 : (int)found;
+}
+
+int String::lastIndexOf(char c) const {
+    size_t found = text.rfind(c);
+    return found == std::string::npos ? -1 : (int)found;
+}
+
+int String::lastIndexOf(char c, unsigned int from) const {
+    size_t found = text.rfind(c, from);
+    return found == std::string::npos ? -1 : (int)found;
+}
+
+int String::lastIndexOf(const String& other) const {
+    if (other.text.size() > text.size()) return -1;
+    return lastIndexOf(other, text.size() - other.text.size());
+}
+
+int String::lastIndexOf(const String& other, unsigned int from) const {
+    size_t found = text.rfind(other.text, from);
+    return found == std::string::npos ? -1 : (int)found;
+}
+
+String String::substring(unsigned int from, unsigned int to) const {
+    if (from > to) std::swap(from, to);
+    if (from >= text.size()) return String();
+    if (to > text.size()) to = text.size();
+    String result;
+    result.text = text.substr(from, to - from);
+    return result;
+}
+
+void String::replace(char find, char replacement) {
+    for (char& c : text) {
+        if (c == find) c = replacement;
+    }
+}
+
+void String::replace(const String& find, const String& replacement) {
+    if (find.text.empty()) return;
+    std::string result;
+    size_t at = 0;
+    size_t found;
+    while ((found = text.find(find.text, at)) != std::string::npos) {
+        result.append(text, at, found - at);
+        result += replacement.text;
+        at = found + find.text.size();
+    }
+    result.append(text, at, std::string::npos);
+    text.swap(result);
+}
+
+void String::remove(unsigned int index, unsigned int count) {
+    if (index >= text.size()) return;
+    text.erase(index, count);
+}
+
+void String::toLowerCase() {
+    for (char& c : text) c = tolower((unsigned char)c);
+}
+
+void String::toUpperCase() {
+    for (char& c : text) c = toupper((unsigned char)c);
+}
+
+void String::trim() {
+    size_t first = 0;
+    while (first < text.size() && isspace((unsigned char)text[first])) first++;
+    size_t last = text.size();
+    while (last > first && isspace((unsigned char)text[last - 1])) last--;
+    text = text.substr(first, last - first);
+}
+
+long String::toInt() const {
+    return atol(text.c_str());
+}
+
+float String::toFloat() const {
+    return (float)atof(text.c_str());
+}
+
+double String::toDouble() const {
+    return atof(text.c_str());
+}
+
+String operator+(const String& a, const String& b) { String r(a); r.concat(b); return r; }
+String operator+(const String& a, const char* b) { String r(a); r.concat(b); return r; }
+String operator+(const char* a, const String& b) { String r(a); r.concat(b); return r; }
+String operator+(const String& a, char b) { String r(a); r.concat(b); return r; }
+String operator+(const String& a, int b) { String r(a); r.concat(b); return r; }
+String operator+(const String& a, unsigned int b) { String r(a); r.concat(b); return r; }
+String operator+(const String& a, long b) { String r(a); r.concat(b); return r; }
+String operator+(const String& a, unsigned long b) { String r(a); r.concat(b); return r; }
+String operator+(const String& a, long long b) { String r(a); r.concat(b); return r; }
+String operator+(const String& a, unsigned long long b) { String r(a); r.concat(b); return r; }
+String operator+(const String& a, float b) { String r(a); r.concat(b); return r; }
+String operator+(const String& a, double b) { String r(a); r.concat(b); return r; }
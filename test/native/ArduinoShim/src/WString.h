@@ -0,0 +1,133 @@
+#ifndef ARDUINO_SHIM_WSTRING_H
+#define ARDUINO_SHIM_WSTRING_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+/**
+ * @brief Host version of the Arduino String
+ *
+ * Only the Arduino API is exposed, so code that builds here also builds
+ * against the ESP32 core.
+ */
+class String {
+public:
+    String() {}
+    String(const char* text) : text(text ? text : "") {}
+    String(const char* text, unsigned int length) : text(text ? text : "", text ? length : 0) {}
+    String(const String& other) = default;
+    String(String&& other) = default;
+    explicit String(char c) : text(1, c) {}
+    explicit String(unsigned char value, unsigned char base = 10);
+    explicit String(int value, unsigned char base = 10);
+    explicit String(unsigned int value, unsigned char base = 10);
+    explicit String(long value, unsigned char base = 10);
+    explicit String(unsigned long value, unsigned char base = 10);
+    explicit String(long long value, unsigned char base = 10);
+    explicit String(unsigned long long value, unsigned char base = 10);
+    explicit String(float value, unsigned int decimals = 2);
+    explicit String(double value, unsigned int decimals = 2);
+
+    String& operator=(const String& other) = default;
+    String& operator=(String&& other) = default;
+    String& operator=(const char* other) { text = other ? other : ""; return *this; }
+
+    // Memory
+    bool reserve(unsigned int size) { text.reserve(size); return true; }
+    unsigned int length() const { return text.size(); }
+    bool isEmpty() const { return text.empty(); }
+    void clear() { text.clear(); }
+
+    // Concatenation
+    bool concat(const String& other) { text += other.text; return true; }
+    bool concat(const char* other) { if (!other) return false; text += other; return true; }
+    bool concat(const char* other, unsigned int length) { if (!other) return false; text.append(other, length); return true; }
+    bool concat(char c) { text += c; return true; }
+    bool concat(unsigned char value) { return concat(String(value)); }
+    bool concat(int value) { return concat(String(value)); }
+    bool concat(unsigned int value) { return concat(String(value)); }
+    bool concat(long value) { return concat(String(value)); }
+    bool concat(unsigned long value) { return concat(String(value)); }
+    bool concat(long long value) { return concat(String(value)); }
+    bool concat(unsigned long long value) { return concat(String(value)); }
+    bool concat(float value) { return concat(String(value)); }
+    bool concat(double value) { return concat(String(value)); }
+
+    template <typename T>
+    String& operator+=(const T& value) { concat(value); return *this; }
+
+    // Comparison
+    int compareTo(const String& other) const { return text.compare(other.text); }
+    bool equals(const String& other) const { return text == other.text; }
+    bool equals(const char* other) const { return text == (other ? other : ""); }
+    bool equalsIgnoreCase(const String& other) const;
+    bool operator==(const String& other) const { return equals(other); }
+    bool operator==(const char* other) const { return equals(other); }
+    bool operator!=(const String& other) const { return !equals(other); }
+    bool operator!=(const char* other) const { return !equals(other); }
+    bool operator<(const String& other) const { return text < other.text; }
+    bool operator>(const String& other) const { return text > other.text; }
+    bool operator<=(const String& other) const { return text <= other.text; }
+    bool operator>=(const String& other) const { return text >= other.text; }
+    bool startsWith(const String& prefix) const { return startsWith(prefix, 0); }
+    bool startsWith(const String& prefix, unsigned int offset) const;
+    bool endsWith(const String& suffix) const;
+
+    // Characters
+    char charAt(unsigned int index) const { return index < text.size() ? text[index] : 0; }
+    void setCharAt(unsigned int index, char c) { if (index < text.size()) text[index] = c; }
+    char operator[](unsigned int index) const { return charAt(index); }
+    char& operator[](unsigned int index);
+    void getBytes(unsigned char* buf, unsigned int size, unsigned int index = 0) const;
+    void toCharArray(char* buf, unsigned int size, unsigned int index = 0) const { getBytes((unsigned char*)buf, size, index); }
+    const char* c_str() const { return text.c_str(); }
+    char* begin() { return &text[0]; }
+    char* end() { return &text[0] + text.size(); }
+    const char* begin() const { return text.c_str(); }
+    const char* end() const { return text.c_str() + text.size(); }
+
+    // Search
+    int indexOf(char c) const { return indexOf(c, 0); }
+    int indexOf(char c, unsigned int from) const;
+    int indexOf(const String& other) const { return indexOf(other, 0); }
+    int indexOf(const String& other, unsigned int from) const;
+    int lastIndexOf(char c) const;
+    int lastIndexOf(char c, unsigned int from) const;
+    int lastIndexOf(const String& other) const;
+    int lastIndexOf(const String& other, unsigned int from) const;
+    String substring(unsigned int from) const { return substring(from, length()); }
+    String substring(unsigned int from, unsigned int to) const;
+
+    // Modification
+    void replace(char find, char replacement);
+    void replace(const String& find, const String& replacement);
+    void remove(unsigned int index) { remove(index, (unsigned int)-1); }
+    void remove(unsigned int index, unsigned int count);
+    void toLowerCase();
+    void toUpperCase();
+    void trim();
+
+    // Parsing
+    long toInt() const;
+    float toFloat() const;
+    double toDouble() const;
+
+private:
+    std::string text;
+};
+
+String operator+(const String& a, const String& b);
+String operator+(const String& a, const char* b);
+String operator+(const char* a, const String& b);
+String operator+(const String& a, char b);
+String operator+(const String& a, int b);
+String operator+(const String& a, unsigned int b);
+String operator+(const String& a, long b);
+String operator+(const String& a, unsigned long b);
+String operator+(const String& a, long long b);
+String operator+(const String& a, unsigned long long b);
+String operator+(const String& a, float b);
+String operator+(const String& a, double b);
+
+#endif // ARDUINO_SHIM_WSTRING_H
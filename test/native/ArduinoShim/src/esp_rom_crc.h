@@ -0,0 +1,9 @@
+#ifndef ARDUINO_SHIM_ESP_ROM_CRC_H
+#define ARDUINO_SHIM_ESP_ROM_CRC_H
+
+#include <stdint.h>
+
+// CRC-32 (IEEE), continuing from `crc` like the ROM function and zlib's crc32()
+uint32_t esp_rom_crc32_le(uint32_t crc, const uint8_t* buf, uint32_t len);
+
+#endif // ARDUINO_SHIM_ESP_ROM_CRC_H
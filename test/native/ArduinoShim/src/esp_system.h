@@ -0,0 +1,9 @@
+#ifndef ARDUINO_SHIM_ESP_SYSTEM_H
+#define ARDUINO_SHIM_ESP_SYSTEM_H
+
+#include <stdint.h>
+
+inline uint32_t esp_get_free_heap_size() { return 256 * 1024; }
+inline uint32_t esp_get_minimum_free_heap_size() { return 192 * 1024; }
+
+#endif // ARDUINO_SHIM_ESP_SYSTEM_H
@@ -0,0 +1,505 @@
+// Generated by scripts/compile_rules.py from hex_strings.yar - do not edit
+#ifndef HEX_RULE_IMAGE_H
+#define HEX_RULE_IMAGE_H
+
+#include <Arduino.h>
+
+// Stored in flash and executed in place by RuleImage / MultiPatternMatcher
+alignas(8) static const uint8_t HEX_RULE_IMAGE[7896] = {
+    0x46, 0x52, 0x52, 0x49, 0x03, 0x00, 0x88, 0x00, 0xd8, 0x1e, 0x00, 0x00, 0x67, 0x5d, 0xc2, 0x17,
+    0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
+    0xdc, 0x00, 0x00, 0x00, 0x1c, 0x01, 0x00, 0x00, 0xa8, 0x1c, 0x00, 0x00, 0x2d, 0x02, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x01, 0x00, 0x00,
+    0x1c, 0x02, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x24, 0x02, 0x00, 0x00, 0x24, 0x02, 0x00, 0x00,
+    0x24, 0x02, 0x00, 0x00, 0x24, 0x02, 0x00, 0x00, 0x2c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2c, 0x02, 0x00, 0x00,
+    0x90, 0x02, 0x00, 0x00, 0x90, 0x1a, 0x00, 0x00, 0x08, 0x1b, 0x00, 0x00, 0x88, 0x1c, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xa8, 0x1c, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x32, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x01, 0x00, 0x67, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00,
+    0x36, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00,
+    0xe1, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x1c, 0x01, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x41, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xa2, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xcb, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x2c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xb7, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x1a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xcc, 0x0f, 0xe7, 0xe1, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0xe1, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0xe1, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0xe1, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0xe1, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0xe1, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0xe1, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0xe1, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0xe1, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0xe1, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0xe1, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0xe1, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0xf1, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0xe1, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0xe1, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0xe1, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x71, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x71, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x71, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x2f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x71, 0x00, 0x00, 0x00, 0x00, 0xd5, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x1f, 0xe7, 0x63, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x63, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x63, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x63, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x63, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x63, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x63, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x63, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x63, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x63, 0x00, 0x00, 0x00, 0x00,
+    0xe6, 0x0f, 0xe7, 0x63, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x63, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x73, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x63, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x63, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x63, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x65, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x65, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x65, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x65, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x65, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x65, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x65, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x65, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x65, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x65, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x65, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x65, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x75, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x65, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x65, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x65, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x71, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x69, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x71, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xcf, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x71, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x71, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x71, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xef, 0x71, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x71, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xf7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x71, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x71, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0xe7, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x08, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x20, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x13, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x43, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf1, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf2, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf8, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x2f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x8f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x09, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x11, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x21, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x41, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x81, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x01, 0x01, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x01, 0x02, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x01, 0x04, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0xbe, 0xfd, 0x71, 0x83, 0xe7, 0x11, 0x00, 0x00, 0xbe, 0x7d, 0x20, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x20, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x20, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x20, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x20, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x20, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x20, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x20, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x20, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x20, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x20, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x20, 0xa3, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x20, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x20, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x20, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x10, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0xa3, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x10, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0xa3, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x10, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0xa3, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x10, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0xa3, 0xe7, 0x10, 0x00, 0x00, 0xbf, 0x7f, 0x02, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x10, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xfe, 0x7d, 0x04, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0xa3, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x10, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0xa3, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x10, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0xa3, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x10, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0xa3, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x18, 0xc3, 0xef, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0xa3, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x10, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0xa3, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x10, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0xa3, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x10, 0x93, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x93, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x93, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x93, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x93, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x93, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x93, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x93, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x93, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x93, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x93, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x93, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x80, 0xbf, 0xe7, 0x3e, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x93, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x93, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x93, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x10, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0xa3, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x10, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xf7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0xa3, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x10, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0xa3, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00, 0xbe, 0x7d, 0x00, 0x83, 0xe7, 0x10, 0x00, 0x00,
+    0x11, 0x40, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x08, 0x20, 0x08, 0x82, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0f, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00,
+    0x00, 0x78, 0x00, 0x03, 0x06, 0x00, 0x00, 0x00, 0x00, 0x04, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0x45, 0x5f, 0x48, 0x65, 0x61, 0x64,
+    0x65, 0x72, 0x5f, 0x53, 0x74, 0x75, 0x62, 0x00, 0x4d, 0x5a, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65,
+    0x72, 0x20, 0x66, 0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x61, 0x20,
+    0x50, 0x45, 0x20, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x00, 0x6c, 0x6f, 0x77, 0x00, 0x65, 0x78,
+    0x65, 0x63, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x7b, 0x20, 0x34, 0x44, 0x20, 0x35, 0x41,
+    0x20, 0x3f, 0x3f, 0x20, 0x30, 0x30, 0x20, 0x7d, 0x00, 0x7b, 0x20, 0x34, 0x44, 0x20, 0x35, 0x41,
+    0x20, 0x5b, 0x32, 0x2d, 0x36, 0x5d, 0x20, 0x35, 0x30, 0x20, 0x34, 0x35, 0x20, 0x7d, 0x00, 0x53,
+    0x68, 0x65, 0x6c, 0x6c, 0x63, 0x6f, 0x64, 0x65, 0x5f, 0x50, 0x72, 0x6f, 0x6c, 0x6f, 0x67, 0x75,
+    0x65, 0x00, 0x4e, 0x4f, 0x50, 0x20, 0x73, 0x6c, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20,
+    0x61, 0x6e, 0x20, 0x69, 0x6e, 0x74, 0x33, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x61, 0x20, 0x63, 0x61,
+    0x6c, 0x6c, 0x00, 0x6d, 0x65, 0x64, 0x69, 0x75, 0x6d, 0x00, 0x7b, 0x20, 0x39, 0x30, 0x20, 0x39,
+    0x30, 0x20, 0x5b, 0x30, 0x2d, 0x33, 0x5d, 0x20, 0x43, 0x43, 0x20, 0x7d, 0x00, 0x7b, 0x20, 0x45,
+    0x38, 0x20, 0x3f, 0x3f, 0x20, 0x3f, 0x3f, 0x20, 0x3f, 0x3f, 0x20, 0x3f, 0x3f, 0x20, 0x35, 0x3f,
+    0x20, 0x7d, 0x00, 0x7b, 0x20, 0x36, 0x3f, 0x20, 0x38, 0x42, 0x20, 0x3f, 0x43, 0x20, 0x5b, 0x31,
+    0x2d, 0x32, 0x5d, 0x20, 0x30, 0x3f, 0x20, 0x7d, 0x00, 0x4c, 0x6f, 0x6e, 0x67, 0x5f, 0x53, 0x65,
+    0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 0x73, 0x00, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x73, 0x20,
+    0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x65, 0x6e, 0x6f, 0x75, 0x67, 0x68, 0x20, 0x74, 0x6f, 0x20, 0x6e,
+    0x65, 0x65, 0x64, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x6f, 0x77, 0x6e, 0x20, 0x77, 0x6f,
+    0x72, 0x64, 0x73, 0x00, 0x64, 0x65, 0x66, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x65, 0x76, 0x61, 0x73,
+    0x69, 0x6f, 0x6e, 0x00, 0x7b, 0x20, 0x30, 0x30, 0x20, 0x30, 0x31, 0x20, 0x30, 0x32, 0x20, 0x30,
+    0x33, 0x20, 0x30, 0x34, 0x20, 0x30, 0x35, 0x20, 0x30, 0x36, 0x20, 0x30, 0x37, 0x20, 0x3f, 0x3f,
+    0x20, 0x3f, 0x3f, 0x20, 0x30, 0x41, 0x20, 0x30, 0x42, 0x20, 0x30, 0x43, 0x20, 0x30, 0x44, 0x20,
+    0x30, 0x45, 0x20, 0x30, 0x46, 0x20, 0x31, 0x30, 0x20, 0x31, 0x31, 0x20, 0x31, 0x32, 0x20, 0x31,
+    0x33, 0x20, 0x5b, 0x30, 0x2d, 0x38, 0x5d, 0x20, 0x31, 0x34, 0x20, 0x31, 0x35, 0x20, 0x31, 0x36,
+    0x20, 0x31, 0x37, 0x20, 0x31, 0x38, 0x20, 0x31, 0x39, 0x20, 0x31, 0x41, 0x20, 0x31, 0x42, 0x20,
+    0x31, 0x43, 0x20, 0x31, 0x44, 0x20, 0x31, 0x45, 0x20, 0x31, 0x46, 0x20, 0x32, 0x3f, 0x20, 0x32,
+    0x31, 0x20, 0x32, 0x32, 0x20, 0x32, 0x33, 0x20, 0x32, 0x34, 0x20, 0x32, 0x35, 0x20, 0x32, 0x36,
+    0x20, 0x32, 0x37, 0x20, 0x32, 0x38, 0x20, 0x32, 0x39, 0x20, 0x32, 0x41, 0x20, 0x7d, 0x00, 0x7b,
+    0x20, 0x34, 0x44, 0x20, 0x3f, 0x3f, 0x20, 0x5b, 0x34, 0x5d, 0x20, 0x35, 0x41, 0x20, 0x3f, 0x3f,
+    0x20, 0x3f, 0x3f, 0x20, 0x34, 0x44, 0x20, 0x5b, 0x31, 0x2d, 0x35, 0x5d, 0x20, 0x30, 0x30, 0x20,
+    0x30, 0x30, 0x20, 0x34, 0x44, 0x20, 0x35, 0x41, 0x20, 0x39, 0x30, 0x20, 0x3f, 0x30, 0x20, 0x30,
+    0x3f, 0x20, 0x30, 0x30, 0x20, 0x43, 0x43, 0x20, 0x5b, 0x30, 0x2d, 0x32, 0x5d, 0x20, 0x43, 0x43,
+    0x20, 0x43, 0x43, 0x20, 0x43, 0x3f, 0x20, 0x3f, 0x43, 0x20, 0x39, 0x30, 0x20, 0x5b, 0x32, 0x2d,
+    0x34, 0x5d, 0x20, 0x39, 0x30, 0x20, 0x45, 0x38, 0x20, 0x5b, 0x33, 0x5d, 0x20, 0x30, 0x30, 0x20,
+    0x7d, 0x00, 0x7b, 0x20, 0x43, 0x43, 0x20, 0x43, 0x43, 0x20, 0x43, 0x43, 0x20, 0x3f, 0x3f, 0x20,
+    0x43, 0x43, 0x20, 0x7d, 0x00, 0x00, 0x00, 0x00,
+};
+
+#endif // HEX_RULE_IMAGE_H
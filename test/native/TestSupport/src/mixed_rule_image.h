@@ -0,0 +1,417 @@
+// Generated by scripts/compile_rules.py from mixed_strings.yar - do not edit
+#ifndef MIXED_RULE_IMAGE_H
+#define MIXED_RULE_IMAGE_H
+
+#include <Arduino.h>
+
+// Stored in flash and executed in place by RuleImage / MultiPatternMatcher
+alignas(8) static const uint8_t MIXED_RULE_IMAGE[6496] = {
+    0x46, 0x52, 0x52, 0x49, 0x03, 0x00, 0x88, 0x00, 0x60, 0x19, 0x00, 0x00, 0xd5, 0xb3, 0x3f, 0xaa,
+    0x04, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
+    0xf8, 0x00, 0x00, 0x00, 0x48, 0x01, 0x00, 0x00, 0xcc, 0x17, 0x00, 0x00, 0x91, 0x01, 0x00, 0x00,
+    0x29, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00,
+    0x90, 0x02, 0x00, 0x00, 0x18, 0x0e, 0x00, 0x00, 0x1c, 0x0e, 0x00, 0x00, 0x1c, 0x0e, 0x00, 0x00,
+    0x1c, 0x0e, 0x00, 0x00, 0x1c, 0x0e, 0x00, 0x00, 0xc4, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xd0, 0x0e, 0x00, 0x00,
+    0xf8, 0x0e, 0x00, 0x00, 0xf8, 0x16, 0x00, 0x00, 0x20, 0x17, 0x00, 0x00, 0xa0, 0x17, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0xc0, 0x17, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x03, 0x00, 0x70, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+    0x37, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00,
+    0xdc, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x16, 0x01, 0x00, 0x00,
+    0x41, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0x57, 0x01, 0x00, 0x00,
+    0x60, 0x01, 0x00, 0x00, 0x77, 0x01, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00,
+    0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x42, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03,
+    0x51, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0xa4, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0xb1, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x03,
+    0xc4, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x2a, 0x01, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03,
+    0x37, 0x01, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0x44, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x7b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0xab, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00,
+    0x09, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x01, 0x00, 0x00, 0x06, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3e, 0x01, 0x00, 0x00, 0x06, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x00, 0x06, 0x07, 0x08, 0x09, 0x00, 0x0a, 0x00, 0x0b, 0x0c,
+    0x0d, 0x00, 0x0e, 0x0f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x00, 0x06, 0x07, 0x08, 0x09, 0x00, 0x0a, 0x00, 0x0b, 0x0c,
+    0x0d, 0x00, 0x0e, 0x0f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x23, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc5, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc4, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0xd1, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x54, 0x65, 0x78,
+    0x74, 0x5f, 0x41, 0x6e, 0x64, 0x5f, 0x48, 0x65, 0x78, 0x5f, 0x41, 0x6c, 0x6c, 0x00, 0x45, 0x76,
+    0x65, 0x72, 0x79, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2c, 0x20, 0x6f, 0x6e, 0x65, 0x20,
+    0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x6d, 0x20, 0x68, 0x65, 0x78, 0x00, 0x6d, 0x65, 0x64, 0x69,
+    0x75, 0x6d, 0x00, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x64, 0x72,
+    0x6f, 0x70, 0x70, 0x65, 0x72, 0x00, 0x64, 0x72, 0x6f, 0x70, 0x70, 0x65, 0x72, 0x70, 0x61, 0x79,
+    0x6c, 0x6f, 0x61, 0x64, 0x00, 0x70, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 0x7b, 0x20, 0x34, 0x44,
+    0x20, 0x35, 0x41, 0x20, 0x3f, 0x3f, 0x20, 0x30, 0x30, 0x20, 0x7d, 0x00, 0x54, 0x68, 0x72, 0x65,
+    0x65, 0x5f, 0x4f, 0x66, 0x5f, 0x54, 0x65, 0x78, 0x74, 0x5f, 0x41, 0x6e, 0x64, 0x5f, 0x52, 0x65,
+    0x67, 0x65, 0x78, 0x00, 0x4d, 0x6f, 0x72, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x73,
+    0x20, 0x74, 0x68, 0x61, 0x6e, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x6f, 0x6e, 0x65, 0x73, 0x00,
+    0x73, 0x74, 0x61, 0x67, 0x65, 0x72, 0x00, 0x73, 0x74, 0x61, 0x67, 0x65, 0x72, 0x73, 0x68, 0x65,
+    0x6c, 0x6c, 0x63, 0x6f, 0x64, 0x65, 0x00, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x63, 0x6f, 0x64, 0x65,
+    0x2f, 0x69, 0x6e, 0x6a, 0x65, 0x63, 0x74, 0x5f, 0x5c, 0x64, 0x2b, 0x2f, 0x00, 0x69, 0x6e, 0x6a,
+    0x65, 0x63, 0x74, 0x5f, 0x5c, 0x64, 0x2b, 0x00, 0x54, 0x77, 0x6f, 0x5f, 0x4f, 0x66, 0x5f, 0x54,
+    0x65, 0x78, 0x74, 0x5f, 0x41, 0x6e, 0x64, 0x5f, 0x48, 0x65, 0x78, 0x00, 0x41, 0x20, 0x74, 0x68,
+    0x72, 0x65, 0x73, 0x68, 0x6f, 0x6c, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x65, 0x78, 0x74,
+    0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x73, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x6d, 0x65, 0x65,
+    0x74, 0x00, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x5f, 0x61, 0x6e, 0x64, 0x5f, 0x63, 0x6f,
+    0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x00, 0x62, 0x65, 0x61, 0x63, 0x6f, 0x6e, 0x00, 0x62, 0x65, 0x61,
+    0x63, 0x6f, 0x6e, 0x6a, 0x69, 0x74, 0x74, 0x65, 0x72, 0x00, 0x6a, 0x69, 0x74, 0x74, 0x65, 0x72,
+    0x7b, 0x20, 0x39, 0x30, 0x20, 0x39, 0x30, 0x20, 0x5b, 0x32, 0x2d, 0x34, 0x5d, 0x20, 0x43, 0x43,
+    0x20, 0x7d, 0x00, 0x48, 0x65, 0x78, 0x5f, 0x4f, 0x6e, 0x6c, 0x79, 0x00, 0x4e, 0x6f, 0x20, 0x74,
+    0x65, 0x78, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x73, 0x20, 0x61, 0x74, 0x20, 0x61,
+    0x6c, 0x6c, 0x00, 0x6c, 0x6f, 0x77, 0x00, 0x7b, 0x20, 0x45, 0x38, 0x20, 0x3f, 0x3f, 0x20, 0x3f,
+    0x3f, 0x20, 0x3f, 0x3f, 0x20, 0x3f, 0x3f, 0x20, 0x35, 0x3f, 0x20, 0x7d, 0x00, 0x00, 0x00, 0x00,
+};
+
+#endif // MIXED_RULE_IMAGE_H
@@ -0,0 +1,46 @@
+#ifndef STORAGE_FIXTURE_H
+#define STORAGE_FIXTURE_H
+
+#include <Arduino.h>
+#include <unity.h>
+#include "storage.h"
+
+/**
+ * @brief Checks how a rule or list loader reaches its file through FRFDStorage
+ *
+ * Every loader that takes an FRFDStorage* should read a path under /evidence
+ * from the SD card and any other path from SPIFFS, and load nothing without
+ * storage or without the file. `load(T&, FRFDStorage*, path)` loads into a
+ * fresh T, `check(const T&)` checks what `content` loaded into, and
+ * `count(const T&)` is the number of entries a T holds.
+ */
+template <typename T, typename Load, typename Check, typename Count>
+void checkLoadsThroughStorage(FRFDStorage& storage, const String& file_name, const String& content,
+                              Load load, Check check, Count count) {
+    // Under /evidence: SD
+    const String sd_path = "/evidence/" + file_name;
+    TEST_ASSERT_TRUE(storage.writeFile(sd_path, content));
+    {
+        T loaded;
+        TEST_ASSERT_TRUE(load(loaded, &storage, sd_path));
+        check(loaded);
+    }
+
+    // Anywhere else: SPIFFS
+    const String spiffs_path = "/" + file_name;
+    TEST_ASSERT_TRUE(storage.writeFile(spiffs_path, content));
+    TEST_ASSERT_FALSE(SD.exists(spiffs_path));
+    {
+        T loaded;
+        TEST_ASSERT_TRUE(load(loaded, &storage, spiffs_path));
+        check(loaded);
+    }
+
+    // No storage, or no such file
+    T empty;
+    TEST_ASSERT_FALSE(load(empty, nullptr, spiffs_path));
+    TEST_ASSERT_FALSE(load(empty, &storage, "/missing_" + file_name));
+    TEST_ASSERT_EQUAL_UINT32(0, count(empty));
+}
+
+#endif // STORAGE_FIXTURE_H
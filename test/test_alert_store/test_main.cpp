@@ -0,0 +1,189 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <set>
+#include "threat_detector.h"
+
+static ThreatAlert makeAlert(const String& rule_id, const String& source, ThreatSeverity severity) {
+    ThreatAlert alert;
+    alert.alert_id = rule_id + "@" + source;
+    alert.rule_id = rule_id;
+    alert.rule_name = rule_id;
+    alert.severity = severity;
+    alert.artifact_source = source;
+    alert.timestamp = 0;
+    alert.confidence = 50;
+    alert.false_positive = false;
+    return alert;
+}
+
+static ThreatRule makeContentRule(const String& rule_id, ThreatSeverity severity, const String& pattern) {
+    ThreatRule rule;
+    rule.rule_id = rule_id;
+    rule.name = rule_id;
+    rule.type = RULE_CONTENT_PATTERN;
+    rule.severity = severity;
+    rule.patterns.push_back(pattern);
+    rule.enabled = true;
+    rule.match_count = 0;
+    return rule;
+}
+
+static uint32_t totalGenerated(const ThreatDetector& detector) {
+    return detector.getStatistics().total_alerts_generated;
+}
+
+// ===========================
+// Eviction
+// ===========================
+
+void test_oldest_lowest_severity_is_evicted_first() {
+    // Alerts of unknown rules are not capped per rule
+    ThreatDetector detector;
+    for (int i = 0; i < THREAT_MAX_ALERTS; i++) {
+        detector.addAlert(makeAlert("low", "s" + String(i), i % 4 == 3 ? THREAT_INFO : THREAT_LOW));
+    }
+    TEST_ASSERT_EQUAL_UINT32(THREAT_MAX_ALERTS, detector.getAlertCount());
+
+    // Info alerts go first, oldest first, then low ones; the rest keep their order
+    for (int i = 0; i < THREAT_MAX_ALERTS / 4 + 2; i++) {
+        detector.addAlert(makeAlert("medium", "m" + String(i), THREAT_MEDIUM));
+    }
+    const std::vector<ThreatAlert>& alerts = detector.getAlerts();
+    TEST_ASSERT_EQUAL_UINT32(THREAT_MAX_ALERTS, alerts.size());
+    TEST_ASSERT_EQUAL_UINT32(THREAT_MAX_ALERTS / 4 + 2, detector.getSuppressedAlertCount());
+    TEST_ASSERT_EQUAL_STRING("s2", alerts[0].artifact_source.c_str());
+    TEST_ASSERT_EQUAL_STRING("s4", alerts[1].artifact_source.c_str());
+    for (const ThreatAlert& alert : alerts) {
+        TEST_ASSERT_TRUE(alert.severity != THREAT_INFO);
+    }
+    TEST_ASSERT_EQUAL_STRING("m0", alerts[THREAT_MAX_ALERTS - THREAT_MAX_ALERTS / 4 - 2].artifact_source.c_str());
+
+    std::vector<AlertRollup> rollups = detector.getAlertRollups();
+    TEST_ASSERT_EQUAL_UINT32(1, rollups.size());
+    TEST_ASSERT_EQUAL_UINT32(THREAT_MAX_ALERTS / 4 + 2, rollups[0].count);
+    TEST_ASSERT_EQUAL_STRING("s1", rollups[0].last_source.c_str());
+    TEST_ASSERT_EQUAL_UINT32(THREAT_MAX_ALERTS + THREAT_MAX_ALERTS / 4 + 2, totalGenerated(detector));
+}
+
+void test_evicted_alert_is_not_counted_again() {
+    ThreatDetector detector;
+    for (int i = 0; i < THREAT_MAX_ALERTS; i++) {
+        detector.addAlert(makeAlert("low", "s" + String(i), THREAT_LOW));
+    }
+    detector.addAlert(makeAlert("medium", "m", THREAT_MEDIUM));
+    TEST_ASSERT_EQUAL_UINT32(1, detector.getSuppressedAlertCount());
+
+    // s0 was rolled up to make room; seeing it again changes nothing
+    uint32_t generated = totalGenerated(detector);
+    detector.addAlert(makeAlert("low", "s0", THREAT_LOW));
+    detector.addAlert(makeAlert("medium", "m", THREAT_MEDIUM));
+    TEST_ASSERT_EQUAL_UINT32(1, detector.getSuppressedAlertCount());
+    TEST_ASSERT_EQUAL_UINT32(THREAT_MAX_ALERTS, detector.getAlertCount());
+    TEST_ASSERT_EQUAL_UINT32(generated, totalGenerated(detector));
+
+    // Until the store is cleared
+    detector.clearAlerts();
+    detector.addAlert(makeAlert("low", "s0", THREAT_LOW));
+    TEST_ASSERT_EQUAL_UINT32(1, detector.getAlertCount());
+}
+
+void test_rolled_up_alert_is_not_counted_again() {
+    ThreatDetector detector;
+    TEST_ASSERT_TRUE(detector.loadRule(makeContentRule("capped", THREAT_LOW, "beacon")));
+    for (int i = 0; i < THREAT_ALERTS_PER_RULE + 3; i++) {
+        detector.addAlert(makeAlert("capped", "s" + String(i), THREAT_LOW));
+    }
+    TEST_ASSERT_EQUAL_UINT32(THREAT_ALERTS_PER_RULE, detector.getAlertCount());
+    TEST_ASSERT_EQUAL_UINT32(3, detector.getSuppressedAlertCount());
+
+    // A later scan of the same artifacts finds nothing new
+    for (int i = 0; i < THREAT_ALERTS_PER_RULE + 3; i++) {
+        TEST_ASSERT_TRUE(detector.scanContent("beacon", "s" + String(i)));
+    }
+    TEST_ASSERT_EQUAL_UINT32(3, detector.getSuppressedAlertCount());
+    TEST_ASSERT_EQUAL_UINT32(THREAT_ALERTS_PER_RULE + 3, detector.findRule("capped")->match_count);
+}
+
+void test_high_alerts_are_kept_past_the_limit() {
+    ThreatDetector detector;
+    for (int i = 0; i < THREAT_MAX_ALERTS - 1; i++) {
+        detector.addAlert(makeAlert("high", "s" + String(i), THREAT_HIGH));
+    }
+    detector.addAlert(makeAlert("medium", "m", THREAT_MEDIUM));
+
+    // The medium alert makes room for one high alert, then the store grows
+    detector.addAlert(makeAlert("critical", "c0", THREAT_CRITICAL));
+    detector.addAlert(makeAlert("critical", "c1", THREAT_CRITICAL));
+    TEST_ASSERT_EQUAL_UINT32(THREAT_MAX_ALERTS + 1, detector.getAlertCount());
+    TEST_ASSERT_EQUAL_UINT32(1, detector.getSuppressedAlertCount());
+
+    // One alert per (rule, source), and lower severities are rolled up
+    detector.addAlert(makeAlert("critical", "c1", THREAT_CRITICAL));
+    detector.addAlert(makeAlert("low", "l", THREAT_LOW));
+    TEST_ASSERT_EQUAL_UINT32(THREAT_MAX_ALERTS + 1, detector.getAlertCount());
+    TEST_ASSERT_EQUAL_UINT32(2, detector.getSuppressedAlertCount());
+}
+
+// ===========================
+// Eviction during scans
+// ===========================
+
+void test_scans_return_a_compact_store() {
+    // 32 info rules fill the store from 16 artifacts
+    ThreatDetector detector;
+    for (int r = 0; r < 32; r++) {
+        TEST_ASSERT_TRUE(detector.loadRule(makeContentRule("info" + String(r), THREAT_INFO, "marker")));
+    }
+    for (int i = 0; i < THREAT_ALERTS_PER_RULE; i++) {
+        TEST_ASSERT_TRUE(detector.scanContent("marker", "a" + String(i)));
+    }
+    TEST_ASSERT_EQUAL_UINT32(THREAT_MAX_ALERTS, detector.getAlertCount());
+
+    // Each scan of another artifact evicts 200 info alerts for 200 low ones, more than the
+    // store holds evicted at once
+    for (int r = 0; r < 200; r++) {
+        TEST_ASSERT_TRUE(detector.loadRule(makeContentRule("low" + String(r), THREAT_LOW, "payload")));
+    }
+    for (int i = 0; i < 2; i++) {
+        TEST_ASSERT_TRUE(detector.scanContent("payload", "b" + String(i)));
+
+        const std::vector<ThreatAlert>& alerts = detector.getAlerts();
+        TEST_ASSERT_EQUAL_UINT32(THREAT_MAX_ALERTS, alerts.size());
+        std::set<String> keys;
+        uint32_t low = 0;
+        for (const ThreatAlert& alert : alerts) {
+            keys.insert(alert.rule_id + "@" + alert.artifact_source);
+            if (alert.severity == THREAT_LOW) low++;
+        }
+        TEST_ASSERT_EQUAL_UINT32(alerts.size(), keys.size());
+        TEST_ASSERT_EQUAL_UINT32(200 * (i + 1), low);
+        TEST_ASSERT_EQUAL_UINT32(200 * (i + 1), detector.getSuppressedAlertCount());
+        TEST_ASSERT_EQUAL_UINT32(THREAT_MAX_ALERTS + 200 * (i + 1), totalGenerated(detector));
+    }
+
+    // The oldest 400 were evicted, and are not counted again
+    const ThreatAlert& oldest = detector.getAlerts()[0];
+    TEST_ASSERT_EQUAL_STRING("info16", oldest.rule_id.c_str());
+    TEST_ASSERT_EQUAL_STRING("a12", oldest.artifact_source.c_str());
+    TEST_ASSERT_TRUE(detector.scanContent("marker", "a0"));
+    TEST_ASSERT_EQUAL_UINT32(400, detector.getSuppressedAlertCount());
+}
+
+void setUp() {
+    Serial.setQuiet(true);
+}
+
+void tearDown() {
+}
+
+int main(int argc, char** argv) {
+    Serial.setQuiet(true);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_oldest_lowest_severity_is_evicted_first);
+    RUN_TEST(test_evicted_alert_is_not_counted_again);
+    RUN_TEST(test_rolled_up_alert_is_not_counted_again);
+    RUN_TEST(test_high_alerts_are_kept_past_the_limit);
+    RUN_TEST(test_scans_return_a_compact_store);
+    return UNITY_END();
+}
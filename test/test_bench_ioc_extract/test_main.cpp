@@ -0,0 +1,102 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <random>
+#include <string>
+#include "ioc_lexer.h"
+#include "ioc_extractor.h"
+#include "storage.h"
+
+// Throughput of the single-pass IOC lexer, alone and behind
+// IOCExtractor::extractFromFile, on sshd/syslog-style logs.
+
+static const size_t LOG_SIZE = 8 * 1024 * 1024;
+
+static FRFDStorage storage;
+
+static std::string buildLog(unsigned ioc_every_lines) {
+    static const char* const indicators[] = {
+        "connect to http://update.evil-c2.net/stage2.bin",
+        "dropped 9e107d9d372bb6826bd81d3542a419d6",
+        "beacon 185.220.101.45:443",
+        "reg add HKLM\\Software\\Microsoft\\Windows\\CurrentVersion\\Run\\svc",
+        "mail from attacker@phish-mail.example.org",
+    };
+
+    std::mt19937 rng(11);
+    std::string log;
+    log.reserve(LOG_SIZE + 256);
+    char line[200];
+    unsigned n = 0;
+    while (log.size() < LOG_SIZE) {
+        if (++n % ioc_every_lines == 0) {
+            snprintf(line, sizeof(line), "Jan  3 12:00:%02u host kernel: %s\n",
+                     (unsigned)(rng() % 60), indicators[rng() % 5]);
+        } else {
+            snprintf(line, sizeof(line),
+                     "Jan  3 12:%02u:%02u host sshd[%u]: Failed password for invalid user admin from port %u ssh2\n",
+                     (unsigned)(rng() % 60), (unsigned)(rng() % 60), (unsigned)(1000 + rng() % 60000),
+                     (unsigned)(1024 + rng() % 60000));
+        }
+        log += line;
+    }
+    return log;
+}
+
+static double mbPerSecond(size_t bytes, unsigned long us) {
+    return us == 0 ? 0.0 : (double)bytes / (double)us;
+}
+
+static void benchLog(unsigned ioc_every_lines) {
+    std::string log = buildLog(ioc_every_lines);
+
+    IOCLexer lexer;
+    size_t tokens = 0;
+    unsigned long start = micros();
+    lexer.scan((const uint8_t*)log.data(), log.size(), [&tokens](IOCType, size_t, size_t) { tokens++; });
+    unsigned long lex_us = micros() - start;
+    TEST_ASSERT_TRUE(tokens > 0);
+
+    String path = String("/evidence/bench_") + ioc_every_lines + ".log";
+    TEST_ASSERT_TRUE(storage.writeFile(path, (const uint8_t*)log.data(), log.size()));
+
+    IOCExtractor extractor;
+    extractor.begin(&storage);
+    start = micros();
+    TEST_ASSERT_TRUE(extractor.extractFromFile(path));
+    unsigned long extract_us = micros() - start;
+    TEST_ASSERT_TRUE(extractor.getIOCCount() > 0);
+
+    char report[200];
+    snprintf(report, sizeof(report), "IOC every %u lines, %u bytes: lexer %.1f MB/s, extractFromFile %.1f MB/s (%u IOCs)",
+             ioc_every_lines, (unsigned)log.size(), mbPerSecond(log.size(), lex_us),
+             mbPerSecond(log.size(), extract_us), (unsigned)extractor.getIOCCount());
+    TEST_MESSAGE(report);
+}
+
+void test_bench_dense_iocs() {
+    benchLog(25);
+}
+
+void test_bench_sparse_iocs() {
+    benchLog(400);
+}
+
+void setUp() {
+    Serial.setQuiet(true);
+}
+
+void tearDown() {
+}
+
+int main(int argc, char** argv) {
+    Serial.setQuiet(true);
+    SD.wipe();
+    SPIFFS.wipe();
+    storage.begin();
+    storage.createDirectory("/evidence");
+
+    UNITY_BEGIN();
+    RUN_TEST(test_bench_dense_iocs);
+    RUN_TEST(test_bench_sparse_iocs);
+    return UNITY_END();
+}
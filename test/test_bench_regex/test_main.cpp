@@ -0,0 +1,116 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <random>
+#include <regex>
+#include <string>
+#include "regex_matcher.h"
+
+// RegexMatcher against std::regex on threat-rule expressions over 1 MB of
+// log-like text with no match. std::regex is timed on 64 KB and scaled up.
+
+static const size_t TEXT_SIZE = 1024 * 1024;
+static const size_t REFERENCE_SIZE = 64 * 1024;
+
+static const char* const PATTERNS[] = {
+    "powershell(\\.exe)?\\s+-(e|enc|encodedcommand)\\s+[a-z0-9+/=]{20,}",
+    "eval\\s*\\(\\s*(\\$_POST\\[|request\\[)",
+    "certutil(\\.exe)?\\s+-urlcache",
+    "\\bmimikatz\\b",
+    "(sekurlsa|lsadump)::(logonpasswords|sam|dcsync)",
+    "https?://\\d{1,3}\\.\\d{1,3}\\.\\d{1,3}\\.\\d{1,3}(:\\d+)?/",
+    "reg(\\.exe)?\\s+add\\s+hk(lm|cu)\\\\software\\\\microsoft\\\\windows\\\\currentversion\\\\run",
+};
+
+static std::string buildText() {
+    static const char* const words[] = {
+        "GET", "/index.html", "HTTP/1.1", "200", "user", "session", "opened", "for", "root",
+        "powershell", "-nop", "eval", "request", "certutil", "reg", "query", "hklm", "sekurlsa",
+        "http://example.com/", "10.0.0.1", "mimikat", "=", "(", ")", "::",
+    };
+    std::mt19937 rng(3);
+    std::string text;
+    text.reserve(TEXT_SIZE + 64);
+    while (text.size() < TEXT_SIZE) {
+        int n = 6 + rng() % 10;
+        for (int i = 0; i < n; i++) {
+            text += words[rng() % (sizeof(words) / sizeof(words[0]))];
+            text += ' ';
+        }
+        text += '\n';
+    }
+    text.resize(TEXT_SIZE);
+    return text;
+}
+
+void test_bench_rule_expressions() {
+    std::string text = buildText();
+
+    for (const char* pattern : PATTERNS) {
+        RegexMatcher matcher;
+        TEST_ASSERT_TRUE(matcher.compile(pattern, true));
+
+        unsigned long start = micros();
+        bool found = matcher.search((const uint8_t*)text.data(), text.size());
+        unsigned long dfa_us = micros() - start;
+
+        std::regex reference(pattern, std::regex::ECMAScript | std::regex::icase);
+        start = micros();
+        bool expected = std::regex_search(text.begin(), text.begin() + REFERENCE_SIZE, reference);
+        unsigned long reference_us = (micros() - start) * (TEXT_SIZE / REFERENCE_SIZE);
+
+        TEST_ASSERT_FALSE(found);
+        TEST_ASSERT_FALSE(expected);
+
+        char report[220];
+        snprintf(report, sizeof(report), "%-60.60s dfa %7.1f ms  std::regex %7.0f ms  %u bytes",
+                 pattern, dfa_us / 1000.0, reference_us / 1000.0, (unsigned)matcher.getMemoryUsage());
+        TEST_MESSAGE(report);
+    }
+}
+
+void test_bench_pathological() {
+    RegexMatcher matcher;
+    TEST_ASSERT_TRUE(matcher.compile("(a|aa)*(a*)*b"));
+    std::string text(TEXT_SIZE, 'a');
+
+    unsigned long start = micros();
+    TEST_ASSERT_FALSE(matcher.search((const uint8_t*)text.data(), text.size()));
+    char report[120];
+    snprintf(report, sizeof(report), "(a|aa)*(a*)*b on 1 MB of 'a': %.1f ms", (micros() - start) / 1000.0);
+    TEST_MESSAGE(report);
+}
+
+void test_bench_cache_pressure() {
+    std::mt19937 rng(5);
+    std::string text(TEXT_SIZE, ' ');
+    for (char& c : text) c = 'a' + rng() % 26;
+
+    const size_t cache_sizes[] = {256 * 1024, 4 * 1024};
+    for (size_t cache_size : cache_sizes) {
+        RegexMatcher matcher;
+        TEST_ASSERT_TRUE(matcher.compile("[a-q][^u-z]{13}!", false, cache_size));
+
+        unsigned long start = micros();
+        TEST_ASSERT_FALSE(matcher.search((const uint8_t*)text.data(), text.size()));
+        char report[160];
+        snprintf(report, sizeof(report), "[a-q][^u-z]{13}! with a %u KB cache: %.1f ms, %u flushes, %u bytes",
+                 (unsigned)(cache_size / 1024), (micros() - start) / 1000.0,
+                 (unsigned)matcher.getCacheFlushes(), (unsigned)matcher.getMemoryUsage());
+        TEST_MESSAGE(report);
+    }
+}
+
+void setUp() {
+    Serial.setQuiet(true);
+}
+
+void tearDown() {
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_bench_rule_expressions);
+    RUN_TEST(test_bench_pathological);
+    RUN_TEST(test_bench_cache_pressure);
+    return UNITY_END();
+}
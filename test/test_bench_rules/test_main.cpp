@@ -0,0 +1,142 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <random>
+#include <set>
+#include <vector>
+#include "ioc_matcher.h"
+
+// Throughput of IOCMatcher's single automaton pass against the per-string
+// lowercase-and-indexOf path it replaced, on a synthetic auth log.
+
+static const size_t LOG_SIZE = 2 * 1024 * 1024;
+
+static const char* const WORDS[] = {
+    "mimikatz", "invoke-expression", "downloadstring", "powershell -enc", "certutil -urlcache",
+    "bitsadmin /transfer", "rundll32", "regsvr32 /s", "schtasks /create", "vssadmin delete",
+    "wget http", "curl -o", "chmod +x", "/dev/tcp/", "nc -e", "bash -i", "crontab -e",
+    "eval(base64_decode", "system($_get", "passthru(", "shell_exec(", "assert($_post",
+    "stratum+tcp", "xmrig", "socks5://", ".onion", "pastebin.com/raw", "ngrok.io",
+    "lsass.exe", "sekurlsa", "net user /add", "wmic process call", "psexec", "procdump",
+};
+
+static String buildAuthLog(std::mt19937& rng) {
+    static const char* const users[] = {"root", "admin", "deploy", "www-data", "backup"};
+    static const char* const events[] = {
+        "Accepted publickey for", "Failed password for", "session opened for user",
+        "Invalid user", "pam_unix(sshd:auth): authentication failure; user=",
+    };
+
+    String log;
+    char line[160];
+    while (log.length() < LOG_SIZE) {
+        snprintf(line, sizeof(line), "Jan %2u %02u:%02u:%02u host sshd[%u]: %s %s from 10.%u.%u.%u port %u ssh2\n",
+                 (unsigned)(1 + rng() % 28), (unsigned)(rng() % 24), (unsigned)(rng() % 60), (unsigned)(rng() % 60),
+                 (unsigned)(1000 + rng() % 60000), events[rng() % 5], users[rng() % 5],
+                 (unsigned)(rng() % 256), (unsigned)(rng() % 256), (unsigned)(rng() % 256),
+                 (unsigned)(1024 + rng() % 60000));
+        log += line;
+
+        // A few indicators scattered through the log
+        if (rng() % 4000 == 0) {
+            log += "cmd: ";
+            log += WORDS[rng() % (sizeof(WORDS) / sizeof(WORDS[0]))];
+            log += "\n";
+        }
+    }
+    return log;
+}
+
+static std::vector<IOCRule> buildRules(std::mt19937& rng) {
+    static const char* const conditions[] = {"any", "2 of them", "all"};
+    const size_t word_count = sizeof(WORDS) / sizeof(WORDS[0]);
+
+    std::vector<IOCRule> rules;
+    for (int r = 0; r < 24; r++) {
+        IOCRule rule;
+        rule.name = String("Bench_Rule_") + r;
+        rule.severity = "high";
+        rule.condition = conditions[r % 3];
+        std::set<size_t> picked;
+        while (picked.size() < 5) picked.insert(rng() % word_count);
+        for (size_t w : picked) rule.strings.push_back(WORDS[w]);
+        rules.push_back(rule);
+    }
+    return rules;
+}
+
+// The pre-automaton IOCMatcher: lowercase copies and one indexOf per rule string
+static bool containsString(const String& content, const String& pattern) {
+    String contentLower = content;
+    String patternLower = pattern;
+    contentLower.toLowerCase();
+    patternLower.toLowerCase();
+    return contentLower.indexOf(patternLower) >= 0;
+}
+
+static std::set<String> naiveScan(const std::vector<IOCRule>& rules, const String& content) {
+    std::set<String> matched_rules;
+    for (const IOCRule& rule : rules) {
+        size_t matched = 0;
+        for (const String& pattern : rule.strings) {
+            if (containsString(content, pattern)) matched++;
+        }
+
+        bool hit = false;
+        if (rule.condition == "any") hit = matched > 0;
+        else if (rule.condition == "all") hit = matched == rule.strings.size();
+        else if (rule.condition.startsWith("2 of")) hit = matched >= 2;
+        if (hit) matched_rules.insert(rule.name);
+    }
+    return matched_rules;
+}
+
+static double mbPerSecond(size_t bytes, unsigned long us) {
+    return us == 0 ? 0.0 : (double)bytes / (double)us;
+}
+
+void test_bench_rule_scan() {
+    std::mt19937 rng(7);
+    String log = buildAuthLog(rng);
+    std::vector<IOCRule> rules = buildRules(rng);
+
+    IOCMatcher matcher;
+    for (const IOCRule& rule : rules) TEST_ASSERT_TRUE(matcher.addRule(rule));
+    matcher.scanContent("warm-up", "warm-up");   // Compiles the automaton
+    matcher.clearMatches();
+
+    unsigned long start = micros();
+    std::set<String> expected = naiveScan(rules, log);
+    unsigned long naive_us = micros() - start;
+
+    const int runs = 20;
+    start = micros();
+    for (int i = 0; i < runs; i++) {
+        matcher.clearMatches();
+        matcher.scanContent(log, "auth.log");
+    }
+    unsigned long automaton_us = (micros() - start) / runs;
+
+    std::set<String> actual;
+    for (const IOCMatch& match : matcher.getMatches()) actual.insert(match.ruleName);
+    TEST_ASSERT_TRUE(expected == actual);
+
+    char report[160];
+    snprintf(report, sizeof(report), "%u rules over %u bytes: per-string path %.1f MB/s, automaton %.1f MB/s",
+             (unsigned)rules.size(), (unsigned)log.length(),
+             mbPerSecond(log.length(), naive_us), mbPerSecond(log.length(), automaton_us));
+    TEST_MESSAGE(report);
+    TEST_ASSERT_TRUE(automaton_us < naive_us);
+}
+
+void setUp() {
+    Serial.setQuiet(true);
+}
+
+void tearDown() {
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_bench_rule_scan);
+    return UNITY_END();
+}
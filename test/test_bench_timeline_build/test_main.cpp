@@ -0,0 +1,97 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <random>
+#include <stdio.h>
+#include "timeline_generator.h"
+#include "storage.h"
+
+// Wall-clock time of buildTimelineFromDirectory with parser threads against
+// the sequential build, on a directory of MFT exports. Parsing runs on the
+// workers; interning, dedup and indexing stay on the calling thread, so the
+// speedup is bounded by how much of the build parsing is.
+
+static const int FILES = 8;
+static const uint32_t ROWS_PER_FILE = 12000;
+static const int ROUNDS = 3;
+
+static FRFDStorage storage;
+
+static String isoTime(uint32_t seconds) {
+    return TimelineGenerator::formatTimestamp((1700000000LL + seconds) * 1000000LL);
+}
+
+static String mftExport(std::mt19937& rng, int file_number) {
+    String csv = "Filename,Created,Modified,Accessed,Changed\n";
+    for (uint32_t i = 0; i < ROWS_PER_FILE; i++) {
+        uint32_t file = rng() % 50000;
+        uint32_t created = file * 10;
+        csv += "C:\\case" + String(file_number) + "\\dir" + String(file % 97) + "\\file" + String(file) + ".dat,";
+        csv += isoTime(created) + ",";
+        csv += isoTime(created + 1 + rng() % 5) + ",";
+        csv += isoTime(created + 100000 - rng() % 50000) + ",";
+        csv += isoTime(created) + "\n";
+    }
+    return csv;
+}
+
+// Best of ROUNDS, in ms
+static double buildMs(uint8_t workers, uint32_t& events) {
+    double best = 1e30;
+    for (int round = 0; round < ROUNDS; round++) {
+        TimelineGenerator generator;
+        generator.begin(&storage);
+        generator.setParseWorkers(workers);
+        unsigned long start = micros();
+        TEST_ASSERT_TRUE(generator.buildTimelineFromDirectory("/evidence/bench"));
+        double ms = (micros() - start) / 1000.0;
+        if (ms < best) best = ms;
+        events = generator.getEventCount();
+    }
+    return best;
+}
+
+void test_bench_parallel_build() {
+    std::mt19937 rng(20241016);
+    storage.createDirectory("/evidence/bench");
+    for (int f = 0; f < FILES; f++) {
+        TEST_ASSERT_TRUE(storage.writeFile("/evidence/bench/mft_" + String(f) + ".csv", mftExport(rng, f)));
+    }
+
+    uint32_t sequential_events = 0;
+    double sequential = buildMs(1, sequential_events);
+    char report[120];
+    snprintf(report, sizeof(report), "%-24s %8.1f ms  %u events", "sequential", sequential,
+             (unsigned)sequential_events);
+    TEST_MESSAGE(report);
+
+    for (uint8_t workers : {(uint8_t)2, (uint8_t)4, (uint8_t)0}) {
+        uint32_t events = 0;
+        double ms = buildMs(workers, events);
+        TEST_ASSERT_EQUAL_UINT32(sequential_events, events);
+
+        char label[32];
+        if (workers == 0) snprintf(label, sizeof(label), "one worker per core");
+        else snprintf(label, sizeof(label), "%u workers", (unsigned)workers);
+        snprintf(report, sizeof(report), "%-24s %8.1f ms  %.2fx", label, ms, sequential / ms);
+        TEST_MESSAGE(report);
+    }
+}
+
+void setUp() {
+    Serial.setQuiet(true);
+}
+
+void tearDown() {
+}
+
+int main(int argc, char** argv) {
+    Serial.setQuiet(true);
+    SD.wipe();
+    SPIFFS.wipe();
+    storage.begin();
+    storage.createDirectory("/evidence");
+
+    UNITY_BEGIN();
+    RUN_TEST(test_bench_parallel_build);
+    return UNITY_END();
+}
@@ -0,0 +1,129 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <random>
+#include <string>
+#include <vector>
+#include <stdio.h>
+#include <time.h>
+#include "timestamp_parser.h"
+
+// Nanoseconds per timestamp for each format, over 1M generated values.
+
+static const size_t COUNT = 1000000;
+
+// Timestamps packed back to back, as they sit in a read buffer
+struct Lines {
+    std::string text;
+    std::vector<uint32_t> starts;       // COUNT + 1 offsets into text
+};
+
+static Lines generate(const char* format, bool same_day) {
+    std::mt19937 rng(23);
+    Lines lines;
+    lines.text.reserve(COUNT * 32);
+    lines.starts.reserve(COUNT + 1);
+    char text[48];
+    for (size_t i = 0; i < COUNT; i++) {
+        unsigned day = same_day ? 15 : 1 + rng() % 28;
+        unsigned month = same_day ? 3 : 1 + rng() % 12;
+        unsigned hour = rng() % 24, minute = rng() % 60, second = rng() % 60;
+        if (strcmp(format, "iso") == 0) {
+            snprintf(text, sizeof(text), "2024-%02u-%02uT%02u:%02u:%02u.%06uZ", month, day, hour, minute, second,
+                     (unsigned)(rng() % 1000000));
+        } else if (strcmp(format, "syslog") == 0) {
+            static const char* const months[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun",
+                                                 "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+            snprintf(text, sizeof(text), "%s %2u %02u:%02u:%02u", months[month - 1], day, hour, minute, second);
+        } else if (strcmp(format, "us") == 0) {
+            snprintf(text, sizeof(text), "%u/%u/2024 %u:%02u:%02u %s", month, day, 1 + hour % 12, minute, second,
+                     hour < 12 ? "AM" : "PM");
+        } else if (strcmp(format, "filetime") == 0) {
+            snprintf(text, sizeof(text), "%llu", 133550000000000000ULL + (unsigned long long)rng() * 1000);
+        } else {
+            snprintf(text, sizeof(text), "%llu", 1710000000ULL + rng() % 10000000);
+        }
+        lines.starts.push_back(lines.text.size());
+        lines.text += text;
+    }
+    lines.starts.push_back(lines.text.size());
+    return lines;
+}
+
+static double nsPerLine(unsigned long us) {
+    return us * 1000.0 / COUNT;
+}
+
+static void benchFormat(const char* label, const char* format, bool same_day) {
+    Lines lines = generate(format, same_day);
+    TimestampParser parser;
+    int64_t sum = 0;
+
+    size_t failed = 0;
+    unsigned long start = micros();
+    for (size_t i = 0; i < COUNT; i++) {
+        int64_t micros;
+        if (parser.parse(lines.text.data() + lines.starts[i], lines.starts[i + 1] - lines.starts[i], micros)) {
+            sum += micros;
+        } else {
+            failed++;
+        }
+    }
+    unsigned long elapsed = micros() - start;
+    TEST_ASSERT_EQUAL_UINT32(0, failed);
+    TEST_ASSERT_TRUE(sum != 0);
+
+    char report[120];
+    snprintf(report, sizeof(report), "%-28s %6.1f ns", label, nsPerLine(elapsed));
+    TEST_MESSAGE(report);
+}
+
+void test_bench_formats() {
+    benchFormat("ISO 8601, same day", "iso", true);
+    benchFormat("ISO 8601, random days", "iso", false);
+    benchFormat("syslog, same day", "syslog", true);
+    benchFormat("syslog, random days", "syslog", false);
+    benchFormat("US date, same day", "us", true);
+    benchFormat("FILETIME", "filetime", false);
+    benchFormat("epoch seconds", "epoch", false);
+}
+
+void test_bench_sscanf_timegm() {
+    Lines lines = generate("iso", false);
+    int64_t sum = 0;
+
+    unsigned long start = micros();
+    for (size_t i = 0; i < COUNT; i++) {
+        struct tm tm = {};
+        unsigned fraction = 0;
+        // sscanf wants a terminated string (and strlen()s it), so copy the line out
+        char line[48];
+        size_t length = lines.starts[i + 1] - lines.starts[i];
+        memcpy(line, lines.text.data() + lines.starts[i], length);
+        line[length] = 0;
+        sscanf(line, "%d-%d-%dT%d:%d:%d.%uZ", &tm.tm_year, &tm.tm_mon, &tm.tm_mday,
+               &tm.tm_hour, &tm.tm_min, &tm.tm_sec, &fraction);
+        tm.tm_year -= 1900;
+        tm.tm_mon -= 1;
+        sum += (int64_t)timegm(&tm) * TIMESTAMP_MICROS_PER_SECOND + fraction;
+    }
+    unsigned long elapsed = micros() - start;
+    TEST_ASSERT_TRUE(sum != 0);
+
+    char report[120];
+    snprintf(report, sizeof(report), "%-28s %6.1f ns", "ISO 8601, sscanf + timegm", nsPerLine(elapsed));
+    TEST_MESSAGE(report);
+}
+
+void setUp() {
+    Serial.setQuiet(true);
+}
+
+void tearDown() {
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_bench_formats);
+    RUN_TEST(test_bench_sscanf_timegm);
+    return UNITY_END();
+}
@@ -0,0 +1,281 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <random>
+#include <utility>
+#include <vector>
+#include "cidr_tree.h"
+#include "ioc_extractor.h"
+#include "threat_detector.h"
+#include "storage.h"
+#include "storage_fixture.h"
+
+static FRFDStorage storage;
+
+static IOC makeIOC(IOCType type, const char* value) {
+    IOC ioc;
+    ioc.type = type;
+    ioc.value = value;
+    ioc.source_artifact = "fixture";
+    ioc.timestamp = 0;
+    ioc.confidence = 100;
+    return ioc;
+}
+
+static ThreatRule makeNetworkRule(const char* id, const std::vector<String>& patterns) {
+    ThreatRule rule;
+    rule.rule_id = id;
+    rule.name = id;
+    rule.description = "fixture";
+    rule.type = RULE_NETWORK_PATTERN;
+    rule.severity = THREAT_HIGH;
+    rule.patterns = patterns;
+    rule.enabled = true;
+    rule.match_count = 0;
+    return rule;
+}
+
+static const char* RANGES =
+    "# tag,cidr[,severity[,label]]\n"
+    "deny,198.51.100.0/24,90,bulletproof host\n"
+    "intel,2001:db8:bad::/48\n"
+    "allow,203.0.113.0/25\n"
+    "\n"
+    "bogus,10.0.0.0/8\n";
+
+// ===========================
+// Range files
+// ===========================
+
+static void checkLoadedRanges(const CidrTree& tree) {
+    TEST_ASSERT_EQUAL_UINT32(3, tree.getRangeCount());
+
+    CidrMatch match;
+    TEST_ASSERT_EQUAL_INT(CIDR_DENY, tree.lookup("198.51.100.77", &match));
+    TEST_ASSERT_EQUAL_UINT8(90, match.severity);
+    TEST_ASSERT_EQUAL_STRING("bulletproof host", match.label->c_str());
+    TEST_ASSERT_EQUAL_INT(CIDR_INTEL, tree.lookup(String("2001:db8:bad:1::5")));
+    TEST_ASSERT_EQUAL_INT(CIDR_ALLOW, tree.lookup(String("203.0.113.5")));
+    TEST_ASSERT_EQUAL_INT(CIDR_NONE, tree.lookup(String("203.0.113.200")));
+    TEST_ASSERT_EQUAL_INT(CIDR_NONE, tree.lookup(String("10.1.2.3")));
+}
+
+void test_loads_ranges_through_storage() {
+    checkLoadsThroughStorage<CidrTree>(
+        storage, "ranges.csv", RANGES,
+        [](CidrTree& tree, FRFDStorage* from, const String& path) { return tree.loadFile(from, path); },
+        checkLoadedRanges, [](const CidrTree& tree) { return tree.getRangeCount(); });
+}
+
+void test_extractor_loads_ranges_through_its_storage() {
+    TEST_ASSERT_TRUE(storage.writeFile("/evidence/extractor_ranges.csv", String(RANGES)));
+
+    IOCExtractor extractor;
+    extractor.begin(&storage);
+    TEST_ASSERT_TRUE(extractor.loadIPRanges("/evidence/extractor_ranges.csv"));
+    TEST_ASSERT_EQUAL_INT(CIDR_DENY, extractor.classifyIP("198.51.100.1"));
+}
+
+// ===========================
+// Lookups
+// ===========================
+
+void test_most_specific_range_wins() {
+    // The same nested ranges, added outermost first and innermost first
+    const char* const ranges[] = {"10.0.0.0/8", "10.1.0.0/16", "10.1.2.0/24", "10.1.2.3/32"};
+    const CidrTag tags[] = {CIDR_PRIVATE, CIDR_ALLOW, CIDR_INTEL, CIDR_DENY};
+    for (int order = 0; order < 2; order++) {
+        CidrTree tree;
+        for (int i = 0; i < 4; i++) {
+            int r = order == 0 ? i : 3 - i;
+            TEST_ASSERT_TRUE(tree.add(ranges[r], tags[r]));
+        }
+        TEST_ASSERT_EQUAL_UINT32(4, tree.getRangeCount());
+
+        CidrMatch match;
+        TEST_ASSERT_EQUAL_INT(CIDR_DENY, tree.lookup("10.1.2.3", &match));
+        TEST_ASSERT_EQUAL_UINT8(96 + 32, match.prefix_len);
+        TEST_ASSERT_EQUAL_INT(CIDR_INTEL, tree.lookup("10.1.2.4", &match));
+        TEST_ASSERT_EQUAL_UINT8(96 + 24, match.prefix_len);
+        TEST_ASSERT_EQUAL_INT(CIDR_ALLOW, tree.lookup(String("10.1.3.4")));
+        TEST_ASSERT_EQUAL_INT(CIDR_PRIVATE, tree.lookup(String("10.2.0.1")));
+        TEST_ASSERT_EQUAL_INT(CIDR_NONE, tree.lookup(String("11.0.0.1")));
+    }
+}
+
+void test_host_bits_are_masked_and_readding_replaces() {
+    CidrTree tree;
+    TEST_ASSERT_TRUE(tree.add("198.51.100.77/24", CIDR_DENY, 80, "first"));
+    TEST_ASSERT_EQUAL_INT(CIDR_DENY, tree.lookup(String("198.51.100.1")));
+
+    CidrMatch match;
+    TEST_ASSERT_TRUE(tree.add("198.51.100.0/24", CIDR_ALLOW));
+    TEST_ASSERT_EQUAL_UINT32(1, tree.getRangeCount());
+    TEST_ASSERT_EQUAL_INT(CIDR_ALLOW, tree.lookup("198.51.100.1", &match));
+    TEST_ASSERT_EQUAL_UINT8(0, match.severity);
+    TEST_ASSERT_EQUAL_STRING("", match.label->c_str());
+}
+
+void test_default_ranges_cover_both_families() {
+    CidrTree tree;
+    tree.addDefaultRanges();
+
+    TEST_ASSERT_EQUAL_INT(CIDR_PRIVATE, tree.lookup(String("192.168.1.1")));
+    TEST_ASSERT_EQUAL_INT(CIDR_PRIVATE, tree.lookup(String("::ffff:192.168.1.1")));    // IPv4-mapped
+    TEST_ASSERT_EQUAL_INT(CIDR_PRIVATE, tree.lookup(String("172.31.255.255")));
+    TEST_ASSERT_EQUAL_INT(CIDR_NONE, tree.lookup(String("172.32.0.0")));
+    TEST_ASSERT_EQUAL_INT(CIDR_PRIVATE, tree.lookup(String("FE80::1")));
+    TEST_ASSERT_EQUAL_INT(CIDR_PRIVATE, tree.lookup(String("fd12:3456::1")));
+    TEST_ASSERT_EQUAL_INT(CIDR_LOOPBACK, tree.lookup(String("127.0.0.1")));
+    TEST_ASSERT_EQUAL_INT(CIDR_LOOPBACK, tree.lookup(String("::1")));
+    TEST_ASSERT_EQUAL_INT(CIDR_NONE, tree.lookup(String("::2")));
+    TEST_ASSERT_EQUAL_INT(CIDR_NONE, tree.lookup(String("8.8.8.8")));
+
+    // The IPv4 ranges live in ::ffff:0:0/96 and do not cover the same bits elsewhere
+    TEST_ASSERT_EQUAL_INT(CIDR_NONE, tree.lookup(String("::a00:1")));
+}
+
+void test_rejects_malformed_ranges_and_addresses() {
+    CidrTree tree;
+    TEST_ASSERT_FALSE(tree.add("10.0.0.0/33", CIDR_DENY));
+    TEST_ASSERT_FALSE(tree.add("2001:db8::/129", CIDR_DENY));
+    TEST_ASSERT_FALSE(tree.add("10.0.0.0/", CIDR_DENY));
+    TEST_ASSERT_FALSE(tree.add("10.0.0.0/8x", CIDR_DENY));
+    TEST_ASSERT_FALSE(tree.add("10.0.0.0/8", CIDR_NONE));
+    TEST_ASSERT_FALSE(tree.add("10.0.0/8", CIDR_DENY));
+    TEST_ASSERT_EQUAL_UINT32(0, tree.getRangeCount());
+
+    const char* const bad[] = {"256.1.1.1", "1.2.3", "1..2.3", "1.2.3.4.", "1:2:3:4:5:6:7:8:9",
+                               "1::2::3", ":1::", "1:2:3:4:5:6:7:", "12345::", "g::1", ""};
+    CidrAddress address;
+    for (const char* text : bad) {
+        TEST_ASSERT_FALSE(CidrTree::parseAddress(text, strlen(text), address));
+    }
+
+    // Unparseable addresses match nothing, not even a /0 range
+    TEST_ASSERT_TRUE(tree.add("0.0.0.0/0", CIDR_INTEL));
+    TEST_ASSERT_EQUAL_INT(CIDR_INTEL, tree.lookup(String("1.2.3.4")));
+    TEST_ASSERT_EQUAL_INT(CIDR_NONE, tree.lookup(String("1.2.3")));
+}
+
+// Longest prefix by trying every range
+static CidrTag naiveLookup(const std::vector<std::pair<String, CidrTag>>& ranges, const String& ip) {
+    CidrAddress address;
+    if (!CidrTree::parseAddress(ip.c_str(), ip.length(), address)) return CIDR_NONE;
+    CidrTag best = CIDR_NONE;
+    int best_len = -1;
+    for (const auto& range : ranges) {
+        CidrAddress prefix;
+        uint8_t len;
+        TEST_ASSERT_TRUE(CidrTree::parseCidr(range.first, prefix, len));
+        bool inside = true;
+        for (uint8_t bit = 0; bit < len && inside; bit++) {
+            uint64_t a = bit < 64 ? address.hi >> (63 - bit) : address.lo >> (127 - bit);
+            uint64_t p = bit < 64 ? prefix.hi >> (63 - bit) : prefix.lo >> (127 - bit);
+            inside = (a & 1) == (p & 1);
+        }
+        // A later range of the same length replaces an earlier one
+        if (inside && len >= best_len) {
+            best = range.second;
+            best_len = len;
+        }
+    }
+    return best;
+}
+
+void test_lookup_matches_a_linear_scan() {
+    std::mt19937 rng(7);
+    // Few distinct octets and groups, so ranges nest, share prefixes and collide
+    auto ipv4 = [&rng]() {
+        return "10." + String(rng() % 4) + "." + String(rng() % 4 * 64) + "." + String(rng() % 256);
+    };
+    auto ipv6 = [&rng]() {
+        return "2001:db8:" + String(rng() % 3, HEX) + ":" + String(rng() % 2 * 0x8000, HEX) + "::" + String(rng() % 0x10000, HEX);
+    };
+    const CidrTag tags[] = {CIDR_ALLOW, CIDR_DENY, CIDR_INTEL, CIDR_PRIVATE};
+
+    for (int round = 0; round < 20; round++) {
+        CidrTree tree;
+        std::vector<std::pair<String, CidrTag>> ranges;
+        for (int i = 0; i < 40; i++) {
+            bool v4 = rng() % 2;
+            String cidr = v4 ? ipv4() + "/" + String(rng() % 33) : ipv6() + "/" + String(rng() % 129);
+            CidrTag tag = tags[rng() % 4];
+            TEST_ASSERT_TRUE(tree.add(cidr, tag));
+            ranges.push_back(std::make_pair(cidr, tag));
+        }
+        for (int i = 0; i < 200; i++) {
+            String ip = rng() % 2 ? ipv4() : ipv6();
+            TEST_ASSERT_EQUAL_INT(naiveLookup(ranges, ip), tree.lookup(ip));
+        }
+    }
+}
+
+// ===========================
+// ThreatDetector network rules
+// ===========================
+
+void test_network_rule_matches_ranges_and_substrings() {
+    ThreatDetector detector;
+    detector.begin(&storage, nullptr, nullptr);
+    TEST_ASSERT_TRUE(detector.loadRule(makeNetworkRule("NET_FIXTURE", {"198.51.100.0/24", "Evil-C2.example"})));
+    const ThreatRule* rule = detector.findRule("NET_FIXTURE");
+    TEST_ASSERT_NOT_NULL(rule);
+
+    std::vector<IOC> in_range = {makeIOC(IOC_IP_ADDRESS, "198.51.100.9")};
+    std::vector<IOC> out_of_range = {makeIOC(IOC_IP_ADDRESS, "198.51.101.9")};
+    std::vector<IOC> domain = {makeIOC(IOC_DOMAIN, "cdn.EVIL-C2.example.net")};
+    std::vector<IOC> hash = {makeIOC(IOC_FILE_HASH_MD5, "198.51.100.9")};
+
+    TEST_ASSERT_TRUE(detector.matchNetworkPattern(*rule, in_range));
+    TEST_ASSERT_FALSE(detector.matchNetworkPattern(*rule, out_of_range));
+    TEST_ASSERT_TRUE(detector.matchNetworkPattern(*rule, domain));
+    TEST_ASSERT_FALSE(detector.matchNetworkPattern(*rule, hash));
+
+    // A rule the detector does not hold is split on the spot
+    ThreatRule copy = *rule;
+    TEST_ASSERT_TRUE(detector.matchNetworkPattern(copy, in_range));
+    TEST_ASSERT_FALSE(detector.matchNetworkPattern(copy, out_of_range));
+    TEST_ASSERT_TRUE(detector.matchNetworkPattern(copy, domain));
+}
+
+void test_edited_network_rule_rebuilds_its_ranges() {
+    ThreatDetector detector;
+    detector.begin(&storage, nullptr, nullptr);
+    TEST_ASSERT_TRUE(detector.loadRule(makeNetworkRule("NET_EDIT", {"198.51.100.0/24"})));
+
+    std::vector<IOC> first = {makeIOC(IOC_IP_ADDRESS, "198.51.100.9")};
+    std::vector<IOC> second = {makeIOC(IOC_IP_ADDRESS, "192.0.2.9")};
+    TEST_ASSERT_TRUE(detector.matchNetworkPattern(*detector.findRule("NET_EDIT"), first));
+
+    ThreatRule* rule = detector.getRule("NET_EDIT");
+    rule->patterns[0] = "192.0.2.0/24";
+    TEST_ASSERT_FALSE(detector.matchNetworkPattern(*rule, first));
+    TEST_ASSERT_TRUE(detector.matchNetworkPattern(*rule, second));
+}
+
+void setUp() {
+    Serial.setQuiet(true);
+}
+
+void tearDown() {
+}
+
+int main(int argc, char** argv) {
+    Serial.setQuiet(true);
+    SD.wipe();
+    SPIFFS.wipe();
+    storage.begin();
+    storage.createDirectory("/evidence");
+
+    UNITY_BEGIN();
+    RUN_TEST(test_loads_ranges_through_storage);
+    RUN_TEST(test_extractor_loads_ranges_through_its_storage);
+    RUN_TEST(test_most_specific_range_wins);
+    RUN_TEST(test_host_bits_are_masked_and_readding_replaces);
+    RUN_TEST(test_default_ranges_cover_both_families);
+    RUN_TEST(test_rejects_malformed_ranges_and_addresses);
+    RUN_TEST(test_lookup_matches_a_linear_scan);
+    RUN_TEST(test_network_rule_matches_ranges_and_substrings);
+    RUN_TEST(test_edited_network_rule_rebuilds_its_ranges);
+    return UNITY_END();
+}
@@ -0,0 +1,226 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <random>
+#include <string>
+#include <vector>
+#include "csv_reader.h"
+#include "storage.h"
+
+typedef std::vector<std::vector<std::string>> Rows;
+
+static FRFDStorage storage;
+static std::mt19937 rng(20241021);
+
+static Rows readRows(CSVReader& reader) {
+    Rows rows;
+    while (reader.nextRow()) {
+        std::vector<std::string> row;
+        for (size_t f = 0; f < reader.getFieldCount(); f++) {
+            const CSVField& field = reader.getField(f);
+            TEST_ASSERT_EQUAL_UINT32(strlen(field.data), field.length);
+            row.push_back(std::string(field.data, field.length));
+        }
+        rows.push_back(row);
+    }
+    TEST_ASSERT_FALSE(reader.hasError());
+    return rows;
+}
+
+static Rows readText(const std::string& text) {
+    CSVReader reader;
+    reader.open(text.data(), text.size());
+    return readRows(reader);
+}
+
+static void checkRow(const Rows& rows, size_t index, const std::vector<std::string>& expected) {
+    TEST_ASSERT_TRUE(index < rows.size());
+    TEST_ASSERT_EQUAL_UINT32(expected.size(), rows[index].size());
+    for (size_t f = 0; f < expected.size(); f++) {
+        TEST_ASSERT_EQUAL_STRING(expected[f].c_str(), rows[index][f].c_str());
+    }
+}
+
+// Random field: mostly plain text, sometimes the characters that need quoting, sometimes long
+static std::string randomField() {
+    static const char chars[] = "abcXYZ019 ,\"\n\r;";
+    size_t length = rng() % 40 == 0 ? CSV_READER_BLOCK_SIZE / 2 + rng() % (2 * CSV_READER_BLOCK_SIZE) : rng() % 12;
+    std::string field;
+    for (size_t i = 0; i < length; i++) {
+        field += rng() % 8 ? chars[rng() % 9] : chars[rng() % (sizeof(chars) - 1)];
+    }
+    return field;
+}
+
+// Quoted when it has to be, and sometimes when it need not
+static std::string encodeField(const std::string& field) {
+    bool quote = field.find_first_of(",\"\n\r") != std::string::npos || rng() % 6 == 0;
+    if (!quote) return field;
+    std::string encoded = "\"";
+    for (char c : field) {
+        if (c == '"') encoded += '"';
+        encoded += c;
+    }
+    return encoded + "\"";
+}
+
+static std::string encodeRows(const Rows& rows, bool final_newline) {
+    std::string text;
+    for (size_t r = 0; r < rows.size(); r++) {
+        for (size_t f = 0; f < rows[r].size(); f++) {
+            if (f > 0) text += ',';
+            // A lone empty field would be an empty line
+            text += rows[r].size() == 1 && rows[r][0].empty() ? "\"\"" : encodeField(rows[r][f]);
+        }
+        if (r + 1 < rows.size() || final_newline) text += rng() % 2 ? "\r\n" : "\n";
+    }
+    return text;
+}
+
+static Rows randomRows(size_t count) {
+    Rows rows(count);
+    for (std::vector<std::string>& row : rows) {
+        size_t fields = 1 + rng() % 6;
+        for (size_t f = 0; f < fields; f++) row.push_back(randomField());
+    }
+    return rows;
+}
+
+// ===========================
+// Fields
+// ===========================
+
+void test_quoted_fields_and_escaped_quotes() {
+    Rows rows = readText("plain,\"with, comma\",\"say \"\"hi\"\"\",\"\"\n"
+                         "a\"b,\"closed\"after,\"\"\"\"\n");
+    TEST_ASSERT_EQUAL_UINT32(2, rows.size());
+    checkRow(rows, 0, {"plain", "with, comma", "say \"hi\"", ""});
+    // A quote inside an unquoted field, and text after a closing quote, are literal
+    checkRow(rows, 1, {"a\"b", "closedafter", "\""});
+}
+
+void test_empty_fields_and_lines() {
+    Rows rows = readText("\n,,\n\r\n\"\"\nlast\n\n");
+    TEST_ASSERT_EQUAL_UINT32(3, rows.size());
+    checkRow(rows, 0, {"", "", ""});
+    checkRow(rows, 1, {""});
+    checkRow(rows, 2, {"last"});
+}
+
+void test_crlf_line_endings() {
+    Rows rows = readText("a,b\r\nc,\"d\"\r\n\"e\r\",f\r\ng\rh,i\r\n");
+    TEST_ASSERT_EQUAL_UINT32(4, rows.size());
+    checkRow(rows, 0, {"a", "b"});
+    checkRow(rows, 1, {"c", "d"});
+    // Only a CR straight before the line break is part of it
+    checkRow(rows, 2, {"e\r", "f"});
+    checkRow(rows, 3, {"g\rh", "i"});
+}
+
+void test_line_breaks_inside_quotes() {
+    Rows rows = readText("\"two\nlines\",x\n\"crlf\r\ninside\",\"\n\"\nnext\n");
+    TEST_ASSERT_EQUAL_UINT32(3, rows.size());
+    checkRow(rows, 0, {"two\nlines", "x"});
+    checkRow(rows, 1, {"crlf\r\ninside", "\n"});
+    checkRow(rows, 2, {"next"});
+}
+
+void test_last_record_without_line_break() {
+    checkRow(readText("a,b\nc,d"), 1, {"c", "d"});
+    checkRow(readText("a,b\n\"c\nd\""), 1, {"c\nd"});
+    checkRow(readText("a,b\nc,"), 1, {"c", ""});
+    TEST_ASSERT_EQUAL_UINT32(1, readText("a,b\r\n").size());
+    TEST_ASSERT_EQUAL_UINT32(0, readText("").size());
+}
+
+// ===========================
+// Block boundaries
+// ===========================
+
+void test_records_longer_than_a_block() {
+    // Each record straddles one or more refills, and the first outgrows the buffer
+    std::string longest(3 * CSV_READER_BLOCK_SIZE, 'x');
+    longest[100] = '"';
+    std::string text = "id," + encodeField(longest) + "\nshort,row\n" +
+                       std::string(CSV_READER_BLOCK_SIZE - 5, 'y') + ",z";
+    Rows rows = readText(text);
+    TEST_ASSERT_EQUAL_UINT32(3, rows.size());
+    TEST_ASSERT_TRUE(rows[0][1] == longest);
+    checkRow(rows, 1, {"short", "row"});
+    checkRow(rows, 2, {std::string(CSV_READER_BLOCK_SIZE - 5, 'y'), "z"});
+}
+
+void test_record_over_the_limit_is_an_error() {
+    std::string text = "ok\n\"" + std::string(CSV_READER_MAX_RECORD + 10, 'x') + "\"\nnever\n";
+    CSVReader reader;
+    reader.open(text.data(), text.size());
+    TEST_ASSERT_TRUE(reader.nextRow());
+    TEST_ASSERT_FALSE(reader.nextRow());
+    TEST_ASSERT_TRUE(reader.hasError());
+    TEST_ASSERT_FALSE(reader.nextRow());
+    TEST_ASSERT_EQUAL_UINT32(1, reader.getRowNumber());
+}
+
+void test_random_records_read_back_from_memory_and_file() {
+    for (int round = 0; round < 6; round++) {
+        Rows expected = randomRows(200 + rng() % 800);
+        std::string text = encodeRows(expected, round % 2 == 0);
+
+        Rows from_memory = readText(text);
+        TEST_ASSERT_EQUAL_UINT32(expected.size(), from_memory.size());
+        TEST_ASSERT_TRUE(expected == from_memory);
+
+        const String path = "/evidence/random_" + String(round) + ".csv";
+        TEST_ASSERT_TRUE(storage.writeFile(path, String(text.c_str())));
+        CSVReader reader;
+        TEST_ASSERT_TRUE(reader.open(storage.openFile(path, FILE_READ)));
+        TEST_ASSERT_TRUE(expected == readRows(reader));
+        TEST_ASSERT_EQUAL_UINT32(expected.size(), reader.getRowNumber());
+    }
+}
+
+// ===========================
+// Whole lines
+// ===========================
+
+void test_next_line_keeps_quotes_and_commas() {
+    std::string text = "a,\"b,c\"\r\n\n" + std::string(CSV_READER_BLOCK_SIZE + 7, 'l') + "\nlast";
+    CSVReader reader;
+    reader.open(text.data(), text.size());
+
+    TEST_ASSERT_TRUE(reader.nextLine());
+    TEST_ASSERT_EQUAL_UINT32(1, reader.getFieldCount());
+    TEST_ASSERT_TRUE(reader.getField(0).equals("a,\"b,c\""));
+    TEST_ASSERT_TRUE(reader.nextLine());
+    TEST_ASSERT_EQUAL_UINT32(CSV_READER_BLOCK_SIZE + 7, reader.getField(0).length);
+    TEST_ASSERT_TRUE(reader.nextLine());
+    TEST_ASSERT_TRUE(reader.getField(0).equals("last"));
+    TEST_ASSERT_FALSE(reader.nextLine());
+    TEST_ASSERT_EQUAL_UINT32(3, reader.getRowNumber());
+}
+
+void setUp() {
+    Serial.setQuiet(true);
+}
+
+void tearDown() {
+}
+
+int main(int argc, char** argv) {
+    Serial.setQuiet(true);
+    SD.wipe();
+    SPIFFS.wipe();
+    storage.begin();
+    storage.createDirectory("/evidence");
+
+    UNITY_BEGIN();
+    RUN_TEST(test_quoted_fields_and_escaped_quotes);
+    RUN_TEST(test_empty_fields_and_lines);
+    RUN_TEST(test_crlf_line_endings);
+    RUN_TEST(test_line_breaks_inside_quotes);
+    RUN_TEST(test_last_record_without_line_break);
+    RUN_TEST(test_records_longer_than_a_block);
+    RUN_TEST(test_record_over_the_limit_is_an_error);
+    RUN_TEST(test_random_records_read_back_from_memory_and_file);
+    RUN_TEST(test_next_line_keeps_quotes_and_commas);
+    return UNITY_END();
+}
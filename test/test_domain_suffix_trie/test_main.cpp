@@ -0,0 +1,229 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <random>
+#include <utility>
+#include <vector>
+#include "domain_suffix_trie.h"
+#include "ioc_extractor.h"
+#include "storage.h"
+#include "storage_fixture.h"
+
+static FRFDStorage storage;
+
+static const char* SUFFIXES =
+    "# tag,suffix[,severity[,label]]\n"
+    "allow,microsoft.com\n"
+    "deny,*.evil-c2.net,95,c2 infrastructure\n"
+    "intel,.duckdns.org,60,dynamic dns\n"
+    "\n"
+    "bogus,example.org\n";
+
+static const char* PUBLIC_SUFFIXES =
+    "// Public suffix list excerpt\n"
+    "com\n"
+    "net\n"
+    "org\n"
+    "uk\n"
+    "co.uk\n"
+    "*.ck\n"
+    "!www.ck\n";
+
+// ===========================
+// Suffix files
+// ===========================
+
+static void checkLoadedSuffixes(const DomainSuffixTrie& trie) {
+    TEST_ASSERT_EQUAL_UINT32(3, trie.getEntryCount());
+
+    DomainMatch match;
+    TEST_ASSERT_EQUAL_INT(DOMAIN_DENY, trie.lookup("beacon.EVIL-C2.net", &match));
+    TEST_ASSERT_EQUAL_UINT8(95, match.severity);
+    TEST_ASSERT_EQUAL_STRING("c2 infrastructure", match.label->c_str());
+    TEST_ASSERT_EQUAL_INT(DOMAIN_ALLOW, trie.lookup(String("update.microsoft.com")));
+    TEST_ASSERT_EQUAL_INT(DOMAIN_INTEL, trie.lookup(String("x.duckdns.org")));
+    TEST_ASSERT_EQUAL_INT(DOMAIN_NONE, trie.lookup(String("notmicrosoft.com")));
+    TEST_ASSERT_EQUAL_INT(DOMAIN_NONE, trie.lookup(String("example.org")));
+}
+
+static void checkLoadedPublicSuffixes(const DomainSuffixTrie& trie) {
+    TEST_ASSERT_TRUE(trie.hasPublicSuffixList());
+    TEST_ASSERT_EQUAL_UINT32(7, trie.getPublicSuffixRuleCount());
+
+    TEST_ASSERT_EQUAL_STRING("bbc.co.uk", trie.getRegistrableDomain("news.bbc.co.uk").c_str());
+    TEST_ASSERT_EQUAL_STRING("a.b.ck", trie.getRegistrableDomain("x.a.b.ck").c_str());
+    TEST_ASSERT_EQUAL_STRING("www.ck", trie.getRegistrableDomain("www.ck").c_str());
+    TEST_ASSERT_EQUAL_STRING("", trie.getRegistrableDomain("co.uk").c_str());
+}
+
+void test_loads_suffixes_through_storage() {
+    checkLoadsThroughStorage<DomainSuffixTrie>(
+        storage, "domains.csv", SUFFIXES,
+        [](DomainSuffixTrie& trie, FRFDStorage* from, const String& path) { return trie.loadFile(from, path); },
+        checkLoadedSuffixes, [](const DomainSuffixTrie& trie) { return trie.getEntryCount(); });
+}
+
+void test_loads_public_suffix_list_through_storage() {
+    checkLoadsThroughStorage<DomainSuffixTrie>(
+        storage, "psl.dat", PUBLIC_SUFFIXES,
+        [](DomainSuffixTrie& trie, FRFDStorage* from, const String& path) {
+            return trie.loadPublicSuffixList(from, path);
+        },
+        checkLoadedPublicSuffixes, [](const DomainSuffixTrie& trie) { return trie.getPublicSuffixRuleCount(); });
+}
+
+// ===========================
+// Lookups
+// ===========================
+
+void test_most_specific_suffix_wins() {
+    DomainSuffixTrie trie;
+    TEST_ASSERT_TRUE(trie.add("microsoft.com", DOMAIN_ALLOW));
+    TEST_ASSERT_TRUE(trie.add("evil.microsoft.com", DOMAIN_DENY, 90));
+
+    DomainMatch match;
+    TEST_ASSERT_EQUAL_INT(DOMAIN_DENY, trie.lookup("a.evil.microsoft.com", &match));
+    TEST_ASSERT_EQUAL_UINT32(strlen("evil.microsoft.com"), match.suffix_length);
+    TEST_ASSERT_EQUAL_INT(DOMAIN_ALLOW, trie.lookup("www.microsoft.com", &match));
+    TEST_ASSERT_EQUAL_UINT32(strlen("microsoft.com"), match.suffix_length);
+    TEST_ASSERT_EQUAL_INT(DOMAIN_ALLOW, trie.lookup(String("microsoft.com")));
+    TEST_ASSERT_EQUAL_INT(DOMAIN_NONE, trie.lookup(String("com")));
+}
+
+void test_matches_whole_labels_in_any_case() {
+    DomainSuffixTrie trie;
+    TEST_ASSERT_TRUE(trie.add("Microsoft.COM", DOMAIN_ALLOW));
+
+    TEST_ASSERT_EQUAL_INT(DOMAIN_ALLOW, trie.lookup(String("LOGIN.microsoft.com")));
+    TEST_ASSERT_EQUAL_INT(DOMAIN_ALLOW, trie.lookup(String("login.microsoft.com.")));     // Root dot
+    TEST_ASSERT_EQUAL_INT(DOMAIN_NONE, trie.lookup(String("notmicrosoft.com")));
+    TEST_ASSERT_EQUAL_INT(DOMAIN_NONE, trie.lookup(String("microsoft.com.evil.net")));
+    TEST_ASSERT_EQUAL_INT(DOMAIN_NONE, trie.lookup(String("microsoft.co")));
+    TEST_ASSERT_EQUAL_INT(DOMAIN_NONE, trie.lookup(String("")));
+}
+
+void test_rejects_bad_suffixes() {
+    DomainSuffixTrie trie;
+    String longest;
+    while (longest.length() < 63) longest += 'a';
+    TEST_ASSERT_TRUE(trie.add(longest + ".com", DOMAIN_DENY));
+    TEST_ASSERT_FALSE(trie.add(longest + "a.com", DOMAIN_DENY));     // Label over 63 characters
+    TEST_ASSERT_FALSE(trie.add("a..com", DOMAIN_DENY));
+    TEST_ASSERT_FALSE(trie.add(".", DOMAIN_DENY));
+    TEST_ASSERT_FALSE(trie.add("", DOMAIN_DENY));
+    TEST_ASSERT_FALSE(trie.add("example.com", DOMAIN_NONE));
+    TEST_ASSERT_EQUAL_UINT32(1, trie.getEntryCount());
+}
+
+void test_readding_a_suffix_replaces_it() {
+    DomainSuffixTrie trie;
+    TEST_ASSERT_TRUE(trie.add("duckdns.org", DOMAIN_INTEL, 60, "dynamic dns"));
+    TEST_ASSERT_TRUE(trie.add("DUCKDNS.org.", DOMAIN_ALLOW));
+    TEST_ASSERT_EQUAL_UINT32(1, trie.getEntryCount());
+
+    DomainMatch match;
+    TEST_ASSERT_EQUAL_INT(DOMAIN_ALLOW, trie.lookup("x.duckdns.org", &match));
+    TEST_ASSERT_EQUAL_UINT8(0, match.severity);
+    TEST_ASSERT_EQUAL_STRING("", match.label->c_str());
+}
+
+void test_last_label_is_the_suffix_without_a_list() {
+    DomainSuffixTrie trie;
+    bool listed = true;
+    const char* domain = "a.b.example.com";
+    TEST_ASSERT_EQUAL_UINT32(strlen("a.b.example."), trie.getPublicSuffixStart(domain, strlen(domain), &listed));
+    TEST_ASSERT_FALSE(listed);
+    TEST_ASSERT_EQUAL_STRING("example.com", trie.getRegistrableDomain("a.b.example.com").c_str());
+    TEST_ASSERT_EQUAL_STRING("example.com", trie.getRegistrableDomain("example.com.").c_str());
+    TEST_ASSERT_EQUAL_STRING("", trie.getRegistrableDomain("com").c_str());
+}
+
+// Longest listed suffix by trying every entry; a later entry replaces an equal one
+static DomainTag naiveLookup(const std::vector<std::pair<String, DomainTag>>& entries, String domain) {
+    domain.toLowerCase();
+    DomainTag best = DOMAIN_NONE;
+    size_t best_length = 0;
+    for (const auto& entry : entries) {
+        String suffix = entry.first;
+        suffix.toLowerCase();
+        bool under = domain == suffix || domain.endsWith("." + suffix);
+        if (under && suffix.length() >= best_length) {
+            best = entry.second;
+            best_length = suffix.length();
+        }
+    }
+    return best;
+}
+
+void test_lookup_matches_a_linear_scan() {
+    std::mt19937 rng(11);
+    // Few distinct labels, so suffixes nest and share labels at every depth
+    const char* const words[] = {"com", "net", "Evil", "cdn", "a", "b", "login", "c2"};
+    auto domain = [&rng, &words](size_t max_labels) {
+        String name;
+        size_t labels = 1 + rng() % max_labels;
+        for (size_t i = 0; i < labels; i++) {
+            if (i > 0) name += '.';
+            name += words[rng() % 8];
+        }
+        return name;
+    };
+    const DomainTag tags[] = {DOMAIN_ALLOW, DOMAIN_DENY, DOMAIN_INTEL};
+
+    for (int round = 0; round < 10; round++) {
+        DomainSuffixTrie trie;
+        std::vector<std::pair<String, DomainTag>> entries;
+        for (int i = 0; i < 200; i++) {         // Enough nodes to grow the edge table
+            String suffix = domain(4);
+            DomainTag tag = tags[rng() % 3];
+            TEST_ASSERT_TRUE(trie.add(suffix, tag));
+            entries.push_back(std::make_pair(suffix, tag));
+        }
+        for (int i = 0; i < 300; i++) {
+            String name = domain(6);
+            TEST_ASSERT_EQUAL_INT(naiveLookup(entries, name), trie.lookup(name));
+        }
+    }
+}
+
+// ===========================
+// IOCExtractor
+// ===========================
+
+void test_extractor_loads_suffixes_through_its_storage() {
+    TEST_ASSERT_TRUE(storage.writeFile("/evidence/extractor_domains.csv", String(SUFFIXES)));
+    TEST_ASSERT_TRUE(storage.writeFile("/extractor_psl.dat", String(PUBLIC_SUFFIXES)));
+
+    IOCExtractor extractor;
+    extractor.begin(&storage);
+    TEST_ASSERT_TRUE(extractor.loadDomainSuffixes("/evidence/extractor_domains.csv"));
+    TEST_ASSERT_TRUE(extractor.loadPublicSuffixList("/extractor_psl.dat"));
+    TEST_ASSERT_EQUAL_INT(DOMAIN_DENY, extractor.classifyDomain("a.evil-c2.net"));
+    TEST_ASSERT_TRUE(extractor.getDomainSuffixes().hasPublicSuffixList());
+}
+
+void setUp() {
+    Serial.setQuiet(true);
+}
+
+void tearDown() {
+}
+
+int main(int argc, char** argv) {
+    Serial.setQuiet(true);
+    SD.wipe();
+    SPIFFS.wipe();
+    storage.begin();
+    storage.createDirectory("/evidence");
+
+    UNITY_BEGIN();
+    RUN_TEST(test_loads_suffixes_through_storage);
+    RUN_TEST(test_loads_public_suffix_list_through_storage);
+    RUN_TEST(test_most_specific_suffix_wins);
+    RUN_TEST(test_matches_whole_labels_in_any_case);
+    RUN_TEST(test_rejects_bad_suffixes);
+    RUN_TEST(test_readding_a_suffix_replaces_it);
+    RUN_TEST(test_last_label_is_the_suffix_without_a_list);
+    RUN_TEST(test_lookup_matches_a_linear_scan);
+    RUN_TEST(test_extractor_loads_suffixes_through_its_storage);
+    return UNITY_END();
+}
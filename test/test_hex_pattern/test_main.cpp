@@ -0,0 +1,251 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <algorithm>
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+#include "hex_pattern_matcher.h"
+#include "rule_image.h"
+#include "hex_rule_image.h"
+
+// Occurrences as (pattern id, end offset), the way HexPatternMatcher::scan reports them
+typedef std::set<std::pair<uint32_t, uint64_t>> Occurrences;
+
+static std::mt19937 rng(20240715);
+
+// Few distinct bytes, so wildcards, nibble masks and jumps line up often
+static const uint8_t TEXT_BYTES[] = {0x00, 0x0C, 0x4D, 0x5A, 0x50, 0x45, 0x90, 0xCC, 0xE8, 0x6B, 0x8B};
+
+static std::vector<uint8_t> randomBytes(size_t length) {
+    std::vector<uint8_t> data(length);
+    for (size_t i = 0; i < length; i++) {
+        data[i] = rng() % 8 ? TEXT_BYTES[rng() % sizeof(TEXT_BYTES)] : (uint8_t)rng();
+    }
+    return data;
+}
+
+static String hexByte(uint8_t b) {
+    static const char digits[] = "0123456789ABCDEF";
+    String text;
+    text += digits[b >> 4];
+    text += digits[b & 15];
+    return text;
+}
+
+// Random hex string: exact bytes, ??, nibble masks and bounded jumps between them
+static String randomHexString(size_t max_tokens) {
+    String hex;
+    size_t tokens = 1 + rng() % max_tokens;
+    for (size_t t = 0; t < tokens; t++) {
+        if (t > 0 && t + 1 < tokens && rng() % 5 == 0) {
+            uint32_t low = rng() % 3;
+            uint32_t high = low + rng() % 4;
+            hex += low == high ? "[" + String(low) + "] " : "[" + String(low) + "-" + String(high) + "] ";
+            continue;
+        }
+        String byte = hexByte(TEXT_BYTES[rng() % sizeof(TEXT_BYTES)]);
+        switch (rng() % 6) {
+            case 0: byte = "??"; break;
+            case 1: byte[0] = '?'; break;
+            case 2: byte[1] = '?'; break;
+            default: break;
+        }
+        hex += byte + " ";
+    }
+    return hex;
+}
+
+// Reference: every end offset at which the positions can match, trying each start and
+// each way of taking or skipping the optional (jump) positions
+static void naiveEnds(const std::vector<HexPatternMatcher::Position>& positions, const std::vector<uint8_t>& data,
+                      uint32_t id, Occurrences& found) {
+    for (size_t start = 0; start < data.size(); start++) {
+        std::set<size_t> offsets = {start};
+        for (const HexPatternMatcher::Position& pos : positions) {
+            std::set<size_t> next;
+            for (size_t at : offsets) {
+                if (at < data.size() && (data[at] & pos.mask) == pos.value) next.insert(at + 1);
+                if (pos.optional) next.insert(at);
+            }
+            offsets.swap(next);
+            if (offsets.empty()) break;
+        }
+        for (size_t end : offsets) found.insert(std::make_pair(id, (uint64_t)end));
+    }
+}
+
+static Occurrences naiveScan(const std::vector<String>& patterns, const std::vector<uint8_t>& data) {
+    Occurrences found;
+    for (size_t p = 0; p < patterns.size(); p++) {
+        std::vector<HexPatternMatcher::Position> positions;
+        TEST_ASSERT_TRUE(HexPatternMatcher::parse(patterns[p], positions));
+        naiveEnds(positions, data, p, found);
+    }
+    return found;
+}
+
+// Feeds `data` in blocks of random size (1..max_block), carrying the state across blocks
+static Occurrences matcherScan(const HexPatternMatcher& matcher, const std::vector<uint8_t>& data,
+                               size_t max_block) {
+    Occurrences found;
+    std::vector<uint64_t> state(matcher.getWordCount(), 0);
+    size_t pos = 0;
+    while (pos < data.size()) {
+        size_t len = std::min(data.size() - pos, (size_t)(1 + rng() % max_block));
+        uint64_t base = pos;
+        matcher.scan(data.data() + pos, len, state.data(), [&found, base](uint16_t id, size_t end) {
+            found.insert(std::make_pair((uint32_t)id, base + end));
+        });
+        pos += len;
+    }
+    return found;
+}
+
+static void runDifferential(size_t max_tokens, size_t max_patterns, size_t max_block) {
+    for (int round = 0; round < 60; round++) {
+        std::vector<String> patterns;
+        HexPatternMatcher matcher;
+        size_t count = 1 + rng() % max_patterns;
+        while (patterns.size() < count) {
+            String hex = randomHexString(max_tokens);
+            if (matcher.addPattern(hex) < 0) continue;      // A jump drawn last, or too long
+            patterns.push_back(hex);
+        }
+        TEST_ASSERT_TRUE(matcher.compile());
+
+        std::vector<uint8_t> data = randomBytes(1 + rng() % 4000);
+        Occurrences expected = naiveScan(patterns, data);
+        Occurrences actual = matcherScan(matcher, data, max_block);
+        TEST_ASSERT_EQUAL_UINT32(expected.size(), actual.size());
+        TEST_ASSERT_TRUE(expected == actual);
+    }
+}
+
+// ===========================
+// Matching
+// ===========================
+
+void test_wildcards_and_jumps_match_like_naive() {
+    runDifferential(8, 6, 1 << 20);
+}
+
+void test_matches_straddle_block_boundaries() {
+    runDifferential(8, 6, 5);
+}
+
+void test_patterns_packed_across_words() {
+    // Long strings and many of them, so patterns fill several words and end at word edges
+    runDifferential(40, 12, 97);
+}
+
+void test_nibble_masks() {
+    HexPatternMatcher matcher;
+    TEST_ASSERT_EQUAL_INT(0, matcher.addPattern("{ 4? ?D }"));
+    TEST_ASSERT_TRUE(matcher.compile());
+
+    const uint8_t data[] = {0x41, 0x0D, 0x4F, 0x3D, 0x5D, 0x40, 0xFD};
+    Occurrences found = matcherScan(matcher, std::vector<uint8_t>(data, data + sizeof(data)), 1 << 20);
+    Occurrences expected = {{0, 2}, {0, 4}, {0, 7}};
+    TEST_ASSERT_TRUE(expected == found);
+}
+
+void test_jump_lengths() {
+    HexPatternMatcher matcher;
+    TEST_ASSERT_EQUAL_INT(0, matcher.addPattern("{ AA [1-3] BB }"));
+    TEST_ASSERT_TRUE(matcher.compile());
+
+    // Gaps of 0 to 4 bytes between AA and BB: only 1, 2 and 3 match
+    for (size_t gap = 0; gap <= 4; gap++) {
+        std::vector<uint8_t> data(gap + 2, 0x11);
+        data.front() = 0xAA;
+        data.back() = 0xBB;
+        Occurrences found = matcherScan(matcher, data, 1 << 20);
+        TEST_ASSERT_EQUAL_UINT32(gap >= 1 && gap <= 3 ? 1 : 0, found.size());
+    }
+}
+
+void test_rejects_unsupported_syntax() {
+    HexPatternMatcher matcher;
+    TEST_ASSERT_TRUE(matcher.addPattern("{ [2] 4D }") < 0);         // Jump first
+    TEST_ASSERT_TRUE(matcher.addPattern("{ 4D [2] }") < 0);         // Jump last
+    TEST_ASSERT_TRUE(matcher.addPattern("{ 4D [2-] 5A }") < 0);     // Unbounded
+    TEST_ASSERT_TRUE(matcher.addPattern("{ 4D [3-1] 5A }") < 0);
+    TEST_ASSERT_TRUE(matcher.addPattern("{ 4D 5 }") < 0);           // Half a byte
+    TEST_ASSERT_TRUE(matcher.addPattern("{ 4D ZZ }") < 0);
+    TEST_ASSERT_TRUE(matcher.addPattern("{ }") < 0);
+
+    String longest = "{";
+    for (size_t i = 0; i < HexPatternMatcher::MAX_POSITIONS; i++) longest += " 4D";
+    TEST_ASSERT_EQUAL_INT(0, matcher.addPattern(longest + " }"));
+    TEST_ASSERT_TRUE(matcher.addPattern(longest + " 5A }") < 0);
+    TEST_ASSERT_TRUE(matcher.addPattern("{ 4D [63-64] 5A }") < 0);
+}
+
+// ===========================
+// Tables attached from a rule image
+// ===========================
+
+void test_image_tables_match_like_compiled_ones() {
+    RuleImage image;
+    TEST_ASSERT_TRUE(image.attach(HEX_RULE_IMAGE, sizeof(HEX_RULE_IMAGE)));
+    TEST_ASSERT_TRUE(image.getHexTables().word_count > 1);
+
+    HexPatternMatcher attached;
+    TEST_ASSERT_TRUE(attached.attach(image.getHexTables()));
+
+    // The same strings, compiled on the device, with ids in image order
+    std::vector<String> patterns;
+    HexPatternMatcher compiled;
+    for (uint32_t p = 0; p < image.getHexPatternCount(); p++) {
+        const RuleImagePattern& pattern = image.getHexPattern(p);
+        const RuleImageRule& rule = image.getRule(pattern.rule);
+        String hex = image.getText(image.getString(rule.first_string + pattern.slot).text);
+        patterns.push_back(hex);
+        TEST_ASSERT_EQUAL_INT(p, compiled.addPattern(hex));
+    }
+    TEST_ASSERT_TRUE(compiled.compile());
+    TEST_ASSERT_EQUAL_UINT32(compiled.getWordCount(), attached.getWordCount());
+
+    // Random data with each string planted a few times
+    for (int round = 0; round < 20; round++) {
+        std::vector<uint8_t> data = randomBytes(2000 + rng() % 6000);
+        for (size_t p = 0; p < patterns.size(); p++) {
+            std::vector<HexPatternMatcher::Position> positions;
+            TEST_ASSERT_TRUE(HexPatternMatcher::parse(patterns[p], positions));
+            size_t at = rng() % (data.size() - positions.size());
+            for (const HexPatternMatcher::Position& pos : positions) {
+                if (pos.optional && rng() % 2) continue;
+                data[at] = (data[at] & ~pos.mask) | pos.value;
+                at++;
+            }
+        }
+
+        Occurrences expected = naiveScan(patterns, data);
+        TEST_ASSERT_TRUE(expected.size() >= patterns.size());
+        TEST_ASSERT_TRUE(expected == matcherScan(attached, data, 1 + rng() % 300));
+        TEST_ASSERT_TRUE(expected == matcherScan(compiled, data, 1 + rng() % 300));
+    }
+}
+
+void setUp() {
+    Serial.setQuiet(true);
+}
+
+void tearDown() {
+}
+
+int main(int argc, char** argv) {
+    Serial.setQuiet(true);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_wildcards_and_jumps_match_like_naive);
+    RUN_TEST(test_matches_straddle_block_boundaries);
+    RUN_TEST(test_patterns_packed_across_words);
+    RUN_TEST(test_nibble_masks);
+    RUN_TEST(test_jump_lengths);
+    RUN_TEST(test_rejects_unsupported_syntax);
+    RUN_TEST(test_image_tables_match_like_compiled_ones);
+    return UNITY_END();
+}
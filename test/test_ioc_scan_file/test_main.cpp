@@ -0,0 +1,140 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <random>
+#include <set>
+#include "ioc_matcher.h"
+#include "performance_monitor.h"
+#include "storage.h"
+
+static FRFDStorage storage;
+
+static std::set<String> ruleNames(IOCMatcher& matcher) {
+    std::set<String> names;
+    for (const IOCMatch& match : matcher.getMatches()) names.insert(match.ruleName);
+    return names;
+}
+
+static IOCRule makeRule(const char* name, const std::vector<String>& strings, const char* condition) {
+    IOCRule rule;
+    rule.name = name;
+    rule.severity = "high";
+    rule.strings = strings;
+    rule.condition = condition;
+    return rule;
+}
+
+// Filler with each indicator placed so that it straddles a block boundary
+static String buildArtifact(const std::vector<const char*>& indicators, std::mt19937& rng) {
+    String content;
+    for (size_t i = 0; i < indicators.size(); i++) {
+        size_t boundary = (i + 1) * IOC_SCAN_BLOCK_SIZE;
+        size_t length = strlen(indicators[i]);
+        size_t start = boundary - 1 - rng() % (length - 1);
+        while (content.length() < start) content += (char)('a' + rng() % 3);
+        content += indicators[i];
+    }
+    while (content.length() < (indicators.size() + 1) * IOC_SCAN_BLOCK_SIZE) content += '.';
+    return content;
+}
+
+void test_scan_file_matches_across_blocks() {
+    std::mt19937 rng(3);
+    const char* const paths[] = {"/evidence/artifact.log", "/artifact.log"};
+
+    for (const char* path : paths) {
+        IOCMatcher matcher;
+        matcher.begin(&storage);
+        matcher.loadDefaultRules();
+        TEST_ASSERT_TRUE(matcher.addRule(makeRule("Straddle_All", {"sekurlsa::logonpasswords", "invoke-mimikatz"}, "all")));
+
+        String content = buildArtifact({"sekurlsa::logonpasswords", "Invoke-Mimikatz", "vssadmin delete shadows"}, rng);
+        TEST_ASSERT_TRUE(storage.writeFile(path, content));
+
+        TEST_ASSERT_TRUE(matcher.scanContent(content, path));
+        std::set<String> expected = ruleNames(matcher);
+        std::vector<IOCMatch> in_memory = matcher.getMatches();
+        matcher.clearMatches();
+
+        TEST_ASSERT_TRUE(matcher.scanFile(path));
+        TEST_ASSERT_TRUE(expected == ruleNames(matcher));
+        TEST_ASSERT_TRUE(expected.count("Straddle_All") == 1);
+
+        // Same first-occurrence offsets either way
+        std::vector<IOCMatch> streamed = matcher.getMatches();
+        TEST_ASSERT_EQUAL_UINT32(in_memory.size(), streamed.size());
+        for (size_t i = 0; i < streamed.size(); i++) {
+            TEST_ASSERT_TRUE(in_memory[i].offsets == streamed[i].offsets);
+        }
+    }
+}
+
+// Bytes the last scans read, as recorded for the whole pass
+static uint64_t bytesScanned(PerformanceMonitor& monitor) {
+    for (const RuleScanStats& stats : monitor.getRuleStats()) {
+        if (stats.rule_name == "(scan)") return stats.bytes_scanned;
+    }
+    return 0;
+}
+
+void test_scan_file_stops_once_every_rule_is_decided() {
+    // Indicators in the first two blocks of an eight-block file
+    String content = "alpha-beacon gamma-loader ";
+    while (content.length() < IOC_SCAN_BLOCK_SIZE + 10) content += '.';
+    content += " delta-stager";
+    while (content.length() < 8 * IOC_SCAN_BLOCK_SIZE) content += '.';
+    TEST_ASSERT_TRUE(storage.writeFile("/evidence/decided.log", content));
+
+    // "any" fires in the first block, "2 of them" in the second, and a rule that needs
+    // more strings than it has can never fire
+    IOCMatcher matcher;
+    PerformanceMonitor monitor;
+    matcher.begin(&storage);
+    matcher.setPerformanceMonitor(&monitor);
+    TEST_ASSERT_TRUE(matcher.addRule(makeRule("Any_Beacon", {"alpha-beacon", "omega-beacon"}, "any")));
+    TEST_ASSERT_TRUE(matcher.addRule(makeRule("Two_Loaders", {"gamma-loader", "delta-stager", "zeta"}, "2 of them")));
+    TEST_ASSERT_TRUE(matcher.addRule(makeRule("Never", {"gamma-loader"}, "3 of them")));
+
+    TEST_ASSERT_TRUE(matcher.scanFile("/evidence/decided.log"));
+    TEST_ASSERT_EQUAL_UINT64(2 * IOC_SCAN_BLOCK_SIZE, bytesScanned(monitor));
+    std::set<String> fired = ruleNames(matcher);
+    TEST_ASSERT_EQUAL_UINT32(2, fired.size());
+    TEST_ASSERT_TRUE(fired.count("Any_Beacon") == 1 && fired.count("Two_Loaders") == 1);
+
+    // One rule still undecided keeps the scan going to the end
+    matcher.clearMatches();
+    TEST_ASSERT_TRUE(matcher.addRule(makeRule("All_Absent", {"alpha-beacon", "absent"}, "all")));
+    uint64_t before = bytesScanned(monitor);
+    TEST_ASSERT_TRUE(matcher.scanFile("/evidence/decided.log"));
+    TEST_ASSERT_EQUAL_UINT64(8 * IOC_SCAN_BLOCK_SIZE, bytesScanned(monitor) - before);
+    TEST_ASSERT_EQUAL_UINT32(2, matcher.getMatchCount());
+}
+
+void test_scan_file_needs_storage_and_file() {
+    IOCMatcher matcher;
+    matcher.loadDefaultRules();
+    TEST_ASSERT_FALSE(matcher.scanFile("/evidence/artifact.log"));
+
+    matcher.begin(&storage);
+    TEST_ASSERT_FALSE(matcher.scanFile("/evidence/missing.log"));
+}
+
+void setUp() {
+    Serial.setQuiet(true);
+}
+
+void tearDown() {
+}
+
+int main(int argc, char** argv) {
+    Serial.setQuiet(true);
+    SD.wipe();
+    SPIFFS.wipe();
+    storage.begin();
+    storage.createDirectory("/evidence");
+
+    UNITY_BEGIN();
+    RUN_TEST(test_scan_file_matches_across_blocks);
+    RUN_TEST(test_scan_file_stops_once_every_rule_is_decided);
+    RUN_TEST(test_scan_file_needs_storage_and_file);
+    return UNITY_END();
+}
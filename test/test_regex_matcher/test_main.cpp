@@ -0,0 +1,206 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <random>
+#include <regex>
+#include <string>
+#include "regex_matcher.h"
+
+static std::mt19937 rng(1337);
+
+// Random patterns over a small alphabet, in the syntax both engines read the same way
+static std::string randomAtom(int depth, bool with_boundaries);
+
+static std::string randomSequence(int depth, bool with_boundaries) {
+    std::string pattern;
+    int atoms = 1 + rng() % 4;
+    for (int i = 0; i < atoms; i++) {
+        std::string atom = randomAtom(depth, with_boundaries);
+        pattern += atom;
+        if (atom == "\\b") continue;     // Assertions take no quantifier
+        if (atom[0] == '(') {
+            // Nested stars send std::regex into exponential backtracking
+            if (rng() % 3 == 0) pattern += rng() % 2 ? "?" : "{1,2}";
+            continue;
+        }
+        switch (rng() % 8) {
+            case 0: pattern += "*"; break;
+            case 1: pattern += "+"; break;
+            case 2: pattern += "?"; break;
+            case 3: pattern += "{" + std::to_string(rng() % 3) + "," + std::to_string(2 + rng() % 3) + "}"; break;
+            default: break;
+        }
+    }
+    return pattern;
+}
+
+static std::string randomAtom(int depth, bool with_boundaries) {
+    static const char* const atoms[] = {"a", "b", "c", "1", ".", "[ab]", "[^a]", "[a-c1]", "\\d", "\\w", "\\s", "\\W"};
+    unsigned pick = rng() % (depth < 3 ? 16 : 12);
+    if (pick < 12) return atoms[pick];
+    if (pick == 12 && with_boundaries) return "\\b";
+    if (pick == 13) return "(?:" + randomSequence(depth + 1, with_boundaries) + ")";
+    return "(" + randomSequence(depth + 1, with_boundaries) + "|" + randomSequence(depth + 1, with_boundaries) + ")";
+}
+
+static std::string randomInput(size_t max_length) {
+    static const char alphabet[] = "abcABC1 -_";
+    std::string text;
+    size_t length = rng() % (max_length + 1);
+    for (size_t i = 0; i < length; i++) text += alphabet[rng() % (sizeof(alphabet) - 1)];
+    return text;
+}
+
+// Reference leftmost-longest extent: first start with any match, then its longest end
+static bool referenceFind(const std::regex& re, const std::string& text, size_t& start, size_t& end) {
+    for (size_t s = 0; s <= text.size(); s++) {
+        bool found = false;
+        for (size_t e = text.size() + 1; e-- > s;) {
+            if (std::regex_match(text.begin() + s, text.begin() + e, re)) {
+                start = s;
+                end = e;
+                found = true;
+                break;
+            }
+        }
+        if (found) return true;
+    }
+    return false;
+}
+
+// Returns the DFA cache flushes seen along the way
+static uint32_t runSearchDifferential(bool case_insensitive, size_t cache_size, int rounds) {
+    int compared = 0;
+    uint32_t flushes = 0;
+    for (int round = 0; round < rounds; round++) {
+        std::string pattern = randomSequence(0, true);
+        std::regex reference(pattern, case_insensitive ? std::regex::ECMAScript | std::regex::icase
+                                                       : std::regex::ECMAScript);
+
+        RegexMatcher matcher;
+        TEST_ASSERT_TRUE_MESSAGE(matcher.compile(pattern.c_str(), case_insensitive, cache_size), pattern.c_str());
+
+        for (int i = 0; i < 8; i++) {
+            std::string text = randomInput(40);
+            bool expected = std::regex_search(text, reference);
+            bool actual = matcher.search((const uint8_t*)text.data(), text.size());
+            if (expected != actual) {
+                std::string message = "/" + pattern + "/ on \"" + text + "\"";
+                TEST_FAIL_MESSAGE(message.c_str());
+            }
+
+            // The same input fed in two blocks
+            size_t split = text.empty() ? 0 : rng() % text.size();
+            RegexMatcher::Cursor cursor;
+            matcher.begin(cursor);
+            bool streamed = matcher.feed(cursor, (const uint8_t*)text.data(), split);
+            streamed = matcher.feed(cursor, (const uint8_t*)text.data() + split, text.size() - split) || streamed;
+            streamed = matcher.finish(cursor) || streamed;
+            if (expected != streamed) {
+                std::string message = "streamed /" + pattern + "/ on \"" + text + "\"";
+                TEST_FAIL_MESSAGE(message.c_str());
+            }
+            compared++;
+        }
+        flushes += matcher.getCacheFlushes();
+    }
+    TEST_ASSERT_EQUAL_UINT32(rounds * 8, compared);
+    return flushes;
+}
+
+// ===========================
+// Differential against std::regex
+// ===========================
+
+void test_search_matches_std_regex() {
+    runSearchDifferential(false, REGEX_DFA_CACHE_SIZE, 1500);
+}
+
+void test_case_insensitive_search_matches_std_regex() {
+    runSearchDifferential(true, REGEX_DFA_CACHE_SIZE, 800);
+}
+
+void test_tiny_cache_matches_std_regex() {
+    // Small enough to flush constantly
+    TEST_ASSERT_TRUE(runSearchDifferential(false, 1024, 600) > 0);
+}
+
+void test_find_is_leftmost_longest() {
+    for (int round = 0; round < 600; round++) {
+        // No \b: the reference matches substrings without their surroundings
+        std::string pattern = randomSequence(0, false);
+        std::regex reference(pattern);
+
+        RegexMatcher matcher;
+        TEST_ASSERT_TRUE(matcher.compile(pattern.c_str()));
+
+        for (int i = 0; i < 4; i++) {
+            std::string text = randomInput(24);
+            size_t expected_start = 0, expected_end = 0, start = 0, end = 0;
+            bool expected = referenceFind(reference, text, expected_start, expected_end);
+            bool actual = matcher.find((const uint8_t*)text.data(), text.size(), 0, start, end);
+            if (expected != actual || (expected && (start != expected_start || end != expected_end))) {
+                std::string message = "find /" + pattern + "/ on \"" + text + "\"";
+                TEST_FAIL_MESSAGE(message.c_str());
+            }
+        }
+    }
+}
+
+// ===========================
+// Syntax
+// ===========================
+
+void test_rejects_unsupported_syntax() {
+    RegexMatcher matcher;
+    TEST_ASSERT_FALSE(matcher.compile("(a)\\1"));
+    TEST_ASSERT_FALSE(matcher.compile("a(?=b)"));
+    TEST_ASSERT_FALSE(matcher.compile("(ab"));
+    TEST_ASSERT_FALSE(matcher.compile("a{3,1}"));
+    TEST_ASSERT_TRUE(matcher.getError().length() > 0);
+}
+
+void test_line_anchors_and_flags() {
+    RegexMatcher matcher;
+    TEST_ASSERT_TRUE(matcher.compile("^cmd\\.exe$"));
+    TEST_ASSERT_TRUE(matcher.search(String("start\ncmd.exe\nend")));
+    TEST_ASSERT_FALSE(matcher.search(String("run cmd.exe now")));
+
+    TEST_ASSERT_TRUE(matcher.compile("(?i)invoke-expression"));
+    TEST_ASSERT_TRUE(matcher.search(String("IEX: Invoke-Expression $x")));
+
+    TEST_ASSERT_TRUE(matcher.compile("a.b"));
+    TEST_ASSERT_FALSE(matcher.search(String("a\nb")));
+    TEST_ASSERT_TRUE(matcher.compile("(?s)a.b"));
+    TEST_ASSERT_TRUE(matcher.search(String("a\nb")));
+
+    TEST_ASSERT_TRUE(matcher.compile("\\x4d\\x5a"));
+    TEST_ASSERT_TRUE(matcher.search(String("..MZ..")));
+}
+
+void test_pathological_pattern_is_linear() {
+    RegexMatcher matcher;
+    TEST_ASSERT_TRUE(matcher.compile("(a|aa)*(a*)*b"));
+    std::string text(1 << 20, 'a');
+    unsigned long start = millis();
+    TEST_ASSERT_FALSE(matcher.search((const uint8_t*)text.data(), text.size()));
+    TEST_ASSERT_TRUE(millis() - start < 2000);
+}
+
+void setUp() {
+    Serial.setQuiet(true);
+}
+
+void tearDown() {
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_search_matches_std_regex);
+    RUN_TEST(test_case_insensitive_search_matches_std_regex);
+    RUN_TEST(test_tiny_cache_matches_std_regex);
+    RUN_TEST(test_find_is_leftmost_longest);
+    RUN_TEST(test_rejects_unsupported_syntax);
+    RUN_TEST(test_line_anchors_and_flags);
+    RUN_TEST(test_pathological_pattern_is_linear);
+    return UNITY_END();
+}
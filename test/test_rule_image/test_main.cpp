@@ -0,0 +1,261 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <vector>
+#include <functional>
+#include "rule_image.h"
+#include "esp_rom_crc.h"
+#include "ioc_matcher.h"
+#include "threat_detector.h"
+#include "default_rule_image.h"
+#include "mixed_rule_image.h"
+#include "storage.h"
+
+static FRFDStorage storage;
+
+static bool matchedRule(IOCMatcher& matcher, const char* name) {
+    for (const IOCMatch& match : matcher.getMatches()) {
+        if (match.ruleName == name) return true;
+    }
+    return false;
+}
+
+static const char* const CHOPPER_REGEX = "/eval\\s*\\(\\s*(\\$_POST\\[|Request\\[)/";
+
+void test_default_image_attaches_in_place() {
+    RuleImage image;
+    TEST_ASSERT_TRUE(image.attach(FRFD_DEFAULT_RULE_IMAGE, sizeof(FRFD_DEFAULT_RULE_IMAGE)));
+    TEST_ASSERT_TRUE(image.getRuleCount() > 0);
+}
+
+void test_loads_image_through_storage() {
+    // Evidence paths live on the SD card, everything else on SPIFFS
+    const char* const paths[] = {"/evidence/rules.frri", "/rules.frri"};
+    for (const char* path : paths) {
+        TEST_ASSERT_TRUE(storage.writeFile(path, FRFD_DEFAULT_RULE_IMAGE, sizeof(FRFD_DEFAULT_RULE_IMAGE)));
+
+        IOCMatcher matcher;
+        matcher.begin(&storage);
+        TEST_ASSERT_TRUE(matcher.loadRulesFromFile(path));
+
+        RuleImage image;
+        TEST_ASSERT_TRUE(image.attach(FRFD_DEFAULT_RULE_IMAGE, sizeof(FRFD_DEFAULT_RULE_IMAGE)));
+        TEST_ASSERT_EQUAL_UINT32(image.getRuleCount(), matcher.getRuleCount());
+
+        TEST_ASSERT_TRUE(matcher.scanContent("procdump -ma lsass.exe out.dmp", "cmd.log"));
+        TEST_ASSERT_TRUE(matchedRule(matcher, "Credential_Dumping_Tools"));
+    }
+}
+
+void test_image_carries_regex_strings() {
+    RuleImage image;
+    TEST_ASSERT_TRUE(image.attach(FRFD_DEFAULT_RULE_IMAGE, sizeof(FRFD_DEFAULT_RULE_IMAGE)));
+    TEST_ASSERT_EQUAL_UINT32(1, image.getRegexPatternCount());
+
+    const RuleImagePattern& pattern = image.getRegexPattern(0);
+    const RuleImageRule& rule = image.getRule(pattern.rule);
+    const RuleImageString& str = image.getString(rule.first_string + pattern.slot);
+    TEST_ASSERT_EQUAL_STRING("China_Chopper_Webshell", image.getText(rule.name));
+    TEST_ASSERT_EQUAL_UINT32(RULE_STRING_REGEX, str.kind);
+    TEST_ASSERT_EQUAL_STRING(CHOPPER_REGEX, image.getText(str.text));
+}
+
+void test_regex_string_matches_alone() {
+    IOCMatcher matcher;
+    matcher.loadDefaultRules();
+
+    // None of the rule's literal strings occur, only the regex
+    const char* shell = "<?php @eval ( $_POST['z']);?>";
+    TEST_ASSERT_TRUE(matcher.scanContent(shell, "shell.php"));
+    TEST_ASSERT_TRUE(matchedRule(matcher, "China_Chopper_Webshell"));
+
+    std::vector<IOCMatch> matches = matcher.getMatches();
+    const IOCMatch& match = matches[0];
+    TEST_ASSERT_EQUAL_UINT32(1, match.matchedStrings.size());
+    TEST_ASSERT_EQUAL_STRING(CHOPPER_REGEX, match.matchedStrings[0].c_str());
+    TEST_ASSERT_EQUAL_UINT64(7, match.offsets[0]);
+
+    // No i flag: case matters
+    matcher.clearMatches();
+    matcher.scanContent("<?php @EVAL ( $_POST['z']);?>", "shell.php");
+    TEST_ASSERT_FALSE(matchedRule(matcher, "China_Chopper_Webshell"));
+}
+
+void test_regex_match_straddles_file_blocks() {
+    // "eval (" ends the first block, "$_POST[" starts the second
+    String content;
+    while (content.length() < IOC_SCAN_BLOCK_SIZE - 6) content += "<p>static page</p>\n";
+    content = content.substring(0, IOC_SCAN_BLOCK_SIZE - 6);
+    content += "eval (";
+    content += "$_POST['z']);\n";
+    TEST_ASSERT_TRUE(storage.writeFile("/evidence/straddle.php", content));
+
+    IOCMatcher matcher;
+    matcher.begin(&storage);
+    matcher.loadDefaultRules();
+    TEST_ASSERT_TRUE(matcher.scanFile("/evidence/straddle.php"));
+    TEST_ASSERT_TRUE(matchedRule(matcher, "China_Chopper_Webshell"));
+}
+
+void test_rejects_corrupt_image() {
+    std::vector<uint8_t> corrupt(FRFD_DEFAULT_RULE_IMAGE, FRFD_DEFAULT_RULE_IMAGE + sizeof(FRFD_DEFAULT_RULE_IMAGE));
+    corrupt[corrupt.size() / 2] ^= 0x5A;
+    TEST_ASSERT_TRUE(storage.writeFile("/evidence/corrupt.frri", corrupt.data(), corrupt.size()));
+
+    IOCMatcher matcher;
+    matcher.begin(&storage);
+    TEST_ASSERT_FALSE(matcher.loadRulesFromFile("/evidence/corrupt.frri"));
+    TEST_ASSERT_EQUAL_UINT32(0, matcher.getRuleCount());
+}
+
+// Copy of an image, edited and given a valid checksum again, as a crafted file would be
+static bool attachesTampered(const std::function<void(uint8_t* data, RuleImageHeader* h)>& edit,
+                             const uint8_t* original = FRFD_DEFAULT_RULE_IMAGE,
+                             size_t size = sizeof(FRFD_DEFAULT_RULE_IMAGE)) {
+    std::vector<uint64_t> copy((size + 7) / 8);
+    uint8_t* data = (uint8_t*)copy.data();
+    memcpy(data, original, size);
+    RuleImageHeader* h = (RuleImageHeader*)data;
+    edit(data, h);
+    if (h->image_size >= h->header_size) {
+        h->checksum = esp_rom_crc32_le(0, data + h->header_size, h->image_size - h->header_size);
+    }
+
+    RuleImage image;
+    return image.attach(data, size);
+}
+
+void test_rejects_bad_references_with_valid_checksum() {
+    // The unedited copy still attaches
+    TEST_ASSERT_TRUE(attachesTampered([](uint8_t*, RuleImageHeader*) {}));
+
+    // Section sizes that wrap around in 32 bits
+    TEST_ASSERT_FALSE(attachesTampered([](uint8_t*, RuleImageHeader* h) { h->hex_word_count = 0x01000000; }));
+    TEST_ASSERT_FALSE(attachesTampered([](uint8_t*, RuleImageHeader* h) { h->num_states = 0xFFFFFFFF; }));
+    TEST_ASSERT_FALSE(attachesTampered([](uint8_t*, RuleImageHeader* h) { h->image_size = 16; }));
+
+    // Rules and strings
+    TEST_ASSERT_FALSE(attachesTampered([](uint8_t* data, RuleImageHeader* h) {
+        RuleImageRule* rules = (RuleImageRule*)(data + h->rules_offset);
+        rules[h->rule_count - 1].first_string = h->string_count - rules[h->rule_count - 1].string_count + 1;
+    }));
+    TEST_ASSERT_FALSE(attachesTampered([](uint8_t* data, RuleImageHeader* h) {
+        ((RuleImageRule*)(data + h->rules_offset))[0].string_count = RULE_IMAGE_MAX_STRINGS + 1;
+    }));
+    TEST_ASSERT_FALSE(attachesTampered([](uint8_t* data, RuleImageHeader* h) {
+        ((RuleImageRule*)(data + h->rules_offset))[0].name = h->pool_size;
+    }));
+    TEST_ASSERT_FALSE(attachesTampered([](uint8_t* data, RuleImageHeader* h) {
+        ((RuleImageString*)(data + h->strings_offset))[0].text = 0x7FFFFFFF;
+    }));
+
+    // Patterns
+    TEST_ASSERT_FALSE(attachesTampered([](uint8_t* data, RuleImageHeader* h) {
+        ((RuleImagePattern*)(data + h->patterns_offset))[0].rule = h->rule_count;
+    }));
+    TEST_ASSERT_FALSE(attachesTampered([](uint8_t* data, RuleImageHeader* h) {
+        RuleImagePattern* pattern = (RuleImagePattern*)(data + h->patterns_offset);
+        pattern->slot = ((RuleImageRule*)(data + h->rules_offset))[pattern->rule].string_count;
+    }));
+    TEST_ASSERT_FALSE(attachesTampered([](uint8_t* data, RuleImageHeader* h) {
+        ((RuleImagePattern*)(data + h->patterns_offset))[0].bytes = h->pool_size - 1;
+    }));
+    TEST_ASSERT_FALSE(attachesTampered([](uint8_t* data, RuleImageHeader* h) {
+        ((RuleImagePattern*)(data + h->regex_patterns_offset))[0].bytes = h->pool_size;
+    }));
+
+    // Automaton
+    TEST_ASSERT_FALSE(attachesTampered([](uint8_t* data, RuleImageHeader* h) {
+        data[h->class_map_offset + 'a'] = h->num_classes;
+    }));
+    TEST_ASSERT_FALSE(attachesTampered([](uint8_t* data, RuleImageHeader* h) {
+        ((uint32_t*)(data + h->dense_offset))[1] = h->num_states;
+    }));
+    TEST_ASSERT_FALSE(attachesTampered([](uint8_t* data, RuleImageHeader* h) {
+        ((uint32_t*)(data + h->sparse_next_offset))[0] = h->num_states | MultiPatternMatcher::OUTPUT_FLAG;
+    }));
+    TEST_ASSERT_FALSE(attachesTampered([](uint8_t* data, RuleImageHeader* h) {
+        // A failure link back to the state itself would never end
+        ((uint32_t*)(data + h->fail_offset))[0] = h->dense_states;
+    }));
+    TEST_ASSERT_FALSE(attachesTampered([](uint8_t* data, RuleImageHeader* h) {
+        ((uint32_t*)(data + h->output_begin_offset))[h->num_states] = h->output_count + 1;
+    }));
+    TEST_ASSERT_FALSE(attachesTampered([](uint8_t* data, RuleImageHeader* h) {
+        ((uint16_t*)(data + h->output_ids_offset))[0] = h->pattern_count;
+    }));
+
+    // Hex tables, in an image that has some
+    TEST_ASSERT_TRUE(attachesTampered([](uint8_t*, RuleImageHeader*) {}, MIXED_RULE_IMAGE, sizeof(MIXED_RULE_IMAGE)));
+    TEST_ASSERT_FALSE(attachesTampered([](uint8_t* data, RuleImageHeader* h) {
+        ((RuleImagePattern*)(data + h->hex_patterns_offset))[0].rule = h->rule_count;
+    }, MIXED_RULE_IMAGE, sizeof(MIXED_RULE_IMAGE)));
+    TEST_ASSERT_FALSE(attachesTampered([](uint8_t* data, RuleImageHeader* h) {
+        const uint64_t* bits = (const uint64_t*)(data + h->hex_bits_offset);
+        int bit = __builtin_ctzll(bits[HexPatternMatcher::WORD_ACCEPTS]);
+        ((uint16_t*)(data + h->hex_accept_offset))[bit] = h->hex_pattern_count;
+    }, MIXED_RULE_IMAGE, sizeof(MIXED_RULE_IMAGE)));
+}
+
+// ===========================
+// Rule images in ThreatDetector
+// ===========================
+
+void test_detector_keeps_image_thresholds() {
+    TEST_ASSERT_TRUE(storage.writeFile("/evidence/mixed.frri", MIXED_RULE_IMAGE, sizeof(MIXED_RULE_IMAGE)));
+    ThreatDetector detector;
+    detector.begin(&storage, nullptr, nullptr);
+    TEST_ASSERT_TRUE(detector.loadRulesFromFile("/evidence/mixed.frri"));
+
+    // Rules needing more strings than their text ones cannot be decided on text
+    TEST_ASSERT_NULL(detector.findRule("YARA_Text_And_Hex_All"));
+    TEST_ASSERT_NULL(detector.findRule("YARA_Three_Of_Text_And_Regex"));
+    TEST_ASSERT_NULL(detector.findRule("YARA_Hex_Only"));
+
+    // Two text strings still meet "2 of them", at the same threshold
+    const ThreatRule* rule = detector.findRule("YARA_Two_Of_Text_And_Hex");
+    TEST_ASSERT_NOT_NULL(rule);
+    TEST_ASSERT_EQUAL_UINT32(2, rule->patterns.size());
+    TEST_ASSERT_EQUAL_STRING("2", rule->metadata.at("min_matches").c_str());
+
+    TEST_ASSERT_FALSE(detector.matchContentPattern(*rule, "beacon only"));
+    TEST_ASSERT_TRUE(detector.matchContentPattern(*rule, "beacon with jitter"));
+
+    // The text half of an "all of them" rule raises nothing
+    detector.scanContent("dropper unpacks the payload", "notes.txt");
+    for (const ThreatAlert& alert : detector.getAlerts()) {
+        TEST_ASSERT_FALSE(alert.rule_id == "YARA_Text_And_Hex_All");
+    }
+}
+
+void test_needs_storage_to_load() {
+    IOCMatcher matcher;
+    TEST_ASSERT_FALSE(matcher.loadRulesFromFile("/evidence/rules.frri"));
+    TEST_ASSERT_FALSE(matcher.loadRulesFromFile("/evidence/missing.frri"));
+}
+
+void setUp() {
+    Serial.setQuiet(true);
+}
+
+void tearDown() {
+}
+
+int main(int argc, char** argv) {
+    Serial.setQuiet(true);
+    SD.wipe();
+    SPIFFS.wipe();
+    storage.begin();
+    storage.createDirectory("/evidence");
+
+    UNITY_BEGIN();
+    RUN_TEST(test_default_image_attaches_in_place);
+    RUN_TEST(test_loads_image_through_storage);
+    RUN_TEST(test_image_carries_regex_strings);
+    RUN_TEST(test_regex_string_matches_alone);
+    RUN_TEST(test_regex_match_straddles_file_blocks);
+    RUN_TEST(test_rejects_corrupt_image);
+    RUN_TEST(test_rejects_bad_references_with_valid_checksum);
+    RUN_TEST(test_detector_keeps_image_thresholds);
+    RUN_TEST(test_needs_storage_to_load);
+    return UNITY_END();
+}
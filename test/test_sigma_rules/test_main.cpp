@@ -0,0 +1,383 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <vector>
+#include "sigma_rules.h"
+#include "threat_detector.h"
+#include "storage.h"
+#include "storage_fixture.h"
+
+static FRFDStorage storage;
+
+static const char* RULES =
+    "title: Encoded PowerShell\n"
+    "id: sigma-encoded-ps\n"
+    "level: high\n"
+    "tags:\n"
+    "  - attack.execution\n"
+    "  - attack.t1059.001\n"
+    "detection:\n"
+    "  selection:\n"
+    "    actor|endswith: '\\powershell.exe'\n"
+    "    details|contains: ' -enc '\n"
+    "  condition: selection\n"
+    "---\n"
+    "title: Shadow Copy Deletion\n"
+    "id: sigma-vss-delete\n"
+    "level: critical\n"
+    "detection:\n"
+    "  keywords:\n"
+    "    - 'vssadmin delete shadows'\n"
+    "  condition: keywords\n";
+
+static TimelineEvent makeEvent(const char* actor, const char* target, const char* details,
+                               const char* source = "evtx", TimelineEventType type = EVENT_PROCESS_STARTED) {
+    static int64_t seconds = 1700000000;
+    TimelineEvent event;
+    event.timestamp = seconds++ * 1000000LL;
+    event.datetime = TimelineGenerator::formatTimestamp(event.timestamp);
+    event.type = type;
+    event.description = "Process started";
+    event.source_artifact = source;
+    event.actor = actor;
+    event.target = target;
+    event.details = details;
+    event.significance = 5;
+    return event;
+}
+
+// Adds a rule made of a detection block (indented two spaces) and returns its index
+static int addDetection(SigmaRuleSet& set, const char* detection) {
+    return set.addRule(String("title: Fixture ") + String((int)set.getRuleCount()) + "\ndetection:\n" + detection);
+}
+
+static std::vector<uint16_t> matchedRules(SigmaRuleSet& set, const TimelineEvent& event) {
+    if (!set.isCompiled()) TEST_ASSERT_TRUE(set.compile());
+    std::vector<uint16_t> matched;
+    set.match(event, matched);
+    return matched;
+}
+
+static bool matches(SigmaRuleSet& set, const TimelineEvent& event) {
+    return !matchedRules(set, event).empty();
+}
+
+// ===========================
+// Rule files
+// ===========================
+
+static void checkLoadedRules(const SigmaRuleSet& set) {
+    TEST_ASSERT_EQUAL_UINT32(2, set.getRuleCount());
+    TEST_ASSERT_EQUAL_STRING("sigma-encoded-ps", set.getRule(0).id.c_str());
+    TEST_ASSERT_EQUAL_STRING("high", set.getRule(0).level.c_str());
+    TEST_ASSERT_EQUAL_UINT32(2, set.getRule(0).tags.size());
+    TEST_ASSERT_EQUAL_STRING("Shadow Copy Deletion", set.getRule(1).title.c_str());
+}
+
+void test_loads_rules_through_storage() {
+    checkLoadsThroughStorage<SigmaRuleSet>(
+        storage, "sigma.yml", RULES,
+        [](SigmaRuleSet& set, FRFDStorage* from, const String& path) { return set.loadFile(from, path); },
+        checkLoadedRules, [](const SigmaRuleSet& set) { return set.getRuleCount(); });
+}
+
+// ===========================
+// Modifiers and values
+// ===========================
+
+void test_string_modifiers() {
+    SigmaRuleSet set;
+    TEST_ASSERT_EQUAL_INT(0, addDetection(set,
+        "  selection:\n"
+        "    actor|endswith: '\\powershell.exe'\n"
+        "    details|contains|all:\n"
+        "      - ' -nop'\n"
+        "      - ' -enc '\n"
+        "  condition: selection\n"));
+    TEST_ASSERT_EQUAL_INT(1, addDetection(set,
+        "  selection:\n"
+        "    target|startswith: 'C:\\Users\\Public\\'\n"
+        "  condition: selection\n"));
+
+    const char* powershell = "C:\\Windows\\System32\\WindowsPowerShell\\v1.0\\POWERSHELL.EXE";
+    TEST_ASSERT_TRUE(matchedRules(set, makeEvent(powershell, "", "ps -NoP -nop -ENC SQBFAFgA")) ==
+                     std::vector<uint16_t>({0}));
+    TEST_ASSERT_FALSE(matches(set, makeEvent(powershell, "", "ps -enc SQBFAFgA")));          // Not all values
+    TEST_ASSERT_FALSE(matches(set, makeEvent("powershell.exe.bak", "", "ps -nop -enc x")));   // Not at the end
+    TEST_ASSERT_TRUE(matchedRules(set, makeEvent("cmd.exe", "c:\\users\\public\\drop.exe", "")) ==
+                     std::vector<uint16_t>({1}));
+    TEST_ASSERT_FALSE(matches(set, makeEvent("cmd.exe", "D:\\C:\\Users\\Public\\drop.exe", "")));
+}
+
+void test_regex_modifiers() {
+    SigmaRuleSet set;
+    TEST_ASSERT_EQUAL_INT(0, addDetection(set,
+        "  selection:\n"
+        "    details|re: 'Invoke-[A-Z][a-z]+'\n"
+        "  condition: selection\n"));
+    TEST_ASSERT_EQUAL_INT(1, addDetection(set,
+        "  selection:\n"
+        "    target|re|i: '\\.(ps1|vbs)$'\n"
+        "  condition: selection\n"));
+
+    // |re is case-sensitive, |re|i is not
+    TEST_ASSERT_TRUE(matchedRules(set, makeEvent("a", "", "IEX; Invoke-Mimikatz -dump")) == std::vector<uint16_t>({0}));
+    TEST_ASSERT_FALSE(matches(set, makeEvent("a", "", "iex; invoke-mimikatz -dump")));
+    TEST_ASSERT_TRUE(matchedRules(set, makeEvent("a", "C:\\x\\RUN.PS1", "")) == std::vector<uint16_t>({1}));
+    TEST_ASSERT_FALSE(matches(set, makeEvent("a", "C:\\x\\run.ps1.txt", "")));
+}
+
+void test_values_match_case_insensitively_unless_cased() {
+    SigmaRuleSet set;
+    TEST_ASSERT_EQUAL_INT(0, addDetection(set,
+        "  selection:\n"
+        "    actor: 'SYSTEM'\n"
+        "  condition: selection\n"));
+    TEST_ASSERT_EQUAL_INT(1, addDetection(set,
+        "  selection:\n"
+        "    actor|cased: 'Administrator'\n"
+        "  condition: selection\n"));
+
+    TEST_ASSERT_TRUE(matchedRules(set, makeEvent("system", "", "")) == std::vector<uint16_t>({0}));
+    TEST_ASSERT_FALSE(matches(set, makeEvent("SYSTEM32", "", "")));                // Whole value
+    TEST_ASSERT_TRUE(matchedRules(set, makeEvent("Administrator", "", "")) == std::vector<uint16_t>({1}));
+    TEST_ASSERT_FALSE(matches(set, makeEvent("administrator", "", "")));
+}
+
+void test_wildcards_and_escapes() {
+    SigmaRuleSet set;
+    // \\ before * is a backslash and a wildcard; \* is a literal star
+    TEST_ASSERT_EQUAL_INT(0, addDetection(set,
+        "  selection:\n"
+        "    target: 'C:\\Temp\\\\*.exe'\n"
+        "  condition: selection\n"));
+    TEST_ASSERT_EQUAL_INT(1, addDetection(set,
+        "  selection:\n"
+        "    target: 'report\\*final?.doc'\n"
+        "  condition: selection\n"));
+
+    TEST_ASSERT_TRUE(matchedRules(set, makeEvent("a", "c:\\temp\\evil.exe", "")) == std::vector<uint16_t>({0}));
+    TEST_ASSERT_TRUE(matches(set, makeEvent("a", "C:\\Temp\\sub\\evil.exe", "")));
+    TEST_ASSERT_FALSE(matches(set, makeEvent("a", "C:\\Temp\\evil.exe.txt", "")));
+    TEST_ASSERT_FALSE(matches(set, makeEvent("a", "C:\\Temp2\\evil.exe", "")));
+
+    TEST_ASSERT_TRUE(matchedRules(set, makeEvent("a", "REPORT*final1.doc", "")) == std::vector<uint16_t>({1}));
+    TEST_ASSERT_FALSE(matches(set, makeEvent("a", "reportXfinal1.doc", "")));
+    TEST_ASSERT_FALSE(matches(set, makeEvent("a", "report*final12.doc", "")));
+}
+
+void test_null_and_exists() {
+    SigmaRuleSet set;
+    TEST_ASSERT_EQUAL_INT(0, addDetection(set,
+        "  selection:\n"
+        "    details: null\n"
+        "  condition: selection\n"));
+    TEST_ASSERT_EQUAL_INT(1, addDetection(set,
+        "  selection:\n"
+        "    target|exists: true\n"
+        "  condition: selection\n"));
+    TEST_ASSERT_EQUAL_INT(2, addDetection(set,
+        "  selection:\n"
+        "    target|exists: false\n"
+        "  condition: selection\n"));
+
+    TEST_ASSERT_TRUE(matchedRules(set, makeEvent("a", "", "")) == std::vector<uint16_t>({0, 2}));
+    TEST_ASSERT_TRUE(matchedRules(set, makeEvent("a", "C:\\a.txt", "x")) == std::vector<uint16_t>({1}));
+}
+
+// ===========================
+// Conditions
+// ===========================
+
+void test_condition_operators() {
+    const char* selections =
+        "  sel_process:\n"
+        "    actor|endswith: '\\cmd.exe'\n"
+        "  sel_args:\n"
+        "    details|contains: '/c whoami'\n"
+        "  filter:\n"
+        "    source: 'trusted'\n";
+    const char* const conditions[] = {
+        "sel_process and not filter",
+        "1 of sel_*",
+        "all of sel_*",
+        "(sel_process or sel_args) and not filter",
+    };
+    SigmaRuleSet set;
+    for (const char* condition : conditions) {
+        String detection = String(selections) + "  condition: " + condition + "\n";
+        TEST_ASSERT_TRUE(addDetection(set, detection.c_str()) >= 0);
+    }
+    // "them" leaves out selections starting with '_'
+    TEST_ASSERT_EQUAL_INT(4, addDetection(set,
+        "  _noise:\n"
+        "    details|contains: 'whoami'\n"
+        "  selection:\n"
+        "    actor|endswith: '\\explorer.exe'\n"
+        "  condition: 1 of them\n"));
+
+    TEST_ASSERT_TRUE(matchedRules(set, makeEvent("C:\\cmd.exe", "", "cmd /c whoami")) ==
+                     std::vector<uint16_t>({0, 1, 2, 3}));
+    TEST_ASSERT_TRUE(matchedRules(set, makeEvent("C:\\cmd.exe", "", "dir", "trusted")) ==
+                     std::vector<uint16_t>({1}));
+    TEST_ASSERT_TRUE(matchedRules(set, makeEvent("C:\\explorer.exe", "", "cmd /c whoami")) ==
+                     std::vector<uint16_t>({1, 3, 4}));
+    TEST_ASSERT_TRUE(matchedRules(set, makeEvent("C:\\notepad.exe", "", "whoami")).empty());
+}
+
+void test_keyword_lists_search_every_text_field() {
+    SigmaRuleSet set;
+    TEST_ASSERT_EQUAL_INT(0, addDetection(set,
+        "  keywords:\n"
+        "    - 'vssadmin delete shadows'\n"
+        "    - 'wbadmin delete catalog'\n"
+        "  condition: keywords\n"));
+
+    TEST_ASSERT_TRUE(matches(set, makeEvent("VSSADMIN Delete Shadows /all", "", "")));
+    TEST_ASSERT_TRUE(matches(set, makeEvent("a", "", "wbadmin delete catalog -quiet")));
+    TEST_ASSERT_FALSE(matches(set, makeEvent("a", "", "", "vssadmin delete shadows")));    // Not the source
+}
+
+// ===========================
+// Indexing
+// ===========================
+
+void test_programs_run_only_on_trigger_atoms() {
+    SigmaRuleSet set;
+    TEST_ASSERT_EQUAL_INT(0, addDetection(set,
+        "  selection:\n"
+        "    details|contains: 'mimikatz'\n"
+        "  filter:\n"
+        "    actor: 'trusted.exe'\n"
+        "  condition: selection and not filter\n"));
+    TEST_ASSERT_TRUE(set.compile());
+    TEST_ASSERT_EQUAL_UINT32(0, set.getUnindexedRuleCount());
+
+    // The filter's literal alone does not run the program
+    for (int i = 0; i < 100; i++) {
+        TEST_ASSERT_FALSE(matches(set, makeEvent(i % 2 ? "trusted.exe" : "cmd.exe", "", "benign")));
+    }
+    TEST_ASSERT_EQUAL_UINT64(100, set.getEventsScanned());
+    TEST_ASSERT_EQUAL_UINT64(0, set.getProgramsRun());
+
+    TEST_ASSERT_TRUE(matches(set, makeEvent("cmd.exe", "", "MIMIKATZ.exe")));
+    TEST_ASSERT_FALSE(matches(set, makeEvent("trusted.exe", "", "mimikatz.exe")));
+    TEST_ASSERT_EQUAL_UINT64(2, set.getProgramsRun());
+}
+
+void test_unindexed_rules_run_on_every_event() {
+    SigmaRuleSet set;
+    // True without any literal: a bare not, and a regex
+    TEST_ASSERT_EQUAL_INT(0, addDetection(set,
+        "  filter:\n"
+        "    actor|endswith: '\\svchost.exe'\n"
+        "  condition: not filter\n"));
+    TEST_ASSERT_EQUAL_INT(1, addDetection(set,
+        "  selection:\n"
+        "    details|re: '^a+b$'\n"
+        "  condition: selection\n"));
+    TEST_ASSERT_TRUE(set.compile());
+    TEST_ASSERT_EQUAL_UINT32(2, set.getUnindexedRuleCount());
+
+    TEST_ASSERT_TRUE(matchedRules(set, makeEvent("cmd.exe", "", "xyz")) == std::vector<uint16_t>({0}));
+    TEST_ASSERT_TRUE(matchedRules(set, makeEvent("C:\\svchost.exe", "", "aaab")) == std::vector<uint16_t>({1}));
+    TEST_ASSERT_TRUE(matchedRules(set, makeEvent("C:\\svchost.exe", "", "b")).empty());
+    TEST_ASSERT_EQUAL_UINT64(3 * 2, set.getProgramsRun());
+}
+
+void test_rejects_unsupported_rules() {
+    const char* const detections[] = {
+        "  selection:\n    details: x\n  condition: selection | count() > 5\n",
+        "  selection:\n    details: x\n  timeframe: 5m\n  condition: selection\n",
+        "  selection:\n    Hashes: x\n  condition: selection\n",
+        "  selection:\n    details|base64: x\n  condition: selection\n",
+        "  selection:\n    details|re: '(ab'\n  condition: selection\n",
+        "  selection:\n    details: x\n  condition: other\n",
+        "  selection:\n    details: x\n  condition: 2 of selection\n",
+    };
+    SigmaRuleSet set;
+    for (const char* detection : detections) {
+        TEST_ASSERT_EQUAL_INT(-1, addDetection(set, detection));
+        TEST_ASSERT_TRUE(set.getError().length() > 0);
+        TEST_ASSERT_EQUAL_UINT32(0, set.getRuleCount());
+        TEST_ASSERT_EQUAL_UINT32(0, set.getAtomCount());     // Nothing left behind
+    }
+    TEST_ASSERT_EQUAL_INT(-1, set.addRule("detection:\n  selection:\n    details: x\n  condition: selection\n"));
+}
+
+// ===========================
+// ThreatDetector
+// ===========================
+
+void test_detector_loads_sigma_rules_through_its_storage() {
+    TEST_ASSERT_TRUE(storage.writeFile("/evidence/detector_sigma.yml", String(RULES)));
+
+    ThreatDetector detector;
+    detector.begin(&storage, nullptr, nullptr);
+    TEST_ASSERT_TRUE(detector.loadSigmaRules("/evidence/detector_sigma.yml"));
+
+    const ThreatRule* rule = detector.findRule("SIGMA_sigma-encoded-ps");
+    TEST_ASSERT_TRUE(rule != nullptr);
+    TEST_ASSERT_TRUE(rule->type == RULE_SIGMA);
+    TEST_ASSERT_TRUE(rule->severity == THREAT_HIGH);
+    TEST_ASSERT_TRUE(detector.findRule("SIGMA_sigma-vss-delete") != nullptr);
+}
+
+void test_detector_raises_sigma_alerts() {
+    TEST_ASSERT_TRUE(storage.writeFile("/evidence/alert_sigma.yml", String(RULES)));
+
+    TimelineGenerator timeline;
+    timeline.begin(&storage);
+    timeline.addEvent(makeEvent("C:\\Windows\\powershell.exe", "", "powershell -enc SQBFAFgA", "evtx_security"));
+    timeline.addEvent(makeEvent("C:\\Windows\\powershell.exe", "", "powershell -enc AAAA", "evtx_security"));
+    timeline.addEvent(makeEvent("C:\\Windows\\cmd.exe", "", "vssadmin delete shadows /all /quiet", "prefetch"));
+    timeline.addEvent(makeEvent("C:\\Windows\\explorer.exe", "", "benign", "prefetch"));
+
+    ThreatDetector detector;
+    detector.begin(&storage, nullptr, &timeline);
+    TEST_ASSERT_TRUE(detector.loadSigmaRules("/evidence/alert_sigma.yml"));
+    TEST_ASSERT_TRUE(detector.scanAllArtifacts());
+
+    // One alert per rule and source artifact
+    std::vector<const ThreatAlert*> encoded, vss;
+    for (const ThreatAlert& alert : detector.getAlerts()) {
+        if (alert.rule_id == "SIGMA_sigma-encoded-ps") encoded.push_back(&alert);
+        if (alert.rule_id == "SIGMA_sigma-vss-delete") vss.push_back(&alert);
+    }
+    TEST_ASSERT_EQUAL_UINT32(1, encoded.size());
+    TEST_ASSERT_EQUAL_STRING("evtx_security", encoded[0]->artifact_source.c_str());
+    TEST_ASSERT_TRUE(encoded[0]->severity == THREAT_HIGH);
+    TEST_ASSERT_EQUAL_UINT32(1, vss.size());
+    TEST_ASSERT_EQUAL_STRING("prefetch", vss[0]->artifact_source.c_str());
+    TEST_ASSERT_TRUE(vss[0]->severity == THREAT_CRITICAL);
+}
+
+void setUp() {
+    Serial.setQuiet(true);
+}
+
+void tearDown() {
+}
+
+int main(int argc, char** argv) {
+    Serial.setQuiet(true);
+    SD.wipe();
+    SPIFFS.wipe();
+    storage.begin();
+    storage.createDirectory("/evidence");
+
+    UNITY_BEGIN();
+    RUN_TEST(test_loads_rules_through_storage);
+    RUN_TEST(test_string_modifiers);
+    RUN_TEST(test_regex_modifiers);
+    RUN_TEST(test_values_match_case_insensitively_unless_cased);
+    RUN_TEST(test_wildcards_and_escapes);
+    RUN_TEST(test_null_and_exists);
+    RUN_TEST(test_condition_operators);
+    RUN_TEST(test_keyword_lists_search_every_text_field);
+    RUN_TEST(test_programs_run_only_on_trigger_atoms);
+    RUN_TEST(test_unindexed_rules_run_on_every_event);
+    RUN_TEST(test_rejects_unsupported_rules);
+    RUN_TEST(test_detector_loads_sigma_rules_through_its_storage);
+    RUN_TEST(test_detector_raises_sigma_alerts);
+    return UNITY_END();
+}
@@ -0,0 +1,87 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <random>
+#include "timeline_generator.h"
+#include "storage.h"
+
+static FRFDStorage storage;
+static std::mt19937 rng(20241016);
+
+static String isoTime(uint32_t seconds) {
+    return TimelineGenerator::formatTimestamp((1700000000LL + seconds) * 1000000LL);
+}
+
+// MFT export with rows out of time order, sharing files with the other exports
+static String mftExport(uint32_t rows) {
+    String csv = "Filename,Created,Modified,Accessed,Changed\n";
+    for (uint32_t i = 0; i < rows; i++) {
+        uint32_t file = rng() % 3000;
+        uint32_t created = file * 10;
+        csv += "C:\\data\\file" + String(file) + ".txt,";
+        csv += isoTime(created) + ",";
+        csv += isoTime(created + 1 + rng() % 5) + ",";
+        csv += isoTime(created + 100000 - rng() % 50000) + ",";
+        csv += isoTime(created) + "\n";
+    }
+    return csv;
+}
+
+static void checkSameTimeline(const TimelineGenerator& expected, const TimelineGenerator& actual) {
+    TEST_ASSERT_EQUAL_UINT32(expected.getEventCount(), actual.getEventCount());
+    TEST_ASSERT_EQUAL_UINT32(expected.getDuplicateCount(), actual.getDuplicateCount());
+    for (uint32_t i = 0; i < expected.getEventCount(); i++) {
+        TimelineEvent a = expected.getEvent(i);
+        TimelineEvent b = actual.getEvent(i);
+        TEST_ASSERT_TRUE(a.timestamp == b.timestamp);
+        TEST_ASSERT_EQUAL_INT(a.type, b.type);
+        TEST_ASSERT_EQUAL_STRING(a.target.c_str(), b.target.c_str());
+        TEST_ASSERT_EQUAL_STRING(a.source_artifact.c_str(), b.source_artifact.c_str());
+        TEST_ASSERT_EQUAL_UINT8(a.significance, b.significance);
+    }
+}
+
+// ===========================
+// Parallel build
+// ===========================
+
+void test_parallel_build_matches_sequential() {
+    // Files longer than a batch, so each is handed over in several
+    storage.createDirectory("/evidence/artifacts");
+    for (int f = 0; f < 5; f++) {
+        uint32_t rows = TIMELINE_PARSE_BATCH_EVENTS / 2 + rng() % TIMELINE_PARSE_BATCH_EVENTS;
+        TEST_ASSERT_TRUE(storage.writeFile("/evidence/artifacts/mft_" + String(f) + ".csv", mftExport(rows)));
+    }
+
+    TimelineGenerator sequential;
+    sequential.begin(&storage);
+    sequential.setParseWorkers(1);
+    TEST_ASSERT_TRUE(sequential.buildTimelineFromDirectory("/evidence/artifacts"));
+    TEST_ASSERT_TRUE(sequential.getDuplicateCount() > 0);
+
+    for (uint8_t workers = 2; workers <= 4; workers++) {
+        TimelineGenerator parallel;
+        parallel.begin(&storage);
+        parallel.setParseWorkers(workers);
+        TEST_ASSERT_TRUE(parallel.buildTimelineFromDirectory("/evidence/artifacts"));
+        checkSameTimeline(sequential, parallel);
+    }
+}
+
+void setUp() {
+    Serial.setQuiet(true);
+}
+
+void tearDown() {
+}
+
+int main(int argc, char** argv) {
+    Serial.setQuiet(true);
+    SD.wipe();
+    SPIFFS.wipe();
+    storage.begin();
+    storage.createDirectory("/evidence");
+
+    UNITY_BEGIN();
+    RUN_TEST(test_parallel_build_matches_sequential);
+    return UNITY_END();
+}
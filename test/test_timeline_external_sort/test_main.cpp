@@ -0,0 +1,120 @@
+#include <Arduino.h>
+#include <unity.h>
+#include "timeline_generator.h"
+#include "storage.h"
+
+static FRFDStorage storage;
+
+static TimelineEvent makeEvent(int64_t seconds, uint32_t target, const char* source, uint8_t significance) {
+    TimelineEvent event;
+    event.timestamp = seconds * 1000000LL;
+    event.datetime = TimelineGenerator::formatTimestamp(event.timestamp);
+    event.type = EVENT_FILE_MODIFIED;
+    event.description = "File modified";
+    event.source_artifact = source;
+    event.actor = "SYSTEM";
+    event.target = String("C:\\files\\") + target;
+    event.details = "";
+    event.significance = significance;
+    return event;
+}
+
+static uint32_t countOf(const String& text, const char* needle) {
+    uint32_t count = 0;
+    size_t length = strlen(needle);
+    for (int at = text.indexOf(needle); at >= 0; at = text.indexOf(needle, at + length)) {
+        count++;
+    }
+    return count;
+}
+
+static void addPass(TimelineGenerator& generator, uint32_t events, const char* source, uint8_t significance) {
+    for (uint32_t i = 0; i < events; i++) {
+        // Four events share each second
+        generator.addEvent(makeEvent(1700000000 + i / 4, i, source, significance));
+    }
+}
+
+// ===========================
+// Duplicates across runs
+// ===========================
+
+void test_duplicates_in_different_runs_are_merged() {
+    TimelineGenerator generator;
+    generator.begin(&storage);
+    generator.setSortMemoryBudget(0);
+    TEST_ASSERT_TRUE(generator.beginExternalSort("/evidence/sort_dedup"));
+
+    // Each pass spills, so most copies of an event land in different runs
+    const uint32_t events = 6000;
+    addPass(generator, events, "mft", 4);
+    addPass(generator, events, "usn", 7);
+    TEST_ASSERT_TRUE(generator.getSpilledRunCount() > 2);
+
+    TEST_ASSERT_TRUE(generator.saveSortedToFile("/evidence/sort_dedup.json", "json"));
+    String json = storage.readFile("/evidence/sort_dedup.json");
+    TEST_ASSERT_EQUAL_UINT32(events, countOf(json, "\"type\":"));
+    TEST_ASSERT_EQUAL_UINT32(events, countOf(json, "\"source\":\"mft; usn\""));
+    TEST_ASSERT_EQUAL_UINT32(events, countOf(json, "\"significance\":7"));
+    TEST_ASSERT_TRUE(json.indexOf("\"event_count\":6000}") > 0);
+    generator.endExternalSort();
+}
+
+void test_duplicates_merged_through_intermediate_merges() {
+    TimelineGenerator generator;
+    generator.begin(&storage);
+    generator.setSortMemoryBudget(0);
+    TEST_ASSERT_TRUE(generator.beginExternalSort("/evidence/sort_fanin"));
+
+    // More runs than one merge takes, so groups of runs are merged first
+    const uint32_t events = 12000;
+    addPass(generator, events, "mft", 4);
+    addPass(generator, events, "usn", 7);
+    addPass(generator, events, "mft", 2);
+    TEST_ASSERT_TRUE(generator.getSpilledRunCount() > TIMELINE_SORT_MAX_FANIN);
+
+    TEST_ASSERT_TRUE(generator.saveSortedToFile("/evidence/sort_fanin.csv", "csv"));
+    String csv = storage.readFile("/evidence/sort_fanin.csv");
+    TEST_ASSERT_EQUAL_UINT32(events + 1, countOf(csv, "\n"));
+    TEST_ASSERT_EQUAL_UINT32(events, countOf(csv, "\"mft; usn\""));
+    generator.endExternalSort();
+}
+
+void test_deduplication_off_keeps_every_copy() {
+    TimelineGenerator generator;
+    generator.begin(&storage);
+    generator.setDeduplication(false);
+    generator.setSortMemoryBudget(0);
+    TEST_ASSERT_TRUE(generator.beginExternalSort("/evidence/sort_keep"));
+
+    addPass(generator, 3000, "mft", 4);
+    addPass(generator, 3000, "usn", 7);
+    TEST_ASSERT_TRUE(generator.getSpilledRunCount() > 0);
+
+    TEST_ASSERT_TRUE(generator.saveSortedToFile("/evidence/sort_keep.json", "json"));
+    String json = storage.readFile("/evidence/sort_keep.json");
+    TEST_ASSERT_EQUAL_UINT32(6000, countOf(json, "\"type\":"));
+    TEST_ASSERT_EQUAL_UINT32(0, countOf(json, "mft; usn"));
+    generator.endExternalSort();
+}
+
+void setUp() {
+    Serial.setQuiet(true);
+}
+
+void tearDown() {
+}
+
+int main(int argc, char** argv) {
+    Serial.setQuiet(true);
+    SD.wipe();
+    SPIFFS.wipe();
+    storage.begin();
+    storage.createDirectory("/evidence");
+
+    UNITY_BEGIN();
+    RUN_TEST(test_duplicates_in_different_runs_are_merged);
+    RUN_TEST(test_duplicates_merged_through_intermediate_merges);
+    RUN_TEST(test_deduplication_off_keeps_every_copy);
+    return UNITY_END();
+}
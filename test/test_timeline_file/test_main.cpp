@@ -0,0 +1,334 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <vector>
+#include "esp_rom_crc.h"
+#include "timeline_file.h"
+#include "timeline_generator.h"
+#include "storage.h"
+
+static FRFDStorage storage;
+
+static TimelineEvent makeEvent(int64_t seconds, const char* target, const char* source, uint8_t significance = 5) {
+    TimelineEvent event;
+    event.timestamp = seconds * 1000000LL;
+    event.datetime = TimelineGenerator::formatTimestamp(event.timestamp);
+    event.type = EVENT_FILE_MODIFIED;
+    event.description = "File modified";
+    event.source_artifact = source;
+    event.actor = "SYSTEM";
+    event.target = target;
+    event.details = "";
+    event.significance = significance;
+    return event;
+}
+
+static std::vector<TimelineEvent> readAll(const String& path) {
+    std::vector<TimelineEvent> events;
+    TimelineFileReader reader;
+    if (!reader.open(storage.openFile(path, FILE_READ))) return events;
+    reader.query(INT64_MIN, INT64_MAX, [&](const TimelineEvent& event, uint32_t) { events.push_back(event); });
+    return events;
+}
+
+static std::vector<uint8_t> readBytes(const String& path) {
+    File in = storage.openFile(path, FILE_READ);
+    std::vector<uint8_t> bytes(in.size());
+    in.read(bytes.data(), bytes.size());
+    in.close();
+    return bytes;
+}
+
+static void writeBytes(const String& path, const std::vector<uint8_t>& bytes) {
+    File out = storage.openFile(path, FILE_WRITE);
+    out.write(bytes.data(), bytes.size());
+    out.close();
+}
+
+// ===========================
+// Saving
+// ===========================
+
+void test_save_without_new_events_writes_nothing() {
+    const String path = "/evidence/unchanged.frtl";
+    TimelineGenerator generator;
+    generator.begin(&storage);
+    TEST_ASSERT_TRUE(generator.openTimelineFile(path));
+    for (int i = 0; i < 10; i++) {
+        generator.addEvent(makeEvent(1000 + i, "C:\\a.txt", "mft"));
+    }
+    TEST_ASSERT_TRUE(generator.saveTimelineFile());
+    size_t saved = storage.getFileSize(path);
+
+    // Neither a second save nor the close has anything new to index
+    TEST_ASSERT_TRUE(generator.saveTimelineFile());
+    TEST_ASSERT_EQUAL_UINT32(saved, storage.getFileSize(path));
+    generator.closeTimelineFile();
+    TEST_ASSERT_EQUAL_UINT32(saved, storage.getFileSize(path));
+
+    // Nor does reopening and closing it
+    generator.clearTimeline();
+    TEST_ASSERT_TRUE(generator.openTimelineFile(path));
+    generator.closeTimelineFile();
+    TEST_ASSERT_EQUAL_UINT32(saved, storage.getFileSize(path));
+    TEST_ASSERT_EQUAL_UINT32(10, readAll(path).size());
+
+    // A new event is indexed again
+    TEST_ASSERT_TRUE(generator.openTimelineFile(path));
+    generator.addEvent(makeEvent(2000, "C:\\b.txt", "mft"));
+    generator.closeTimelineFile();
+    TEST_ASSERT_TRUE(storage.getFileSize(path) > saved);
+    TEST_ASSERT_EQUAL_UINT32(11, readAll(path).size());
+}
+
+void test_new_empty_file_is_indexed() {
+    const String path = "/evidence/empty.frtl";
+    TimelineFileWriter writer;
+    TEST_ASSERT_TRUE(writer.open(storage, path));
+    writer.close();
+
+    TimelineFileReader reader;
+    TEST_ASSERT_TRUE(reader.open(storage.openFile(path, FILE_READ)));
+    TEST_ASSERT_FALSE(reader.wasRecovered());
+    TEST_ASSERT_EQUAL_UINT32(0, reader.getEventCount());
+}
+
+// ===========================
+// Duplicates merged after writing
+// ===========================
+
+void test_merged_duplicate_updates_the_file() {
+    const String path = "/evidence/updated.frtl";
+    TimelineGenerator generator;
+    generator.begin(&storage);
+    TEST_ASSERT_TRUE(generator.openTimelineFile(path));
+    for (int i = 0; i < 50; i++) {
+        generator.addEvent(makeEvent(1000 + i, String("C:\\f" + String(i)).c_str(), "mft", 4));
+    }
+    TEST_ASSERT_TRUE(generator.saveTimelineFile());
+
+    // Reported again by another source, after a sort renumbered the events
+    generator.sortBySignificance();
+    generator.addEvent(makeEvent(1007, "C:\\f7", "usn", 9));
+    generator.addEvent(makeEvent(1020, "C:\\f20", "mft", 2));     // Changes nothing
+    TEST_ASSERT_EQUAL_UINT32(2, generator.getDuplicateCount());
+    generator.closeTimelineFile();
+
+    std::vector<TimelineEvent> events = readAll(path);
+    TEST_ASSERT_EQUAL_UINT32(50, events.size());
+    TEST_ASSERT_EQUAL_STRING("C:\\f7", events[7].target.c_str());
+    TEST_ASSERT_EQUAL_STRING("mft; usn", events[7].source_artifact.c_str());
+    TEST_ASSERT_EQUAL_UINT8(9, events[7].significance);
+    TEST_ASSERT_EQUAL_STRING("mft", events[20].source_artifact.c_str());
+
+    TimelineFileReader reader;
+    TEST_ASSERT_TRUE(reader.open(storage.openFile(path, FILE_READ)));
+    TEST_ASSERT_EQUAL_UINT32(1, reader.getUpdateBlocks().size());
+
+    // A window query sees the update too
+    uint32_t seen = reader.query(1007000000LL, 1007000000LL, [&](const TimelineEvent& event, uint32_t number) {
+        TEST_ASSERT_EQUAL_UINT32(7, number);
+        TEST_ASSERT_EQUAL_STRING("mft; usn", event.source_artifact.c_str());
+    });
+    TEST_ASSERT_EQUAL_UINT32(1, seen);
+}
+
+void test_later_update_wins() {
+    const String path = "/evidence/updated_twice.frtl";
+    TimelineGenerator generator;
+    generator.begin(&storage);
+    TEST_ASSERT_TRUE(generator.openTimelineFile(path));
+    generator.addEvent(makeEvent(1000, "C:\\a", "mft", 3));
+    TEST_ASSERT_TRUE(generator.saveTimelineFile());
+    generator.addEvent(makeEvent(1000, "C:\\a", "usn", 5));
+    TEST_ASSERT_TRUE(generator.saveTimelineFile());
+    generator.addEvent(makeEvent(1000, "C:\\a", "evtx", 7));
+    generator.closeTimelineFile();
+
+    // Loaded into a fresh timeline, in its latest version
+    TimelineGenerator loader;
+    loader.begin(&storage);
+    TEST_ASSERT_EQUAL_UINT32(1, loader.loadTimelineFile(path));
+    TEST_ASSERT_EQUAL_STRING("mft; usn; evtx", loader.getEvent(0).source_artifact.c_str());
+    TEST_ASSERT_EQUAL_UINT8(7, loader.getEvent(0).significance);
+}
+
+void test_updates_survive_recovery() {
+    // The updated file without its last index block, as if cut off while saving
+    const String path = "/evidence/updated.frtl";
+    const String torn = "/evidence/updated_torn.frtl";
+    File in = storage.openFile(path, FILE_READ);
+    std::vector<uint8_t> bytes(in.size() - TIMELINE_FILE_BLOCK_SIZE);
+    TEST_ASSERT_EQUAL_UINT32(bytes.size(), in.read(bytes.data(), bytes.size()));
+    in.close();
+    File out = storage.openFile(torn, FILE_WRITE);
+    out.write(bytes.data(), bytes.size());
+    out.close();
+
+    TimelineFileReader reader;
+    TEST_ASSERT_TRUE(reader.open(storage.openFile(torn, FILE_READ)));
+    TEST_ASSERT_TRUE(reader.wasRecovered());
+    TEST_ASSERT_EQUAL_UINT32(1, reader.getUpdateBlocks().size());
+    std::vector<TimelineEvent> events = readAll(torn);
+    TEST_ASSERT_EQUAL_UINT32(50, events.size());
+    TEST_ASSERT_EQUAL_STRING("mft; usn", events[7].source_artifact.c_str());
+}
+
+// ===========================
+// Reopening
+// ===========================
+
+void test_reopening_does_not_append_events_again() {
+    const String path = "/evidence/reopened.frtl";
+    TimelineGenerator generator;
+    generator.begin(&storage);
+    TEST_ASSERT_TRUE(generator.openTimelineFile(path));
+    for (int i = 0; i < 20; i++) {
+        generator.addEvent(makeEvent(1000 + i, String("C:\\r" + String(i)).c_str(), "mft", 4));
+    }
+    generator.closeTimelineFile();
+    size_t closed = storage.getFileSize(path);
+
+    // Same events in memory: nothing to write
+    TEST_ASSERT_TRUE(generator.openTimelineFile(path));
+    generator.closeTimelineFile();
+    TEST_ASSERT_EQUAL_UINT32(closed, storage.getFileSize(path));
+
+    // Merged while the file was closed, and one event more: an update and an append
+    generator.addEvent(makeEvent(1003, "C:\\r3", "usn", 4));
+    generator.addEvent(makeEvent(2000, "C:\\new", "usn", 4));
+    TEST_ASSERT_TRUE(generator.openTimelineFile(path));
+    generator.closeTimelineFile();
+
+    std::vector<TimelineEvent> events = readAll(path);
+    TEST_ASSERT_EQUAL_UINT32(21, events.size());
+    TEST_ASSERT_EQUAL_STRING("mft; usn", events[3].source_artifact.c_str());
+    TEST_ASSERT_EQUAL_STRING("C:\\new", events[20].target.c_str());
+}
+
+void test_loading_then_opening_the_same_file() {
+    const String path = "/evidence/resumed.frtl";
+    {
+        TimelineGenerator first;
+        first.begin(&storage);
+        TEST_ASSERT_TRUE(first.openTimelineFile(path));
+        for (int i = 0; i < 20; i++) {
+            first.addEvent(makeEvent(1000 + i, String("C:\\s" + String(i)).c_str(), "mft", 4));
+        }
+        first.closeTimelineFile();
+    }
+
+    // A later run: load the file, open it, and re-add an overlapping artifact
+    TimelineGenerator generator;
+    generator.begin(&storage);
+    TEST_ASSERT_EQUAL_UINT32(20, generator.loadTimelineFile(path));
+    TEST_ASSERT_TRUE(generator.openTimelineFile(path));
+    for (int i = 10; i < 30; i++) {
+        generator.addEvent(makeEvent(1000 + i, String("C:\\s" + String(i)).c_str(), "usn", 4));
+    }
+    generator.closeTimelineFile();
+
+    std::vector<TimelineEvent> events = readAll(path);
+    TEST_ASSERT_EQUAL_UINT32(30, events.size());
+    TEST_ASSERT_EQUAL_STRING("mft", events[9].source_artifact.c_str());
+    TEST_ASSERT_EQUAL_STRING("mft; usn", events[10].source_artifact.c_str());
+    TEST_ASSERT_EQUAL_STRING("usn", events[29].source_artifact.c_str());
+}
+
+// ===========================
+// Sizes read from the file
+// ===========================
+
+// Record counts that make count * record size wrap around in 32 bits to the true size
+void test_wrapping_index_record_count_is_rejected() {
+    const String path = "/evidence/wrapped_index.frtl";
+    TimelineGenerator generator;
+    generator.begin(&storage);
+    TEST_ASSERT_TRUE(generator.openTimelineFile(path));
+    for (int i = 0; i < 20; i++) {
+        generator.addEvent(makeEvent(1000 + i, String("C:\\w" + String(i)).c_str(), "mft"));
+    }
+    generator.closeTimelineFile();
+
+    // 24-byte index entries: 2^29 more of them is the same size modulo 2^32
+    std::vector<uint8_t> bytes = readBytes(path);
+    TimelineFileTrailer trailer;
+    memcpy(&trailer, &bytes[bytes.size() - sizeof(trailer)], sizeof(trailer));
+    TimelineBlockHeader index;
+    memcpy(&index, &bytes[trailer.index_offset], sizeof(index));
+    index.record_count += 1UL << 29;
+    memcpy(&bytes[trailer.index_offset], &index, sizeof(index));
+    writeBytes(path, bytes);
+
+    // The index is not trusted; the blocks are scanned instead
+    TimelineFileReader reader;
+    TEST_ASSERT_TRUE(reader.open(storage.openFile(path, FILE_READ)));
+    TEST_ASSERT_TRUE(reader.wasRecovered());
+    TEST_ASSERT_EQUAL_UINT32(20, readAll(path).size());
+}
+
+void test_wrapping_block_record_count_is_rejected() {
+    const String path = "/evidence/wrapped_block.frtl";
+    TimelineGenerator generator;
+    generator.begin(&storage);
+    TEST_ASSERT_TRUE(generator.openTimelineFile(path));
+    for (int i = 0; i < 20; i++) {
+        generator.addEvent(makeEvent(1000 + i, String("C:\\b" + String(i)).c_str(), "mft"));
+    }
+    generator.closeTimelineFile();
+
+    // 36-byte records: 2^30 more, in the event block and its index entry, with the index
+    // checksum recomputed
+    std::vector<uint8_t> bytes = readBytes(path);
+    TimelineFileTrailer trailer;
+    memcpy(&trailer, &bytes[bytes.size() - sizeof(trailer)], sizeof(trailer));
+    TimelineBlockHeader index;
+    memcpy(&index, &bytes[trailer.index_offset], sizeof(index));
+    uint8_t* entries = &bytes[trailer.index_offset + sizeof(index) + sizeof(TimelineIndexHeader)];
+    TimelineIndexEntry entry;
+    memcpy(&entry, entries, sizeof(entry));
+    TimelineBlockHeader events;
+    memcpy(&events, &bytes[entry.offset], sizeof(events));
+
+    entry.event_count += 1UL << 30;
+    events.record_count = entry.event_count;
+    memcpy(entries, &entry, sizeof(entry));
+    memcpy(&bytes[entry.offset], &events, sizeof(events));
+    index.checksum = esp_rom_crc32_le(0, &bytes[trailer.index_offset + sizeof(index)], index.used);
+    memcpy(&bytes[trailer.index_offset], &index, sizeof(index));
+    writeBytes(path, bytes);
+
+    // The index is read, but the block is refused rather than read past its end
+    TimelineFileReader reader;
+    TEST_ASSERT_TRUE(reader.open(storage.openFile(path, FILE_READ)));
+    TEST_ASSERT_FALSE(reader.wasRecovered());
+    uint32_t seen = reader.query(INT64_MIN, INT64_MAX, [](const TimelineEvent&, uint32_t) {});
+    TEST_ASSERT_EQUAL_UINT32(0, seen);
+    TEST_ASSERT_EQUAL_UINT32(1, reader.getBadBlocks());
+}
+
+void setUp() {
+    Serial.setQuiet(true);
+}
+
+void tearDown() {
+}
+
+int main(int argc, char** argv) {
+    Serial.setQuiet(true);
+    SD.wipe();
+    SPIFFS.wipe();
+    storage.begin();
+    storage.createDirectory("/evidence");
+
+    UNITY_BEGIN();
+    RUN_TEST(test_save_without_new_events_writes_nothing);
+    RUN_TEST(test_new_empty_file_is_indexed);
+    RUN_TEST(test_merged_duplicate_updates_the_file);
+    RUN_TEST(test_later_update_wins);
+    RUN_TEST(test_updates_survive_recovery);
+    RUN_TEST(test_reopening_does_not_append_events_again);
+    RUN_TEST(test_loading_then_opening_the_same_file);
+    RUN_TEST(test_wrapping_index_record_count_is_rejected);
+    RUN_TEST(test_wrapping_block_record_count_is_rejected);
+    return UNITY_END();
+}
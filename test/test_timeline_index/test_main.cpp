@@ -0,0 +1,144 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <algorithm>
+#include <map>
+#include <random>
+#include <vector>
+#include "timeline_store.h"
+#include "timeline_index.h"
+
+// Reference: position lists per pool id, rebuilt from the store's columns
+typedef std::map<uint32_t, std::vector<uint32_t>> EntityLists;
+
+static std::mt19937 rng(20240917);
+
+static EntityLists naiveLists(const TimelineStore& store, TimelineField field) {
+    EntityLists lists;
+    for (uint32_t i = 0; i < store.size(); i++) {
+        uint32_t id = store.getTextId(field, i);
+        if (id != TimelineStringPool::EMPTY) lists[id].push_back(i);
+    }
+    return lists;
+}
+
+static void checkEntities(const TimelineStore& store, const TimelineIndex& index) {
+    EntityLists actors = naiveLists(store, TIMELINE_FIELD_ACTOR);
+    for (const auto& entry : actors) {
+        TimelineSpan span = index.byActor(entry.first);
+        TEST_ASSERT_EQUAL_UINT32(entry.second.size(), span.size());
+        TEST_ASSERT_TRUE(std::equal(span.begin(), span.end(), entry.second.begin()));
+    }
+
+    EntityLists targets = naiveLists(store, TIMELINE_FIELD_TARGET);
+    for (const auto& entry : targets) {
+        TimelineSpan span = index.byTarget(entry.first);
+        TEST_ASSERT_EQUAL_UINT32(entry.second.size(), span.size());
+        TEST_ASSERT_TRUE(std::equal(span.begin(), span.end(), entry.second.begin()));
+    }
+}
+
+static TimelineEvent randomEvent(uint32_t actors, uint32_t targets) {
+    TimelineEvent event;
+    event.timestamp = (int64_t)(rng() % 100000) * 1000000LL;
+    event.type = (TimelineEventType)(rng() % (EVENT_UNKNOWN + 1));
+    event.description = "event";
+    event.source_artifact = "fixture";
+    // A few events have no actor, most targets are unique as in an MFT
+    event.actor = rng() % 10 == 0 ? String("") : String("user") + (unsigned)(rng() % actors);
+    event.target = rng() % 4 == 0 ? String("C:\\shared\\") + (unsigned)(rng() % 16)
+                                  : String("C:\\files\\") + (unsigned)(rng() % targets);
+    event.significance = 1 + rng() % 10;
+    return event;
+}
+
+// ===========================
+// Entity lists
+// ===========================
+
+void test_entity_lists_match_reference_while_growing() {
+    TimelineStore store;
+    TimelineIndex index(store);
+
+    // Queries between batches of adds merge each batch into the lists built so far
+    for (int batch = 0; batch < 30; batch++) {
+        size_t count = 1 + rng() % 400;
+        for (size_t i = 0; i < count; i++) {
+            index.add(store.add(randomEvent(12, 50000)));
+        }
+        checkEntities(store, index);
+    }
+}
+
+void test_entity_lists_after_rebuild() {
+    TimelineStore store;
+    TimelineIndex index(store);
+    for (int i = 0; i < 3000; i++) {
+        index.add(store.add(randomEvent(40, 2000)));
+    }
+
+    // Renumber the events by time, as a sort does, then rebuild
+    std::vector<uint32_t> order(store.size());
+    for (uint32_t i = 0; i < order.size(); i++) order[i] = i;
+    const std::vector<int64_t>& timestamps = store.getTimestamps();
+    std::stable_sort(order.begin(), order.end(),
+                     [&](uint32_t a, uint32_t b) { return timestamps[a] < timestamps[b]; });
+    store.permute(order);
+    index.rebuild();
+    checkEntities(store, index);
+
+    index.add(store.add(randomEvent(40, 2000)));
+    checkEntities(store, index);
+}
+
+void test_unknown_and_empty_entities() {
+    TimelineStore store;
+    TimelineIndex index(store);
+    TimelineEvent event = randomEvent(4, 4);
+    event.actor = "";
+    index.add(store.add(event));
+
+    TEST_ASSERT_TRUE(index.byActor(TimelineStringPool::EMPTY).empty());
+    TEST_ASSERT_TRUE(index.byActor(store.findText("nobody")).empty());
+    TEST_ASSERT_EQUAL_UINT32(1, index.byTarget(store.getTextId(TIMELINE_FIELD_TARGET, 0)).size());
+
+    index.clear();
+    TEST_ASSERT_TRUE(index.byTarget(store.getTextId(TIMELINE_FIELD_TARGET, 0)).empty());
+}
+
+void test_unique_targets() {
+    // Nearly every target distinct, as in an MFT timeline
+    TimelineStore store;
+    TimelineIndex index(store);
+    const uint32_t events = 20000;
+    for (uint32_t i = 0; i < events; i++) {
+        TimelineEvent event = randomEvent(8, 1);
+        event.target = String("C:\\mft\\file") + i;
+        index.add(store.add(event));
+    }
+    for (uint32_t i = 0; i < events; i += 997) {
+        TimelineSpan span = index.byTarget(store.getTextId(TIMELINE_FIELD_TARGET, i));
+        TEST_ASSERT_EQUAL_UINT32(1, span.size());
+        TEST_ASSERT_EQUAL_UINT32(i, span[0]);
+    }
+
+    char report[96];
+    snprintf(report, sizeof(report), "%u unique targets: %u bytes of index",
+             (unsigned)events, (unsigned)index.getMemoryUsage());
+    TEST_MESSAGE(report);
+}
+
+void setUp() {
+    Serial.setQuiet(true);
+}
+
+void tearDown() {
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_entity_lists_match_reference_while_growing);
+    RUN_TEST(test_entity_lists_after_rebuild);
+    RUN_TEST(test_unknown_and_empty_entities);
+    RUN_TEST(test_unique_targets);
+    return UNITY_END();
+}
@@ -0,0 +1,180 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <random>
+#include <time.h>
+#include "timestamp_parser.h"
+
+static std::mt19937 rng(19);
+
+static int64_t parsed(TimestampParser& parser, const char* text) {
+    int64_t micros = 0;
+    TEST_ASSERT_TRUE_MESSAGE(parser.parse(text, strlen(text), micros), text);
+    return micros;
+}
+
+static bool rejects(TimestampParser& parser, const char* text) {
+    int64_t micros;
+    return !parser.parse(text, strlen(text), micros);
+}
+
+static int64_t utcMicros(int year, int month, int day, int hour, int minute, int second) {
+    struct tm tm = {};
+    tm.tm_year = year - 1900;
+    tm.tm_mon = month - 1;
+    tm.tm_mday = day;
+    tm.tm_hour = hour;
+    tm.tm_min = minute;
+    tm.tm_sec = second;
+    return (int64_t)timegm(&tm) * TIMESTAMP_MICROS_PER_SECOND;
+}
+
+// ===========================
+// Round trips
+// ===========================
+
+void test_iso_round_trips_match_timegm() {
+    TimestampParser parser;
+    char text[64];
+
+    for (int i = 0; i < 200000; i++) {
+        int year = 1601 + rng() % 500;
+        int month = 1 + rng() % 12;
+        int day = 1 + rng() % 28;
+        int hour = rng() % 24, minute = rng() % 60, second = rng() % 60;
+        unsigned fraction = rng() % 1000000;
+
+        snprintf(text, sizeof(text), "%04d-%02d-%02dT%02d:%02d:%02d.%06uZ", year, month, day, hour, minute, second,
+                 fraction);
+        int64_t expected = utcMicros(year, month, day, hour, minute, second) + fraction;
+        int64_t micros = parsed(parser, text);
+        if (micros != expected) TEST_FAIL_MESSAGE(text);
+        TEST_ASSERT_TRUE(parser.getLastFormat() == TS_FORMAT_ISO8601);
+
+        // format() writes what parse() reads back
+        String formatted = TimestampParser::format(micros);
+        TEST_ASSERT_EQUAL_INT64(expected, parsed(parser, formatted.c_str()));
+    }
+}
+
+void test_civil_day_conversions_invert() {
+    for (int64_t days = -200000; days <= 200000; days += 7) {
+        int64_t year;
+        unsigned month, day;
+        TimestampParser::civilFromDays(days, year, month, day);
+        TEST_ASSERT_EQUAL_INT64(days, TimestampParser::daysFromCivil(year, month, day));
+    }
+}
+
+// ===========================
+// Formats
+// ===========================
+
+void test_iso_variants() {
+    TimestampParser parser;
+    int64_t base = utcMicros(2024, 3, 15, 10, 22, 33);
+
+    TEST_ASSERT_EQUAL_INT64(base, parsed(parser, "2024-03-15T10:22:33Z"));
+    TEST_ASSERT_EQUAL_INT64(base, parsed(parser, "2024-03-15 10:22:33"));
+    TEST_ASSERT_EQUAL_INT64(base + 123000, parsed(parser, "2024-03-15T10:22:33.123"));
+    TEST_ASSERT_EQUAL_INT64(base - 2 * 3600 * TIMESTAMP_MICROS_PER_SECOND, parsed(parser, "2024-03-15T10:22:33+02:00"));
+    TEST_ASSERT_EQUAL_INT64(base + 5 * 3600 * TIMESTAMP_MICROS_PER_SECOND, parsed(parser, "2024-03-15T10:22:33-0500"));
+    TEST_ASSERT_EQUAL_INT64(base - 33 * TIMESTAMP_MICROS_PER_SECOND, parsed(parser, "2024-03-15T10:22"));
+    TEST_ASSERT_EQUAL_INT64(base, parsed(parser, "\"2024-03-15T10:22:33Z\"\r\n"));
+
+    TEST_ASSERT_TRUE(rejects(parser, "2024-02-30T00:00:00Z"));
+    TEST_ASSERT_TRUE(rejects(parser, "2023-02-29T00:00:00Z"));
+    TEST_ASSERT_TRUE(rejects(parser, "2024-03-15T24:00:00Z"));
+    TEST_ASSERT_TRUE(rejects(parser, "2024-13-01T00:00:00Z"));
+    TEST_ASSERT_TRUE(rejects(parser, "2024-03-15T10:22:33 garbage"));
+}
+
+void test_default_offset_applies_to_zoneless_times() {
+    TimestampParser parser;
+    parser.setDefaultOffset(3600);
+    int64_t base = utcMicros(2024, 3, 15, 10, 22, 33);
+    TEST_ASSERT_EQUAL_INT64(base - 3600 * TIMESTAMP_MICROS_PER_SECOND, parsed(parser, "2024-03-15 10:22:33"));
+    TEST_ASSERT_EQUAL_INT64(base, parsed(parser, "2024-03-15T10:22:33Z"));
+}
+
+void test_day_cache_follows_the_date() {
+    TimestampParser parser;
+    TEST_ASSERT_EQUAL_INT64(utcMicros(2024, 3, 15, 23, 59, 59), parsed(parser, "2024-03-15T23:59:59Z"));
+    TEST_ASSERT_EQUAL_INT64(utcMicros(2024, 3, 15, 0, 0, 1), parsed(parser, "2024-03-15T00:00:01Z"));
+    TEST_ASSERT_EQUAL_INT64(utcMicros(2024, 3, 16, 0, 0, 0), parsed(parser, "2024-03-16T00:00:00Z"));
+    TEST_ASSERT_EQUAL_INT64(utcMicros(2024, 3, 15, 12, 0, 0), parsed(parser, "2024-03-15T12:00:00Z"));
+}
+
+void test_syslog_year_inference() {
+    TimestampParser parser;
+    parser.setReferenceTime(utcMicros(2025, 1, 10, 0, 0, 0));
+    TEST_ASSERT_EQUAL_INT64(utcMicros(2025, 1, 9, 8, 1, 2), parsed(parser, "Jan  9 08:01:02"));
+    TEST_ASSERT_TRUE(parser.getLastFormat() == TS_FORMAT_SYSLOG);
+
+    // A December line read in January belongs to the year before
+    TEST_ASSERT_EQUAL_INT64(utcMicros(2024, 12, 31, 23, 59, 58), parsed(parser, "Dec 31 23:59:58"));
+
+    parser.setReferenceTime(utcMicros(2024, 6, 1, 0, 0, 0));
+    TEST_ASSERT_EQUAL_INT64(utcMicros(2024, 2, 29, 1, 0, 0), parsed(parser, "Feb 29 01:00:00"));
+    TEST_ASSERT_TRUE(rejects(parser, "Foo 12 01:00:00"));
+}
+
+void test_us_dates() {
+    TimestampParser parser;
+    TEST_ASSERT_EQUAL_INT64(utcMicros(2024, 3, 15, 10, 22, 33), parsed(parser, "3/15/2024 10:22:33 AM"));
+    TEST_ASSERT_EQUAL_INT64(utcMicros(2024, 3, 15, 22, 22, 33), parsed(parser, "3/15/2024 10:22:33 PM"));
+    TEST_ASSERT_EQUAL_INT64(utcMicros(2024, 12, 1, 0, 5, 0), parsed(parser, "12/1/2024 12:05:00 AM"));
+    TEST_ASSERT_EQUAL_INT64(utcMicros(2024, 12, 1, 12, 5, 0), parsed(parser, "12/1/2024 12:05:00 PM"));
+    TEST_ASSERT_TRUE(parser.getLastFormat() == TS_FORMAT_US_DATE);
+    TEST_ASSERT_TRUE(rejects(parser, "2/30/2024 10:00:00 AM"));
+}
+
+void test_filetime_and_epoch() {
+    TimestampParser parser;
+    int64_t base = utcMicros(2024, 3, 15, 10, 22, 33);
+    uint64_t filetime = (uint64_t)(base + TIMESTAMP_FILETIME_EPOCH_OFFSET) * 10;
+
+    char text[32];
+    snprintf(text, sizeof(text), "%llu", (unsigned long long)filetime);
+    TEST_ASSERT_EQUAL_INT64(base, parsed(parser, text));
+    TEST_ASSERT_TRUE(parser.getLastFormat() == TS_FORMAT_FILETIME);
+    snprintf(text, sizeof(text), "0x%llX", (unsigned long long)filetime);
+    TEST_ASSERT_EQUAL_INT64(base, parsed(parser, text));
+
+    // Epoch units by magnitude
+    TEST_ASSERT_EQUAL_INT64(base, parsed(parser, "1710498153"));
+    TEST_ASSERT_TRUE(parser.getLastFormat() == TS_FORMAT_EPOCH);
+    TEST_ASSERT_EQUAL_INT64(base + 250000, parsed(parser, "1710498153.25"));
+    TEST_ASSERT_EQUAL_INT64(base + 1000, parsed(parser, "1710498153001"));
+    TEST_ASSERT_EQUAL_INT64(base + 7, parsed(parser, "1710498153000007"));
+    TEST_ASSERT_EQUAL_INT64(base + 7, parsed(parser, "1710498153000007999"));
+}
+
+void test_rejects_non_timestamps() {
+    TimestampParser parser;
+    TEST_ASSERT_TRUE(rejects(parser, ""));
+    TEST_ASSERT_TRUE(rejects(parser, "   "));
+    TEST_ASSERT_TRUE(rejects(parser, "-"));
+    TEST_ASSERT_TRUE(rejects(parser, "hello world"));
+    TEST_ASSERT_TRUE(rejects(parser, "12ab"));
+}
+
+void setUp() {
+    Serial.setQuiet(true);
+}
+
+void tearDown() {
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_iso_round_trips_match_timegm);
+    RUN_TEST(test_civil_day_conversions_invert);
+    RUN_TEST(test_iso_variants);
+    RUN_TEST(test_default_offset_applies_to_zoneless_times);
+    RUN_TEST(test_day_cache_follows_the_date);
+    RUN_TEST(test_syslog_year_inference);
+    RUN_TEST(test_us_dates);
+    RUN_TEST(test_filetime_and_epoch);
+    RUN_TEST(test_rejects_non_timestamps);
+    return UNITY_END();
+}
@@ -0,0 +1,217 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <algorithm>
+#include <string>
+#include <tuple>
+#include <vector>
+#include "threat_intel_watchlist.h"
+#include "ioc_extractor.h"
+#include "esp_rom_crc.h"
+#include "storage.h"
+
+static FRFDStorage storage;
+
+struct Entry {
+    uint8_t type;
+    std::string value;          // Lowercase
+    uint8_t severity;
+    std::string label;
+};
+
+// Same layout as scripts/build_watchlist.py writes
+static std::vector<uint8_t> buildWatchlist(std::vector<Entry> entries, uint32_t block_size, uint32_t bloom_bits,
+                                           uint32_t bloom_hashes) {
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+        return ThreatIntelWatchlist::makeKey(a.type, a.value.data(), a.value.size()) <
+               ThreatIntelWatchlist::makeKey(b.type, b.value.data(), b.value.size());
+    });
+
+    std::vector<uint8_t> bloom(bloom_bits / 8, 0);
+    std::vector<uint64_t> first_keys;
+    std::vector<std::vector<uint8_t>> blocks;
+    std::vector<uint8_t> current;
+    uint16_t count = 0;
+
+    auto flush = [&]() {
+        std::vector<uint8_t> block(block_size, 0);
+        WatchlistBlockHeader block_header;
+        block_header.record_count = count;
+        block_header.used = current.size();
+        block_header.checksum = esp_rom_crc32_le(0, current.data(), current.size());
+        memcpy(block.data(), &block_header, sizeof(block_header));
+        memcpy(block.data() + sizeof(block_header), current.data(), current.size());
+        blocks.push_back(block);
+        current.clear();
+        count = 0;
+    };
+
+    for (const Entry& entry : entries) {
+        uint64_t key = ThreatIntelWatchlist::makeKey(entry.type, entry.value.data(), entry.value.size());
+        uint32_t h1 = (uint32_t)key;
+        uint32_t h2 = (uint32_t)(key >> 32) | 1;
+        for (uint32_t i = 0; i < bloom_hashes; i++) {
+            uint32_t bit = (h1 + i * h2) % bloom_bits;
+            bloom[bit >> 3] |= 1 << (bit & 7);
+        }
+
+        std::vector<uint8_t> record(WATCHLIST_RECORD_HEADER);
+        memcpy(record.data(), &key, sizeof(key));
+        record[8] = entry.type;
+        record[9] = entry.severity;
+        record[10] = entry.value.size();
+        record[11] = entry.label.size();
+        record.insert(record.end(), entry.value.begin(), entry.value.end());
+        record.insert(record.end(), entry.label.begin(), entry.label.end());
+
+        if (sizeof(WatchlistBlockHeader) + current.size() + record.size() > block_size) flush();
+        if (current.empty()) first_keys.push_back(key);
+        current.insert(current.end(), record.begin(), record.end());
+        count++;
+    }
+    if (!current.empty()) flush();
+
+    WatchlistHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic = WATCHLIST_MAGIC;
+    header.version = WATCHLIST_VERSION;
+    header.header_size = sizeof(header);
+    header.block_size = block_size;
+    header.block_count = blocks.size();
+    header.entry_count = entries.size();
+    header.bloom_bits = bloom_bits;
+    header.bloom_hashes = bloom_hashes;
+    header.bloom_offset = sizeof(header);
+    header.index_offset = header.bloom_offset + bloom.size();
+    size_t index_end = header.index_offset + first_keys.size() * sizeof(uint64_t);
+    header.blocks_offset = (index_end + block_size - 1) / block_size * block_size;
+
+    std::vector<uint8_t> tables(bloom);
+    tables.insert(tables.end(), (const uint8_t*)first_keys.data(),
+                  (const uint8_t*)(first_keys.data() + first_keys.size()));
+    header.checksum = esp_rom_crc32_le(0, tables.data(), tables.size());
+
+    std::vector<uint8_t> image((const uint8_t*)&header, (const uint8_t*)(&header + 1));
+    image.insert(image.end(), tables.begin(), tables.end());
+    image.resize(header.blocks_offset, 0);
+    for (const auto& block : blocks) image.insert(image.end(), block.begin(), block.end());
+    return image;
+}
+
+static std::vector<Entry> sampleEntries() {
+    std::vector<Entry> entries;
+    char value[64];
+    for (int i = 0; i < 3000; i++) {
+        Entry entry;
+        switch (i % 3) {
+            case 0:
+                entry.type = IOC_IP_ADDRESS;
+                snprintf(value, sizeof(value), "198.51.%d.%d", i / 250, i % 250);
+                break;
+            case 1:
+                entry.type = IOC_DOMAIN;
+                snprintf(value, sizeof(value), "c2-%d.evil.example", i);
+                break;
+            default:
+                entry.type = IOC_FILE_HASH_MD5;
+                snprintf(value, sizeof(value), "%032x", i * 2654435761u);
+                break;
+        }
+        entry.value = value;
+        entry.severity = i % 101;
+        entry.label = "feed-" + std::to_string(i % 7);
+        entries.push_back(entry);
+    }
+    return entries;
+}
+
+static bool writeImage(const char* path, const std::vector<uint8_t>& image) {
+    return storage.writeFile(path, image.data(), image.size());
+}
+
+void test_finds_every_entry_through_storage() {
+    std::vector<Entry> entries = sampleEntries();
+    std::vector<uint8_t> image = buildWatchlist(entries, 512, 32768, 5);
+
+    // Evidence paths live on the SD card, everything else on SPIFFS
+    const char* const paths[] = {"/evidence/intel.frwl", "/intel.frwl"};
+    for (const char* path : paths) {
+        TEST_ASSERT_TRUE(writeImage(path, image));
+
+        ThreatIntelWatchlist watchlist;
+        TEST_ASSERT_TRUE(watchlist.load(&storage, path));
+        TEST_ASSERT_EQUAL_UINT32(entries.size(), watchlist.getEntryCount());
+
+        for (const Entry& entry : entries) {
+            String upper(entry.value.c_str());
+            upper.toUpperCase();
+            WatchlistHit hit;
+            TEST_ASSERT_TRUE(watchlist.lookup(entry.type, upper, &hit));
+            TEST_ASSERT_EQUAL_UINT32(entry.severity, hit.severity);
+            TEST_ASSERT_EQUAL_STRING(entry.value.c_str(), hit.value.c_str());
+            TEST_ASSERT_EQUAL_STRING(entry.label.c_str(), hit.label.c_str());
+        }
+
+        // Absent values never hit, and most stop at the Bloom filter
+        watchlist.resetStats();
+        for (int i = 0; i < 3000; i++) {
+            String value = String("absent-") + i + ".example";
+            TEST_ASSERT_FALSE(watchlist.lookup(IOC_DOMAIN, value));
+        }
+        TEST_ASSERT_FALSE(watchlist.lookup(IOC_DOMAIN, String("198.51.0.0")));     // Right value, wrong type
+        WatchlistStats stats = watchlist.getStats();
+        TEST_ASSERT_TRUE(stats.bloom_rejects > 2900);
+        TEST_ASSERT_EQUAL_UINT32(0, stats.hits);
+    }
+}
+
+void test_rejects_damaged_files() {
+    std::vector<uint8_t> image = buildWatchlist(sampleEntries(), 512, 32768, 5);
+    ThreatIntelWatchlist watchlist;
+
+    std::vector<uint8_t> bad_index(image);
+    bad_index[sizeof(WatchlistHeader) + 3] ^= 0xFF;
+    TEST_ASSERT_TRUE(writeImage("/evidence/bad.frwl", bad_index));
+    TEST_ASSERT_FALSE(watchlist.load(&storage, "/evidence/bad.frwl"));
+
+    // A corrupt block only fails the lookups that land in it
+    std::vector<uint8_t> bad_block(image);
+    WatchlistHeader header;
+    memcpy(&header, image.data(), sizeof(header));
+    bad_block[header.blocks_offset + sizeof(WatchlistBlockHeader) + 20] ^= 0xFF;
+    TEST_ASSERT_TRUE(writeImage("/evidence/bad.frwl", bad_block));
+    TEST_ASSERT_TRUE(watchlist.load(&storage, "/evidence/bad.frwl"));
+
+    size_t found = 0;
+    for (const Entry& entry : sampleEntries()) {
+        if (watchlist.lookup(entry.type, entry.value.c_str(), entry.value.size())) found++;
+    }
+    TEST_ASSERT_TRUE(found > 0 && found < 3000);
+}
+
+void test_needs_storage_and_file() {
+    ThreatIntelWatchlist watchlist;
+    TEST_ASSERT_FALSE(watchlist.load(nullptr, "/evidence/intel.frwl"));
+    TEST_ASSERT_FALSE(watchlist.load(&storage, "/evidence/missing.frwl"));
+    TEST_ASSERT_FALSE(watchlist.isLoaded());
+}
+
+void setUp() {
+    Serial.setQuiet(true);
+}
+
+void tearDown() {
+}
+
+int main(int argc, char** argv) {
+    Serial.setQuiet(true);
+    SD.wipe();
+    SPIFFS.wipe();
+    storage.begin();
+    storage.createDirectory("/evidence");
+
+    UNITY_BEGIN();
+    RUN_TEST(test_finds_every_entry_through_storage);
+    RUN_TEST(test_rejects_damaged_files);
+    RUN_TEST(test_needs_storage_and_file);
+    return UNITY_END();
+}